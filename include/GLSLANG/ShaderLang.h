@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 378
+#define ANGLE_SH_VERSION 383
 
 enum ShShaderSpec
 {
@@ -445,6 +445,11 @@ struct ShCompileOptions
     // Whether SPIR-V 1.4 can be emitted.  If not set, SPIR-V 1.3 is emitted.
     uint64_t emitSPIRV14 : 1;
 
+    // Run lightweight optimizations on the generated SPIR-V: forwarding of redundant loads,
+    // elimination of common subexpressions within a block, and removal of dead local variables,
+    // stores and side-effect-free instructions.
+    uint64_t optimizeSPIRV : 1;
+
     // Reject shaders with obvious undefined behavior:
     //
     // - Shader contains easy-to-detect infinite loops
@@ -469,8 +474,22 @@ struct ShCompileOptions
     // Ensure all loops execute side-effects or terminate.
     uint64_t ensureLoopForwardProgress : 1;
 
+    // Record the time taken and the AST nodes traversed by each translation pass, along with the
+    // other statistics of sh::CompileProfile.  Used to measure the translator; the statistics are
+    // available through sh::GetCompileProfile().
+    uint64_t collectPassStatistics : 1;
+
+    // Keep the parsed shader after compilation, so that it can be translated again with different
+    // options through sh::CompileVariant without preprocessing and parsing it again.
+    uint64_t retainParsedShader : 1;
+
     ShCompileOptionsMetal metal;
     ShPixelLocalStorageOptions pls;
+
+    // If not zero, the compilation fails once it has taken longer than this many milliseconds.
+    // This is checked while constant folding during parsing and between translation passes, so
+    // the compilation can overrun the budget by the time of one pass.
+    uint32_t compileTimeBudgetMs;
 };
 
 // The 64 bits hash function. The first parameter is the input string; the
@@ -750,6 +769,34 @@ namespace sh
 using BinaryBlob       = std::vector<uint32_t>;
 using ShaderBinaryBlob = std::vector<uint8_t>;
 
+// Time taken and nodes entered by the traversers of a translation pass.
+struct CompilePassProfile
+{
+    const char *name;
+    double seconds;
+    uint64_t nodeVisits;
+};
+
+// Statistics of a compilation, collected with ShCompileOptions::collectPassStatistics.
+struct CompileProfile
+{
+    // The passes, in the order they ran.  "Parse" includes preprocessing and the constant folding
+    // done while parsing.
+    std::vector<CompilePassProfile> passes;
+    double seconds;
+    // Nodes in the AST after parsing.
+    uint64_t astNodes;
+    // Bytes allocated from the translator's memory pools.
+    size_t poolBytes;
+    // Name lookups in the symbol table, made while parsing and by the translation passes.
+    uint64_t symbolLookups;
+    // Size of the object code, or of the SPIR-V binary.
+    size_t objectCodeBytes;
+    // Whether the compilation failed for taking longer than ShCompileOptions::compileTimeBudgetMs.
+    // Set whether or not the statistics are collected.
+    bool budgetExceeded;
+};
+
 //
 // Driver must call this first, once, before doing any other compiler operations.
 // If the function succeeds, the return value is true, else false.
@@ -812,6 +859,31 @@ bool Compile(const ShHandle handle,
              size_t numStrings,
              const ShCompileOptions &compileOptions);
 
+//
+// Preprocesses the given shader source without compiling it.  The resulting tokens are written to
+// tokenStreamOut, interleaved with the directives that affect how they are compiled.  Shaders that
+// preprocess to the same token stream compile to the same results with the same compiler and
+// options, except for the line numbers in the info log.  This makes the token stream a cache key
+// that is independent of comments, whitespace and unused macros.
+// If preprocessing fails, the return value is false.
+// Parameters are the same as for Compile(), but the results of the previous compilation are kept.
+bool GetPreprocessedTokenStream(const ShHandle handle,
+                                const char *const shaderStrings[],
+                                size_t numStrings,
+                                const ShCompileOptions &compileOptions,
+                                std::string *tokenStreamOut);
+
+//
+// Compiles the shader retained by the last call to Compile() with
+// ShCompileOptions::retainParsedShader again, with different options.  Only the passes that run
+// after parsing are repeated, unless the options differ from the retained ones in how the shader is
+// parsed (sourcePath, preserveDenorms, emulateGLDrawID, emulateGLBaseVertexBaseInstance,
+// flattenPragmaSTDGLInvariantAll and regenerateStructNames), in which case the shader is compiled
+// again from its source.  The results are the same as Compile() would produce with these options,
+// and replace the results of the previous compilation.
+// If there is no retained shader or the compilation fails, the return value is false.
+bool CompileVariant(const ShHandle handle, const ShCompileOptions &compileOptions);
+
 // Clears the results from the previous compilation.
 void ClearResults(const ShHandle handle);
 
@@ -838,6 +910,12 @@ const std::string &GetObjectCode(const ShHandle handle);
 // handle: Specifies the compiler
 const BinaryBlob &GetObjectBinaryBlob(const ShHandle handle);
 
+// Returns the profile of the last compilation.  Only the budgetExceeded field is set unless the
+// compilation was done with ShCompileOptions::collectPassStatistics.
+// Parameters:
+// handle: Specifies the compiler
+const CompileProfile &GetCompileProfile(const ShHandle handle);
+
 // Returns a full binary for a compiled shader, to be loaded with glShaderBinary during runtime.
 // Parameters:
 // handle: Specifies the compiler
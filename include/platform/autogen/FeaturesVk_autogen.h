@@ -710,6 +710,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo warmUpRecordedPipelinesAtLink = {
+        "warmUpRecordedPipelinesAtLink",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo preferDeviceLocalMemoryHostVisible = {
         "preferDeviceLocalMemoryHostVisible",
         FeatureCategory::VulkanFeatures,
@@ -1166,6 +1172,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo optimizeTranslatedSpirv = {
+        "optimizeTranslatedSpirv",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo wrapSwitchInIfTrue = {
         "wrapSwitchInIfTrue",
         FeatureCategory::VulkanWorkarounds,
@@ -1418,6 +1430,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo incrementalPipelineCacheSync = {
+        "incrementalPipelineCacheSync",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo descriptorSetCache = {
         "descriptorSetCache",
         FeatureCategory::VulkanFeatures,
@@ -105,6 +105,30 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo asyncBlobCacheCompression = {
+        "asyncBlobCacheCompression",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo fastBlobCacheCompression = {
+        "fastBlobCacheCompression",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo cacheShadersByPreprocessedSource = {
+        "cacheShadersByPreprocessedSource",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo asyncCommandStream = {
+        "asyncCommandStream",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
     FeatureInfo dumpShaderSource = {
         "dumpShaderSource",
         FeatureCategory::FrontendFeatures,
@@ -10,6 +10,7 @@
 
 import sys, os, pprint, json
 import fnmatch
+import re
 import registry_xml
 from registry_xml import apis, script_relative, strip_api_prefix, api_enums
 
@@ -179,6 +180,61 @@ CONTEXT_PRIVATE_WILDCARDS = [
     'glTranslate[fx]',
 ]
 
+# These are frequent entry points that return nothing.  With the asyncCommandStream frontend
+# feature, they record themselves in the command stream of the context instead of running.  The
+# client memory they read is copied, see get_command_stream_data.  See libANGLE/CommandStream.h.
+COMMAND_STREAM_CMDS = [
+    'glActiveTexture',
+    'glBindBuffer',
+    'glBindTexture',
+    'glBindVertexArray',
+    'glBufferSubData',
+    'glClear',
+    'glClearColor',
+    'glDrawArrays',
+    'glDrawArraysInstanced',
+    'glDrawElements',
+    'glDrawElementsInstanced',
+    'glDrawRangeElements',
+    'glScissor',
+    'glUniform1f',
+    'glUniform1fv',
+    'glUniform1i',
+    'glUniform1iv',
+    'glUniform1ui',
+    'glUniform1uiv',
+    'glUniform2f',
+    'glUniform2fv',
+    'glUniform2i',
+    'glUniform2iv',
+    'glUniform2ui',
+    'glUniform2uiv',
+    'glUniform3f',
+    'glUniform3fv',
+    'glUniform3i',
+    'glUniform3iv',
+    'glUniform3ui',
+    'glUniform3uiv',
+    'glUniform4f',
+    'glUniform4fv',
+    'glUniform4i',
+    'glUniform4iv',
+    'glUniform4ui',
+    'glUniform4uiv',
+    'glUniformMatrix2fv',
+    'glUniformMatrix2x3fv',
+    'glUniformMatrix2x4fv',
+    'glUniformMatrix3fv',
+    'glUniformMatrix3x2fv',
+    'glUniformMatrix3x4fv',
+    'glUniformMatrix4fv',
+    'glUniformMatrix4x2fv',
+    'glUniformMatrix4x3fv',
+    'glUseProgram',
+    'glVertexAttribPointer',
+    'glViewport',
+]
+
 TEMPLATE_ENTRY_POINT_HEADER = """\
 // GENERATED FILE - DO NOT EDIT.
 // Generated by {script_name} using data from {data_source_name}.
@@ -298,7 +354,7 @@ TEMPLATE_GLES_ENTRY_POINT_NO_RETURN = """\
 void GL_APIENTRY GL_{name}({params})
 {{
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = {context_getter};
+    Context *context = {context_getter};{command_stream_record}
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
 
     if ({valid_context_check})
@@ -323,7 +379,7 @@ TEMPLATE_GLES_CONTEXT_PRIVATE_ENTRY_POINT_NO_RETURN = """\
 void GL_APIENTRY GL_{name}({params})
 {{
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = {context_getter};
+    Context *context = {context_getter};{command_stream_record}
     {event_comment}EVENT(context, GL{name}, "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
 
     if ({valid_context_check})
@@ -1914,9 +1970,60 @@ def get_context_getter_function(cmd_name):
     if is_context_lost_acceptable_cmd(cmd_name):
         return "GetGlobalContext()"
 
+    # The recorded calls must not wait for the command stream they are recorded in.
+    if cmd_name in COMMAND_STREAM_CMDS:
+        return "GetValidGlobalContextForCommandStream()"
+
     return "GetValidGlobalContext()"
 
 
+# Returns the parameter of a recorded entry point that points to client memory, and the size of that
+# memory in bytes, or None if the entry point reads no client memory.
+def get_command_stream_data(cmd_name):
+    if cmd_name == 'glBufferSubData':
+        return ('data', 'size')
+
+    component_types = {'f': 'GLfloat', 'i': 'GLint', 'ui': 'GLuint'}
+    match = re.match(r'glUniform([1-4])(f|i|ui)v$', cmd_name)
+    if match:
+        components = int(match.group(1))
+        component_type = component_types[match.group(2)]
+    else:
+        match = re.match(r'glUniformMatrix([2-4])(?:x([2-4]))?fv$', cmd_name)
+        if not match:
+            return None
+        components = int(match.group(1)) * int(match.group(2) or match.group(1))
+        component_type = 'GLfloat'
+
+    # The count is converted to size_t first, so a negative count gives a size too large to record
+    # instead of overflowing.
+    size = 'count * sizeof(%s)' % component_type
+    if components > 1:
+        size += ' * %d' % components
+    return ('value', size)
+
+
+def get_command_stream_record(cmd_name, params):
+    if cmd_name not in COMMAND_STREAM_CMDS:
+        return ""
+
+    data = get_command_stream_data(cmd_name)
+    args = ["GL_" + cmd_name[2:]]
+    for param in params:
+        name = just_the_name(param)
+        if data and name == data[0]:
+            args.append("MakeCommandStreamData(%s, %s)" % data)
+        else:
+            args.append(name)
+
+    return """
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream({args}))
+    {{
+        return;
+    }}""".format(args=", ".join(args))
+
+
 def get_valid_context_check(cmd_name):
     return "ANGLE_LIKELY(context != nullptr)"
 
@@ -2089,6 +2196,8 @@ def format_entry_point_def(api, command_node, cmd_name, proto, params, cmd_packe
             ", ".join(format_params),
         "context_getter":
             get_context_getter_function(cmd_name),
+        "command_stream_record":
+            get_command_stream_record(cmd_name, params),
         "valid_context_check":
             get_valid_context_check(cmd_name),
         "constext_lost_error_generator":
@@ -3256,11 +3365,17 @@ def get_egl_entry_point_labeled_object(ep_to_object, cmd_stripped, params, packe
 
 
 def disable_share_group_lock(api, cmd_name):
-    if cmd_name == 'glBindBuffer':
-        # This function looks up the ID in the buffer manager,
+    if cmd_name in ['glBindBuffer', 'glIsBuffer']:
+        # These functions look up the ID in the buffer manager,
         # access to which is thread-safe for buffers.
         return True
 
+    if strip_suffix(api, cmd_name) in [
+            'glIsFramebuffer', 'glIsQuery', 'glIsTransformFeedback', 'glIsVertexArray'
+    ]:
+        # These functions only look up the ID in resource maps that are private to the context.
+        return True
+
     if api == apis.GLES and cmd_name.startswith('glUniform'):
         # Thread safety of glUniform1/2/3/4 and glUniformMatrix* calls is defined by the backend,
         # frontend only does validation.
@@ -150,9 +150,9 @@ PoolAllocator::PoolAllocator(int growthIncrement, int allocationAlignment)
       mPageSize(growthIncrement),
       mFreeList(nullptr),
       mInUseList(nullptr),
+#endif
       mNumCalls(0),
       mTotalBytes(0),
-#endif
       mLocked(false)
 {
 #if !defined(ANGLE_DISABLE_POOL_ALLOC)
@@ -227,10 +227,10 @@ void Allocation::checkGuardBlock(unsigned char *blockMem,
 
 void PoolAllocator::reset()
 {
-#if !defined(ANGLE_DISABLE_POOL_ALLOC)
     mNumCalls   = 0;
     mTotalBytes = 0;
 
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
     mCurrentPageOffset = mPageSize;
     PageHeader *page   = std::exchange(mInUseList, nullptr);
     while (page)
@@ -271,13 +271,13 @@ void *PoolAllocator::allocate(size_t numBytes)
 {
     ASSERT(!mLocked);
 
-#if !defined(ANGLE_DISABLE_POOL_ALLOC)
     //
     // Just keep some interesting statistics.
     //
     ++mNumCalls;
     mTotalBytes += numBytes;
 
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
     uint8_t *currentPagePtr = reinterpret_cast<uint8_t *>(mInUseList) + mCurrentPageOffset;
 
     size_t preAllocationPadding = 0;
@@ -107,6 +107,9 @@ class PoolAllocator : angle::NonCopyable
     void lock();
     void unlock();
 
+    // The number of bytes requested through allocate() since construction or the last reset().
+    size_t getTotalBytes() const { return mTotalBytes; }
+
   private:
     size_t mAlignment;  // all returned allocations will be aligned at
                         // this granularity, which will be a power of 2
@@ -131,14 +134,13 @@ class PoolAllocator : angle::NonCopyable
     // List of all memory currently being used.  The head of this list is where allocations are
     // currently being made from.
     PageHeader *mInUseList;
-
-    int mNumCalls;       // just an interesting statistic
-    size_t mTotalBytes;  // just an interesting statistic
-
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
     std::vector<std::unique_ptr<uint8_t[]>> mStack;
 #endif
 
+    int mNumCalls;       // just an interesting statistic
+    size_t mTotalBytes;  // just an interesting statistic
+
     bool mLocked;
 };
 
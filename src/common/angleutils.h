@@ -137,6 +137,10 @@ struct PerfMonitorTriplet
     FN(pipelineCreationTotalCacheHitsDurationNs)   \
     FN(pipelineCreationTotalCacheMissesDurationNs) \
     FN(monolithicPipelineCreation)                 \
+    FN(drawGraphicsPipelineCacheMisses)            \
+    FN(pipelineCacheSyncs)                         \
+    FN(pipelineCacheSyncBytesWritten)              \
+    FN(pipelineCacheSyncStallDurationNs)           \
     FN(descriptorSetAllocations)                   \
     FN(descriptorSetCacheTotalSize)                \
     FN(descriptorSetCacheKeySizeBytes)             \
@@ -162,7 +166,8 @@ struct PerfMonitorTriplet
     FN(dynamicBufferAllocations)                   \
     FN(framebufferCacheSize)                       \
     FN(pendingSubmissionGarbageObjects)            \
-    FN(graphicsDriverUniformsUpdated)
+    FN(graphicsDriverUniformsUpdated)              \
+    FN(defaultUniformBytesUploaded)
 
 #define ANGLE_DECLARE_PERF_COUNTER(COUNTER) uint64_t COUNTER;
 
@@ -0,0 +1,96 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// content_chunking.cpp: Implements content-defined chunking with a gear rolling hash.
+
+#include "common/content_chunking.h"
+
+#include <algorithm>
+#include <array>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace angle
+{
+namespace
+{
+constexpr uint64_t SplitMix64(uint64_t *state)
+{
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z          = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+constexpr std::array<uint64_t, 256> MakeGearTable()
+{
+    std::array<uint64_t, 256> table = {};
+    uint64_t state                  = 0x414E474C45434443ull;
+    for (uint64_t &entry : table)
+    {
+        entry = SplitMix64(&state);
+    }
+    return table;
+}
+
+// Random value per byte.  The rolling hash shifts by one bit per byte, so each hash depends on the
+// last 64 bytes only.  The table is generated from a fixed seed and must not change, as that
+// would move every chunk boundary.
+constexpr std::array<uint64_t, 256> kGearTable = MakeGearTable();
+}  // anonymous namespace
+
+void SplitIntoContentDefinedChunks(const uint8_t *data,
+                                   size_t size,
+                                   const ContentChunkingParams &params,
+                                   std::vector<ContentChunk> *chunksOut)
+{
+    ASSERT(gl::isPow2(params.averageChunkSize));
+    ASSERT(params.minChunkSize > 0 && params.minChunkSize <= params.maxChunkSize);
+
+    // The high bits of the hash mix in the most bytes, so the boundary pattern is taken from
+    // them.
+    const int maskBits  = gl::log2(params.averageChunkSize);
+    const uint64_t mask = maskBits == 0 ? 0 : ~uint64_t(0) << (64 - maskBits);
+
+    chunksOut->clear();
+
+    size_t chunkStart = 0;
+    while (chunkStart < size)
+    {
+        const size_t remaining = size - chunkStart;
+        if (remaining <= params.minChunkSize)
+        {
+            chunksOut->push_back({chunkStart, remaining});
+            break;
+        }
+
+        const size_t limit       = std::min(remaining, params.maxChunkSize);
+        const uint8_t *chunkData = data + chunkStart;
+
+        // Bytes before minChunkSize can't end the chunk, but the last 64 of them affect the hash.
+        size_t index  = params.minChunkSize > 64 ? params.minChunkSize - 64 : 0;
+        uint64_t hash = 0;
+        for (; index < params.minChunkSize; ++index)
+        {
+            hash = (hash << 1) + kGearTable[chunkData[index]];
+        }
+
+        size_t chunkSize = limit;
+        for (; index < limit; ++index)
+        {
+            hash = (hash << 1) + kGearTable[chunkData[index]];
+            if ((hash & mask) == 0)
+            {
+                chunkSize = index + 1;
+                break;
+            }
+        }
+
+        chunksOut->push_back({chunkStart, chunkSize});
+        chunkStart += chunkSize;
+    }
+}
+}  // namespace angle
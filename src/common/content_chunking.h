@@ -0,0 +1,49 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// content_chunking.h: Content-defined chunking of byte streams.  Chunk boundaries are placed where
+// a rolling hash of the last few dozen bytes matches a pattern, so they follow the data rather
+// than fixed offsets.  Inserting or removing bytes only changes the chunks around the edit; the
+// chunks before and after it come out identical, which lets persistent caches store only the
+// chunks that changed.
+//
+
+#ifndef COMMON_CONTENT_CHUNKING_H_
+#define COMMON_CONTENT_CHUNKING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace angle
+{
+struct ContentChunk
+{
+    size_t offset;
+    size_t size;
+};
+
+struct ContentChunkingParams
+{
+    // No boundary is placed before this many bytes of a chunk.
+    size_t minChunkSize;
+    // Must be a power of two.  Boundaries are found on average this many bytes after
+    // minChunkSize.
+    size_t averageChunkSize;
+    // A boundary is forced at this many bytes.
+    size_t maxChunkSize;
+};
+
+// Splits |size| bytes at |data| into consecutive chunks that cover all of it.  Only the last
+// chunk may be smaller than minChunkSize.  The boundaries for given data and parameters never
+// change, as they are persisted indirectly by the users of this function.
+void SplitIntoContentDefinedChunks(const uint8_t *data,
+                                   size_t size,
+                                   const ContentChunkingParams &params,
+                                   std::vector<ContentChunk> *chunksOut);
+}  // namespace angle
+
+#endif  // COMMON_CONTENT_CHUNKING_H_
@@ -0,0 +1,140 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// content_chunking_unittest.cpp: Unit tests for content-defined chunking.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "common/content_chunking.h"
+
+namespace angle
+{
+namespace
+{
+constexpr ContentChunkingParams kParams = {1024, 4096, 16384};
+
+std::vector<uint8_t> RandomData(size_t size, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+    std::vector<uint8_t> data(size);
+    for (uint8_t &byte : data)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+    return data;
+}
+
+std::vector<ContentChunk> Split(const std::vector<uint8_t> &data)
+{
+    std::vector<ContentChunk> chunks;
+    SplitIntoContentDefinedChunks(data.data(), data.size(), kParams, &chunks);
+    return chunks;
+}
+
+std::set<std::string> ChunkContents(const std::vector<uint8_t> &data)
+{
+    std::set<std::string> contents;
+    for (const ContentChunk &chunk : Split(data))
+    {
+        contents.emplace(reinterpret_cast<const char *>(data.data()) + chunk.offset, chunk.size);
+    }
+    return contents;
+}
+
+// Tests that chunks cover the data contiguously and respect the size limits.
+TEST(ContentChunkingTest, CoversData)
+{
+    for (size_t size : {0, 1, 1024, 1025, 16384, 100000, 1000000})
+    {
+        const std::vector<uint8_t> data        = RandomData(size, 1);
+        const std::vector<ContentChunk> chunks = Split(data);
+
+        size_t offset = 0;
+        for (size_t index = 0; index < chunks.size(); ++index)
+        {
+            EXPECT_EQ(chunks[index].offset, offset);
+            EXPECT_LE(chunks[index].size, kParams.maxChunkSize);
+            if (index + 1 < chunks.size())
+            {
+                EXPECT_GE(chunks[index].size, kParams.minChunkSize);
+            }
+            offset += chunks[index].size;
+        }
+        EXPECT_EQ(offset, size);
+    }
+
+    // Data without boundaries is cut at the maximum size.
+    const std::vector<uint8_t> zeros(100000, 0);
+    for (const ContentChunk &chunk : Split(zeros))
+    {
+        const bool isLast = chunk.offset + chunk.size == zeros.size();
+        EXPECT_TRUE(isLast || chunk.size == kParams.maxChunkSize);
+    }
+}
+
+// Tests that the average chunk size is roughly the requested one on random data.
+TEST(ContentChunkingTest, AverageSize)
+{
+    const std::vector<uint8_t> data = RandomData(4 * 1024 * 1024, 2);
+    const size_t averageSize        = data.size() / Split(data).size();
+    EXPECT_GT(averageSize, kParams.minChunkSize + kParams.averageChunkSize / 2);
+    EXPECT_LT(averageSize, kParams.minChunkSize + kParams.averageChunkSize * 2);
+}
+
+// Tests that inserting and removing bytes in the middle of the data leaves the chunks away from
+// the edit unchanged.
+TEST(ContentChunkingTest, EditsAreLocal)
+{
+    const std::vector<uint8_t> original          = RandomData(1024 * 1024, 3);
+    const std::set<std::string> originalContents = ChunkContents(original);
+
+    std::vector<uint8_t> inserted        = original;
+    const std::vector<uint8_t> insertion = RandomData(3000, 4);
+    inserted.insert(inserted.begin() + inserted.size() / 2, insertion.begin(), insertion.end());
+
+    std::vector<uint8_t> removed = original;
+    removed.erase(removed.begin() + removed.size() / 3, removed.begin() + removed.size() / 3 + 5);
+
+    for (const std::vector<uint8_t> *edited : {&inserted, &removed})
+    {
+        const std::set<std::string> editedContents = ChunkContents(*edited);
+
+        size_t newChunks = 0;
+        for (const std::string &content : editedContents)
+        {
+            newChunks += originalContents.count(content) == 0;
+        }
+        EXPECT_LE(newChunks, 3u);
+        EXPECT_GT(editedContents.size(), 100u);
+    }
+}
+
+// Tests that boundaries don't depend on how data is placed in memory.
+TEST(ContentChunkingTest, Deterministic)
+{
+    const std::vector<uint8_t> data = RandomData(300000, 5);
+    std::vector<uint8_t> shifted(data.size() + 1);
+    std::copy(data.begin(), data.end(), shifted.begin() + 1);
+
+    std::vector<ContentChunk> chunks;
+    std::vector<ContentChunk> shiftedChunks;
+    SplitIntoContentDefinedChunks(data.data(), data.size(), kParams, &chunks);
+    SplitIntoContentDefinedChunks(shifted.data() + 1, data.size(), kParams, &shiftedChunks);
+
+    ASSERT_EQ(chunks.size(), shiftedChunks.size());
+    for (size_t index = 0; index < chunks.size(); ++index)
+    {
+        EXPECT_EQ(chunks[index].offset, shiftedChunks[index].offset);
+        EXPECT_EQ(chunks[index].size, shiftedChunks[index].size);
+    }
+}
+}  // anonymous namespace
+}  // namespace angle
@@ -0,0 +1,294 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz_codec.cpp: Implements the LZ codec declared in lz_codec.h.
+//
+
+#include "common/lz_codec.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "common/mathutil.h"
+
+namespace angle
+{
+namespace
+{
+constexpr size_t kMinMatchLength = 4;
+constexpr size_t kMaxOffset      = 0xFFFF;
+// The last bytes of the input are always literals, and no match starts in the last
+// kMatchStartMargin bytes.  This keeps the forward match search away from the end of the input.
+constexpr size_t kLastLiterals     = 5;
+constexpr size_t kMatchStartMargin = 12;
+// Positions of recent 4-byte sequences, looked up by hash.
+constexpr unsigned int kHashBits = 12;
+// The search skips ahead faster the longer it goes without finding a match.
+constexpr unsigned int kSkipShift = 6;
+constexpr size_t kLengthNibbleMax = 15;
+// The decoder copies in chunks of this size when both buffers have room for the overrun.
+constexpr size_t kCopyChunkSize = 16;
+
+uint32_t Read32(const uint8_t *source)
+{
+    uint32_t value;
+    memcpy(&value, source, sizeof(value));
+    return value;
+}
+
+uint64_t Read64(const uint8_t *source)
+{
+    uint64_t value;
+    memcpy(&value, source, sizeof(value));
+    return value;
+}
+
+uint32_t HashSequence(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+// Writes the part of a length that doesn't fit in its token nibble.
+uint8_t *WriteExtraLength(uint8_t *dest, size_t length)
+{
+    length -= kLengthNibbleMax;
+    while (length >= 0xFF)
+    {
+        *dest++ = 0xFF;
+        length -= 0xFF;
+    }
+    *dest++ = static_cast<uint8_t>(length);
+    return dest;
+}
+
+// Writes a token and its literals.  Returns where the offset goes.
+uint8_t *WriteLiterals(uint8_t *dest,
+                       const uint8_t *literals,
+                       size_t literalCount,
+                       size_t matchLengthCode)
+{
+    const size_t literalNibble = std::min(literalCount, kLengthNibbleMax);
+    const size_t matchNibble   = std::min(matchLengthCode, kLengthNibbleMax);
+    *dest++                    = static_cast<uint8_t>(literalNibble << 4 | matchNibble);
+
+    if (literalCount >= kLengthNibbleMax)
+    {
+        dest = WriteExtraLength(dest, literalCount);
+    }
+    memcpy(dest, literals, literalCount);
+    return dest + literalCount;
+}
+
+uint8_t *WriteSequence(uint8_t *dest,
+                       const uint8_t *literals,
+                       size_t literalCount,
+                       size_t offset,
+                       size_t matchLength)
+{
+    const size_t matchLengthCode = matchLength - kMinMatchLength;
+    dest                         = WriteLiterals(dest, literals, literalCount, matchLengthCode);
+
+    *dest++ = static_cast<uint8_t>(offset);
+    *dest++ = static_cast<uint8_t>(offset >> 8);
+
+    if (matchLengthCode >= kLengthNibbleMax)
+    {
+        dest = WriteExtraLength(dest, matchLengthCode);
+    }
+    return dest;
+}
+
+// Copies |count| bytes rounded up to kCopyChunkSize.  Chunks may read bytes written by earlier
+// chunks, which is what overlapping matches need as long as |dest| - |source| >= kCopyChunkSize.
+void ChunkedCopy(uint8_t *dest, const uint8_t *source, size_t count)
+{
+    for (size_t copied = 0; copied < count; copied += kCopyChunkSize)
+    {
+        memcpy(dest + copied, source + copied, kCopyChunkSize);
+    }
+}
+
+// Adds the length bytes that follow a token nibble of 15 to |length|.
+bool ReadExtraLength(const uint8_t **source, const uint8_t *sourceEnd, size_t *length)
+{
+    uint8_t byte;
+    do
+    {
+        if (*source == sourceEnd)
+        {
+            return false;
+        }
+        byte = *(*source)++;
+        *length += byte;
+    } while (byte == 0xFF);
+    return true;
+}
+}  // anonymous namespace
+
+size_t LZCompressBound(size_t inputSize)
+{
+    return inputSize + inputSize / 0xFF + 16;
+}
+
+size_t LZCompress(const uint8_t *input, size_t inputSize, uint8_t *output)
+{
+    uint8_t *dest = output;
+    size_t anchor = 0;
+
+    if (inputSize > kMatchStartMargin)
+    {
+        // Positions are stored modulo 2^32; only their distance to the current position matters.
+        uint32_t positions[1 << kHashBits] = {};
+
+        const size_t matchStartLimit = inputSize - kMatchStartMargin;
+        const size_t matchEndLimit   = inputSize - kLastLiterals;
+
+        size_t pos = 0;
+        while (pos < matchStartLimit)
+        {
+            const uint32_t sequence = Read32(input + pos);
+            const uint32_t hash     = HashSequence(sequence);
+            const uint32_t distance = static_cast<uint32_t>(pos) - positions[hash];
+            positions[hash]         = static_cast<uint32_t>(pos);
+
+            if (distance == 0 || distance > kMaxOffset || distance > pos ||
+                Read32(input + pos - distance) != sequence)
+            {
+                pos += 1 + ((pos - anchor) >> kSkipShift);
+                continue;
+            }
+
+            // Extend the match backwards over the pending literals, then forwards.
+            size_t matchPos = pos - distance;
+            while (pos > anchor && matchPos > 0 && input[pos - 1] == input[matchPos - 1])
+            {
+                --pos;
+                --matchPos;
+            }
+
+            size_t length = kMinMatchLength;
+            while (pos + length + sizeof(uint64_t) <= matchEndLimit)
+            {
+                const uint64_t difference =
+                    Read64(input + pos + length) ^ Read64(input + matchPos + length);
+                if (difference != 0)
+                {
+                    length += gl::ScanForward(difference) / 8;
+                    break;
+                }
+                length += sizeof(uint64_t);
+            }
+            while (pos + length < matchEndLimit && input[pos + length] == input[matchPos + length])
+            {
+                ++length;
+            }
+
+            dest   = WriteSequence(dest, input + anchor, pos - anchor, distance, length);
+            pos    = pos + length;
+            anchor = pos;
+
+            // Remember a position inside the match, which helps with repetitive data.
+            if (pos < matchStartLimit)
+            {
+                positions[HashSequence(Read32(input + pos - 2))] = static_cast<uint32_t>(pos - 2);
+            }
+        }
+    }
+
+    dest = WriteLiterals(dest, input + anchor, inputSize - anchor, 0);
+    return dest - output;
+}
+
+bool LZDecompress(const uint8_t *input, size_t inputSize, uint8_t *output, size_t outputSize)
+{
+    const uint8_t *source          = input;
+    const uint8_t *const sourceEnd = input + inputSize;
+    uint8_t *dest                  = output;
+    uint8_t *const destEnd         = output + outputSize;
+
+    while (true)
+    {
+        if (source == sourceEnd)
+        {
+            return false;
+        }
+        const uint8_t token = *source++;
+
+        size_t literalCount = token >> 4;
+        if (literalCount == kLengthNibbleMax && !ReadExtraLength(&source, sourceEnd, &literalCount))
+        {
+            return false;
+        }
+        if (literalCount > static_cast<size_t>(sourceEnd - source) ||
+            literalCount > static_cast<size_t>(destEnd - dest))
+        {
+            return false;
+        }
+        if (literalCount + kCopyChunkSize <= static_cast<size_t>(sourceEnd - source) &&
+            literalCount + kCopyChunkSize <= static_cast<size_t>(destEnd - dest))
+        {
+            ChunkedCopy(dest, source, literalCount);
+        }
+        else if (literalCount > 0)
+        {
+            memcpy(dest, source, literalCount);
+        }
+        source += literalCount;
+        dest += literalCount;
+
+        // The last sequence has no match.
+        if (source == sourceEnd)
+        {
+            return dest == destEnd;
+        }
+
+        if (sourceEnd - source < 2)
+        {
+            return false;
+        }
+        const size_t offset = source[0] | (source[1] << 8);
+        source += 2;
+        if (offset == 0 || offset > static_cast<size_t>(dest - output))
+        {
+            return false;
+        }
+
+        size_t matchLength = token & 0xF;
+        if (matchLength == kLengthNibbleMax && !ReadExtraLength(&source, sourceEnd, &matchLength))
+        {
+            return false;
+        }
+        matchLength += kMinMatchLength;
+        if (matchLength > static_cast<size_t>(destEnd - dest))
+        {
+            return false;
+        }
+
+        // Matches may overlap the bytes they produce.  With an offset of at least the chunk size,
+        // copying a chunk at a time still reads every byte after it was written.
+        const uint8_t *match = dest - offset;
+        size_t copied        = 0;
+        if (offset >= kCopyChunkSize &&
+            matchLength + kCopyChunkSize <= static_cast<size_t>(destEnd - dest))
+        {
+            ChunkedCopy(dest, match, matchLength);
+            copied = matchLength;
+        }
+        else if (offset >= sizeof(uint64_t))
+        {
+            for (; copied + sizeof(uint64_t) <= matchLength; copied += sizeof(uint64_t))
+            {
+                memcpy(dest + copied, match + copied, sizeof(uint64_t));
+            }
+        }
+        for (; copied < matchLength; ++copied)
+        {
+            dest[copied] = match[copied];
+        }
+        dest += matchLength;
+    }
+}
+}  // namespace angle
@@ -0,0 +1,47 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz_codec.h: A small byte-oriented LZ77 codec in the style of the LZ4 block format.  It
+// compresses less than zlib but decompresses several times faster, which suits data that is
+// compressed once and decompressed on every cache hit.
+//
+// The compressed stream is a sequence of:
+//
+//   token                 high nibble: literal count, low nibble: match length - 4.  15 means
+//                         more length bytes follow, each adding up to 255.
+//   [literal count bytes]
+//   literals
+//   offset                2 bytes, little endian, 1 to 65535.  Absent in the last sequence.
+//   [match length bytes]
+//
+// The last sequence only holds literals.  The stream does not record the uncompressed size, so
+// the caller has to store it.
+//
+
+#ifndef COMMON_LZ_CODEC_H_
+#define COMMON_LZ_CODEC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace angle
+{
+// Returns the largest compressed size LZCompress can produce for |inputSize| bytes.
+size_t LZCompressBound(size_t inputSize);
+
+// Compresses |input| into |output|, which must have room for LZCompressBound(inputSize) bytes.
+// Returns the compressed size.
+size_t LZCompress(const uint8_t *input, size_t inputSize, uint8_t *output);
+
+// Decompresses |input| into exactly |outputSize| bytes at |output|.  Returns false if the stream is
+// malformed or doesn't decompress to exactly |outputSize| bytes.  Never reads or writes out of
+// bounds, even for corrupt input.
+[[nodiscard]] bool LZDecompress(const uint8_t *input,
+                                size_t inputSize,
+                                uint8_t *output,
+                                size_t outputSize);
+}  // namespace angle
+
+#endif  // COMMON_LZ_CODEC_H_
@@ -0,0 +1,119 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// lz_codec_unittest.cpp: Unit tests for the LZ codec.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/lz_codec.h"
+
+namespace angle
+{
+namespace
+{
+std::vector<uint8_t> Compress(const std::vector<uint8_t> &input)
+{
+    std::vector<uint8_t> compressed(LZCompressBound(input.size()));
+    compressed.resize(LZCompress(input.data(), input.size(), compressed.data()));
+    return compressed;
+}
+
+void ExpectRoundTrip(const std::vector<uint8_t> &input)
+{
+    const std::vector<uint8_t> compressed = Compress(input);
+    EXPECT_LE(compressed.size(), LZCompressBound(input.size()));
+
+    std::vector<uint8_t> output(input.size());
+    ASSERT_TRUE(LZDecompress(compressed.data(), compressed.size(), output.data(), output.size()))
+        << "size " << input.size();
+    EXPECT_EQ(input, output) << "size " << input.size();
+}
+
+// Tests data that is short, repetitive, self-overlapping, incompressible, and mixed, around the
+// sizes where matches start to be searched.
+TEST(LZCodecTest, RoundTrip)
+{
+    std::mt19937 generator(0);
+
+    for (size_t size : {0, 1, 4, 11, 12, 13, 17, 64, 255, 256, 300, 4096, 70000, 200000})
+    {
+        std::vector<uint8_t> zeros(size, 0);
+        ExpectRoundTrip(zeros);
+
+        std::vector<uint8_t> random(size);
+        for (uint8_t &byte : random)
+        {
+            byte = static_cast<uint8_t>(generator());
+        }
+        ExpectRoundTrip(random);
+
+        // Short periods produce matches that overlap their own output.
+        for (size_t period : {1, 2, 3, 7, 8, 9, 100})
+        {
+            std::vector<uint8_t> periodic(size);
+            for (size_t index = 0; index < size; ++index)
+            {
+                periodic[index] = static_cast<uint8_t>(index % period * 37);
+            }
+            ExpectRoundTrip(periodic);
+        }
+
+        // Runs of random bytes between copies of earlier data, some more than 64KB back.
+        std::vector<uint8_t> mixed(size);
+        for (size_t index = 0; index < size; ++index)
+        {
+            const bool copy = index >= 1000 && (index / 500) % 3 != 0;
+            mixed[index]    = copy ? mixed[index - (index % 2 ? 1000 : 999)]
+                                   : static_cast<uint8_t>(generator());
+        }
+        ExpectRoundTrip(mixed);
+    }
+}
+
+// Tests that compressible data compresses.
+TEST(LZCodecTest, CompressesRepetitiveData)
+{
+    std::vector<uint8_t> input(100000);
+    for (size_t index = 0; index < input.size(); ++index)
+    {
+        input[index] = static_cast<uint8_t>(index % 251);
+    }
+    EXPECT_LT(Compress(input).size(), input.size() / 50);
+}
+
+// Tests that decompression rejects truncated streams, wrong sizes and corrupted bytes without
+// touching memory out of bounds.
+TEST(LZCodecTest, MalformedInput)
+{
+    std::vector<uint8_t> input(20000);
+    std::mt19937 generator(1);
+    for (size_t index = 0; index < input.size(); ++index)
+    {
+        input[index] = index % 3 == 0 ? static_cast<uint8_t>(generator()) : input[index / 2];
+    }
+    const std::vector<uint8_t> compressed = Compress(input);
+
+    std::vector<uint8_t> output(input.size() + 1);
+    EXPECT_FALSE(LZDecompress(compressed.data(), compressed.size() - 1, output.data(),
+                              input.size()));
+    EXPECT_FALSE(LZDecompress(compressed.data(), compressed.size(), output.data(),
+                              input.size() - 1));
+    EXPECT_FALSE(LZDecompress(compressed.data(), compressed.size(), output.data(),
+                              input.size() + 1));
+    EXPECT_FALSE(LZDecompress(compressed.data(), 0, output.data(), input.size()));
+
+    // Corruption may or may not be detected, but must not crash.
+    for (size_t iteration = 0; iteration < 1000; ++iteration)
+    {
+        std::vector<uint8_t> corrupted = compressed;
+        corrupted[generator() % corrupted.size()] ^= static_cast<uint8_t>(1 + generator() % 255);
+        (void)LZDecompress(corrupted.data(), corrupted.size(), output.data(), input.size());
+    }
+}
+}  // anonymous namespace
+}  // namespace angle
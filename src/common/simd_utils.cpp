@@ -0,0 +1,88 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// simd_utils.cpp: Runtime CPU feature detection for SIMD code paths.
+//
+
+#include "common/simd_utils.h"
+
+namespace angle
+{
+namespace
+{
+struct CPUFeatures
+{
+    bool sse2  = false;
+    bool sse41 = false;
+    bool avx2  = false;
+    bool neon  = false;
+};
+
+CPUFeatures DetectCPUFeatures()
+{
+    CPUFeatures features;
+
+#if defined(ANGLE_SIMD_X86)
+#    if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+
+    if (maxLeaf >= 1)
+    {
+        __cpuid(info, 1);
+        features.sse2  = (info[3] >> 26) & 1;
+        features.sse41 = (info[2] >> 19) & 1;
+
+        // AVX2 additionally requires the OS to save the YMM registers on context switch.
+        const bool osxsave = (info[2] >> 27) & 1;
+        const bool avx     = (info[2] >> 28) & 1;
+        if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6)
+        {
+            __cpuidex(info, 7, 0);
+            features.avx2 = (info[1] >> 5) & 1;
+        }
+    }
+#    else
+    __builtin_cpu_init();
+    features.sse2  = __builtin_cpu_supports("sse2");
+    features.sse41 = __builtin_cpu_supports("sse4.1");
+    features.avx2  = __builtin_cpu_supports("avx2");
+#    endif
+#elif defined(ANGLE_SIMD_NEON)
+    // NEON is part of the baseline wherever ANGLE_SIMD_NEON is defined.
+    features.neon = true;
+#endif
+
+    return features;
+}
+
+const CPUFeatures &GetCPUFeatures()
+{
+    static const CPUFeatures features = DetectCPUFeatures();
+    return features;
+}
+}  // anonymous namespace
+
+bool SupportsSSE2()
+{
+    return GetCPUFeatures().sse2;
+}
+
+bool SupportsSSE41()
+{
+    return GetCPUFeatures().sse41;
+}
+
+bool SupportsAVX2()
+{
+    return GetCPUFeatures().avx2;
+}
+
+bool SupportsNEON()
+{
+    return GetCPUFeatures().neon;
+}
+}  // namespace angle
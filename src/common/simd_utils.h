@@ -0,0 +1,44 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// simd_utils.h: Helpers for selecting SIMD code paths at compile time and at runtime.
+//
+// Code using wider instruction sets than the build baseline must be placed in functions marked
+// with ANGLE_SIMD_TARGET_SSE41 or ANGLE_SIMD_TARGET_AVX2, and must only be called after checking
+// the matching runtime query below.
+//
+
+#ifndef COMMON_SIMD_UTILS_H_
+#define COMMON_SIMD_UTILS_H_
+
+#include "common/platform.h"
+
+#if (defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)) && \
+    !defined(_M_ARM64EC)
+#    define ANGLE_SIMD_X86 1
+#    if defined(_MSC_VER) && !defined(__clang__)
+#        include <intrin.h>
+#        define ANGLE_SIMD_TARGET_SSE41
+#        define ANGLE_SIMD_TARGET_AVX2
+#    else
+#        include <immintrin.h>
+#        define ANGLE_SIMD_TARGET_SSE41 __attribute__((target("sse4.1")))
+#        define ANGLE_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#    endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#    define ANGLE_SIMD_NEON 1
+#    include <arm_neon.h>
+#endif
+
+namespace angle
+{
+// Runtime CPU feature queries.  The results are computed once and cached.
+bool SupportsSSE2();
+bool SupportsSSE41();
+bool SupportsAVX2();
+bool SupportsNEON();
+}  // namespace angle
+
+#endif  // COMMON_SIMD_UTILS_H_
@@ -10,6 +10,7 @@
 #include "GLES3/gl3.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
+#include "common/simd_utils.h"
 #include "common/string_utils.h"
 
 #include <set>
@@ -24,40 +25,360 @@
 namespace
 {
 
+// The SIMD kernels below process the largest multiple of the vector width and fold the result
+// into |minOut|/|maxOut|, returning the number of indices consumed.  Primitive restart indices are
+// the maximum value of their type, so they never lower the minimum; they are masked to zero
+// before contributing to the maximum.  A range that contains only restart indices is therefore
+// detected by its minimum still being the restart index.
+template <class IndexType>
+using IndexMinMaxKernel = size_t (*)(const IndexType *indices,
+                                     size_t count,
+                                     bool primitiveRestartEnabled,
+                                     IndexType *minOut,
+                                     IndexType *maxOut);
+
+template <class IndexType>
+void ReduceIndexLanes(const IndexType *minLanes,
+                      const IndexType *maxLanes,
+                      size_t laneCount,
+                      IndexType *minOut,
+                      IndexType *maxOut)
+{
+    for (size_t lane = 0; lane < laneCount; ++lane)
+    {
+        *minOut = std::min(*minOut, minLanes[lane]);
+        *maxOut = std::max(*maxOut, maxLanes[lane]);
+    }
+}
+
+#if defined(ANGLE_SIMD_X86)
+template <class IndexType>
+struct SSE41IndexOps;
+
+template <>
+struct SSE41IndexOps<uint8_t>
+{
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Equal(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi8(a, b);
+    }
+};
+
+template <>
+struct SSE41IndexOps<uint16_t>
+{
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu16(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu16(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Equal(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi16(a, b);
+    }
+};
+
+template <>
+struct SSE41IndexOps<uint32_t>
+{
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu32(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu32(a, b); }
+    ANGLE_SIMD_TARGET_SSE41 static __m128i Equal(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi32(a, b);
+    }
+};
+
+template <class IndexType>
+ANGLE_SIMD_TARGET_SSE41 size_t ComputeIndexMinMaxSSE41(const IndexType *indices,
+                                                       size_t count,
+                                                       bool primitiveRestartEnabled,
+                                                       IndexType *minOut,
+                                                       IndexType *maxOut)
+{
+    using Ops               = SSE41IndexOps<IndexType>;
+    constexpr size_t kLanes = sizeof(__m128i) / sizeof(IndexType);
+    const size_t vectorized = count - count % kLanes;
+
+    // All bits set is both the restart index and the initial minimum.
+    const __m128i allOnes = _mm_set1_epi32(-1);
+    __m128i minVec        = allOnes;
+    __m128i maxVec        = _mm_setzero_si128();
+
+    if (primitiveRestartEnabled)
+    {
+        for (size_t i = 0; i < vectorized; i += kLanes)
+        {
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+            minVec       = Ops::Min(minVec, data);
+            maxVec       = Ops::Max(maxVec, _mm_andnot_si128(Ops::Equal(data, allOnes), data));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < vectorized; i += kLanes)
+        {
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+            minVec       = Ops::Min(minVec, data);
+            maxVec       = Ops::Max(maxVec, data);
+        }
+    }
+
+    alignas(16) IndexType minLanes[kLanes];
+    alignas(16) IndexType maxLanes[kLanes];
+    _mm_store_si128(reinterpret_cast<__m128i *>(minLanes), minVec);
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxLanes), maxVec);
+    ReduceIndexLanes(minLanes, maxLanes, kLanes, minOut, maxOut);
+
+    return vectorized;
+}
+
+template <class IndexType>
+struct AVX2IndexOps;
+
+template <>
+struct AVX2IndexOps<uint8_t>
+{
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu8(a, b); }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu8(a, b); }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi8(a, b);
+    }
+};
+
+template <>
+struct AVX2IndexOps<uint16_t>
+{
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu16(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu16(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+};
+
+template <>
+struct AVX2IndexOps<uint32_t>
+{
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu32(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu32(a, b);
+    }
+    ANGLE_SIMD_TARGET_AVX2 static __m256i Equal(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+};
+
+template <class IndexType>
+ANGLE_SIMD_TARGET_AVX2 size_t ComputeIndexMinMaxAVX2(const IndexType *indices,
+                                                     size_t count,
+                                                     bool primitiveRestartEnabled,
+                                                     IndexType *minOut,
+                                                     IndexType *maxOut)
+{
+    using Ops               = AVX2IndexOps<IndexType>;
+    constexpr size_t kLanes = sizeof(__m256i) / sizeof(IndexType);
+    const size_t vectorized = count - count % kLanes;
+
+    const __m256i allOnes = _mm256_set1_epi32(-1);
+    __m256i minVec        = allOnes;
+    __m256i maxVec        = _mm256_setzero_si256();
+
+    if (primitiveRestartEnabled)
+    {
+        for (size_t i = 0; i < vectorized; i += kLanes)
+        {
+            __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+            minVec       = Ops::Min(minVec, data);
+            maxVec       = Ops::Max(maxVec, _mm256_andnot_si256(Ops::Equal(data, allOnes), data));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < vectorized; i += kLanes)
+        {
+            __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+            minVec       = Ops::Min(minVec, data);
+            maxVec       = Ops::Max(maxVec, data);
+        }
+    }
+
+    alignas(32) IndexType minLanes[kLanes];
+    alignas(32) IndexType maxLanes[kLanes];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(minLanes), minVec);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(maxLanes), maxVec);
+    ReduceIndexLanes(minLanes, maxLanes, kLanes, minOut, maxOut);
+
+    return vectorized;
+}
+#endif  // defined(ANGLE_SIMD_X86)
+
+#if defined(ANGLE_SIMD_NEON)
+template <class IndexType>
+struct NEONIndexOps;
+
+template <>
+struct NEONIndexOps<uint8_t>
+{
+    using Vec = uint8x16_t;
+    static Vec Load(const uint8_t *data) { return vld1q_u8(data); }
+    static void Store(uint8_t *data, Vec v) { vst1q_u8(data, v); }
+    static Vec Splat(uint8_t value) { return vdupq_n_u8(value); }
+    static Vec Min(Vec a, Vec b) { return vminq_u8(a, b); }
+    static Vec Max(Vec a, Vec b) { return vmaxq_u8(a, b); }
+    // Returns |a| with the lanes equal to |b| cleared.
+    static Vec ClearEqual(Vec a, Vec b) { return vbicq_u8(a, vceqq_u8(a, b)); }
+};
+
+template <>
+struct NEONIndexOps<uint16_t>
+{
+    using Vec = uint16x8_t;
+    static Vec Load(const uint16_t *data) { return vld1q_u16(data); }
+    static void Store(uint16_t *data, Vec v) { vst1q_u16(data, v); }
+    static Vec Splat(uint16_t value) { return vdupq_n_u16(value); }
+    static Vec Min(Vec a, Vec b) { return vminq_u16(a, b); }
+    static Vec Max(Vec a, Vec b) { return vmaxq_u16(a, b); }
+    static Vec ClearEqual(Vec a, Vec b) { return vbicq_u16(a, vceqq_u16(a, b)); }
+};
+
+template <>
+struct NEONIndexOps<uint32_t>
+{
+    using Vec = uint32x4_t;
+    static Vec Load(const uint32_t *data) { return vld1q_u32(data); }
+    static void Store(uint32_t *data, Vec v) { vst1q_u32(data, v); }
+    static Vec Splat(uint32_t value) { return vdupq_n_u32(value); }
+    static Vec Min(Vec a, Vec b) { return vminq_u32(a, b); }
+    static Vec Max(Vec a, Vec b) { return vmaxq_u32(a, b); }
+    static Vec ClearEqual(Vec a, Vec b) { return vbicq_u32(a, vceqq_u32(a, b)); }
+};
+
+template <class IndexType>
+size_t ComputeIndexMinMaxNEON(const IndexType *indices,
+                              size_t count,
+                              bool primitiveRestartEnabled,
+                              IndexType *minOut,
+                              IndexType *maxOut)
+{
+    using Ops               = NEONIndexOps<IndexType>;
+    using Vec               = typename Ops::Vec;
+    constexpr size_t kLanes = sizeof(Vec) / sizeof(IndexType);
+    const size_t vectorized = count - count % kLanes;
+
+    const Vec restartVec = Ops::Splat(std::numeric_limits<IndexType>::max());
+    Vec minVec           = restartVec;
+    Vec maxVec           = Ops::Splat(0);
+
+    if (primitiveRestartEnabled)
+    {
+        for (size_t i = 0; i < vectorized; i += kLanes)
+        {
+            Vec data = Ops::Load(indices + i);
+            minVec   = Ops::Min(minVec, data);
+            maxVec   = Ops::Max(maxVec, Ops::ClearEqual(data, restartVec));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < vectorized; i += kLanes)
+        {
+            Vec data = Ops::Load(indices + i);
+            minVec   = Ops::Min(minVec, data);
+            maxVec   = Ops::Max(maxVec, data);
+        }
+    }
+
+    IndexType minLanes[kLanes];
+    IndexType maxLanes[kLanes];
+    Ops::Store(minLanes, minVec);
+    Ops::Store(maxLanes, maxVec);
+    ReduceIndexLanes(minLanes, maxLanes, kLanes, minOut, maxOut);
+
+    return vectorized;
+}
+#endif  // defined(ANGLE_SIMD_NEON)
+
+template <class IndexType>
+IndexMinMaxKernel<IndexType> SelectIndexMinMaxKernel()
+{
+#if defined(ANGLE_SIMD_X86)
+    if (angle::SupportsAVX2())
+    {
+        return &ComputeIndexMinMaxAVX2<IndexType>;
+    }
+    if (angle::SupportsSSE41())
+    {
+        return &ComputeIndexMinMaxSSE41<IndexType>;
+    }
+#elif defined(ANGLE_SIMD_NEON)
+    if (angle::SupportsNEON())
+    {
+        return &ComputeIndexMinMaxNEON<IndexType>;
+    }
+#endif
+    return nullptr;
+}
+
+// Below this many indices the setup and horizontal reduction of the SIMD kernels costs more than
+// the scalar loop.
+constexpr size_t kMinIndexCountForSIMD = 64;
+
 template <class IndexType>
 gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                                       size_t count,
                                       bool primitiveRestartEnabled)
 {
+    static const IndexMinMaxKernel<IndexType> kKernel = SelectIndexMinMaxKernel<IndexType>();
+
     constexpr IndexType primitiveRestartIndex = std::numeric_limits<IndexType>::max();
     IndexType minIndex                        = primitiveRestartIndex;
     IndexType maxIndex                        = 0;
-    bool hasVertices                          = false;
+    size_t i                                  = 0;
+
+    if (kKernel != nullptr && count >= kMinIndexCountForSIMD)
+    {
+        i = kKernel(indices, count, primitiveRestartEnabled, &minIndex, &maxIndex);
+    }
 
     if (primitiveRestartEnabled)
     {
-        for (size_t i = 0; i < count; i++)
+        for (; i < count; i++)
         {
             IndexType index = indices[i];
             if (index == primitiveRestartIndex)
             {
                 continue;
             }
-            hasVertices = true;
-            minIndex    = std::min(minIndex, index);
-            maxIndex    = std::max(maxIndex, index);
+            minIndex = std::min(minIndex, index);
+            maxIndex = std::max(maxIndex, index);
         }
     }
     else
     {
-        for (size_t i = 0; i < count; i++)
+        for (; i < count; i++)
         {
             IndexType index = indices[i];
             minIndex        = std::min(minIndex, index);
             maxIndex        = std::max(maxIndex, index);
         }
-        hasVertices = count > 0;
     }
+
+    // With primitive restart, the minimum only moves off the restart index if a vertex index was
+    // seen.
+    const bool hasVertices =
+        primitiveRestartEnabled ? minIndex != primitiveRestartIndex : count > 0;
     if (!hasVertices)
     {
         return gl::IndexRange();
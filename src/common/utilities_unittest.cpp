@@ -254,4 +254,42 @@ TEST(Utilities, IndexRanges)
     EXPECT_EQ(ComputeIndexRange(b, vertices2, 3, false), gl::IndexRange(2, 255));
 }
 
+// Tests gl::ComputeIndexRange() on buffers long enough to use the vectorized kernels, with the
+// extremes and restart indices placed in the unaligned tail as well as the vectorized body.
+TEST(Utilities, IndexRangesLarge)
+{
+    constexpr size_t kCount = 1000;
+
+    std::vector<uint16_t> shorts(kCount, 0xffff);
+    constexpr auto s = gl::DrawElementsType::UnsignedShort;
+    EXPECT_EQ(ComputeIndexRange(s, shorts.data(), kCount, true), gl::IndexRange());
+    EXPECT_EQ(ComputeIndexRange(s, shorts.data(), kCount, false), gl::IndexRange(0xffff, 0xffff));
+
+    shorts[kCount - 1] = 7;
+    EXPECT_EQ(ComputeIndexRange(s, shorts.data(), kCount, true), gl::IndexRange(7, 7));
+    EXPECT_EQ(ComputeIndexRange(s, shorts.data(), kCount, false), gl::IndexRange(7, 0xffff));
+
+    shorts[100] = 3;
+    shorts[101] = 900;
+    EXPECT_EQ(ComputeIndexRange(s, shorts.data() + 1, kCount - 1, true), gl::IndexRange(3, 900));
+
+    std::vector<uint32_t> ints(kCount);
+    for (size_t i = 0; i < kCount; ++i)
+    {
+        ints[i] = static_cast<uint32_t>(i + 10);
+    }
+    ints[500]        = 0xffffffff;
+    constexpr auto u = gl::DrawElementsType::UnsignedInt;
+    EXPECT_EQ(ComputeIndexRange(u, ints.data(), kCount, true),
+              gl::IndexRange(10, static_cast<uint32_t>(kCount + 9)));
+    EXPECT_EQ(ComputeIndexRange(u, ints.data(), kCount, false), gl::IndexRange(10, 0xffffffff));
+
+    std::vector<uint8_t> bytes(kCount, 0x80);
+    bytes[kCount - 2] = 0;
+    bytes[33]         = 0xfe;
+    constexpr auto b  = gl::DrawElementsType::UnsignedByte;
+    EXPECT_EQ(ComputeIndexRange(b, bytes.data(), kCount, true), gl::IndexRange(0, 0xfe));
+    EXPECT_EQ(ComputeIndexRange(b, bytes.data(), kCount - 2, true), gl::IndexRange(0x80, 0xfe));
+}
+
 }  // anonymous namespace
@@ -359,6 +359,20 @@ void DirectiveParser::parseDefine(Token *token)
         // compare macros.
         token->location = SourceLocation();
         macro->replacements.push_back(*token);
+        if (macro->type == Macro::kTypeFunc)
+        {
+            int parameterIndex = -1;
+            if (token->type == Token::IDENTIFIER)
+            {
+                auto iter = std::find(macro->parameters.begin(), macro->parameters.end(),
+                                      token->text);
+                if (iter != macro->parameters.end())
+                {
+                    parameterIndex = static_cast<int>(iter - macro->parameters.begin());
+                }
+            }
+            macro->replacementParameterIndices.push_back(parameterIndex);
+        }
         mTokenizer->lex(token);
     }
     if (!macro->replacements.empty())
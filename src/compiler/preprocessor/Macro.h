@@ -29,6 +29,7 @@ struct Macro
     };
     typedef std::vector<std::string> Parameters;
     typedef std::vector<Token> Replacements;
+    typedef std::vector<int> ParameterIndices;
 
     Macro();
     ~Macro();
@@ -42,6 +43,10 @@ struct Macro
     std::string name;
     Parameters parameters;
     Replacements replacements;
+    // For function-like macros, the index of the parameter each replacement token names, or -1
+    // for tokens that are not parameters.  Computed when the macro is defined so expansion
+    // doesn't need to search the parameters for every replacement token.
+    ParameterIndices replacementParameterIndices;
 };
 
 typedef std::map<std::string, std::shared_ptr<Macro>> MacroSet;
@@ -8,6 +8,7 @@
 
 #include <GLSLANG/ShaderLang.h>
 #include <algorithm>
+#include <iterator>
 
 #include "common/debug.h"
 #include "compiler/preprocessor/DiagnosticsBase.h"
@@ -35,6 +36,7 @@ class TokenLexer : public Lexer
         mIter = mTokens.begin();
     }
 
+    // Each token is lexed only once, so it is moved out instead of copied.
     void lex(Token *token) override
     {
         if (mIter == mTokens.end())
@@ -44,13 +46,13 @@ class TokenLexer : public Lexer
         }
         else
         {
-            *token = *mIter++;
+            *token = std::move(*mIter++);
         }
     }
 
   private:
     TokenVector mTokens;
-    TokenVector::const_iterator mIter;
+    TokenVector::iterator mIter;
 };
 
 }  // anonymous namespace
@@ -196,7 +198,7 @@ void MacroExpander::getToken(Token *token)
 {
     if (mReserveToken.get())
     {
-        *token = *mReserveToken;
+        *token = std::move(*mReserveToken);
         mReserveToken.reset();
         return;
     }
@@ -209,7 +211,7 @@ void MacroExpander::getToken(Token *token)
 
     if (!mContextStack.empty())
     {
-        *token = mContextStack.back().get();
+        mContextStack.back().get(token);
     }
     else
     {
@@ -224,7 +226,7 @@ void MacroExpander::ungetToken(const Token &token)
     {
         MacroContext &context = mContextStack.back();
         context.unget();
-        ASSERT(context.replacements[context.index] == token);
+        ASSERT(context.tokens()[context.index].text == token.text);
     }
     else
     {
@@ -251,15 +253,15 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    MacroContext context(macro, identifier);
+    if (!expandMacro(*macro, identifier, &context))
         return false;
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    mTotalTokensInContexts += replacements.size();
-    mContextStack.emplace_back(std::move(macro), std::move(replacements));
+    mTotalTokensInContexts += context.size();
+    mContextStack.push_back(std::move(context));
     return true;
 }
 
@@ -282,38 +284,31 @@ void MacroExpander::popMacro()
         context.macro->disabled = false;
     }
     context.macro->expansionCount--;
-    mTotalTokensInContexts -= context.replacements.size();
+    mTotalTokensInContexts -= context.size();
 }
 
-bool MacroExpander::expandMacro(const Macro &macro,
-                                const Token &identifier,
-                                std::vector<Token> *replacements)
+bool MacroExpander::expandMacro(const Macro &macro, const Token &identifier, MacroContext *context)
 {
-    replacements->clear();
-
     // In the case of an object-like macro, the replacement list gets its location
     // from the identifier, but in the case of a function-like macro, the replacement
     // list gets its location from the closing parenthesis of the macro invocation.
     // This is tested by dEQP-GLES3.functional.shaders.preprocessor.predefined_macros.*
-    SourceLocation replacementLocation = identifier.location;
     if (macro.type == Macro::kTypeObj)
     {
-        replacements->assign(macro.replacements.begin(), macro.replacements.end());
-
         if (macro.predefined)
         {
             const char kLine[] = "__LINE__";
             const char kFile[] = "__FILE__";
 
-            ASSERT(replacements->size() == 1);
-            Token &repl = replacements->front();
-            if (macro.name == kLine)
+            ASSERT(macro.replacements.size() == 1);
+            if (macro.name == kLine || macro.name == kFile)
             {
-                repl.text = ToString(identifier.location.line);
-            }
-            else if (macro.name == kFile)
-            {
-                repl.text = ToString(identifier.location.file);
+                context->expansion    = macro.replacements;
+                context->useExpansion = true;
+
+                Token &repl = context->expansion.front();
+                repl.text   = ToString(macro.name == kLine ? identifier.location.line
+                                                           : identifier.location.file);
             }
         }
     }
@@ -322,23 +317,11 @@ bool MacroExpander::expandMacro(const Macro &macro,
         ASSERT(macro.type == Macro::kTypeFunc);
         std::vector<MacroArg> args;
         args.reserve(macro.parameters.size());
-        if (!collectMacroArgs(macro, identifier, &args, &replacementLocation))
+        if (!collectMacroArgs(macro, identifier, &args, &context->location))
             return false;
 
-        replaceMacroParams(macro, args, replacements);
-    }
-
-    for (std::size_t i = 0; i < replacements->size(); ++i)
-    {
-        Token &repl = replacements->at(i);
-        if (i == 0)
-        {
-            // The first token in the replacement list inherits the padding
-            // properties of the identifier token.
-            repl.setAtStartOfLine(identifier.atStartOfLine());
-            repl.setHasLeadingSpace(identifier.hasLeadingSpace());
-        }
-        repl.location = replacementLocation;
+        replaceMacroParams(macro, &args, &context->expansion);
+        context->useExpansion = true;
     }
     return true;
 }
@@ -403,7 +386,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
             // Initial whitespace is not part of the argument.
             if (arg.empty())
                 token.setHasLeadingSpace(false);
-            arg.push_back(token);
+            arg.push_back(std::move(token));
         }
     }
 
@@ -444,7 +427,7 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
         expander.lex(&token);
         while (token.type != Token::LAST)
         {
-            arg.push_back(token);
+            arg.push_back(std::move(token));
             expander.lex(&token);
             numTokens++;
             if (numTokens + mTotalTokensInContexts > kMaxContextTokens)
@@ -458,9 +441,28 @@ bool MacroExpander::collectMacroArgs(const Macro &macro,
 }
 
 void MacroExpander::replaceMacroParams(const Macro &macro,
-                                       const std::vector<MacroArg> &args,
+                                       std::vector<MacroArg> *args,
                                        std::vector<Token> *replacements)
 {
+    ASSERT(macro.replacementParameterIndices.size() == macro.replacements.size());
+
+    // Count how many times each argument is used, so the last use can take the argument's tokens
+    // instead of copying them.
+    std::vector<int> remainingUses(args->size(), 0);
+    size_t expandedSize = 0;
+    for (std::size_t i = 0; i < macro.replacements.size(); ++i)
+    {
+        const int iArg = macro.replacementParameterIndices[i];
+        if (iArg < 0)
+        {
+            ++expandedSize;
+            continue;
+        }
+        ++remainingUses[iArg];
+        expandedSize += (*args)[iArg].size();
+    }
+    replacements->reserve(std::min(expandedSize, kMaxContextTokens));
+
     for (std::size_t i = 0; i < macro.replacements.size(); ++i)
     {
         if (!replacements->empty() &&
@@ -472,45 +474,50 @@ void MacroExpander::replaceMacroParams(const Macro &macro,
         }
 
         const Token &repl = macro.replacements[i];
-        if (repl.type != Token::IDENTIFIER)
-        {
-            replacements->push_back(repl);
-            continue;
-        }
-
-        // TODO(alokp): Optimize this.
-        // There is no need to search for macro params every time.
-        // The param index can be cached with the replacement token.
-        Macro::Parameters::const_iterator iter =
-            std::find(macro.parameters.begin(), macro.parameters.end(), repl.text);
-        if (iter == macro.parameters.end())
+        const int iArg    = macro.replacementParameterIndices[i];
+        if (iArg < 0)
         {
             replacements->push_back(repl);
             continue;
         }
 
-        std::size_t iArg    = std::distance(macro.parameters.begin(), iter);
-        const MacroArg &arg = args[iArg];
+        MacroArg &arg = (*args)[iArg];
         if (arg.empty())
         {
             continue;
         }
         std::size_t iRepl = replacements->size();
-        replacements->insert(replacements->end(), arg.begin(), arg.end());
+        if (--remainingUses[iArg] == 0)
+        {
+            replacements->insert(replacements->end(), std::make_move_iterator(arg.begin()),
+                                 std::make_move_iterator(arg.end()));
+        }
+        else
+        {
+            replacements->insert(replacements->end(), arg.begin(), arg.end());
+        }
         // The replacement token inherits padding properties from
         // macro replacement token.
         replacements->at(iRepl).setHasLeadingSpace(repl.hasLeadingSpace());
     }
 }
 
-bool MacroExpander::MacroContext::empty() const
-{
-    return index == replacements.size();
-}
+MacroExpander::MacroContext::MacroContext(std::shared_ptr<Macro> macro, const Token &identifier)
+    : macro(std::move(macro)), location(identifier.location), firstTokenFlags(identifier.flags)
+{}
 
-const Token &MacroExpander::MacroContext::get()
+void MacroExpander::MacroContext::get(Token *token)
 {
-    return replacements[index++];
+    *token          = tokens()[index];
+    token->location = location;
+    if (index == 0)
+    {
+        // The first token in the replacement list inherits the padding
+        // properties of the identifier token.
+        token->setAtStartOfLine((firstTokenFlags & Token::AT_START_OF_LINE) != 0);
+        token->setHasLeadingSpace((firstTokenFlags & Token::HAS_LEADING_SPACE) != 0);
+    }
+    ++index;
 }
 
 void MacroExpander::MacroContext::unget()
@@ -44,7 +44,8 @@ class MacroExpander : public Lexer
     bool pushMacro(std::shared_ptr<Macro> macro, const Token &identifier);
     void popMacro();
 
-    bool expandMacro(const Macro &macro, const Token &identifier, std::vector<Token> *replacements);
+    struct MacroContext;
+    bool expandMacro(const Macro &macro, const Token &identifier, MacroContext *context);
 
     typedef std::vector<Token> MacroArg;
     bool collectMacroArgs(const Macro &macro,
@@ -52,20 +53,30 @@ class MacroExpander : public Lexer
                           std::vector<MacroArg> *args,
                           SourceLocation *closingParenthesisLocation);
     void replaceMacroParams(const Macro &macro,
-                            const std::vector<MacroArg> &args,
+                            std::vector<MacroArg> *args,
                             std::vector<Token> *replacements);
 
+    // The tokens a macro invocation is replaced with.  Unless the replacement list had to be
+    // rewritten, the context reads the tokens straight from the macro definition instead of
+    // copying them.  The location and the padding of the invocation are applied as each token is
+    // read.
     struct MacroContext
     {
-        MacroContext(std::shared_ptr<Macro> macro, std::vector<Token> &&replacements)
-            : macro(std::move(macro)), replacements(std::move(replacements))
-        {}
-        bool empty() const;
-        const Token &get();
+        MacroContext(std::shared_ptr<Macro> macro, const Token &identifier);
+        bool empty() const { return index == size(); }
+        size_t size() const { return tokens().size(); }
+        const std::vector<Token> &tokens() const
+        {
+            return useExpansion ? expansion : macro->replacements;
+        }
+        void get(Token *token);
         void unget();
 
         std::shared_ptr<Macro> macro;
-        std::vector<Token> replacements;
+        std::vector<Token> expansion;
+        bool useExpansion = false;
+        SourceLocation location;
+        unsigned int firstTokenFlags;
         std::size_t index = 0;
     };
 
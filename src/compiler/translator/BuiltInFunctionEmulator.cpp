@@ -7,6 +7,7 @@
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "angle_gl.h"
 #include "compiler/translator/Symbol.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 
 namespace sh
@@ -48,6 +49,19 @@ class BuiltInFunctionEmulator::BuiltInFunctionEmulationMarker : public TIntermTr
     BuiltInFunctionEmulator &mEmulator;
 };
 
+class BuiltInFunctionEmulator::BuiltInFunctionEmulationPass : public TFusablePass
+{
+  public:
+    BuiltInFunctionEmulationPass(BuiltInFunctionEmulator &emulator) : mMarker(emulator) {}
+
+    TIntermTraverser *getTraverser() override { return &mMarker; }
+
+    bool finish(TCompiler *compiler, TIntermBlock *root) override { return true; }
+
+  private:
+    BuiltInFunctionEmulationMarker mMarker;
+};
+
 BuiltInFunctionEmulator::BuiltInFunctionEmulator() {}
 
 void BuiltInFunctionEmulator::addEmulatedFunction(const TSymbolUniqueId &uniqueId,
@@ -140,6 +154,16 @@ void BuiltInFunctionEmulator::markBuiltInFunctionsForEmulation(TIntermNode *root
     root->traverse(&marker);
 }
 
+std::unique_ptr<TFusablePass> BuiltInFunctionEmulator::createMarkBuiltInFunctionsForEmulationPass()
+{
+    if (mEmulatedFunctions.empty() && mQueryFunctions.empty())
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<BuiltInFunctionEmulationPass>(*this);
+}
+
 void BuiltInFunctionEmulator::cleanup()
 {
     mFunctions.clear();
@@ -7,11 +7,14 @@
 #ifndef COMPILER_TRANSLATOR_BUILTINFUNCTIONEMULATOR_H_
 #define COMPILER_TRANSLATOR_BUILTINFUNCTIONEMULATOR_H_
 
+#include <memory>
+
 #include "compiler/translator/InfoSink.h"
 
 namespace sh
 {
 
+class TFusablePass;
 class TIntermNode;
 class TFunction;
 class TSymbolUniqueId;
@@ -30,6 +33,10 @@ class BuiltInFunctionEmulator
 
     void markBuiltInFunctionsForEmulation(TIntermNode *root);
 
+    // markBuiltInFunctionsForEmulation as a pass to run in a TFusedTraverser.  Returns nullptr if
+    // no function is to be emulated.
+    std::unique_ptr<TFusablePass> createMarkBuiltInFunctionsForEmulationPass();
+
     void cleanup();
 
     // "name" gets written as "name_emu".
@@ -52,6 +59,7 @@ class BuiltInFunctionEmulator
 
   private:
     class BuiltInFunctionEmulationMarker;
+    class BuiltInFunctionEmulationPass;
 
     // Records that a function is called by the shader and might need to be emulated. If the
     // function is not in mEmulatedFunctions, this becomes a no-op. Returns true if the function
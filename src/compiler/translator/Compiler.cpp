@@ -14,9 +14,13 @@
 #include "common/CompiledShaderState.h"
 #include "common/PackedEnums.h"
 #include "common/angle_version_info.h"
+#include "common/system_utils.h"
 
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/CollectVariables.h"
+#include "compiler/translator/DirectiveHandler.h"
 #include "compiler/translator/Initialize.h"
 #include "compiler/translator/IsASTDepthBelowLimit.h"
 #include "compiler/translator/OutputTree.h"
@@ -29,6 +33,7 @@
 #include "compiler/translator/ValidateTypeSizeLimitations.h"
 #include "compiler/translator/ValidateVaryingLocations.h"
 #include "compiler/translator/VariablePacker.h"
+#include "compiler/translator/length_limits.h"
 #include "compiler/translator/tree_ops/ClampFragDepth.h"
 #include "compiler/translator/tree_ops/ClampIndirectIndices.h"
 #include "compiler/translator/tree_ops/ClampPointSize.h"
@@ -63,7 +68,9 @@
 #include "compiler/translator/tree_ops/msl/EnsureLoopForwardProgress.h"
 #include "compiler/translator/tree_util/BuiltIn.h"
 #include "compiler/translator/tree_util/FindSymbolNode.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 #include "compiler/translator/tree_util/IntermNodePatternMatcher.h"
+#include "compiler/translator/tree_util/IntermNode_util.h"
 #include "compiler/translator/tree_util/ReplaceShadowingVariables.h"
 #include "compiler/translator/tree_util/ReplaceVariable.h"
 #include "compiler/translator/util.h"
@@ -300,6 +307,52 @@ struct UniformSortComparator
     }
 };
 
+// Forwards directives to the translator's handler, and records the ones that affect compilation in
+// the token stream, where they are interleaved with the tokens whose parsing they affect.
+class TokenStreamDirectiveHandler : public angle::pp::DirectiveHandler
+{
+  public:
+    TokenStreamDirectiveHandler(TDirectiveHandler *handler, std::string *tokenStream)
+        : mHandler(handler), mTokenStream(tokenStream)
+    {}
+
+    void handleError(const angle::pp::SourceLocation &loc, const std::string &msg) override
+    {
+        mHandler->handleError(loc, msg);
+    }
+
+    void handlePragma(const angle::pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {
+        mHandler->handlePragma(loc, name, value, stdgl);
+        *mTokenStream += stdgl ? "#pragma STDGL " : "#pragma ";
+        *mTokenStream += name + "(" + value + ")\n";
+    }
+
+    void handleExtension(const angle::pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {
+        mHandler->handleExtension(loc, name, behavior);
+        *mTokenStream += "#extension " + name + " : " + behavior + "\n";
+    }
+
+    void handleVersion(const angle::pp::SourceLocation &loc,
+                       int version,
+                       ShShaderSpec spec,
+                       angle::pp::MacroSet *macro_set) override
+    {
+        mHandler->handleVersion(loc, version, spec, macro_set);
+        *mTokenStream += "#version " + std::to_string(version) + "\n";
+    }
+
+  private:
+    TDirectiveHandler *mHandler;
+    std::string *mTokenStream;
+};
+
 }  // anonymous namespace
 
 bool IsGLSL130OrNewer(ShShaderOutput output)
@@ -461,6 +514,22 @@ bool ValidateFragColorAndFragData(GLenum shaderType,
     return true;
 }
 
+// Whether a shader parsed with |parsedOptions| can be translated with |compileOptions| without
+// parsing it again.  Besides the options that affect parsing, regenerateStructNames has to match
+// since it renames the structs of the parsed shader in place.
+bool CanTranslateParsedShader(const ShCompileOptions &parsedOptions,
+                              const ShCompileOptions &compileOptions)
+{
+    return parsedOptions.sourcePath == compileOptions.sourcePath &&
+           parsedOptions.preserveDenorms == compileOptions.preserveDenorms &&
+           parsedOptions.emulateGLDrawID == compileOptions.emulateGLDrawID &&
+           parsedOptions.emulateGLBaseVertexBaseInstance ==
+               compileOptions.emulateGLBaseVertexBaseInstance &&
+           parsedOptions.flattenPragmaSTDGLInvariantAll ==
+               compileOptions.flattenPragmaSTDGLInvariantAll &&
+           parsedOptions.regenerateStructNames == compileOptions.regenerateStructNames;
+}
+
 }  // namespace
 
 TShHandleBase::TShHandleBase()
@@ -473,6 +542,23 @@ TShHandleBase::~TShHandleBase()
     SetGlobalPoolAllocator(nullptr);
 }
 
+// A shader parsed by compile() with ShCompileOptions::retainParsedShader.  The tree, the
+// user-defined symbols and the parse context are allocated from the pool of the parsed shader,
+// which is destroyed last.
+struct TCompiler::ParsedShader
+{
+    angle::PoolAllocator allocator;
+
+    std::vector<std::string> sources;
+    ShCompileOptions compileOptions;
+
+    std::unique_ptr<TParseContext> parseContext;
+    TIntermBlock *root = nullptr;
+    TSymbolTable::ParsedShaderState symbolTableState;
+    TExtensionBehavior extensionBehavior;
+    std::string infoLog;
+};
+
 TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
     : mVariablesCollected(false),
       mGLPositionInitialized(false),
@@ -496,7 +582,13 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mHasAnyPreciseType(false),
       mAdvancedBlendEquations(0),
       mUsesDerivatives(false),
-      mCompileOptions{}
+      mCompileOptions{},
+      mProfile{},
+      mCompileStartTime(0),
+      mInPass(false),
+      mPassStartTime(0),
+      mPassStartNodeVisitCount(0),
+      mNodeVisitCount(0)
 {}
 
 TCompiler::~TCompiler() {}
@@ -549,30 +641,20 @@ TIntermBlock *TCompiler::compileTreeForTesting(const char *const shaderStrings[]
     return compileTreeImpl(shaderStrings, numStrings, compileOptions);
 }
 
-TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
-                                         size_t numStrings,
-                                         const ShCompileOptions &compileOptions)
+void TCompiler::resetExtensionBehavior(const ShCompileOptions &compileOptions,
+                                       TExtensionBehavior *extensionBehavior) const
 {
-    // Remember the compile options for helper functions such as validateAST.
-    mCompileOptions = compileOptions;
-
-    clearResults();
-
-    ASSERT(numStrings > 0);
-    ASSERT(GetGlobalPoolAllocator());
-
-    // Reset the extension behavior for each compilation unit.
-    ResetExtensionBehavior(mResources, mExtensionBehavior, compileOptions);
+    ResetExtensionBehavior(mResources, *extensionBehavior, compileOptions);
 
     // If gl_DrawID is not supported, remove it from the available extensions
     // Currently we only allow emulation of gl_DrawID
     const bool glDrawIDSupported = compileOptions.emulateGLDrawID;
     if (!glDrawIDSupported)
     {
-        auto it = mExtensionBehavior.find(TExtension::ANGLE_multi_draw);
-        if (it != mExtensionBehavior.end())
+        auto it = extensionBehavior->find(TExtension::ANGLE_multi_draw);
+        if (it != extensionBehavior->end())
         {
-            mExtensionBehavior.erase(it);
+            extensionBehavior->erase(it);
         }
     }
 
@@ -580,12 +662,89 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     if (!glBaseVertexBaseInstanceSupported)
     {
         auto it =
-            mExtensionBehavior.find(TExtension::ANGLE_base_vertex_base_instance_shader_builtin);
-        if (it != mExtensionBehavior.end())
+            extensionBehavior->find(TExtension::ANGLE_base_vertex_base_instance_shader_builtin);
+        if (it != extensionBehavior->end())
         {
-            mExtensionBehavior.erase(it);
+            extensionBehavior->erase(it);
         }
     }
+}
+
+bool TCompiler::getPreprocessedTokenStream(const char *const shaderStrings[],
+                                           size_t numStrings,
+                                           const ShCompileOptions &compileOptions,
+                                           std::string *tokenStreamOut)
+{
+    ASSERT(numStrings > 0);
+    tokenStreamOut->clear();
+
+    // The preprocessor is set up exactly as for compilation, so that the same macros are defined.
+    TExtensionBehavior extensionBehavior = mExtensionBehavior;
+    resetExtensionBehavior(compileOptions, &extensionBehavior);
+
+    size_t firstSource = 0;
+    if (compileOptions.sourcePath)
+    {
+        tokenStreamOut->append(shaderStrings[0]);
+        tokenStreamOut->push_back('\n');
+        ++firstSource;
+    }
+
+    // Diagnostics are discarded; the compile that follows a failure reports them.
+    TInfoSinkBase infoSink;
+    TDiagnostics diagnostics(infoSink);
+    int shaderVersion = 100;
+    TDirectiveHandler directiveHandler(extensionBehavior, diagnostics, shaderVersion, mShaderType);
+    TokenStreamDirectiveHandler tokenStreamDirectiveHandler(&directiveHandler, tokenStreamOut);
+
+    angle::pp::Preprocessor preprocessor(&diagnostics, &tokenStreamDirectiveHandler,
+                                         angle::pp::PreprocessorSettings(mShaderSpec));
+    if (!preprocessor.init(numStrings - firstSource, &shaderStrings[firstSource], nullptr))
+    {
+        return false;
+    }
+    // See glslang_scan.
+    if (mResources.FragmentPrecisionHigh == 1)
+    {
+        preprocessor.predefineMacro("GL_FRAGMENT_PRECISION_HIGH", 1);
+    }
+    preprocessor.setMaxTokenSize(GetGlobalMaxTokenSize(mShaderSpec));
+
+    // Token locations only end up in the info log, unless the output has line directives.
+    angle::pp::Token token;
+    do
+    {
+        preprocessor.lex(&token);
+        if (compileOptions.lineDirectives)
+        {
+            *tokenStreamOut += std::to_string(token.location.file);
+            tokenStreamOut->push_back(':');
+            *tokenStreamOut += std::to_string(token.location.line);
+            tokenStreamOut->push_back(' ');
+        }
+        *tokenStreamOut += std::to_string(token.type);
+        tokenStreamOut->push_back(' ');
+        *tokenStreamOut += token.text;
+        tokenStreamOut->push_back('\n');
+    } while (token.type != angle::pp::Token::LAST && diagnostics.numErrors() == 0);
+
+    return diagnostics.numErrors() == 0;
+}
+
+TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
+                                         size_t numStrings,
+                                         const ShCompileOptions &compileOptions)
+{
+    // Remember the compile options for helper functions such as validateAST.
+    mCompileOptions = compileOptions;
+
+    clearResults();
+
+    ASSERT(numStrings > 0);
+    ASSERT(GetGlobalPoolAllocator());
+
+    // Reset the extension behavior for each compilation unit.
+    resetExtensionBehavior(compileOptions, &mExtensionBehavior);
 
     // First string is path of source file if flag is set. The actual source follows.
     size_t firstSource = 0;
@@ -599,37 +758,155 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
                                compileOptions, &mDiagnostics, getResources(), getOutputType());
 
     parseContext.setFragmentPrecisionHighOnESSL1(mResources.FragmentPrecisionHigh == 1);
+    if (compileOptions.compileTimeBudgetMs != 0)
+    {
+        parseContext.setCompileDeadline(mCompileStartTime +
+                                        compileOptions.compileTimeBudgetMs / 1000.0);
+    }
 
     // We preserve symbols at the built-in level from compile-to-compile.
     // Start pushing the user-defined symbols at global level.
     TScopedSymbolTableLevel globalLevel(&mSymbolTable);
     ASSERT(mSymbolTable.atGlobalLevel());
 
-    // Parse shader.
-    if (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
-                       &parseContext) != 0)
+    const bool parsed =
+        parseShader(&parseContext, &shaderStrings[firstSource], numStrings - firstSource);
+    mProfile.budgetExceeded = parseContext.isCompileTimeBudgetExceeded();
+    if (!parsed)
     {
         return nullptr;
     }
 
-    if (!postParseChecks(parseContext))
+    TIntermBlock *root = parseContext.getTreeRoot();
+    if (!checkAndSimplifyAST(root, parseContext, compileOptions))
     {
         return nullptr;
     }
 
-    setASTMetadata(parseContext);
+    return root;
+}
 
-    if (!checkShaderVersion(&parseContext))
+bool TCompiler::parseShader(TParseContext *parseContext,
+                            const char *const shaderStrings[],
+                            size_t numStrings)
+{
+    beginPass("Parse");
+    if (PaParseStrings(numStrings, shaderStrings, nullptr, parseContext) != 0)
     {
-        return nullptr;
+        return false;
     }
 
-    TIntermBlock *root = parseContext.getTreeRoot();
+    if (!postParseChecks(*parseContext))
+    {
+        return false;
+    }
+
+    setASTMetadata(*parseContext);
+
+    return checkShaderVersion(parseContext);
+}
+
+bool TCompiler::parseAndRetainShader(const char *const shaderStrings[],
+                                     size_t numStrings,
+                                     const ShCompileOptions &compileOptions)
+{
+    mCompileOptions = compileOptions;
+
+    clearResults();
+
+    ASSERT(numStrings > 0);
+    ASSERT(GetGlobalPoolAllocator());
+
+    std::unique_ptr<ParsedShader> parsedShader = std::make_unique<ParsedShader>();
+    parsedShader->sources.assign(shaderStrings, shaderStrings + numStrings);
+    parsedShader->compileOptions = compileOptions;
+
+    resetExtensionBehavior(compileOptions, &mExtensionBehavior);
+
+    const size_t firstSource = compileOptions.sourcePath ? 1 : 0;
+
+    // Everything the parser creates is allocated from the pool of the retained shader, so that it
+    // outlives this compilation.
+    angle::PoolAllocator *compilationAllocator = GetGlobalPoolAllocator();
+    SetGlobalPoolAllocator(&parsedShader->allocator);
+
+    parsedShader->parseContext = std::make_unique<TParseContext>(
+        mSymbolTable, mExtensionBehavior, mShaderType, mShaderSpec, compileOptions, &mDiagnostics,
+        getResources(), getOutputType());
+    parsedShader->parseContext->setFragmentPrecisionHighOnESSL1(mResources.FragmentPrecisionHigh ==
+                                                                1);
+    if (compileOptions.compileTimeBudgetMs != 0)
+    {
+        parsedShader->parseContext->setCompileDeadline(
+            mCompileStartTime + compileOptions.compileTimeBudgetMs / 1000.0);
+    }
+
+    mSymbolTable.push();
+    ASSERT(mSymbolTable.atGlobalLevel());
+
+    const bool parsed = parseShader(parsedShader->parseContext.get(), &shaderStrings[firstSource],
+                                    numStrings - firstSource);
+    mProfile.budgetExceeded = parsedShader->parseContext->isCompileTimeBudgetExceeded();
+
+    if (parsed)
+    {
+        mSymbolTable.saveParsedShaderState(&parsedShader->symbolTableState);
+    }
+    else
+    {
+        // Parse errors may leave inner levels in the symbol table.
+        while (!mSymbolTable.isEmpty())
+        {
+            mSymbolTable.pop();
+        }
+    }
+    SetGlobalPoolAllocator(compilationAllocator);
+    mProfile.poolBytes += parsedShader->allocator.getTotalBytes();
+
+    if (!parsed)
+    {
+        return false;
+    }
+
+    parsedShader->root              = parsedShader->parseContext->getTreeRoot();
+    parsedShader->extensionBehavior = mExtensionBehavior;
+    parsedShader->infoLog           = mInfoSink.info.str();
+
+    mParsedShader = std::move(parsedShader);
+    return true;
+}
+
+TIntermBlock *TCompiler::compileTreeFromParsedShader(const ShCompileOptions &compileOptions)
+{
+    ASSERT(mParsedShader);
+    ASSERT(GetGlobalPoolAllocator());
+
+    mCompileOptions = compileOptions;
+
+    clearResults();
+
+    // Go back to the state the compiler was in after parsing the shader, including the warnings
+    // it produced.
+    mInfoSink.info << mParsedShader->infoLog;
+    mExtensionBehavior = mParsedShader->extensionBehavior;
+    if (compileOptions.sourcePath)
+    {
+        mSourcePath = mParsedShader->sources[0].c_str();
+    }
+
+    const TParseContext &parseContext = *mParsedShader->parseContext;
+    mSymbolTable.restoreParsedShaderState(&mParsedShader->symbolTableState);
+    setASTMetadata(parseContext);
+
+    // The passes transform the tree in place, so they run on a copy allocated from the pool of
+    // this compilation.
+    TIntermBlock *root = DeepCopyTree(*mParsedShader->root);
     if (!checkAndSimplifyAST(root, parseContext, compileOptions))
     {
-        return nullptr;
+        root = nullptr;
     }
 
+    mSymbolTable.releaseParsedShaderState(&mParsedShader->symbolTableState);
     return root;
 }
 
@@ -827,6 +1104,18 @@ bool TCompiler::getShaderBinary(const ShHandle compilerHandle,
 
 bool TCompiler::validateAST(TIntermNode *root)
 {
+    if (mCompileOptions.compileTimeBudgetMs != 0 && !mProfile.budgetExceeded &&
+        (angle::GetCurrentSystemTime() - mCompileStartTime) * 1000.0 >
+            mCompileOptions.compileTimeBudgetMs)
+    {
+        mProfile.budgetExceeded = true;
+        mDiagnostics.globalError("compilation exceeded its time budget");
+    }
+    if (mProfile.budgetExceeded)
+    {
+        return false;
+    }
+
     if (mCompileOptions.validateAST)
     {
         bool valid = ValidateAST(root, &mDiagnostics, mValidateASTOptions);
@@ -884,6 +1173,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 {
     mValidateASTOptions = {};
 
+    beginPass("LimitExpressionComplexity");
     // Disallow expressions deemed too complex.
     // This needs to be checked before other functions that will traverse the AST
     // to prevent potential stack overflow crashes.
@@ -892,11 +1182,21 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
+    beginPass("ValidateAST");
     if (!validateAST(root))
     {
         return false;
     }
 
+    if (compileOptions.collectPassStatistics)
+    {
+        beginPass("CountASTNodes");
+        const uint64_t nodeVisitsBefore = mNodeVisitCount;
+        TIntermTraverser nodeCounter(true, false, false);
+        root->traverse(&nodeCounter);
+        mProfile.astNodes = mNodeVisitCount - nodeVisitsBefore;
+    }
+
     // Turn |inout| variables that are never read from into |out| before collecting variables and
     // before PLS uses them.
     if (mShaderVersion >= 300 &&
@@ -904,6 +1204,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
          IsExtensionEnabled(mExtensionBehavior,
                             TExtension::EXT_shader_framebuffer_fetch_non_coherent)))
     {
+        beginPass("RemoveUnusedFramebufferFetch");
         if (!RemoveUnusedFramebufferFetch(this, root, &mSymbolTable))
         {
             return false;
@@ -918,6 +1219,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //   Do we want to hide rewritten shader image uniforms from glGetActiveUniform?
     if (hasPixelLocalStorageUniforms())
     {
+        beginPass("RewritePixelLocalStorage");
         ASSERT(
             IsExtensionEnabled(mExtensionBehavior, TExtension::ANGLE_shader_pixel_local_storage));
         if (!RewritePixelLocalStorage(this, root, getSymbolTable(), compileOptions,
@@ -928,10 +1230,13 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
     }
 
-    if (shouldRunLoopAndIndexingValidation(compileOptions) &&
-        !ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
+    if (shouldRunLoopAndIndexingValidation(compileOptions))
     {
-        return false;
+        beginPass("ValidateLimitations");
+        if (!ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
+        {
+            return false;
+        }
     }
 
     if (!ValidateFragColorAndFragData(mShaderType, mShaderVersion, mSymbolTable, &mDiagnostics))
@@ -939,6 +1244,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
+    beginPass("FoldExpressions");
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
     if (!FoldExpressions(this, root, &mDiagnostics))
@@ -957,6 +1263,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         parseContext.isExtensionEnabled(TExtension::EXT_clip_cull_distance) ||
         parseContext.isExtensionEnabled(TExtension::APPLE_clip_distance))
     {
+        beginPass("ValidateClipCullDistance");
         bool isClipDistanceUsed = false;
         if (!ValidateClipCullDistance(this, root, &mDiagnostics,
                                       mResources.MaxCombinedClipAndCullDistances,
@@ -968,11 +1275,16 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     }
 
     // Validate no barrier() after return before prunning it in |PruneNoOps()| below.
-    if (mShaderType == GL_TESS_CONTROL_SHADER && !ValidateBarrierFunctionCall(root, &mDiagnostics))
+    if (mShaderType == GL_TESS_CONTROL_SHADER)
     {
-        return false;
+        beginPass("ValidateBarrierFunctionCall");
+        if (!ValidateBarrierFunctionCall(root, &mDiagnostics))
+        {
+            return false;
+        }
     }
 
+    beginPass("PruneNoOps");
     // We prune no-ops to work around driver bugs and to keep AST processing and output simple.
     // The following kinds of no-ops are pruned:
     //   1. Empty declarations "int;".
@@ -1008,6 +1320,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // This is because MSL doesn't allow statically initialized non-const globals.
     bool forceDeferNonConstGlobalInitializers = getOutputType() == SH_MSL_METAL_OUTPUT;
 
+    beginPass("DeferGlobalInitializers");
     if (enableNonConstantInitializers &&
         !DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
                                  highPrecisionSupported, forceDeferNonConstGlobalInitializers,
@@ -1016,6 +1329,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
+    beginPass("InitCallDag");
     // Create the function DAG and check there is no recursion
     if (!initCallDag(root))
     {
@@ -1035,6 +1349,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
+    beginPass("PruneUnusedFunctions");
     if (!pruneUnusedFunctions(root))
     {
         return false;
@@ -1042,19 +1357,38 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
+        beginPass("ReplaceShadowingVariables");
         if (!ReplaceShadowingVariables(this, root, &mSymbolTable))
         {
             return false;
         }
     }
 
-    if (mShaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, mShaderType))
+    // Varying locations and fragment outputs are validated in a single traversal.  The outputs
+    // are not affected by MonomorphizeUnsupportedFunctions, so they are validated before it.
+    beginPass("ValidateVaryingLocationsAndOutputs");
     {
-        return false;
+        TFusedTraverser interfaceValidator;
+        if (mShaderVersion >= 310)
+        {
+            interfaceValidator.addPass(
+                CreateValidateVaryingLocationsPass(&mDiagnostics, mShaderType));
+        }
+        if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER)
+        {
+            interfaceValidator.addPass(CreateValidateOutputsPass(
+                getExtensionBehavior(), mResources, hasPixelLocalStorageUniforms(),
+                IsWebGLBasedSpec(mShaderSpec), &mDiagnostics));
+        }
+        if (!interfaceValidator.run(this, root))
+        {
+            return false;
+        }
     }
 
     // anglebug.com/42265954: The ESSL spec has a bug with images as function arguments. The
     // recommended workaround is to inline functions that accept image arguments.
+    beginPass("MonomorphizeUnsupportedFunctions");
     if (mShaderVersion >= 310 && !MonomorphizeUnsupportedFunctions(
                                      this, root, &mSymbolTable,
                                      UnsupportedFunctionArgsBitSet{UnsupportedFunctionArgs::Image}))
@@ -1062,16 +1396,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
-    if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER &&
-        !ValidateOutputs(root, getExtensionBehavior(), mResources, hasPixelLocalStorageUniforms(),
-                         IsWebGLBasedSpec(mShaderSpec), &mDiagnostics))
-    {
-        return false;
-    }
-
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
     if (compileOptions.clampIndirectArrayBounds)
     {
+        beginPass("ClampIndirectIndices");
         if (!ClampIndirectIndices(this, root, &mSymbolTable))
         {
             return false;
@@ -1083,6 +1411,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
          parseContext.isExtensionEnabled(TExtension::OVR_multiview)) &&
         getShaderType() != GL_COMPUTE_SHADER)
     {
+        beginPass("DeclareAndInitBuiltinsForInstancedMultiview");
         if (!DeclareAndInitBuiltinsForInstancedMultiview(
                 this, root, mNumViews, mShaderType, compileOptions, mOutputType, &mSymbolTable))
         {
@@ -1092,6 +1421,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.addAndTrueToLoopCondition)
     {
+        beginPass("AddAndTrueToLoopCondition");
         if (!AddAndTrueToLoopCondition(this, root))
         {
             return false;
@@ -1100,6 +1430,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.unfoldShortCircuit)
     {
+        beginPass("UnfoldShortCircuitAST");
         if (!UnfoldShortCircuitAST(this, root))
         {
             return false;
@@ -1108,6 +1439,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.regenerateStructNames)
     {
+        beginPass("RegenerateStructNames");
         if (!RegenerateStructNames(this, root, &mSymbolTable))
         {
             return false;
@@ -1119,6 +1451,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         if (compileOptions.emulateGLDrawID)
         {
+            beginPass("EmulateGLDrawID");
             if (!EmulateGLDrawID(this, root, &mSymbolTable, &mUniforms))
             {
                 return false;
@@ -1132,6 +1465,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         if (compileOptions.emulateGLBaseVertexBaseInstance)
         {
+            beginPass("EmulateGLBaseVertexBaseInstance");
             if (!EmulateGLBaseVertexBaseInstance(this, root, &mSymbolTable, &mUniforms,
                                                  compileOptions.addBaseVertexToVertexID))
             {
@@ -1144,6 +1478,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         mResources.MaxDrawBuffers > 1 &&
         IsExtensionEnabled(mExtensionBehavior, TExtension::EXT_draw_buffers))
     {
+        beginPass("EmulateGLFragColorBroadcast");
         if (!EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers,
                                          mResources.MaxDualSourceDrawBuffers, &mOutputVariables,
                                          &mSymbolTable, mShaderVersion))
@@ -1154,6 +1489,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.ensureLoopForwardProgress)
     {
+        beginPass("EnsureLoopForwardProgress");
         if (!EnsureLoopForwardProgress(this, root))
         {
             return false;
@@ -1162,6 +1498,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.simplifyLoopConditions)
     {
+        beginPass("SimplifyLoopConditions");
         if (!SimplifyLoopConditions(this, root, &getSymbolTable()))
         {
             return false;
@@ -1169,6 +1506,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     }
     else
     {
+        beginPass("SplitMultiDeclarations");
         // Split multi declarations and remove calls to array length().
         // Note that SimplifyLoopConditions needs to be run before any other AST transformations
         // that may need to generate new statements from loop conditions or loop expressions.
@@ -1181,6 +1519,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
     }
 
+    beginPass("SeparateDeclarations");
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
     if (!SeparateDeclarations(*this, *root, mCompileOptions.separateCompoundStructDeclarations))
@@ -1190,6 +1529,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (IsWebGLBasedSpec(mShaderSpec))
     {
+        beginPass("PruneInfiniteLoops");
         // Remove infinite loops, they are not supposed to exist in shaders.
         bool anyInfiniteLoops = false;
         if (!PruneInfiniteLoops(this, root, &mSymbolTable, &anyInfiniteLoops))
@@ -1208,6 +1548,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.rescopeGlobalVariables)
     {
+        beginPass("RescopeGlobalVariables");
         if (!RescopeGlobalVariables(*this, *root))
         {
             return false;
@@ -1216,27 +1557,32 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     mValidateASTOptions.validateMultiDeclarations = true;
 
+    beginPass("SplitSequenceOperator");
     if (!SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
                                &getSymbolTable()))
     {
         return false;
     }
 
+    beginPass("RemoveArrayLengthMethod");
     if (!RemoveArrayLengthMethod(this, root))
     {
         return false;
     }
+    beginPass("FoldExpressions");
     // Fold the expressions again, because |RemoveArrayLengthMethod| can introduce new constants.
     if (!FoldExpressions(this, root, &mDiagnostics))
     {
         return false;
     }
 
+    beginPass("RemoveUnreferencedVariables");
     if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
     {
         return false;
     }
 
+    beginPass("PruneEmptyCases");
     // In case the last case inside a switch statement is a certain type of no-op, GLSL compilers in
     // drivers may not accept it. In this case we clean up the dead code from the end of switch
     // statements. This is also required because PruneNoOps or RemoveUnreferencedVariables may have
@@ -1248,21 +1594,38 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
-    // Run after RemoveUnreferencedVariables, validate that the shader does not have excessively
-    // large variables.
-    if (shouldLimitTypeSizes() && !ValidateTypeSizeLimitations(root, &mSymbolTable, &mDiagnostics))
+    // Type sizes are validated and built-in functions are marked for emulation in a single
+    // traversal.
+    beginPass("ValidateTypeSizeLimitationsAndBuiltInFunctionEmulator");
     {
-        return false;
-    }
+        // Built-in function emulation needs to happen after validateLimitations pass.
+        GetGlobalPoolAllocator()->lock();
+        initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
+        GetGlobalPoolAllocator()->unlock();
 
-    // Built-in function emulation needs to happen after validateLimitations pass.
-    GetGlobalPoolAllocator()->lock();
-    initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
-    GetGlobalPoolAllocator()->unlock();
-    mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+        TFusedTraverser typeSizeValidatorAndEmulationMarker;
+        // Run after RemoveUnreferencedVariables, validate that the shader does not have
+        // excessively large variables.
+        if (shouldLimitTypeSizes())
+        {
+            typeSizeValidatorAndEmulationMarker.addPass(
+                CreateValidateTypeSizeLimitationsPass(&mSymbolTable, &mDiagnostics));
+        }
+        std::unique_ptr<TFusablePass> emulationMarker =
+            mBuiltInFunctionEmulator.createMarkBuiltInFunctionsForEmulationPass();
+        if (emulationMarker)
+        {
+            typeSizeValidatorAndEmulationMarker.addPass(std::move(emulationMarker));
+        }
+        if (!typeSizeValidatorAndEmulationMarker.run(this, root))
+        {
+            return false;
+        }
+    }
 
     if (compileOptions.scalarizeVecAndMatConstructorArgs)
     {
+        beginPass("ScalarizeVecAndMatConstructorArgs");
         if (!ScalarizeVecAndMatConstructorArgs(this, root, &mSymbolTable))
         {
             return false;
@@ -1271,12 +1634,14 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.forceShaderPrecisionHighpToMediump)
     {
+        beginPass("ForceShaderPrecisionToMediump");
         if (!ForceShaderPrecisionToMediump(root, &mSymbolTable, mShaderType))
         {
             return false;
         }
     }
 
+    beginPass("CollectVariables");
     ASSERT(!mVariablesCollected);
     if (!sortUniforms(root))
     {
@@ -1319,6 +1684,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // For the MSL output, keep the inactive fragment outputs, but remove them otherwise.
     if (compileOptions.removeInactiveVariables)
     {
+        beginPass("RemoveInactiveInterfaceVariables");
         if (!RemoveInactiveInterfaceVariables(this, root, &getSymbolTable(), getAttributes(),
                                               getInputVaryings(), getOutputVariables(),
                                               getUniforms(), getInterfaceBlocks(),
@@ -1334,6 +1700,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         compileOptions.initFragmentOutputVariables && mShaderType == GL_FRAGMENT_SHADER;
     if (needInitializeOutputVariables)
     {
+        beginPass("InitializeOutputVariables");
         if (!initializeOutputVariables(root))
         {
             return false;
@@ -1344,6 +1711,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Otherwise, built-in invariant declarations don't apply.
     if (RemoveInvariant(mShaderType, mShaderVersion, mOutputType, compileOptions))
     {
+        beginPass("RemoveInvariantDeclaration");
         if (!RemoveInvariantDeclaration(this, root))
         {
             return false;
@@ -1356,6 +1724,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     if (mShaderType == GL_VERTEX_SHADER && !mGLPositionInitialized &&
         (compileOptions.initGLPosition || mOutputType == SH_GLSL_COMPATIBILITY_OUTPUT))
     {
+        beginPass("InitializeGLPosition");
         if (!initializeGLPosition(root))
         {
             return false;
@@ -1363,6 +1732,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         mGLPositionInitialized = true;
     }
 
+    beginPass("DeferGlobalInitializers");
     // DeferGlobalInitializers needs to be run before other AST transformations that generate new
     // statements from expressions. But it's fine to run DeferGlobalInitializers after the above
     // SplitSequenceOperator and RemoveArrayLengthMethod since they only have an effect on the AST
@@ -1380,6 +1750,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (initializeLocalsAndGlobals)
     {
+        beginPass("InitializeUninitializedLocals");
         // Initialize uninitialized local variables.
         // In some cases initializing can generate extra statements in the parent block, such as
         // when initializing nameless structs or initializing arrays in ESSL 1.00. In that case
@@ -1408,6 +1779,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (getShaderType() == GL_VERTEX_SHADER && compileOptions.clampPointSize)
     {
+        beginPass("ClampPointSize");
         if (!ClampPointSize(this, root, mResources.MinPointSize, mResources.MaxPointSize,
                             &getSymbolTable()))
         {
@@ -1417,6 +1789,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (getShaderType() == GL_FRAGMENT_SHADER && compileOptions.clampFragDepth)
     {
+        beginPass("ClampFragDepth");
         if (!ClampFragDepth(this, root, &getSymbolTable()))
         {
             return false;
@@ -1425,6 +1798,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.rewriteRepeatedAssignToSwizzled)
     {
+        beginPass("RewriteRepeatedAssignToSwizzled");
         if (!sh::RewriteRepeatedAssignToSwizzled(this, root))
         {
             return false;
@@ -1433,6 +1807,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions.removeDynamicIndexingOfSwizzledVector)
     {
+        beginPass("RemoveDynamicIndexingOfSwizzledVector");
         if (!sh::RemoveDynamicIndexingOfSwizzledVector(this, root, &getSymbolTable(), nullptr))
         {
             return false;
@@ -1465,6 +1840,78 @@ bool TCompiler::postParseChecks(const TParseContext &parseContext)
     return true;
 }
 
+// Starts the clock of the compilation budget, and for compilations that collect pass statistics,
+// installs the node visit counter and completes the profile at the end.  Must be created after
+// the pool allocator of the compilation.
+class TCompiler::ScopedCompileProfile : angle::NonCopyable
+{
+  public:
+    ScopedCompileProfile(TCompiler *compiler, const ShCompileOptions &compileOptions)
+        : mCompiler(compiler),
+          mEnabled(compileOptions.collectPassStatistics),
+          mStartPoolBytes(GetGlobalPoolAllocator()->getTotalBytes()),
+          mStartSymbolLookups(compiler->mSymbolTable.getLookupCount())
+    {
+        mCompiler->mProfile          = {};
+        mCompiler->mCompileStartTime = angle::GetCurrentSystemTime();
+        if (mEnabled)
+        {
+            mCompiler->mNodeVisitCount = 0;
+            SetTraversalNodeVisitCounter(&mCompiler->mNodeVisitCount);
+        }
+    }
+
+    ~ScopedCompileProfile()
+    {
+        if (!mEnabled)
+        {
+            return;
+        }
+
+        mCompiler->endPassStatistics();
+        SetTraversalNodeVisitCounter(nullptr);
+
+        CompileProfile &profile = mCompiler->mProfile;
+        profile.seconds         = angle::GetCurrentSystemTime() - mCompiler->mCompileStartTime;
+        profile.poolBytes += GetGlobalPoolAllocator()->getTotalBytes() - mStartPoolBytes;
+        profile.symbolLookups = mCompiler->mSymbolTable.getLookupCount() - mStartSymbolLookups;
+
+        TInfoSinkBase &objectSink = mCompiler->mInfoSink.obj;
+        profile.objectCodeBytes   = objectSink.isBinary()
+                                        ? objectSink.getBinary().size() * sizeof(uint32_t)
+                                        : objectSink.str().size();
+    }
+
+  private:
+    TCompiler *mCompiler;
+    bool mEnabled;
+    size_t mStartPoolBytes;
+    uint64_t mStartSymbolLookups;
+};
+
+void TCompiler::startPassStatistics(const char *name)
+{
+    endPassStatistics();
+
+    mProfile.passes.push_back({name, 0, 0});
+    mInPass                  = true;
+    mPassStartTime           = angle::GetCurrentSystemTime();
+    mPassStartNodeVisitCount = mNodeVisitCount;
+}
+
+void TCompiler::endPassStatistics()
+{
+    if (!mInPass)
+    {
+        return;
+    }
+
+    PassStatistics &pass = mProfile.passes.back();
+    pass.seconds         = angle::GetCurrentSystemTime() - mPassStartTime;
+    pass.nodeVisits      = mNodeVisitCount - mPassStartNodeVisitCount;
+    mInPass              = false;
+}
+
 bool TCompiler::compile(const char *const shaderStrings[],
                         size_t numStrings,
                         const ShCompileOptions &compileOptionsIn)
@@ -1486,9 +1933,64 @@ bool TCompiler::compile(const char *const shaderStrings[],
         compileOptions.flattenPragmaSTDGLInvariantAll = true;
     }
 
+    // A new compilation replaces the retained shader.
+    mParsedShader.reset();
+
+    TScopedPoolAllocator scopedAlloc;
+    ScopedCompileProfile profile(this, compileOptions);
+
+    TIntermBlock *root = nullptr;
+    if (compileOptions.retainParsedShader)
+    {
+        if (parseAndRetainShader(shaderStrings, numStrings, compileOptions))
+        {
+            root = compileTreeFromParsedShader(compileOptions);
+        }
+    }
+    else
+    {
+        root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
+    }
+
+    return finishCompilation(root, compileOptions);
+}
+
+bool TCompiler::compileVariant(const ShCompileOptions &compileOptionsIn)
+{
+    if (!mParsedShader)
+    {
+        return false;
+    }
+
+    ShCompileOptions compileOptions   = compileOptionsIn;
+    compileOptions.retainParsedShader = true;
+
+    // Apply the same key workarounds as compile().
+    if (shouldFlattenPragmaStdglInvariantAll())
+    {
+        compileOptions.flattenPragmaSTDGLInvariantAll = true;
+    }
+
+    if (!CanTranslateParsedShader(mParsedShader->compileOptions, compileOptions))
+    {
+        // Compile the shader again from its source, retaining it with the new options.
+        const std::vector<std::string> sources = std::move(mParsedShader->sources);
+        std::vector<const char *> shaderStrings;
+        for (const std::string &source : sources)
+        {
+            shaderStrings.push_back(source.c_str());
+        }
+        return compile(shaderStrings.data(), shaderStrings.size(), compileOptions);
+    }
+
     TScopedPoolAllocator scopedAlloc;
-    TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
+    ScopedCompileProfile profile(this, compileOptions);
 
+    return finishCompilation(compileTreeFromParsedShader(compileOptions), compileOptions);
+}
+
+bool TCompiler::finishCompilation(TIntermBlock *root, const ShCompileOptions &compileOptions)
+{
     if (root)
     {
         if (compileOptions.intermediateTree)
@@ -1747,6 +2249,9 @@ void TCompiler::clearResults()
 
     mNameMap.clear();
 
+    mProfile.passes.clear();
+    mInPass = false;
+
     mSourcePath = nullptr;
 
     mSymbolTable.clearCompilationResults();
@@ -108,6 +108,16 @@ class TCompiler : public TShHandleBase
                  size_t numStrings,
                  const ShCompileOptions &compileOptions);
 
+    // Compiles the shader retained by the last compile() with ShCompileOptions::retainParsedShader
+    // again with different options.  See sh::CompileVariant.
+    bool compileVariant(const ShCompileOptions &compileOptions);
+
+    // Preprocesses the shader without compiling it.  See sh::GetPreprocessedTokenStream.
+    bool getPreprocessedTokenStream(const char *const shaderStrings[],
+                                    size_t numStrings,
+                                    const ShCompileOptions &compileOptions,
+                                    std::string *tokenStreamOut);
+
     // Get results of the last compilation.
     int getShaderVersion() const { return mShaderVersion; }
     TInfoSink &getInfoSink() { return mInfoSink; }
@@ -208,7 +218,8 @@ class TCompiler : public TShHandleBase
                          const ShCompileOptions &compileOptions,
                          ShaderBinaryBlob *const binaryOut);
 
-    // Validate the AST and produce errors if it is inconsistent.
+    // Validate the AST and produce errors if it is inconsistent.  Passes end with this, so it also
+    // fails the compilation once it exceeds ShCompileOptions::compileTimeBudgetMs.
     bool validateAST(TIntermNode *root);
     // Some transformations may need to temporarily disable validation until they are complete.  A
     // set of disable/enable helpers are used for this purpose.
@@ -236,6 +247,12 @@ class TCompiler : public TShHandleBase
         return mShaderVersion == 100 && !IsWebGLBasedSpec(mShaderSpec);
     }
 
+    using PassStatistics = CompilePassProfile;
+    // Statistics of the passes of the last compilation, in the order they ran.  Only collected
+    // with ShCompileOptions::collectPassStatistics.
+    const std::vector<PassStatistics> &getPassStatistics() const { return mProfile.passes; }
+    const CompileProfile &getCompileProfile() const { return mProfile; }
+
   protected:
     // Add emulated functions to the built-in function emulator.
     virtual void initBuiltInFunctionEmulator(BuiltInFunctionEmulator *emu,
@@ -255,6 +272,16 @@ class TCompiler : public TShHandleBase
 
     virtual bool shouldFlattenPragmaStdglInvariantAll() = 0;
 
+    // Attributes the work from now on to the pass |name| in the pass statistics, ending the
+    // previous pass.  Does nothing unless ShCompileOptions::collectPassStatistics is set.
+    void beginPass(const char *name)
+    {
+        if (mCompileOptions.collectPassStatistics)
+        {
+            startPassStatistics(name);
+        }
+    }
+
     std::vector<sh::ShaderVariable> mAttributes;
     std::vector<sh::ShaderVariable> mOutputVariables;
     std::vector<sh::ShaderVariable> mUniforms;
@@ -274,6 +301,12 @@ class TCompiler : public TShHandleBase
     SpecConstUsageBits mSpecConstUsageBits;
 
   private:
+    class ScopedCompileProfile;
+    struct ParsedShader;
+
+    void startPassStatistics(const char *name);
+    void endPassStatistics();
+
     // Initialize symbol-table with built-in symbols.
     bool initBuiltInSymbolTable(const ShBuiltInResources &resources);
     // Compute the string representation of the built-in resources
@@ -315,10 +348,30 @@ class TCompiler : public TShHandleBase
                                   size_t numStrings,
                                   const ShCompileOptions &compileOptions);
 
+    // Parses the shader into mParsedShader, which outlives the compilation.  Returns false if the
+    // shader fails to parse.
+    bool parseAndRetainShader(const char *const shaderStrings[],
+                              size_t numStrings,
+                              const ShCompileOptions &compileOptions);
+    // Does the work of compileTreeImpl() after parsing on a copy of the tree of mParsedShader.
+    TIntermBlock *compileTreeFromParsedShader(const ShCompileOptions &compileOptions);
+    // Translates the tree returned by compileTreeImpl() or compileTreeFromParsedShader().
+    bool finishCompilation(TIntermBlock *root, const ShCompileOptions &compileOptions);
+
+    // Resets the extension behavior to the extensions the resources and options make available.
+    void resetExtensionBehavior(const ShCompileOptions &compileOptions,
+                                TExtensionBehavior *extensionBehavior) const;
+
     // Fetches and stores shader metadata that is not stored within the AST itself, such as shader
     // version.
     void setASTMetadata(const TParseContext &parseContext);
 
+    // Parses the shader with the global level of the symbol table pushed, and does the checks that
+    // only depend on the parse results.
+    bool parseShader(TParseContext *parseContext,
+                     const char *const shaderStrings[],
+                     size_t numStrings);
+
     // Check if shader version meets the requirement.
     bool checkShaderVersion(TParseContext *parseContext);
 
@@ -345,6 +398,9 @@ class TCompiler : public TShHandleBase
     // Built-in extensions with default behavior.
     TExtensionBehavior mExtensionBehavior;
 
+    // The shader retained by the last compilation with ShCompileOptions::retainParsedShader.
+    std::unique_ptr<ParsedShader> mParsedShader;
+
     BuiltInFunctionEmulator mBuiltInFunctionEmulator;
 
     // Results of compilation.
@@ -398,6 +454,15 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     ShCompileOptions mCompileOptions;
+
+    // Profile of the current compilation.  The traversers report the nodes they entered to
+    // mNodeVisitCount.
+    CompileProfile mProfile;
+    double mCompileStartTime;
+    bool mInPass;
+    double mPassStartTime;
+    uint64_t mPassStartNodeVisitCount;
+    uint64_t mNodeVisitCount;
 };
 
 //
@@ -8,7 +8,7 @@
 //
 // ImmutableString_autogen.cpp: Wrapper for static or pool allocated char arrays, that are
 // guaranteed to be valid and unchanged for the duration of the compilation. Implements
-// mangledNameHash using perfect hash function from gen_builtin_symbols.py
+// mangledNameHash using the perfect hash function generated by gen_builtin_symbols.py
 
 #include "compiler/translator/ImmutableString.h"
 
@@ -22,283 +22,286 @@ std::ostream &operator<<(std::ostream &os, const ImmutableString &str)
 
 }  // namespace sh
 
-#if defined(_MSC_VER)
-#    pragma warning(disable : 4309)  // truncation of constant value
-#endif
-
 namespace
 {
 
-constexpr int mangledkT1[] = {2186, 2708, 298,  662,  720,  2610, 2533, 955,  2266, 363,
-                              1173, 1913, 2069, 417,  1813, 1398, 2943, 2855, 2466, 2534,
-                              437,  1593, 1729, 543,  1529, 2896, 2290, 2843, 2741, 280,
-                              1542, 849,  750,  2664, 258,  424,  2478, 625,  1465, 1890};
-constexpr int mangledkT2[] = {2890, 2051, 1552, 239,  2564, 1463, 881,  1891, 2426, 2313,
-                              826,  805,  1439, 2489, 1282, 100,  1736, 3080, 2650, 2986,
-                              1292, 1531, 979,  1536, 1588, 1155, 2910, 775,  850,  791,
-                              199,  1380, 1547, 2246, 2532, 190,  1494, 672,  1700, 1391};
-constexpr int mangledkG[]  = {
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    682,  0,    296,  0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    489,  0,    696,  0,    0,    0,    0,    0,    0,
-    0,    0,    0,    818,  3071, 0,    0,    0,    0,    2849, 0,    0,    0,    0,    2314, 0,
-    0,    0,    98,   0,    0,    450,  0,    0,    45,   0,    0,    0,    0,    0,    1614, 0,
-    0,    0,    2596, 0,    0,    0,    0,    0,    0,    287,  0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    897,  0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    3038, 1045, 0,    0,    0,    422,  0,    0,    0,    0,    0,    0,    0,    0,    351,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    203,  1211, 0,    0,    0,    184,
-    0,    0,    2806, 0,    0,    0,    0,    0,    74,   0,    448,  0,    0,    0,    0,    0,
-    0,    0,    0,    0,    931,  0,    0,    0,    0,    1061, 0,    0,    0,    198,  0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    2959, 0,    2970, 0,    0,    0,
-    0,    0,    0,    502,  0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    77,   0,    0,    0,    0,    2681, 0,    0,    0,    502,  1779, 0,    0,    0,    0,    0,
-    2758, 0,    1301, 0,    0,    0,    0,    0,    110,  0,    3084, 0,    0,    0,    4,    0,
-    0,    0,    0,    0,    2003, 2899, 791,  0,    400,  0,    1824, 0,    0,    0,    0,    1596,
-    0,    0,    0,    0,    2330, 2862, 0,    1649, 875,  1541, 434,  0,    0,    0,    0,    2406,
-    0,    0,    2252, 0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    545,  0,    0,    0,    0,    0,    0,    0,    909,  0,    0,    0,
-    976,  0,    0,    992,  0,    563,  0,    2679, 850,  0,    0,    0,    620,  2924, 0,    0,
-    2988, 1185, 1503, 0,    0,    0,    812,  2944, 0,    0,    0,    0,    0,    0,    0,    1516,
-    0,    0,    0,    0,    0,    350,  0,    330,  0,    487,  821,  2996, 0,    0,    0,    0,
-    457,  0,    0,    0,    949,  1948, 2806, 0,    0,    1695, 472,  0,    913,  0,    0,    2755,
-    0,    0,    0,    0,    101,  0,    0,    0,    0,    792,  1385, 0,    0,    1255, 0,    359,
-    0,    0,    0,    2877, 0,    0,    0,    0,    0,    209,  406,  216,  0,    2879, 0,    0,
-    0,    0,    0,    97,   2545, 1803, 0,    0,    2556, 615,  0,    0,    0,    0,    0,    0,
-    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    617,  0,    231,  1344, 2986, 1837,
-    0,    2610, 0,    0,    0,    0,    0,    1354, 0,    1177, 0,    0,    0,    0,    279,  0,
-    82,   169,  363,  0,    0,    0,    0,    1309, 0,    0,    0,    0,    0,    1077, 0,    151,
-    0,    0,    2288, 625,  0,    0,    1833, 1279, 0,    0,    0,    0,    271,  2784, 0,    2713,
-    0,    977,  1699, 0,    0,    0,    1559, 49,   0,    582,  0,    0,    0,    0,    0,    1277,
-    453,  0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    396,  462,  557,  0,
-    0,    0,    0,    0,    0,    90,   987,  511,  0,    0,    0,    625,  2485, 0,    0,    1270,
-    0,    207,  0,    0,    0,    1143, 0,    0,    0,    0,    0,    0,    0,    909,  0,    0,
-    0,    0,    2842, 0,    0,    387,  0,    1340, 0,    0,    0,    2394, 0,    0,    0,    0,
-    174,  0,    0,    0,    0,    0,    1074, 0,    0,    0,    2705, 0,    2684, 0,    0,    559,
-    365,  0,    0,    0,    2438, 380,  0,    0,    2240, 0,    0,    0,    0,    199,  0,    304,
-    651,  0,    0,    813,  0,    0,    0,    0,    0,    0,    645,  0,    0,    467,  255,  606,
-    0,    1136, 0,    0,    2958, 0,    2292, 0,    0,    0,    2621, 0,    0,    909,  2545, 0,
-    0,    0,    0,    0,    1165, 239,  0,    1158, 0,    0,    0,    0,    0,    1386, 877,  0,
-    0,    0,    0,    0,    0,    492,  0,    0,    2242, 0,    0,    826,  0,    2445, 0,    0,
-    0,    0,    0,    0,    21,   0,    0,    2819, 0,    0,    0,    0,    2487, 0,    0,    0,
-    0,    3060, 0,    3024, 4,    86,   935,  688,  3058, 520,  1294, 350,  0,    0,    0,    477,
-    2978, 0,    0,    0,    0,    472,  243,  0,    0,    0,    0,    149,  0,    0,    207,  0,
-    0,    0,    0,    0,    0,    0,    100,  0,    0,    407,  1107, 0,    489,  0,    0,    324,
-    517,  0,    0,    0,    0,    2705, 447,  350,  916,  0,    1189, 301,  0,    0,    0,    204,
-    418,  2636, 91,   894,  0,    30,   980,  0,    0,    0,    0,    3045, 0,    389,  755,  1612,
-    0,    3036, 0,    0,    0,    0,    697,  0,    0,    0,    1324, 0,    0,    804,  0,    1288,
-    0,    0,    189,  493,  0,    2363, 3046, 1679, 0,    0,    0,    2028, 0,    0,    0,    0,
-    605,  2657, 0,    2685, 0,    0,    0,    0,    0,    0,    2244, 0,    0,    0,    0,    0,
-    857,  0,    845,  0,    0,    720,  1790, 1010, 0,    0,    0,    0,    446,  0,    0,    0,
-    1184, 518,  2873, 0,    2187, 0,    0,    0,    0,    625,  0,    0,    0,    0,    2354, 0,
-    0,    1052, 0,    1062, 2671, 0,    0,    3004, 0,    342,  0,    1402, 0,    0,    2317, 0,
-    0,    0,    0,    185,  614,  1252, 1285, 3052, 238,  0,    1048, 246,  9,    0,    0,    0,
-    0,    0,    0,    95,   0,    569,  0,    910,  2504, 0,    289,  0,    0,    663,  214,  2800,
-    0,    0,    0,    939,  0,    0,    2798, 156,  362,  282,  0,    0,    223,  2054, 0,    0,
-    1024, 0,    524,  0,    0,    0,    0,    2603, 252,  1058, 58,   507,  0,    0,    0,    1201,
-    1294, 3003, 1050, 0,    0,    0,    1054, 0,    0,    748,  970,  2495, 538,  0,    1021, 2933,
-    0,    0,    0,    929,  415,  0,    3073, 0,    0,    769,  0,    0,    94,   3058, 0,    2462,
-    0,    0,    407,  595,  0,    0,    0,    392,  967,  0,    151,  311,  0,    447,  0,    0,
-    775,  80,   0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    1156, 0,    2843, 895,
-    0,    218,  0,    0,    0,    0,    0,    299,  0,    0,    0,    0,    0,    0,    0,    0,
-    0,    0,    159,  0,    2818, 0,    984,  0,    0,    2793, 0,    0,    0,    1280, 0,    0,
-    0,    64,   0,    0,    1025, 501,  0,    1373, 0,    0,    0,    0,    1249, 456,  388,  0,
-    639,  843,  530,  0,    67,   383,  0,    345,  0,    319,  2701, 1123, 0,    0,    0,    0,
-    552,  702,  2587, 0,    0,    0,    2055, 0,    2825, 0,    2578, 0,    1337, 0,    776,  0,
-    224,  915,  0,    0,    0,    2966, 0,    0,    0,    0,    1013, 544,  908,  1286, 276,  820,
-    415,  0,    635,  0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    633,  0,    1555,
-    758,  279,  948,  2802, 0,    732,  0,    1254, 0,    135,  1039, 0,    86,   1029, 0,    1110,
-    659,  0,    531,  0,    0,    0,    433,  97,   1308, 0,    0,    0,    55,   466,  1279, 725,
-    0,    0,    10,   0,    1348, 3045, 0,    0,    400,  0,    0,    0,    56,   0,    294,  449,
-    0,    0,    0,    0,    2778, 0,    0,    0,    0,    777,  540,  0,    0,    0,    1041, 2080,
-    0,    144,  426,  0,    2483, 2704, 0,    0,    0,    0,    0,    2617, 0,    0,    590,  0,
-    558,  0,    0,    0,    831,  1998, 0,    1302, 967,  0,    484,  200,  46,   0,    0,    0,
-    0,    0,    2650, 1661, 65,   0,    0,    2098, 0,    394,  507,  0,    0,    0,    0,    0,
-    474,  0,    567,  1726, 0,    386,  0,    0,    0,    1176, 0,    0,    54,   0,    864,  3063,
-    291,  0,    0,    246,  0,    1198, 0,    0,    1381, 0,    0,    2858, 0,    0,    1291, 0,
-    0,    0,    0,    1641, 2514, 0,    113,  756,  425,  0,    0,    2924, 0,    0,    1042, 0,
-    0,    0,    331,  772,  1031, 0,    0,    0,    2991, 0,    599,  0,    0,    1022, 1971, 0,
-    387,  0,    1034, 0,    440,  0,    1141, 0,    0,    0,    0,    0,    1080, 1744, 0,    0,
-    0,    2384, 1316, 0,    0,    1314, 0,    0,    0,    0,    1253, 1230, 1583, 0,    0,    718,
-    0,    1085, 270,  1343, 0,    1203, 610,  0,    2960, 2618, 0,    1081, 0,    0,    0,    0,
-    0,    479,  1036, 0,    522,  0,    0,    1120, 1533, 0,    3015, 64,   0,    1241, 0,    2932,
-    0,    148,  0,    3072, 0,    2390, 0,    0,    194,  0,    0,    0,    0,    0,    692,  473,
-    1264, 0,    2718, 0,    700,  600,  0,    565,  140,  2826, 0,    0,    37,   1337, 0,    1113,
-    0,    0,    0,    2473, 2655, 2500, 0,    505,  0,    0,    0,    0,    1178, 779,  369,  0,
-    1670, 338,  0,    0,    0,    0,    0,    1295, 458,  1972, 0,    1364, 0,    296,  1041, 0,
-    0,    105,  0,    433,  602,  1174, 0,    0,    963,  0,    0,    0,    0,    2373, 0,    4,
-    0,    2524, 3079, 178,  0,    0,    0,    2142, 0,    0,    0,    153,  88,   0,    393,  0,
-    800,  8,    624,  0,    0,    0,    0,    2296, 0,    0,    0,    679,  0,    392,  486,  0,
-    733,  0,    0,    2402, 232,  0,    507,  0,    308,  838,  1008, 0,    0,    0,    0,    0,
-    0,    765,  2859, 312,  0,    3065, 2347, 0,    132,  2978, 1222, 549,  0,    1317, 1394, 541,
-    328,  764,  572,  1032, 0,    421,  256,  15,   750,  292,  2914, 482,  846,  0,    364,  0,
-    40,   1215, 873,  1015, 1022, 0,    774,  0,    0,    269,  2286, 375,  426,  628,  2768, 0,
-    332,  0,    0,    0,    2307, 0,    987,  1319, 0,    204,  0,    0,    37,   0,    0,    241,
-    1023, 0,    918,  521,  0,    265,  1126, 238,  729,  534,  0,    0,    377,  748,  2009, 750,
-    393,  1399, 0,    0,    0,    214,  607,  0,    0,    2336, 1098, 0,    2349, 0,    872,  0,
-    448,  1043, 0,    871,  0,    0,    0,    0,    194,  2867, 677,  0,    0,    87,   475,  632,
-    0,    2000, 0,    0,    0,    0,    3009, 829,  752,  2926, 0,    1920, 0,    2,    570,  0,
-    0,    561,  2701, 2890, 3067, 242,  0,    0,    815,  0,    0,    313,  0,    0,    1073, 0,
-    1161, 0,    2753, 0,    0,    0,    0,    382,  0,    0,    0,    2768, 0,    1010, 0,    0,
-    577,  0,    2214, 568,  0,    132,  0,    0,    433,  0,    0,    0,    0,    1341, 1299, 1995,
-    3015, 0,    3086, 3058, 0,    1165, 0,    100,  0,    1361, 0,    0,    312,  11,   0,    0,
-    1830, 0,    2617, 0,    712,  0,    590,  913,  0,    0,    1199, 376,  77,   2889, 2834, 236,
-    0,    0,    2249, 0,    116,  0,    0,    0,    0,    1263, 0,    0,    1260, 844,  0,    0,
-    0,    1885, 0,    496,  0,    375,  0,    150,  2324, 0,    0,    0,    913,  148,  0,    0,
-    268,  1063, 0,    566,  0,    0,    553,  3040, 450,  508,  671,  0,    0,    453,  856,  1027,
-    616,  0,    1070, 0,    0,    0,    509,  0,    0,    866,  361,  0,    0,    0,    377,  1393,
-    0,    65,   0,    0,    180,  368,  0,    0,    0,    1072, 0,    0,    2470, 0,    0,    0,
-    0,    585,  370,  0,    0,    0,    836,  1091, 2013, 0,    0,    41,   447,  0,    0,    1061,
-    676,  0,    801,  648,  0,    0,    0,    0,    0,    0,    0,    1179, 2485, 959,  736,  529,
-    0,    618,  2630, 0,    0,    0,    1967, 902,  0,    0,    0,    213,  0,    185,  0,    0,
-    0,    1049, 628,  176,  374,  195,  996,  0,    54,   182,  0,    0,    118,  0,    0,    966,
-    105,  2922, 1205, 896,  0,    0,    666,  0,    0,    699,  0,    0,    177,  0,    0,    0,
-    0,    60,   0,    250,  0,    0,    0,    2454, 0,    321,  0,    0,    575,  0,    0,    922,
-    789,  1238, 840,  47,   0,    0,    0,    1274, 1130, 541,  44,   64,   444,  0,    511,  3068,
-    0,    0,    0,    271,  0,    1036, 0,    0,    0,    0,    494,  981,  0,    16,   1038, 2897,
-    1002, 0,    0,    1018, 574,  1188, 1138, 1018, 0,    1299, 138,  0,    3048, 847,  217,  604,
-    0,    1391, 0,    16,   665,  1238, 1060, 267,  303,  510,  193,  0,    739,  2235, 912,  221,
-    0,    630,  0,    1789, 0,    1066, 0,    938,  0,    0,    0,    320,  122,  1148, 0,    0,
-    427,  0,    55,   0,    1758, 0,    838,  582,  0,    734,  0,    747,  0,    951,  0,    0,
-    711,  521,  484,  0,    0,    0,    886,  0,    228,  0,    425,  0,    0,    0,    0,    0,
-    0,    0,    0,    2250, 0,    208,  2494, 0,    0,    0,    0,    0,    0,    787,  1382, 2866,
-    0,    0,    0,    0,    721,  949,  830,  1104, 0,    1159, 0,    2850, 2227, 2280, 124,  0,
-    0,    361,  0,    1170, 0,    650,  0,    0,    0,    477,  333,  1398, 1381, 0,    0,    0,
-    0,    0,    0,    0,    0,    0,    393,  941,  2687, 0,    3091, 0,    0,    57,   0,    0,
-    0,    0,    0,    0,    904,  1366, 1150, 278,  0,    175,  0,    0,    0,    0,    563,  0,
-    0,    1040, 0,    495,  791,  1156, 0,    0,    0,    2771, 0,    1258, 1206, 262,  853,  0,
-    455,  0,    410,  0,    149,  0,    556,  0,    212,  776,  265,  0,    0,    2963, 0,    0,
-    96,   0,    849,  566,  0,    0,    2726, 0,    0,    1016, 0,    2964, 755,  0,    326,  0,
-    2905, 815,  0,    912,  0,    481,  0,    1115, 513,  0,    2522, 0,    1169, 0,    590,  845,
-    2651, 1220, 0,    0,    0,    0,    694,  0,    0,    0,    924,  0,    0,    146,  1264, 0,
-    2384, 768,  0,    0,    0,    0,    106,  0,    1284, 463,  663,  794,  1357, 0,    1213, 1189,
-    0,    0,    25,   0,    0,    954,  0,    0,    2627, 0,    0,    3036, 0,    1344, 919,  498,
-    1303, 0,    0,    0,    0,    0,    582,  0,    527,  2735, 0,    2930, 522,  286,  0,    763,
-    2281, 0,    0,    0,    0,    1131, 1016, 0,    1245, 1223, 1041, 84,   0,    405,  877,  247,
-    276,  882,  0,    2402, 998,  784,  0,    781,  1395, 0,    0,    2991, 2720, 0,    2609, 2379,
-    0,    1627, 652,  777,  1265, 0,    1021, 1262, 0,    0,    791,  2494, 0,    401,  430,  0,
-    633,  0,    2403, 2436, 48,   1190, 0,    0,    0,    0,    2879, 2001, 0,    1328, 2224, 0,
-    2830, 1422, 0,    0,    0,    0,    0,    0,    0,    1410, 0,    0,    476,  0,    0,    1121,
-    1977, 0,    0,    0,    698,  0,    0,    0,    0,    842,  23,   793,  3049, 1309, 651,  0,
-    2394, 342,  0,    0,    688,  2015, 0,    0,    42,   0,    1511, 1278, 0,    0,    762,  1262,
-    1649, 808,  865,  0,    0,    0,    2945, 0,    1347, 0,    0,    0,    2991, 1201, 18,   0,
-    1363, 2281, 752,  0,    20,   0,    130,  297,  0,    136,  0,    1274, 670,  3088, 345,  3010,
-    2473, 0,    0,    0,    505,  1129, 672,  165,  837,  246,  0,    1237, 0,    1137, 0,    0,
-    0,    690,  0,    2994, 0,    0,    0,    509,  1256, 0,    2977, 0,    1175, 0,    0,    519,
-    52,   682,  50,   0,    0,    518,  1396, 0,    516,  0,    469,  0,    0,    29,   31,   520,
-    0,    0,    0,    0,    1107, 69,   514,  213,  346,  247,  0,    0,    0,    1934, 0,    0,
-    0,    1414, 2983, 0,    1346, 0,    2761, 840,  986,  863,  2814, 0,    0,    0,    0,    0,
-    2000, 0,    0,    361,  0,    0,    0,    36,   348,  359,  0,    2489, 0,    824,  1224, 527,
-    0,    529,  0,    276,  874,  0,    1035, 168,  0,    1481, 172,  2647, 0,    1934, 0,    0,
-    933,  306,  0,    0,    662,  1235, 0,    2988, 2394, 0,    0,    278,  0,    538,  0,    0,
-    1006, 0,    526,  0,    534,  0,    0,    0,    0,    0,    197,  126,  0,    691,  0,    1003,
-    0,    2412, 528,  1136, 848,  308,  18,   347,  0,    2526, 0,    2867, 3090, 1086, 917,  0,
-    0,    0,    0,    1081, 0,    1128, 0,    0,    0,    717,  2805, 2583, 0,    290,  1687, 124,
-    1117, 182,  0,    0,    0,    0,    0,    0,    0,    0,    554,  850,  67,   687,  747,  7,
-    994,  2813, 1329, 0,    2507, 0,    0,    0,    0,    757,  2974, 0,    409,  0,    866,  2779,
-    97,   0,    1370, 244,  1359, 0,    1059, 2638, 870,  0,    31,   0,    1172, 0,    700,  1217,
-    0,    541,  1152, 851,  0,    2605, 0,    0,    0,    1298, 0,    0,    596,  13,   0,    0,
-    543,  2311, 755,  180,  1219, 0,    0,    94,   2921, 116,  293,  313,  0,    1321, 716,  0,
-    625,  2624, 689,  0,    1211, 0,    0,    1208, 0,    248,  0,    109,  3006, 2316, 156,  368,
-    0,    613,  109,  0,    602,  0,    0,    0,    0,    0,    1218, 2952, 0,    2390, 0,    0,
-    0,    0,    0,    2293, 0,    112,  0,    1901, 729,  2240, 485,  0,    939,  1246, 1283, 305,
-    2988, 0,    0,    213,  0,    0,    2716, 1289, 832,  0,    0,    653,  2775, 0,    1292, 0,
-    1166, 0,    3028, 319,  638,  152,  0,    597,  512,  0,    0,    547,  0,    545,  191,  1353,
-    451,  0,    1031, 239,  2363, 0,    1149, 0,    744,  944,  0,    0,    0,    0,    256,  0,
-    0,    0,    2641, 0,    1187, 758,  0,    0,    316,  0,    706,  2335, 0,    534,  0,    0,
-    51,   0,    98,   2959, 2928, 1217, 1111, 0,    0,    0,    720,  0,    644,  0,    2653, 0,
-    710,  308,  0,    908,  387,  0,    27,   0,    2968, 0,    2664, 0,    380,  1963, 1154, 0,
-    0,    847,  631,  1311, 0,    1063, 1398, 0,    397,  0,    2896, 522,  0,    0,    727,  0,
-    0,    0,    0,    0,    908,  0,    230,  413,  0,    0,    0,    1123, 880,  271,  0,    2323,
-    0,    1369, 0,    197,  235,  999,  0,    1365, 921,  176,  127,  0,    0,    1231, 0,    1473,
-    3017, 2584, 822,  0,    379,  0,    1341, 0,    598,  0,    1387, 10,   0,    0,    357,  2963,
-    0,    0,    0,    725,  764,  0,    0,    0,    0,    8,    1159, 0,    0,    2897, 591,  578,
-    0,    170,  1273, 219,  0,    1517, 0,    0,    554,  0,    0,    0,    0,    1079, 1372, 0,
-    3000, 75,   982,  0,    0,    0,    0,    0,    0,    295,  2181, 0,    503,  1361, 903,  0,
-    0,    722,  622,  38,   339,  0,    830,  2794, 490,  2377, 0,    1076, 13,   0,    2784, 0,
-    3014, 0,    0,    1225, 420,  1153, 1275, 489,  2480, 806,  0,    1878, 162,  1307, 0,    576,
-    2943, 1330, 1405, 672,  164,  0,    61,   1597, 1310, 0,    0,    345,  2504, 787,  722,  0,
-    49,   745,  207,  2713, 43,   344,  408,  851,  774,  1054, 1296, 245,  1562, 2997, 606,  0,
-    0,    738,  0,    506,  437,  0,    120,  1087, 0,    1396, 478,  0,    2326, 2266, 125,  0,
-    366,  381,  412,  991,  287,  0,    1037, 0,    782,  1378, 0,    3002, 0,    2071, 2357, 1214,
-    0,    473,  0,    889,  685,  0,    753,  0,    2520, 648,  1090, 0,    0,    3009, 0,    0,
-    0,    0,    0,    0,    2692, 385,  0,    463,  1196, 0,    0,    0,    0,    0,    27,   0,
-    2532, 219,  1028, 140,  0,    0,    0,    908,  1313, 720,  775,  0,    727,  611,  503,  0,
-    0,    0,    2774, 0,    675,  2906, 0,    0,    0,    545,  1302, 0,    0,    636,  0,    431,
-    2885, 903,  597,  1390, 0,    1251, 1803, 710,  2415, 0,    0,    2918, 3034, 426,  412,  2355,
-    564,  1051, 1383, 654,  0,    1313, 1290, 107,  3,    1350, 0,    79,   2956, 1560, 0,    686,
-    2883, 810,  0,    1014, 0,    0,    0,    0,    1158, 3079, 1409, 337,  0,    0,    419,  749,
-    0,    736,  0,    736,  0,    334,  0,    0,    636,  0,    0,    0,    2402, 642,  0,    1254,
-    0,    23,   155,  1027, 335,  847,  0,    929,  0,    349,  3007, 884,  866,  2179, 354,  1114,
-    1005, 562,  963,  34,   1825, 783,  0,    0,    215,  0,    0,    0,    0,    0,    821,  1091,
-    12,   467,  0,    3079, 476,  70,   0};
+constexpr uint64_t kHashMultiplier = 0x9E3779B97F4A7C15ull;
 
-int MangledHashG(const char *key, const int *T)
+// Loads eight characters as a little-endian word, so that the hash doesn't depend on endianness.
+// Compilers turn this into a single load on little-endian targets.
+uint64_t LoadWord(const char *chars)
 {
-    int sum = 0;
-
-    for (int i = 0; key[i] != '\0'; i++)
-    {
-        sum += T[i] * key[i];
-        sum %= 3095;
-    }
-    return mangledkG[sum];
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(chars);
+    return static_cast<uint64_t>(bytes[0]) | static_cast<uint64_t>(bytes[1]) << 8 |
+           static_cast<uint64_t>(bytes[2]) << 16 | static_cast<uint64_t>(bytes[3]) << 24 |
+           static_cast<uint64_t>(bytes[4]) << 32 | static_cast<uint64_t>(bytes[5]) << 40 |
+           static_cast<uint64_t>(bytes[6]) << 48 | static_cast<uint64_t>(bytes[7]) << 56;
 }
 
-int MangledPerfectHash(const char *key)
+uint64_t MixWord(uint64_t hash, uint64_t word)
 {
-    if (strlen(key) > 40)
-        return 0;
-
-    return (MangledHashG(key, mangledkT1) + MangledHashG(key, mangledkT2)) % 3095;
+    hash = (hash ^ word) * kHashMultiplier;
+    return hash ^ (hash >> 29);
 }
 
-constexpr int unmangledkT1[] = {53,  156, 228, 135, 85,  200, 308, 47,  117, 99,  187,
-                                257, 305, 21,  220, 255, 10,  218, 9,   99,  259, 11,
-                                43,  302, 271, 114, 195, 193, 62,  228, 44,  7};
-constexpr int unmangledkT2[] = {67,  290, 208, 97,  70,  82,  264, 152, 151, 235, 251,
-                                175, 142, 150, 284, 300, 144, 40,  123, 146, 115, 212,
-                                42,  134, 50,  296, 137, 83,  183, 254, 120, 108};
-constexpr int unmangledkG[]  = {
-    0,   0,   0,   0,   313, 0,   0,   198, 0,   0,   78,  26,  0,   0,   0,   93,  0,   148, 305,
-    0,   0,   126, 0,   0,   0,   0,   0,   0,   0,   63,  302, 0,   0,   0,   161, 287, 0,   215,
-    0,   0,   120, 0,   206, 141, 44,  49,  285, 7,   0,   0,   0,   0,   0,   0,   0,   296, 0,
-    0,   172, 0,   243, 0,   288, 0,   129, 173, 0,   71,  0,   0,   137, 0,   277, 0,   68,  0,
-    0,   0,   206, 0,   0,   0,   0,   32,  0,   0,   104, 221, 90,  0,   167, 0,   0,   0,   135,
-    0,   263, 0,   176, 0,   70,  0,   71,  0,   50,  0,   187, 90,  0,   0,   1,   205, 0,   0,
-    82,  131, 130, 56,  0,   60,  0,   0,   0,   0,   42,  308, 102, 69,  0,   151, 154, 0,   166,
-    85,  58,  0,   39,  22,  77,  0,   48,  0,   33,  199, 93,  220, 95,  0,   0,   153, 74,  260,
-    0,   271, 0,   311, 141, 0,   310, 0,   0,   263, 150, 0,   94,  308, 111, 0,   14,  82,  103,
-    0,   111, 0,   42,  259, 107, 66,  55,  287, 0,   133, 273, 4,   249, 0,   4,   234, 0,   23,
-    211, 258, 74,  128, 133, 0,   0,   21,  0,   0,   0,   7,   0,   9,   125, 288, 44,  0,   0,
-    131, 0,   84,  0,   18,  9,   66,  139, 0,   64,  0,   0,   129, 60,  17,  4,   0,   0,   70,
-    0,   111, 73,  274, 275, 0,   309, 251, 130, 132, 0,   0,   117, 0,   0,   129, 0,   176, 36,
-    0,   240, 0,   0,   0,   231, 29,  80,  65,  153, 0,   111, 76,  141, 115, 73,  1,   0,   1,
-    35,  60,  63,  130, 67,  305, 0,   0,   68,  28,  136, 75,  211, 61,  165, 97,  140, 2,   248,
-    0,   43,  0,   14,  0,   0,   8,   164, 0,   0,   100, 0,   12,  282, 212, 0,   126, 0,   123,
-    47,  0,   64,  0,   268, 0,   0,   5,   0,   299, 57,  175};
-
-int UnmangledHashG(const char *key, const int *T)
+// Hashes the name eight characters at a time.  Unless the name is shorter than that, the last word
+// overlaps the previous one instead of being padded.
+uint64_t HashName(const char *name, size_t length, uint64_t seed)
 {
-    int sum = 0;
+    uint64_t hash = seed ^ (length * kHashMultiplier);
 
-    for (int i = 0; key[i] != '\0'; i++)
+    if (length < 8)
+    {
+        uint64_t word = 0;
+        for (size_t index = 0; index < length; ++index)
+        {
+            word |= static_cast<uint64_t>(static_cast<uint8_t>(name[index])) << (index * 8);
+        }
+        hash = MixWord(hash, word);
+    }
+    else
     {
-        sum += T[i] * key[i];
-        sum %= 316;
+        for (size_t offset = 0; offset + 8 < length; offset += 8)
+        {
+            hash = MixWord(hash, LoadWord(name + offset));
+        }
+        hash = MixWord(hash, LoadWord(name + length - 8));
     }
-    return unmangledkG[sum];
+
+    hash *= kHashMultiplier;
+    return hash ^ (hash >> 32);
 }
 
-int UnmangledPerfectHash(const char *key)
+// The two halves of the name hash select two vertices of the graph built by
+// gen_builtin_symbols.py, whose labels add up to the index of the name in the built-in tables.
+template <size_t kGraphSize>
+uint32_t GraphLabelSum(const char *name,
+                       size_t length,
+                       uint64_t seed,
+                       const uint16_t (&labels)[kGraphSize])
 {
-    if (strlen(key) > 32)
-        return 0;
-
-    return (UnmangledHashG(key, unmangledkT1) + UnmangledHashG(key, unmangledkT2)) % 316;
+    const uint64_t hash    = HashName(name, length, seed);
+    const uint64_t vertex1 = ((hash >> 32) * kGraphSize) >> 32;
+    const uint64_t vertex2 = ((hash & 0xFFFFFFFFu) * kGraphSize) >> 32;
+    return labels[vertex1] + labels[vertex2];
 }
 
-}  // namespace
+constexpr uint64_t kMangledSeed = 1;
+
+constexpr uint16_t kMangledGraphLabels[] = {
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    656,  0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    55,   0,    0,
+    0,    0,    0,    1224, 0,    0,    1086, 0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    119,  0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    601,  0,    128,  0,    1108, 0,
+    45,   0,    0,    0,    0,    0,    0,    0,    0,    452,  0,    0,    155,  403,  0,    955,
+    695,  0,    0,    0,    0,    0,    1076, 0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    297,  0,    308,  0,    491,  1416, 0,    0,    0,    0,    0,    0,    1042,
+    451,  1341, 0,    0,    0,    1167, 0,    0,    1366, 0,    146,  0,    0,    0,    0,    94,
+    0,    0,    0,    0,    0,    0,    0,    0,    1219, 0,    0,    0,    0,    1398, 0,    0,
+    0,    0,    733,  0,    0,    0,    0,    0,    0,    0,    264,  794,  92,   0,    0,    0,
+    0,    600,  1154, 0,    0,    0,    0,    0,    0,    0,    91,   0,    0,    0,    0,    0,
+    0,    0,    0,    42,   0,    0,    0,    0,    0,    0,    0,    669,  0,    0,    944,  0,
+    0,    0,    0,    0,    0,    0,    841,  0,    0,    0,    753,  0,    0,    0,    0,    34,
+    0,    838,  0,    0,    905,  245,  0,    1013, 0,    141,  0,    367,  944,  0,    905,  0,
+    717,  1384, 0,    0,    0,    0,    0,    0,    418,  0,    0,    0,    0,    0,    796,  0,
+    0,    863,  0,    0,    990,  0,    0,    377,  903,  0,    0,    0,    583,  0,    461,  118,
+    0,    0,    0,    0,    0,    0,    0,    0,    74,   0,    0,    0,    0,    0,    0,    1369,
+    0,    0,    1394, 485,  1370, 861,  289,  0,    0,    0,    616,  453,  1097, 0,    0,    0,
+    0,    0,    1025, 0,    751,  0,    0,    363,  845,  0,    0,    0,    0,    0,    0,    0,
+    0,    0,    0,    223,  198,  0,    1082, 0,    1399, 0,    0,    0,    0,    1169, 0,    0,
+    0,    0,    171,  0,    761,  37,   1193, 0,    0,    1199, 647,  0,    0,    1213, 0,    1020,
+    0,    0,    619,  1010, 0,    0,    0,    753,  0,    0,    0,    0,    756,  0,    0,    1241,
+    0,    1122, 0,    0,    486,  0,    1269, 941,  0,    0,    0,    0,    292,  0,    978,  942,
+    0,    869,  0,    0,    563,  0,    0,    0,    1125, 0,    0,    5,    179,  0,    0,    0,
+    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    526,  0,    0,    173,  0,
+    0,    0,    902,  630,  0,    1134, 0,    0,    0,    0,    0,    1231, 0,    0,    0,    0,
+    0,    763,  754,  0,    1326, 1330, 328,  0,    0,    1086, 0,    160,  0,    0,    436,  562,
+    0,    0,    0,    0,    0,    0,    1048, 0,    1258, 0,    0,    0,    1163, 0,    0,    0,
+    0,    1049, 0,    0,    1329, 0,    0,    1276, 0,    1417, 0,    0,    0,    0,    0,    0,
+    0,    0,    414,  0,    0,    661,  1374, 0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    0,    913,  0,    0,    87,   780,  1344, 0,    0,    218,  0,    0,    0,    0,    0,
+    0,    0,    1224, 601,  0,    0,    0,    0,    0,    0,    0,    0,    0,    773,  1065, 0,
+    0,    975,  1285, 613,  1212, 0,    0,    1018, 0,    0,    0,    0,    0,    0,    0,    685,
+    0,    1269, 0,    470,  0,    0,    0,    0,    965,  0,    0,    232,  0,    0,    1207, 1052,
+    0,    0,    917,  1026, 0,    1362, 582,  0,    0,    737,  1175, 0,    377,  0,    0,    0,
+    0,    0,    0,    0,    1210, 0,    0,    0,    1333, 241,  35,   0,    0,    0,    0,    389,
+    0,    1339, 0,    0,    0,    84,   0,    0,    0,    0,    0,    0,    0,    0,    185,  0,
+    0,    0,    902,  0,    765,  525,  0,    0,    0,    1227, 981,  1346, 0,    349,  0,    1146,
+    0,    0,    0,    1020, 1020, 0,    0,    0,    0,    683,  0,    0,    804,  118,  0,    0,
+    0,    0,    750,  344,  301,  1267, 0,    396,  250,  157,  776,  0,    0,    1375, 0,    0,
+    0,    0,    0,    0,    586,  355,  769,  0,    68,   1066, 758,  0,    0,    1422, 0,    347,
+    1021, 0,    0,    0,    1131, 0,    1011, 0,    1345, 0,    315,  445,  1172, 0,    1076, 0,
+    0,    0,    0,    427,  0,    0,    1102, 45,   1275, 0,    0,    112,  143,  0,    0,    21,
+    0,    0,    0,    0,    0,    0,    366,  0,    0,    260,  335,  0,    0,    775,  0,    1026,
+    1391, 664,  0,    431,  0,    0,    53,   1097, 0,    0,    1362, 0,    0,    0,    0,    0,
+    0,    0,    469,  431,  1143, 1221, 260,  0,    0,    480,  888,  0,    0,    529,  207,  0,
+    66,   0,    0,    1371, 707,  0,    761,  0,    500,  723,  156,  1244, 135,  2,    0,    0,
+    1183, 0,    0,    732,  0,    1346, 0,    581,  199,  0,    1274, 0,    0,    0,    0,    0,
+    0,    0,    1258, 489,  366,  0,    352,  917,  691,  170,  420,  730,  586,  0,    0,    0,
+    0,    0,    0,    0,    1097, 95,   0,    0,    0,    14,   568,  359,  947,  0,    64,   0,
+    213,  0,    930,  0,    1102, 0,    901,  0,    0,    1334, 0,    202,  375,  0,    0,    0,
+    160,  0,    0,    209,  0,    567,  0,    234,  242,  0,    0,    517,  458,  0,    1418, 0,
+    0,    0,    0,    0,    0,    608,  0,    0,    915,  0,    0,    1250, 135,  0,    0,    831,
+    510,  1252, 0,    1171, 346,  779,  0,    550,  535,  0,    486,  778,  859,  0,    937,  1058,
+    0,    0,    0,    946,  887,  1254, 0,    1309, 0,    545,  78,   2,    0,    0,    0,    0,
+    0,    618,  353,  0,    711,  1192, 1059, 568,  0,    0,    1044, 481,  0,    0,    0,    286,
+    0,    0,    0,    0,    0,    0,    0,    125,  0,    0,    1034, 0,    0,    0,    758,  0,
+    0,    0,    1126, 1076, 539,  0,    483,  493,  976,  0,    184,  0,    32,   0,    989,  0,
+    632,  346,  0,    1077, 1155, 594,  0,    1158, 0,    0,    158,  0,    0,    0,    0,    1197,
+    100,  1001, 531,  0,    1151, 0,    965,  1261, 0,    534,  0,    0,    0,    811,  500,  0,
+    0,    0,    0,    0,    0,    554,  0,    370,  0,    0,    0,    687,  0,    0,    1080, 247,
+    0,    0,    0,    976,  0,    0,    1249, 797,  0,    0,    0,    0,    0,    0,    708,  0,
+    0,    336,  239,  1014, 1060, 711,  0,    999,  960,  0,    964,  0,    0,    940,  0,    0,
+    676,  897,  509,  24,   1282, 0,    540,  240,  752,  1286, 0,    853,  0,    0,    484,  1324,
+    68,   0,    911,  0,    0,    1004, 675,  430,  0,    1016, 0,    848,  331,  0,    353,  0,
+    0,    1158, 0,    0,    0,    0,    604,  678,  345,  0,    0,    0,    0,    471,  1094, 0,
+    356,  0,    386,  551,  0,    0,    1113, 0,    176,  0,    0,    0,    1123, 731,  0,    0,
+    45,   893,  343,  814,  9,    0,    0,    0,    0,    0,    0,    0,    0,    0,    51,   0,
+    0,    487,  0,    0,    1317, 0,    637,  0,    0,    170,  0,    0,    0,    1234, 429,  1146,
+    618,  967,  229,  1308, 459,  0,    0,    0,    0,    0,    1284, 1055, 943,  0,    0,    1223,
+    1067, 1291, 0,    0,    412,  31,   486,  182,  394,  523,  0,    0,    1364, 0,    0,    1225,
+    957,  0,    0,    142,  738,  1421, 1096, 445,  0,    0,    1302, 809,  682,  1069, 0,    1275,
+    0,    0,    0,    233,  0,    1025, 1045, 254,  633,  986,  0,    1132, 0,    489,  509,  0,
+    0,    0,    1203, 297,  0,    0,    620,  0,    0,    0,    164,  881,  0,    860,  397,  0,
+    0,    0,    1400, 1328, 0,    0,    0,    0,    733,  0,    373,  705,  0,    1271, 607,  1350,
+    807,  0,    0,    1018, 1301, 708,  1138, 0,    987,  1216, 0,    0,    878,  593,  0,    570,
+    949,  1348, 0,    818,  0,    0,    0,    82,   0,    678,  0,    0,    0,    795,  882,  795,
+    0,    0,    692,  0,    1173, 0,    0,    0,    0,    0,    820,  35,   603,  693,  0,    0,
+    1344, 0,    0,    751,  1135, 1202, 998,  822,  144,  0,    437,  0,    98,   0,    0,    373,
+    944,  308,  287,  359,  0,    998,  960,  327,  0,    286,  463,  0,    0,    177,  0,    1271,
+    603,  0,    1040, 0,    0,    0,    0,    905,  0,    0,    0,    0,    354,  434,  0,    1047,
+    0,    16,   662,  702,  0,    0,    17,   383,  0,    1387, 0,    1328, 0,    1375, 0,    0,
+    0,    813,  323,  531,  856,  0,    1055, 0,    0,    783,  0,    0,    0,    174,  0,    1091,
+    699,  967,  961,  900,  548,  5,    216,  0,    0,    0,    0,    0,    0,    0,    0,    0,
+    0,    340,  0,    0,    0,    1279, 0,    0,    0,    0,    0,    205,  0,    0,    0,    0,
+    1127, 689,  0,    0,    0,    1398, 563,  0,    378,  460,  993,  1157, 882,  0,    0,    504,
+    632,  0,    0,    0,    832,  0,    0,    0,    0,    0,    1255, 935,  572,  1185, 447,  335,
+    1391, 581,  1109, 0,    0,    0,    846,  0,    1134, 653,  0,    701,  211,  0,    0,    0,
+    518,  62,   0,    0,    0,    4,    638,  1228, 0,    1051, 0,    0,    0,    0,    0,    0,
+    0,    584,  1294, 1221, 1397, 938,  810,  0,    712,  1269, 651,  0,    0,    0,    0,    840,
+    0,    0,    783,  463,  755,  0,    0,    0,    1302, 0,    0,    0,    0,    0,    0,    1331,
+    936,  0,    549,  1407, 627,  659,  1013, 0,    524,  676,  825,  0,    0,    0,    1258, 0,
+    1044, 460,  0,    623,  464,  734,  0,    821,  0,    917,  0,    0,    0,    0,    348,  0,
+    0,    1371, 1281, 0,    1149, 298,  521,  0,    1204, 0,    995,  0,    318,  410,  0,    593,
+    485,  0,    0,    0,    1411, 0,    1178, 1289, 0,    252,  1080, 409,  0,    379,  0,    0,
+    316,  35,   186,  0,    1083, 0,    0,    933,  750,  633,  0,    780,  46,   0,    0,    310,
+    724,  956,  0,    0,    0,    147,  301,  0,    206,  608,  0,    736,  0,    0,    0,    561,
+    405,  385,  0,    0,    0,    258,  684,  18,   1119, 0,    0,    0,    0,    0,    1311, 443,
+    1077, 0,    0,    0,    951,  0,    0,    0,    0,    1354, 0,    0,    0,    854,  918,  0,
+    0,    0,    0,    0,    0,    1408, 0,    0,    1000, 977,  933,  163,  0,    0,    1115, 0,
+    194,  503,  87,   1151, 3,    0,    0,    0,    0,    1296, 0,    1180, 0,    102,  107,  0,
+    1071, 796,  0,    210,  249,  0,    0,    0,    455,  392,  6,    880,  645,  0,    934,  0,
+    0,    0,    876,  0,    620,  1078, 978,  99,   1240, 951,  832,  0,    0,    0,    0,    970,
+    0,    662,  12,   0,    1036, 0,    342,  767,  0,    55,   0,    197,  303,  0,    0,    0,
+    873,  0,    1314, 0,    755,  1070, 686,  0,    1370, 0,    1270, 0,    1005, 158,  0,    0,
+    696,  266,  506,  456,  272,  0,    50,   1232, 1251, 704,  216,  20,   0,    0,    0,    0,
+    0,    746,  1055, 0,    914,  0,    0,    1312, 0,    1197, 0,    1208, 853,  0,    893,  0,
+    536,  434,  734,  0,    368,  621,  0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    578,  663,  122,  0,    762,  0,    1160, 0,    1206, 0,    1226, 0,    199,  1207, 764,  1257,
+    0,    1264, 493,  4,    637,  277,  0,    829,  0,    0,    0,    0,    787,  0,    405,  231,
+    0,    1235, 0,    0,    0,    246,  187,  750,  0,    0,    1043, 924,  718,  0,    162,  0,
+    0,    0,    1370, 0,    926,  882,  0,    52,   103,  453,  589,  0,    745,  1393, 0,    0,
+    0,    1342, 670,  0,    116,  1136, 285,  0,    846,  1121, 0,    329,  386,  0,    622,  0,
+    1368, 0,    0,    0,    80,   501,  653,  0,    565,  779,  0,    0,    1018, 817,  0,    0,
+    0,    33,   1299, 0,    367,  324,  0,    862,  567,  0,    1213, 314,  174,  1260, 0,    0,
+    0,    0,    0,    0,    0,    871,  0,    299,  883,  1170, 0,    910,  1000, 618,  0,    0,
+    432,  218,  918,  982,  0,    510,  0,    425,  1374, 0,    0,    0,    919,  0,    827,  233,
+    0,    813,  511,  0,    0,    0,    0,    1387, 0,    0,    646,  0,    0,    343,  743,  1081,
+    781,  63,   0,    69,   927,  0,    108,  264,  337,  0,    0,    0,    0,    0,    801,  419,
+    135,  516,  0,    747,  1214, 1141, 320,  0,    0,    1014, 0,    0,    1027, 1331, 0,    1291,
+    0,    55,   571,  0,    0,    786,  593,  0,    935,  0,    1240, 1213, 418,  0,    0,    0,
+    602,  0,    0,    1148, 0,    86,   0,    0,    0,    579,  0,    360,  0,    1077, 231,  0,
+    0,    1032, 1349, 0,    311,  0,    0,    905,  575,  0,    0,    0,    1064, 1334, 139,  1367,
+    0,    604,  1278, 0,    931,  15,   0,    1124, 916,  227,  546,  0,    339,  1237, 421,  0,
+    0,    1321, 1129, 362,  725,  0,    105,  1303, 0,    0,    0,    920,  0,    0,    0,    327,
+    734,  346,  1159, 0,    0,    0,    1372, 1118, 0,    0,    0,    1242, 0,    0,    1037, 0,
+    510,  0,    0,    0,    615,  0,    0,    54,   0,    0,    0,    0,    1010, 471,  0,    981,
+    263,  0,    1173, 0,    0,    251,  492,  1316, 0,    0,    543,  445,  0,    751,  178,  710,
+    668,  0,    1268, 377,  0,    612,  0,    183,  903,  319,  0,    94,   0,    892,  0,    448,
+    1299, 23,   226,  910,  1087, 216,  0,    663,  543,  36,   159,  0,    0,    1379, 300,  1350,
+    772,  0,    1172, 276,  151,  0,    30,   224,  0,    588,  664,  0,    0,    898,  0,    0,
+    302,  0,    0,    0,    0,    1053, 1009, 0,    806,  0,    0,    867,  1296, 0,    0,    0,
+    0,    0,    0,    559,  1198, 0,    180,  0,    0,    0,    1188, 0,    1289, 1384, 0,    0,
+    338,  0,    1239, 358,  321,  0,    445,  0,    167,  1109, 0,    895,  0,    0,    388,  0,
+    188,  907,  706,  94,   1324, 0,    0,    763,  0,    0,    482,  934,  1155, 589,  1077, 0,
+    1093, 877,  0,    621,  418,  632,  0,    3,    855,  803,  0,    0,    839,  1412, 0,    1225,
+    645,  82,   0,    0,    1218, 0,    277,  1165, 474,  454,  0,    0,    0,    174,  71,   96,
+    154,  0,    1358, 0,    1,    833,  679,  647,  0,    870,  1101, 369,  1172, 828,  0,    68,
+    385,  129,  770,  695,  733,  0,    0,    0,    0,    645,  185,  1081, 985,  0,    777,  1006,
+    0,    0,    1367, 0,    0,    1009, 1132, 328,  603,  0,    0,    925,  0,    952,  144,  609,
+    0,    723,  0,    989,  1137, 566,  1353, 0,    626,  395,  649,  0,    262,  1038, 918,  367,
+    947,  0,    0,    0,    0,    0,    0,    0,    0,    0,    1282, 1171, 1039, 604,  1378, 843,
+    0,    802,  950,  0,    877,  0,    1100, 1088, 0,    182,  1104, 486,  181,  0,    1042, 459,
+    290,  136,  0,    849,  842,  1040, 193,  0,    0,    0,    0,    0,    347,  0,    1269, 884,
+    442,  0,    873,  0,    0,    0,    0,    980,  0,    1252, 594,  0,    0,    876,  0,    0,
+    643,  0,    0,    459,  1209, 974,  0,    1373, 321,  741,  0,    932,  0,    409,  444,  1386,
+    0,    322,  659,  399,  483,  684,  0,    110,  0,    0,    522,  1157, 1405, 212,  1009, 0,
+    323,  1281, 1371, 0,    0,    520,  524,  86,   0,    0,    1263, 240,  0,    404,  0,    0,
+    0,    0,    622,  72,   492,  90,   483,  0,    836,  1260, 831,  1014, 0,    0,    0,    0,
+    774,  0,    759,  539,  948,  200,  413,  1324, 278,  0,    138,  406,  771,  729,  0,    0,
+    0,    1315, 0,    1171, 0,    574,  718,  834,  1302, 0,    0,    0,    0,    1137, 1301, 615,
+    0,    649,  0,    987,  1234, 0,    781,  1298, 0,    440,  467,  647,  1061, 839,  0,    368,
+    0,    935,  1353, 0,    1184, 204,  1175, 0,    1342, 451,  1327, 0,    0,    0,    300,  0,
+    473,  146,  995,  0,    0,    0,    61,   116,  0,    1332, 80,   0,    605,  0,    0,    791,
+    0,    1196, 0,    449,  19,   908,  1223, 814,  0,    749,  935,  1260, 0,    0,    67,   0,
+    1347, 543,  754,  0,    352,  274,  0,    900,  0,    0,    1046, 1209, 0,    142,  0,    1179,
+    0,    700,  814,  0,    1405, 472,  1175, 387,  0,    0,    0,    1158, 546,  563,  0,    171,
+    0,    252,  803,  0,    0,    0,    0,    0,    0,    942,  0,    0,    1421, 0,    0,    0,
+    0,    829,  0,    1256, 0,    364,  940,  0,    976,  710,  0,    0,    0,    529,  1374, 130,
+    513,  337,  0,    544,  0,    0,    0,    0,    0,    0,    49,   0,    0,    0,    501,  0,
+    514,  0,    323,  93,   730,  0,    0,    727,  864,  0,    1125, 676,  119,  342,  0,    450,
+    0,    0,    779,  0,    0,    618,  0,    0,    0,    1214, 1277, 416,  834,  725,  1378, 1023,
+    0,    0,    0,    929,  1200, 579,  0,    1042, 0,    790,  382,  0,    0,    19,   0,    1333,
+    874,  0,    0,    810,  1166, 728,  1322, 395,  215,  156,  280,  0,    52,   0,    0,    0,
+    163,  0,    0,    0,    0,    0,    0,    0,    0,    37,   184,  0,    282,  0,    969,  439,
+    0,    209,  618,  0,    1047, 1402, 90,   1048, 765,  0,    1124, 0,    1197, 784,  0,    0,
+    0,    1157, 446,  831,  0,    0,    0,    0,    1006, 202,  1350, 0,    315,  0,    266,  1335,
+    0,    371,  0,    0,    1189, 0,    507,  0,    1225, 0,    58,   609,  0,    0,    0,    0,
+    0,    856,  0,    497,  760,  0,    0,    424,  0,    19,   0,    204,  972,  0,    162,  1249,
+    321,  0,    438,  0,    1232, 0,    1367, 0,    325,  0,    1385, 1331, 1363, 0,    0,    845,
+    1421, 0,    282,  1414, 295,  0,    119,  0,    957,  0,    867,  0,    710,  16,   744,  854,
+    1067, 0,    0,    480,  1317, 185,  37,   1406, 447,  0,    587,  1241, 445,  149,  439,  1320,
+    457,  0,    0,    177,  0,    0,    0,    910,  0,    0,    188,  0,    1199, 789,  1382, 20,
+    980,  439,  0,    540,  0,    0,    0,    402,  0,    503,  1154, 0,    653,  1000, 1075, 0,
+    0,    0,    703,  0,    0,    251,  623,  511,  572,  0,    1396, 1048, 0,    443,  1004, 1390,
+    435,  0,    0,    447,  476,  0,    31,   0,    0,    920,  0,    131,  0,    0,    339,  1169,
+    0,    0,    0,    0,    189,  0,    562,  0,    1288, 624,  1012, 1070, 0,    0,    702,  568,
+    1420, 123,  649,  352,  0,    75,   248,  346,  0,    538,  0,    0,    389,  0,    0,    0,
+    0,    0,    633,  0,    0,    564,  725,  0,    357,  0,    571,  0,    0,    671,  32,   0,
+    0,    0,    0,    1418, 1141, 309,  0,    0,    51,   187,  883,  1220, 0,    169,  0,    1281,
+    645,  1038, 1373, 675,  0,    0,    0,    0,    0,    1419, 552,  1313, 9,    208,  763,  0,
+    1029, 0,    772,  0,    375,  0,    994,  1112, 1061, 1083, 655,  895,  0,    1310, 17,   1057,
+    1355, 1412, 0,    590,  201,  855,  1209, 1412, 0,    919,  91,   132,  128,  0,    658,  1078,
+    499,  587,  0,    0,    432,  906,  1121, 133,  1156, 1170, 0,    901,  201};
+
+constexpr uint64_t kUnmangledSeed = 0;
+
+constexpr uint16_t kUnmangledGraphLabels[] = {
+    0,   0,   0,   0,   0,   0,   45,  0,   94,  0,   0,   104, 0,   74,  0,   0,   0,   0,   0,
+    0,   117, 0,   53,  0,   0,   0,   85,  0,   0,   0,   0,   0,   75,  0,   0,   162, 71,  68,
+    0,   0,   0,   0,   89,  0,   0,   0,   0,   0,   80,  0,   161, 24,  22,  0,   0,   110, 0,
+    0,   107, 0,   130, 0,   124, 0,   0,   6,   118, 0,   140, 152, 0,   136, 0,   169, 0,   0,
+    0,   0,   0,   0,   89,  0,   156, 0,   0,   39,  78,  0,   147, 0,   0,   25,  0,   0,   172,
+    0,   0,   0,   159, 0,   0,   129, 0,   0,   0,   178, 44,  81,  36,  0,   0,   0,   8,   0,
+    0,   0,   0,   0,   0,   0,   0,   141, 36,  149, 102, 0,   0,   18,  130, 21,  173, 178, 0,
+    138, 0,   0,   4,   178, 63,  62,  1,   0,   145, 15,  94,  0,   151, 0,   0,   43,  0,   0,
+    35,  0,   0,   0,   0,   0,   0,   0,   136, 164, 0,   72,  156, 66,  116, 14,  0,   0,   0,
+    8,   82,  0,   0,   0,   88,  0,   157, 0,   61,  0,   0,   122, 0,   0,   0,   111, 0,   170,
+    0,   0,   150, 0,   0,   0,   0,   149, 0,   0,   150, 19,  0,   0,   163, 0,   0,   0,   0,
+    0,   171, 64,  106, 0,   0,   89,  18,  0,   69,  65,  0,   175, 0,   0,   142, 0,   0,   9,
+    61,  51,  169, 70,  0,   0,   0,   0,   60,  103, 0,   154, 129, 0,   117, 21,  150, 13,  0,
+    27,  25,  0,   29,  0,   0,   29,  6,   109, 97,  0,   0,   0,   69,  0,   0,   24,  0,   99,
+    138, 0,   0,   0,   110, 0,   109, 154, 44,  0,   0,   0,   0,   0,   132, 0,   158, 126, 0,
+    0,   0,   28,  0,   96,  147, 0,   0,   125, 78,  109, 0,   37,  0,   143, 0,   0,   18,  120,
+    144, 125, 0,   20,  73,  139, 0,   48,  164, 0,   55,  73,  133, 127, 109, 0,   0,   84,  80,
+    111, 0,   15,  0,   0,   51,  0,   0,   68,  0,   102, 26,  0,   48,  0,   0,   0,   101, 51,
+    153, 63,  0,   0,   0,   77,  135, 40,  161, 27,  0,   114, 145, 45,  8,   0,   0,   142, 47,
+    159, 52,  0,   82,  0,   0,   0,   43,  12,  158, 0,   72,  31,  0,   107, 95,  0,   3};
+
+}  // anonymous namespace
 
 namespace sh
 {
@@ -319,12 +322,12 @@ const size_t ImmutableString::FowlerNollVoHash<8>::kFnvOffsetBasis =
 
 uint32_t ImmutableString::mangledNameHash() const
 {
-    return MangledPerfectHash(data());
+    return GraphLabelSum(data(), length(), kMangledSeed, kMangledGraphLabels) % 1423;
 }
 
 uint32_t ImmutableString::unmangledNameHash() const
 {
-    return UnmangledPerfectHash(data());
+    return GraphLabelSum(data(), length(), kUnmangledSeed, kUnmangledGraphLabels) % 180;
 }
 
 }  // namespace sh
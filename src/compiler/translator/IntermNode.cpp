@@ -293,7 +293,9 @@ bool TIntermLoop::replaceChildNode(TIntermNode *original, TIntermNode *replaceme
 
 TIntermBranch::TIntermBranch(const TIntermBranch &node)
     : TIntermBranch(node.mFlowOp, node.mExpression ? node.mExpression->deepCopy() : nullptr)
-{}
+{
+    mLine = node.mLine;
+}
 
 size_t TIntermBranch::getChildCount() const
 {
@@ -435,6 +437,7 @@ bool TIntermAggregate::replaceChildNode(TIntermNode *original, TIntermNode *repl
 
 TIntermBlock::TIntermBlock(const TIntermBlock &node)
 {
+    mLine = node.mLine;
     for (TIntermNode *intermNode : node.mStatements)
     {
         mStatements.push_back(intermNode->deepCopy());
@@ -536,6 +539,7 @@ bool TIntermDeclaration::replaceChildNode(TIntermNode *original, TIntermNode *re
 
 TIntermDeclaration::TIntermDeclaration(const TIntermDeclaration &node)
 {
+    mLine = node.mLine;
     for (TIntermNode *intermNode : node.mDeclarators)
     {
         mDeclarators.push_back(intermNode->deepCopy());
@@ -1108,7 +1112,11 @@ bool TIntermSwitch::replaceChildNode(TIntermNode *original, TIntermNode *replace
     return false;
 }
 
-TIntermCase::TIntermCase(const TIntermCase &node) : TIntermCase(node.mCondition->deepCopy()) {}
+TIntermCase::TIntermCase(const TIntermCase &node)
+    : TIntermCase(node.mCondition ? node.mCondition->deepCopy() : nullptr)
+{
+    mLine = node.mLine;
+}
 
 size_t TIntermCase::getChildCount() const
 {
@@ -1629,7 +1637,9 @@ TIntermLoop::TIntermLoop(const TIntermLoop &node)
                   node.mCond ? node.mCond->deepCopy() : nullptr,
                   node.mExpr ? node.mExpr->deepCopy() : nullptr,
                   node.mBody->deepCopy())
-{}
+{
+    mLine = node.mLine;
+}
 
 TIntermIfElse::TIntermIfElse(TIntermTyped *cond, TIntermBlock *trueB, TIntermBlock *falseB)
     : TIntermNode(), mCondition(cond), mTrueBlock(trueB), mFalseBlock(falseB)
@@ -1646,7 +1656,9 @@ TIntermIfElse::TIntermIfElse(const TIntermIfElse &node)
     : TIntermIfElse(node.mCondition->deepCopy(),
                     node.mTrueBlock->deepCopy(),
                     node.mFalseBlock ? node.mFalseBlock->deepCopy() : nullptr)
-{}
+{
+    mLine = node.mLine;
+}
 
 TIntermSwitch::TIntermSwitch(TIntermTyped *init, TIntermBlock *statementList)
     : TIntermNode(), mInit(init), mStatementList(statementList)
@@ -1657,7 +1669,9 @@ TIntermSwitch::TIntermSwitch(TIntermTyped *init, TIntermBlock *statementList)
 
 TIntermSwitch::TIntermSwitch(const TIntermSwitch &node)
     : TIntermSwitch(node.mInit->deepCopy(), node.mStatementList->deepCopy())
-{}
+{
+    mLine = node.mLine;
+}
 
 void TIntermSwitch::setStatementList(TIntermBlock *statementList)
 {
@@ -4231,7 +4245,9 @@ TIntermPreprocessorDirective::TIntermPreprocessorDirective(PreprocessorDirective
 
 TIntermPreprocessorDirective::TIntermPreprocessorDirective(const TIntermPreprocessorDirective &node)
     : TIntermPreprocessorDirective(node.mDirective, node.mCommand)
-{}
+{
+    mLine = node.mLine;
+}
 
 TIntermPreprocessorDirective::~TIntermPreprocessorDirective() = default;
 
@@ -10,6 +10,7 @@
 #include <stdio.h>
 
 #include "common/mathutil.h"
+#include "common/system_utils.h"
 #include "common/utilities.h"
 #include "compiler/preprocessor/SourceLocation.h"
 #include "compiler/translator/Declarator.h"
@@ -314,6 +315,8 @@ TParseContext::TParseContext(TSymbolTable &symt,
       mMaxExpressionComplexity(static_cast<size_t>(options.limitExpressionComplexity
                                                        ? resources.MaxExpressionComplexity
                                                        : std::numeric_limits<size_t>::max())),
+      mCompileDeadline(0.0),
+      mCompileTimeBudgetExceeded(false),
       mMaxStatementDepth(static_cast<size_t>(resources.MaxStatementDepth)),
       mMinProgramTexelOffset(resources.MinProgramTexelOffset),
       mMaxProgramTexelOffset(resources.MaxProgramTexelOffset),
@@ -4848,7 +4851,7 @@ TIntermTyped *TParseContext::addConstructor(TFunctionLookup *fnCall, const TSour
     TIntermAggregate *constructorNode = TIntermAggregate::CreateConstructor(type, &arguments);
     constructorNode->setLine(line);
 
-    return constructorNode->fold(mDiagnostics);
+    return checkCompileDeadline() ? constructorNode->fold(mDiagnostics) : constructorNode;
 }
 
 //
@@ -5609,7 +5612,7 @@ TIntermTyped *TParseContext::addFieldSelectionExpression(TIntermTyped *baseExpre
         TIntermSwizzle *node = new TIntermSwizzle(baseExpression, fieldOffsets);
         node->setLine(dotLocation);
 
-        return node->fold(mDiagnostics);
+        return checkCompileDeadline() ? node->fold(mDiagnostics) : node;
     }
     else if (baseExpression->getBasicType() == EbtStruct)
     {
@@ -6793,7 +6796,7 @@ TIntermTyped *TParseContext::createUnaryMath(TOperator op,
     TIntermUnary *node = new TIntermUnary(op, child, func);
     node->setLine(loc);
 
-    return node->fold(mDiagnostics);
+    return checkCompileDeadline() ? node->fold(mDiagnostics) : node;
 }
 
 TIntermTyped *TParseContext::addUnaryMath(TOperator op, TIntermTyped *child, const TSourceLoc &loc)
@@ -6815,6 +6818,22 @@ TIntermTyped *TParseContext::addUnaryMathLValue(TOperator op,
     return addUnaryMath(op, child, loc);
 }
 
+bool TParseContext::checkCompileDeadline()
+{
+    if (mCompileTimeBudgetExceeded)
+    {
+        return false;
+    }
+    if (mCompileDeadline == 0.0 || angle::GetCurrentSystemTime() <= mCompileDeadline)
+    {
+        return true;
+    }
+
+    mCompileTimeBudgetExceeded = true;
+    mDiagnostics->globalError("compilation exceeded its time budget");
+    return false;
+}
+
 TIntermTyped *TParseContext::expressionOrFoldedResult(TIntermTyped *expression)
 {
     // If we can, we should return the folded version of the expression for subsequent parsing. This
@@ -6822,6 +6841,11 @@ TIntermTyped *TParseContext::expressionOrFoldedResult(TIntermTyped *expression)
     // FoldExpressions() step where folding nested expressions requires multiple full AST
     // traversals.
 
+    if (!checkCompileDeadline())
+    {
+        return expression;
+    }
+
     // Even if folding fails the fold() functions return some node representing the expression,
     // typically the original node. So "folded" can be assumed to be non-null.
     TIntermTyped *folded = expression->fold(mDiagnostics);
@@ -7800,7 +7824,7 @@ TIntermTyped *TParseContext::addMethod(TFunctionLookup *fnCall, const TSourceLoc
         TIntermUnary *node = new TIntermUnary(EOpArrayLength, thisNode, nullptr);
         markStaticReadIfSymbol(thisNode);
         node->setLine(loc);
-        return node->fold(mDiagnostics);
+        return checkCompileDeadline() ? node->fold(mDiagnostics) : node;
     }
     return CreateZeroNode(TType(EbtInt, EbpUndefined, EvqConst));
 }
@@ -7877,7 +7901,7 @@ TIntermTyped *TParseContext::addNonConstructorFunctionCallImpl(TFunctionLookup *
 
             // See if we can constant fold a built-in. Note that this may be possible
             // even if it is not const-qualified.
-            return callNode->fold(mDiagnostics);
+            return checkCompileDeadline() ? callNode->fold(mDiagnostics) : callNode;
         }
         else
         {
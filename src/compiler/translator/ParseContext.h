@@ -74,6 +74,11 @@ class TParseContext : angle::NonCopyable
         mFragmentPrecisionHighOnESSL1 = fragmentPrecisionHigh;
     }
 
+    // Constant folding stops once angle::GetCurrentSystemTime() passes the deadline, and the parse
+    // fails.  A deadline of 0 disables the check.
+    void setCompileDeadline(double deadline) { mCompileDeadline = deadline; }
+    bool isCompileTimeBudgetExceeded() const { return mCompileTimeBudgetExceeded; }
+
     bool usesDerivatives() const { return mUsesDerivatives; }
     bool isEarlyFragmentTestsSpecified() const { return mEarlyFragmentTestsSpecified; }
     bool hasDiscard() const { return mHasDiscard; }
@@ -670,6 +675,8 @@ class TParseContext : angle::NonCopyable
     // Return either the original expression or the folded version of the expression in case the
     // folded node will validate the same way during subsequent parsing.
     TIntermTyped *expressionOrFoldedResult(TIntermTyped *expression);
+    // Return false and generate an error the first time folding runs past the compile deadline.
+    bool checkCompileDeadline();
 
     // Return true if the checks pass
     bool binaryOpCommonCheck(TOperator op,
@@ -772,6 +779,8 @@ class TParseContext : angle::NonCopyable
     angle::pp::Preprocessor mPreprocessor;
     void *mScanner;
     const size_t mMaxExpressionComplexity;
+    double mCompileDeadline;
+    bool mCompileTimeBudgetExceeded;
     const size_t mMaxStatementDepth;
     int mMinProgramTexelOffset;
     int mMaxProgramTexelOffset;
@@ -414,6 +414,27 @@ bool Compile(const ShHandle handle,
     return compiler->compile(shaderStrings, numStrings, compileOptions);
 }
 
+bool GetPreprocessedTokenStream(const ShHandle handle,
+                                const char *const shaderStrings[],
+                                size_t numStrings,
+                                const ShCompileOptions &compileOptions,
+                                std::string *tokenStreamOut)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    return compiler->getPreprocessedTokenStream(shaderStrings, numStrings, compileOptions,
+                                                tokenStreamOut);
+}
+
+bool CompileVariant(const ShHandle handle, const ShCompileOptions &compileOptions)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    return compiler->compileVariant(compileOptions);
+}
+
 void ClearResults(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
@@ -471,6 +492,14 @@ const BinaryBlob &GetObjectBinaryBlob(const ShHandle handle)
     return infoSink.obj.getBinary();
 }
 
+const CompileProfile &GetCompileProfile(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    return compiler->getCompileProfile();
+}
+
 bool GetShaderBinary(const ShHandle handle,
                      const char *const shaderStrings[],
                      size_t numStrings,
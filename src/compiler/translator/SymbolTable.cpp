@@ -104,6 +104,7 @@ TSymbol *TSymbolTable::TSymbolTableLevel::find(const ImmutableString &name) cons
 TSymbolTable::TSymbolTable()
     : mGlobalInvariant(false),
       mUniqueIdCounter(0),
+      mLookupCount(0),
       mShaderType(GL_FRAGMENT_SHADER),
       mShaderSpec(SH_GLES2_SPEC),
       mGlInVariableWithArraySize(nullptr)
@@ -262,6 +263,7 @@ const TSymbol *TSymbolTable::find(const ImmutableString &name, int shaderVersion
 
 const TSymbol *TSymbolTable::findUserDefined(const ImmutableString &name) const
 {
+    ++mLookupCount;
     int userDefinedLevel = static_cast<int>(mTable.size()) - 1;
     while (userDefinedLevel >= 0)
     {
@@ -280,12 +282,14 @@ TFunction *TSymbolTable::findUserDefinedFunction(const ImmutableString &name) co
 {
     // User-defined functions are always declared at the global level.
     ASSERT(!mTable.empty());
+    ++mLookupCount;
     return static_cast<TFunction *>(mTable[0]->find(name));
 }
 
 const TSymbol *TSymbolTable::findGlobal(const ImmutableString &name) const
 {
     ASSERT(!mTable.empty());
+    ++mLookupCount;
     return mTable[0]->find(name);
 }
 
@@ -362,6 +366,47 @@ void TSymbolTable::clearCompilationResults()
     ASSERT(mTable.empty());
 }
 
+TSymbolTable::ParsedShaderState::ParsedShaderState()
+    : globalInvariant(false), uniqueIdCounter(0), glInVariableWithArraySize(nullptr)
+{}
+
+TSymbolTable::ParsedShaderState::~ParsedShaderState() = default;
+
+void TSymbolTable::saveParsedShaderState(ParsedShaderState *stateOut)
+{
+    ASSERT(mTable.size() == 1);
+    stateOut->globalLevel          = std::move(mTable.back());
+    stateOut->globalPrecisionLevel = std::move(mPrecisionStack.back());
+    mTable.pop_back();
+    mPrecisionStack.pop_back();
+
+    stateOut->globalInvariant           = mGlobalInvariant;
+    stateOut->uniqueIdCounter           = mUniqueIdCounter;
+    stateOut->variableMetadata          = mVariableMetadata;
+    stateOut->glInVariableWithArraySize = mGlInVariableWithArraySize;
+}
+
+void TSymbolTable::restoreParsedShaderState(ParsedShaderState *state)
+{
+    ASSERT(mTable.empty() && state->globalLevel);
+    mTable.push_back(std::move(state->globalLevel));
+    mPrecisionStack.push_back(std::move(state->globalPrecisionLevel));
+
+    mGlobalInvariant           = state->globalInvariant;
+    mUniqueIdCounter           = state->uniqueIdCounter;
+    mVariableMetadata          = state->variableMetadata;
+    mGlInVariableWithArraySize = state->glInVariableWithArraySize;
+}
+
+void TSymbolTable::releaseParsedShaderState(ParsedShaderState *state)
+{
+    ASSERT(mTable.size() == 1 && !state->globalLevel);
+    state->globalLevel          = std::move(mTable.back());
+    state->globalPrecisionLevel = std::move(mPrecisionStack.back());
+    mTable.pop_back();
+    mPrecisionStack.pop_back();
+}
+
 int TSymbolTable::nextUniqueIdValue()
 {
     ASSERT(mUniqueIdCounter < std::numeric_limits<int>::max());
@@ -280,8 +280,24 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
                             const ShBuiltInResources &resources);
     void clearCompilationResults();
 
+    // The global level and the per-compilation state of a parsed shader, kept so that the shader
+    // can be translated again without parsing it.  See TCompiler::compileVariant.
+    struct ParsedShaderState;
+
+    // Moves the global level out of the table once the shader is parsed, along with the state
+    // built while parsing it.  The global level must be the only user-defined level.
+    void saveParsedShaderState(ParsedShaderState *stateOut);
+    // Moves the saved global level back into the table and resets the per-compilation state to
+    // what it was after parsing.  releaseParsedShaderState moves the global level out again.
+    void restoreParsedShaderState(ParsedShaderState *state);
+    void releaseParsedShaderState(ParsedShaderState *state);
+
     ShShaderSpec getShaderSpec() const { return mShaderSpec; }
 
+    // The number of lookups of user-defined and global symbols made so far, including the ones
+    // find() makes before falling back to the built-ins.
+    uint64_t getLookupCount() const { return mLookupCount; }
+
   private:
     friend class TSymbolUniqueId;
 
@@ -316,6 +332,8 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
 
     int mUniqueIdCounter;
 
+    mutable uint64_t mLookupCount;
+
     static constexpr int kFirstUserDefinedSymbolId = 3000;
 
     sh::GLenum mShaderType;
@@ -331,6 +349,20 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
     friend struct SymbolIdChecker;
 };
 
+struct TSymbolTable::ParsedShaderState
+{
+    ParsedShaderState();
+    ~ParsedShaderState();
+
+    std::unique_ptr<TSymbolTableLevel> globalLevel;
+    std::unique_ptr<PrecisionStackLevel> globalPrecisionLevel;
+
+    bool globalInvariant;
+    int uniqueIdCounter;
+    std::map<int, VariableMetadata> variableMetadata;
+    TVariable *glInVariableWithArraySize;
+};
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_SYMBOLTABLE_H_
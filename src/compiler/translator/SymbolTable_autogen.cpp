@@ -19639,1430 +19639,2860 @@ constexpr SymbolRule kRules[] = {
     Rule::Get<300, Shader::NOT_COMPUTE, EXT_INDEX(ANGLE_clip_cull_distance)>(
         &TableBase::m_gl_CullDistance)};
 
-// Flat array of all mangled names.
-constexpr const char *kMangledNames[] = {"radians(00B",
-                                         "radians(10B",
-                                         "radians(20B",
-                                         "radians(30B",
-                                         "degrees(00B",
-                                         "degrees(10B",
-                                         "degrees(20B",
-                                         "degrees(30B",
-                                         "sin(00B",
-                                         "sin(10B",
-                                         "sin(20B",
-                                         "sin(30B",
-                                         "cos(00B",
-                                         "cos(10B",
-                                         "cos(20B",
-                                         "cos(30B",
-                                         "tan(00B",
-                                         "tan(10B",
-                                         "tan(20B",
-                                         "tan(30B",
-                                         "asin(00B",
-                                         "asin(10B",
-                                         "asin(20B",
-                                         "asin(30B",
-                                         "acos(00B",
-                                         "acos(10B",
-                                         "acos(20B",
-                                         "acos(30B",
-                                         "atan(00B00B",
-                                         "atan(10B10B",
-                                         "atan(20B20B",
-                                         "atan(30B30B",
-                                         "atan(00B",
-                                         "atan(10B",
-                                         "atan(20B",
-                                         "atan(30B",
-                                         "sinh(00B",
-                                         "sinh(10B",
-                                         "sinh(20B",
-                                         "sinh(30B",
-                                         "cosh(00B",
-                                         "cosh(10B",
-                                         "cosh(20B",
-                                         "cosh(30B",
-                                         "tanh(00B",
-                                         "tanh(10B",
-                                         "tanh(20B",
-                                         "tanh(30B",
-                                         "asinh(00B",
-                                         "asinh(10B",
-                                         "asinh(20B",
-                                         "asinh(30B",
-                                         "acosh(00B",
-                                         "acosh(10B",
-                                         "acosh(20B",
-                                         "acosh(30B",
-                                         "atanh(00B",
-                                         "atanh(10B",
-                                         "atanh(20B",
-                                         "atanh(30B",
-                                         "pow(00B00B",
-                                         "pow(10B10B",
-                                         "pow(20B20B",
-                                         "pow(30B30B",
-                                         "exp(00B",
-                                         "exp(10B",
-                                         "exp(20B",
-                                         "exp(30B",
-                                         "log(00B",
-                                         "log(10B",
-                                         "log(20B",
-                                         "log(30B",
-                                         "exp2(00B",
-                                         "exp2(10B",
-                                         "exp2(20B",
-                                         "exp2(30B",
-                                         "log2(00B",
-                                         "log2(10B",
-                                         "log2(20B",
-                                         "log2(30B",
-                                         "sqrt(00B",
-                                         "sqrt(10B",
-                                         "sqrt(20B",
-                                         "sqrt(30B",
-                                         "inversesqrt(00B",
-                                         "inversesqrt(10B",
-                                         "inversesqrt(20B",
-                                         "inversesqrt(30B",
-                                         "abs(00B",
-                                         "abs(10B",
-                                         "abs(20B",
-                                         "abs(30B",
-                                         "abs(00C",
-                                         "abs(10C",
-                                         "abs(20C",
-                                         "abs(30C",
-                                         "sign(00B",
-                                         "sign(10B",
-                                         "sign(20B",
-                                         "sign(30B",
-                                         "sign(00C",
-                                         "sign(10C",
-                                         "sign(20C",
-                                         "sign(30C",
-                                         "floor(00B",
-                                         "floor(10B",
-                                         "floor(20B",
-                                         "floor(30B",
-                                         "trunc(00B",
-                                         "trunc(10B",
-                                         "trunc(20B",
-                                         "trunc(30B",
-                                         "round(00B",
-                                         "round(10B",
-                                         "round(20B",
-                                         "round(30B",
-                                         "roundEven(00B",
-                                         "roundEven(10B",
-                                         "roundEven(20B",
-                                         "roundEven(30B",
-                                         "ceil(00B",
-                                         "ceil(10B",
-                                         "ceil(20B",
-                                         "ceil(30B",
-                                         "fract(00B",
-                                         "fract(10B",
-                                         "fract(20B",
-                                         "fract(30B",
-                                         "mod(00B00B",
-                                         "mod(10B00B",
-                                         "mod(20B00B",
-                                         "mod(30B00B",
-                                         "mod(10B10B",
-                                         "mod(20B20B",
-                                         "mod(30B30B",
-                                         "min(00B00B",
-                                         "min(10B00B",
-                                         "min(20B00B",
-                                         "min(30B00B",
-                                         "min(10B10B",
-                                         "min(20B20B",
-                                         "min(30B30B",
-                                         "min(00C00C",
-                                         "min(10C10C",
-                                         "min(20C20C",
-                                         "min(30C30C",
-                                         "min(10C00C",
-                                         "min(20C00C",
-                                         "min(30C00C",
-                                         "min(00D00D",
-                                         "min(10D10D",
-                                         "min(20D20D",
-                                         "min(30D30D",
-                                         "min(10D00D",
-                                         "min(20D00D",
-                                         "min(30D00D",
-                                         "max(00B00B",
-                                         "max(10B00B",
-                                         "max(20B00B",
-                                         "max(30B00B",
-                                         "max(10B10B",
-                                         "max(20B20B",
-                                         "max(30B30B",
-                                         "max(00C00C",
-                                         "max(10C10C",
-                                         "max(20C20C",
-                                         "max(30C30C",
-                                         "max(10C00C",
-                                         "max(20C00C",
-                                         "max(30C00C",
-                                         "max(00D00D",
-                                         "max(10D10D",
-                                         "max(20D20D",
-                                         "max(30D30D",
-                                         "max(10D00D",
-                                         "max(20D00D",
-                                         "max(30D00D",
-                                         "clamp(00B00B00B",
-                                         "clamp(10B00B00B",
-                                         "clamp(20B00B00B",
-                                         "clamp(30B00B00B",
-                                         "clamp(10B10B10B",
-                                         "clamp(20B20B20B",
-                                         "clamp(30B30B30B",
-                                         "clamp(00C00C00C",
-                                         "clamp(10C00C00C",
-                                         "clamp(20C00C00C",
-                                         "clamp(30C00C00C",
-                                         "clamp(10C10C10C",
-                                         "clamp(20C20C20C",
-                                         "clamp(30C30C30C",
-                                         "clamp(00D00D00D",
-                                         "clamp(10D00D00D",
-                                         "clamp(20D00D00D",
-                                         "clamp(30D00D00D",
-                                         "clamp(10D10D10D",
-                                         "clamp(20D20D20D",
-                                         "clamp(30D30D30D",
-                                         "mix(00B00B00B",
-                                         "mix(10B10B00B",
-                                         "mix(20B20B00B",
-                                         "mix(30B30B00B",
-                                         "mix(10B10B10B",
-                                         "mix(20B20B20B",
-                                         "mix(30B30B30B",
-                                         "mix(00B00B00E",
-                                         "mix(10B10B10E",
-                                         "mix(20B20B20E",
-                                         "mix(30B30B30E",
-                                         "mix(00C00C00E",
-                                         "mix(10C10C10E",
-                                         "mix(20C20C20E",
-                                         "mix(30C30C30E",
-                                         "mix(00D00D00E",
-                                         "mix(10D10D10E",
-                                         "mix(20D20D20E",
-                                         "mix(30D30D30E",
-                                         "mix(00E00E00E",
-                                         "mix(10E10E10E",
-                                         "mix(20E20E20E",
-                                         "mix(30E30E30E",
-                                         "step(00B00B",
-                                         "step(10B10B",
-                                         "step(20B20B",
-                                         "step(30B30B",
-                                         "step(00B10B",
-                                         "step(00B20B",
-                                         "step(00B30B",
-                                         "smoothstep(00B00B00B",
-                                         "smoothstep(10B10B10B",
-                                         "smoothstep(20B20B20B",
-                                         "smoothstep(30B30B30B",
-                                         "smoothstep(00B00B10B",
-                                         "smoothstep(00B00B20B",
-                                         "smoothstep(00B00B30B",
-                                         "modf(00B00B",
-                                         "modf(10B10B",
-                                         "modf(20B20B",
-                                         "modf(30B30B",
-                                         "isnan(00B",
-                                         "isnan(10B",
-                                         "isnan(20B",
-                                         "isnan(30B",
-                                         "isinf(00B",
-                                         "isinf(10B",
-                                         "isinf(20B",
-                                         "isinf(30B",
-                                         "floatBitsToInt(00B",
-                                         "floatBitsToInt(10B",
-                                         "floatBitsToInt(20B",
-                                         "floatBitsToInt(30B",
-                                         "floatBitsToUint(00B",
-                                         "floatBitsToUint(10B",
-                                         "floatBitsToUint(20B",
-                                         "floatBitsToUint(30B",
-                                         "intBitsToFloat(00C",
-                                         "intBitsToFloat(10C",
-                                         "intBitsToFloat(20C",
-                                         "intBitsToFloat(30C",
-                                         "uintBitsToFloat(00D",
-                                         "uintBitsToFloat(10D",
-                                         "uintBitsToFloat(20D",
-                                         "uintBitsToFloat(30D",
-                                         "fma(00B00B00B",
-                                         "fma(10B10B10B",
-                                         "fma(20B20B20B",
-                                         "fma(30B30B30B",
-                                         "frexp(00B00C",
-                                         "frexp(10B10C",
-                                         "frexp(20B20C",
-                                         "frexp(30B30C",
-                                         "ldexp(00B00C",
-                                         "ldexp(10B10C",
-                                         "ldexp(20B20C",
-                                         "ldexp(30B30C",
-                                         "packSnorm2x16(10B",
-                                         "packHalf2x16(10B",
-                                         "unpackSnorm2x16(00D",
-                                         "unpackHalf2x16(00D",
-                                         "packUnorm2x16(10B",
-                                         "unpackUnorm2x16(00D",
-                                         "packUnorm4x8(30B",
-                                         "packSnorm4x8(30B",
-                                         "unpackUnorm4x8(00D",
-                                         "unpackSnorm4x8(00D",
-                                         "length(00B",
-                                         "length(10B",
-                                         "length(20B",
-                                         "length(30B",
-                                         "distance(00B00B",
-                                         "distance(10B10B",
-                                         "distance(20B20B",
-                                         "distance(30B30B",
-                                         "dot(00B00B",
-                                         "dot(10B10B",
-                                         "dot(20B20B",
-                                         "dot(30B30B",
-                                         "cross(20B20B",
-                                         "normalize(00B",
-                                         "normalize(10B",
-                                         "normalize(20B",
-                                         "normalize(30B",
-                                         "faceforward(00B00B00B",
-                                         "faceforward(10B10B10B",
-                                         "faceforward(20B20B20B",
-                                         "faceforward(30B30B30B",
-                                         "reflect(00B00B",
-                                         "reflect(10B10B",
-                                         "reflect(20B20B",
-                                         "reflect(30B30B",
-                                         "refract(00B00B00B",
-                                         "refract(10B10B00B",
-                                         "refract(20B20B00B",
-                                         "refract(30B30B00B",
-                                         "matrixCompMult(50B50B",
-                                         "matrixCompMult(A0BA0B",
-                                         "matrixCompMult(F0BF0B",
-                                         "matrixCompMult(90B90B",
-                                         "matrixCompMult(60B60B",
-                                         "matrixCompMult(D0BD0B",
-                                         "matrixCompMult(70B70B",
-                                         "matrixCompMult(E0BE0B",
-                                         "matrixCompMult(B0BB0B",
-                                         "outerProduct(10B10B",
-                                         "outerProduct(20B20B",
-                                         "outerProduct(30B30B",
-                                         "outerProduct(20B10B",
-                                         "outerProduct(10B20B",
-                                         "outerProduct(30B10B",
-                                         "outerProduct(10B30B",
-                                         "outerProduct(30B20B",
-                                         "outerProduct(20B30B",
-                                         "transpose(50B",
-                                         "transpose(A0B",
-                                         "transpose(F0B",
-                                         "transpose(60B",
-                                         "transpose(90B",
-                                         "transpose(70B",
-                                         "transpose(D0B",
-                                         "transpose(B0B",
-                                         "transpose(E0B",
-                                         "determinant(50B",
-                                         "determinant(A0B",
-                                         "determinant(F0B",
-                                         "inverse(50B",
-                                         "inverse(A0B",
-                                         "inverse(F0B",
-                                         "lessThan(10B10B",
-                                         "lessThan(20B20B",
-                                         "lessThan(30B30B",
-                                         "lessThan(10C10C",
-                                         "lessThan(20C20C",
-                                         "lessThan(30C30C",
-                                         "lessThan(10D10D",
-                                         "lessThan(20D20D",
-                                         "lessThan(30D30D",
-                                         "lessThanEqual(10B10B",
-                                         "lessThanEqual(20B20B",
-                                         "lessThanEqual(30B30B",
-                                         "lessThanEqual(10C10C",
-                                         "lessThanEqual(20C20C",
-                                         "lessThanEqual(30C30C",
-                                         "lessThanEqual(10D10D",
-                                         "lessThanEqual(20D20D",
-                                         "lessThanEqual(30D30D",
-                                         "greaterThan(10B10B",
-                                         "greaterThan(20B20B",
-                                         "greaterThan(30B30B",
-                                         "greaterThan(10C10C",
-                                         "greaterThan(20C20C",
-                                         "greaterThan(30C30C",
-                                         "greaterThan(10D10D",
-                                         "greaterThan(20D20D",
-                                         "greaterThan(30D30D",
-                                         "greaterThanEqual(10B10B",
-                                         "greaterThanEqual(20B20B",
-                                         "greaterThanEqual(30B30B",
-                                         "greaterThanEqual(10C10C",
-                                         "greaterThanEqual(20C20C",
-                                         "greaterThanEqual(30C30C",
-                                         "greaterThanEqual(10D10D",
-                                         "greaterThanEqual(20D20D",
-                                         "greaterThanEqual(30D30D",
-                                         "equal(10B10B",
-                                         "equal(20B20B",
-                                         "equal(30B30B",
-                                         "equal(10C10C",
-                                         "equal(20C20C",
-                                         "equal(30C30C",
-                                         "equal(10D10D",
-                                         "equal(20D20D",
-                                         "equal(30D30D",
-                                         "equal(10E10E",
-                                         "equal(20E20E",
-                                         "equal(30E30E",
-                                         "notEqual(10B10B",
-                                         "notEqual(20B20B",
-                                         "notEqual(30B30B",
-                                         "notEqual(10C10C",
-                                         "notEqual(20C20C",
-                                         "notEqual(30C30C",
-                                         "notEqual(10D10D",
-                                         "notEqual(20D20D",
-                                         "notEqual(30D30D",
-                                         "notEqual(10E10E",
-                                         "notEqual(20E20E",
-                                         "notEqual(30E30E",
-                                         "any(10E",
-                                         "any(20E",
-                                         "any(30E",
-                                         "all(10E",
-                                         "all(20E",
-                                         "all(30E",
-                                         "not(10E",
-                                         "not(20E",
-                                         "not(30E",
-                                         "bitfieldExtract(00C00C00C",
-                                         "bitfieldExtract(10C00C00C",
-                                         "bitfieldExtract(20C00C00C",
-                                         "bitfieldExtract(30C00C00C",
-                                         "bitfieldExtract(00D00C00C",
-                                         "bitfieldExtract(10D00C00C",
-                                         "bitfieldExtract(20D00C00C",
-                                         "bitfieldExtract(30D00C00C",
-                                         "bitfieldInsert(00C00C00C00C",
-                                         "bitfieldInsert(10C10C00C00C",
-                                         "bitfieldInsert(20C20C00C00C",
-                                         "bitfieldInsert(30C30C00C00C",
-                                         "bitfieldInsert(00D00D00C00C",
-                                         "bitfieldInsert(10D10D00C00C",
-                                         "bitfieldInsert(20D20D00C00C",
-                                         "bitfieldInsert(30D30D00C00C",
-                                         "bitfieldReverse(00C",
-                                         "bitfieldReverse(10C",
-                                         "bitfieldReverse(20C",
-                                         "bitfieldReverse(30C",
-                                         "bitfieldReverse(00D",
-                                         "bitfieldReverse(10D",
-                                         "bitfieldReverse(20D",
-                                         "bitfieldReverse(30D",
-                                         "bitCount(00C",
-                                         "bitCount(10C",
-                                         "bitCount(20C",
-                                         "bitCount(30C",
-                                         "bitCount(00D",
-                                         "bitCount(10D",
-                                         "bitCount(20D",
-                                         "bitCount(30D",
-                                         "findLSB(00C",
-                                         "findLSB(10C",
-                                         "findLSB(20C",
-                                         "findLSB(30C",
-                                         "findLSB(00D",
-                                         "findLSB(10D",
-                                         "findLSB(20D",
-                                         "findLSB(30D",
-                                         "findMSB(00C",
-                                         "findMSB(10C",
-                                         "findMSB(20C",
-                                         "findMSB(30C",
-                                         "findMSB(00D",
-                                         "findMSB(10D",
-                                         "findMSB(20D",
-                                         "findMSB(30D",
-                                         "uaddCarry(00D00D00D",
-                                         "uaddCarry(10D10D10D",
-                                         "uaddCarry(20D20D20D",
-                                         "uaddCarry(30D30D30D",
-                                         "usubBorrow(00D00D00D",
-                                         "usubBorrow(10D10D10D",
-                                         "usubBorrow(20D20D20D",
-                                         "usubBorrow(30D30D30D",
-                                         "umulExtended(00D00D00D00D",
-                                         "umulExtended(10D10D10D10D",
-                                         "umulExtended(20D20D20D20D",
-                                         "umulExtended(30D30D30D30D",
-                                         "imulExtended(00C00C00C00C",
-                                         "imulExtended(10C10C10C10C",
-                                         "imulExtended(20C20C20C20C",
-                                         "imulExtended(30C30C30C30C",
-                                         "texture2D(00H10B",
-                                         "texture2DProj(00H20B",
-                                         "texture2DProj(00H30B",
-                                         "textureCube(00J20B",
-                                         "texture3D(00I20B",
-                                         "texture3DProj(00I30B",
-                                         "shadow2DEXT(00c20B",
-                                         "shadow2DProjEXT(00c30B",
-                                         "texture2D(00L10B",
-                                         "texture2DProj(00L20B",
-                                         "texture2DProj(00L30B",
-                                         "texture2DRect(00N10B",
-                                         "texture2DRectProj(00N20B",
-                                         "texture2DRectProj(00N30B",
-                                         "texture2DGradEXT(00H10B10B10B",
-                                         "texture2DProjGradEXT(00H20B10B10B",
-                                         "texture2DProjGradEXT(00H30B10B10B",
-                                         "textureCubeGradEXT(00J20B20B20B",
-                                         "textureVideoWEBGL(00p10B",
-                                         "texture2D(00H10B00B",
-                                         "texture2DProj(00H20B00B",
-                                         "texture2DProj(00H30B00B",
-                                         "textureCube(00J20B00B",
-                                         "texture3D(00I20B00B",
-                                         "texture3DProj(00I30B00B",
-                                         "texture3DLod(00I20B00B",
-                                         "texture3DProjLod(00I30B00B",
-                                         "texture2DLod(00H10B00B",
-                                         "texture2DProjLod(00H20B00B",
-                                         "texture2DProjLod(00H30B00B",
-                                         "textureCubeLod(00J20B00B",
-                                         "texture2DLodEXT(00H10B00B",
-                                         "texture2DProjLodEXT(00H20B00B",
-                                         "texture2DProjLodEXT(00H30B00B",
-                                         "textureCubeLodEXT(00J20B00B",
-                                         "texture(00H10B",
-                                         "texture(00Q10B",
-                                         "texture(00W10B",
-                                         "texture(00I20B",
-                                         "texture(00R20B",
-                                         "texture(00X20B",
-                                         "texture(00J20B",
-                                         "texture(00S20B",
-                                         "texture(00Y20B",
-                                         "texture(00K20B",
-                                         "texture(00T20B",
-                                         "texture(00Z20B",
-                                         "texture(00c20B",
-                                         "texture(00d30B",
-                                         "texture(00e30B",
-                                         "texture(00g30B",
-                                         "texture(00l30B",
-                                         "texture(00o30B",
-                                         "texture(00h30B00B",
-                                         "texture(00L10B",
-                                         "texture(00M10B",
-                                         "texture(00N10B",
-                                         "texture(00p10B",
-                                         "textureProj(00H20B",
-                                         "textureProj(00Q20B",
-                                         "textureProj(00W20B",
-                                         "textureProj(00H30B",
-                                         "textureProj(00Q30B",
-                                         "textureProj(00W30B",
-                                         "textureProj(00I30B",
-                                         "textureProj(00R30B",
-                                         "textureProj(00X30B",
-                                         "textureProj(00c30B",
-                                         "textureProj(00L20B",
-                                         "textureProj(00L30B",
-                                         "textureProj(00M20B",
-                                         "textureProj(00M30B",
-                                         "textureProj(00N20B",
-                                         "textureProj(00N30B",
-                                         "textureLod(00H10B00B",
-                                         "textureLod(00Q10B00B",
-                                         "textureLod(00W10B00B",
-                                         "textureLod(00I20B00B",
-                                         "textureLod(00R20B00B",
-                                         "textureLod(00X20B00B",
-                                         "textureLod(00J20B00B",
-                                         "textureLod(00S20B00B",
-                                         "textureLod(00Y20B00B",
-                                         "textureLod(00K20B00B",
-                                         "textureLod(00T20B00B",
-                                         "textureLod(00Z20B00B",
-                                         "textureLod(00c20B00B",
-                                         "textureLod(00d30B00B",
-                                         "textureLod(00e30B00B",
-                                         "textureLod(00h30B00B00B",
-                                         "textureLod(00g30B00B",
-                                         "textureLod(00l30B00B",
-                                         "textureLod(00o30B00B",
-                                         "textureSize(00H00C",
-                                         "textureSize(00Q00C",
-                                         "textureSize(00W00C",
-                                         "textureSize(00I00C",
-                                         "textureSize(00R00C",
-                                         "textureSize(00X00C",
-                                         "textureSize(00J00C",
-                                         "textureSize(00S00C",
-                                         "textureSize(00Y00C",
-                                         "textureSize(00K00C",
-                                         "textureSize(00T00C",
-                                         "textureSize(00Z00C",
-                                         "textureSize(00c00C",
-                                         "textureSize(00d00C",
-                                         "textureSize(00e00C",
-                                         "textureSize(00g00C",
-                                         "textureSize(00l00C",
-                                         "textureSize(00o00C",
-                                         "textureSize(00h00C",
-                                         "textureSize(00f",
-                                         "textureSize(00k",
-                                         "textureSize(00n",
-                                         "textureSize(00O",
-                                         "textureSize(00U",
-                                         "textureSize(00a",
-                                         "textureSize(00P",
-                                         "textureSize(00V",
-                                         "textureSize(00b",
-                                         "textureSize(00L00C",
-                                         "textureSize(00M00C",
-                                         "textureProjLod(00H20B00B",
-                                         "textureProjLod(00Q20B00B",
-                                         "textureProjLod(00W20B00B",
-                                         "textureProjLod(00H30B00B",
-                                         "textureProjLod(00Q30B00B",
-                                         "textureProjLod(00W30B00B",
-                                         "textureProjLod(00I30B00B",
-                                         "textureProjLod(00R30B00B",
-                                         "textureProjLod(00X30B00B",
-                                         "textureProjLod(00c30B00B",
-                                         "texelFetch(00H10C00C",
-                                         "texelFetch(00Q10C00C",
-                                         "texelFetch(00W10C00C",
-                                         "texelFetch(00I20C00C",
-                                         "texelFetch(00R20C00C",
-                                         "texelFetch(00X20C00C",
-                                         "texelFetch(00K20C00C",
-                                         "texelFetch(00T20C00C",
-                                         "texelFetch(00Z20C00C",
-                                         "texelFetch(00f00C",
-                                         "texelFetch(00k00C",
-                                         "texelFetch(00n00C",
-                                         "texelFetch(00O10C00C",
-                                         "texelFetch(00U10C00C",
-                                         "texelFetch(00a10C00C",
-                                         "texelFetch(00P20C00C",
-                                         "texelFetch(00V20C00C",
-                                         "texelFetch(00b20C00C",
-                                         "texelFetch(00L10C00C",
-                                         "texelFetch(00M10C00C",
-                                         "textureGrad(00H10B10B10B",
-                                         "textureGrad(00Q10B10B10B",
-                                         "textureGrad(00W10B10B10B",
-                                         "textureGrad(00I20B20B20B",
-                                         "textureGrad(00R20B20B20B",
-                                         "textureGrad(00X20B20B20B",
-                                         "textureGrad(00J20B20B20B",
-                                         "textureGrad(00S20B20B20B",
-                                         "textureGrad(00Y20B20B20B",
-                                         "textureGrad(00c20B10B10B",
-                                         "textureGrad(00d30B20B20B",
-                                         "textureGrad(00K20B10B10B",
-                                         "textureGrad(00T20B10B10B",
-                                         "textureGrad(00Z20B10B10B",
-                                         "textureGrad(00e30B10B10B",
-                                         "textureGrad(00g30B20B20B",
-                                         "textureGrad(00l30B20B20B",
-                                         "textureGrad(00o30B20B20B",
-                                         "textureProjGrad(00H20B10B10B",
-                                         "textureProjGrad(00Q20B10B10B",
-                                         "textureProjGrad(00W20B10B10B",
-                                         "textureProjGrad(00H30B10B10B",
-                                         "textureProjGrad(00Q30B10B10B",
-                                         "textureProjGrad(00W30B10B10B",
-                                         "textureProjGrad(00I30B20B20B",
-                                         "textureProjGrad(00R30B20B20B",
-                                         "textureProjGrad(00X30B20B20B",
-                                         "textureProjGrad(00c30B10B10B",
-                                         "texture(00H10B00B",
-                                         "texture(00Q10B00B",
-                                         "texture(00W10B00B",
-                                         "texture(00I20B00B",
-                                         "texture(00R20B00B",
-                                         "texture(00X20B00B",
-                                         "texture(00J20B00B",
-                                         "texture(00S20B00B",
-                                         "texture(00Y20B00B",
-                                         "texture(00K20B00B",
-                                         "texture(00T20B00B",
-                                         "texture(00Z20B00B",
-                                         "textureProj(00H20B00B",
-                                         "textureProj(00Q20B00B",
-                                         "textureProj(00W20B00B",
-                                         "textureProj(00H30B00B",
-                                         "textureProj(00Q30B00B",
-                                         "textureProj(00W30B00B",
-                                         "textureProj(00I30B00B",
-                                         "textureProj(00R30B00B",
-                                         "textureProj(00X30B00B",
-                                         "texture(00c20B00B",
-                                         "texture(00d30B00B",
-                                         "textureProj(00c30B00B",
-                                         "texture(00e30B00B",
-                                         "texture(00g30B00B",
-                                         "texture(00l30B00B",
-                                         "texture(00o30B00B",
-                                         "texture(00h30B00B00B",
-                                         "texture(00L10B00B",
-                                         "textureProj(00L20B00B",
-                                         "textureProj(00L30B00B",
-                                         "texture(00M10B00B",
-                                         "textureProj(00M20B00B",
-                                         "textureProj(00M30B00B",
-                                         "textureOffset(00H10B10C",
-                                         "textureOffset(00Q10B10C",
-                                         "textureOffset(00W10B10C",
-                                         "textureOffset(00I20B20C",
-                                         "textureOffset(00R20B20C",
-                                         "textureOffset(00X20B20C",
-                                         "textureOffset(00c20B10C",
-                                         "textureOffset(00K20B10C",
-                                         "textureOffset(00T20B10C",
-                                         "textureOffset(00Z20B10C",
-                                         "textureOffset(00e30B10C",
-                                         "textureProjOffset(00H20B10C",
-                                         "textureProjOffset(00Q20B10C",
-                                         "textureProjOffset(00W20B10C",
-                                         "textureProjOffset(00H30B10C",
-                                         "textureProjOffset(00Q30B10C",
-                                         "textureProjOffset(00W30B10C",
-                                         "textureProjOffset(00I30B20C",
-                                         "textureProjOffset(00R30B20C",
-                                         "textureProjOffset(00X30B20C",
-                                         "textureProjOffset(00c30B10C",
-                                         "textureLodOffset(00H10B00B10C",
-                                         "textureLodOffset(00Q10B00B10C",
-                                         "textureLodOffset(00W10B00B10C",
-                                         "textureLodOffset(00I20B00B20C",
-                                         "textureLodOffset(00R20B00B20C",
-                                         "textureLodOffset(00X20B00B20C",
-                                         "textureLodOffset(00c20B00B10C",
-                                         "textureLodOffset(00K20B00B10C",
-                                         "textureLodOffset(00T20B00B10C",
-                                         "textureLodOffset(00Z20B00B10C",
-                                         "textureLodOffset(00e30B00B10C",
-                                         "textureProjLodOffset(00H20B00B10C",
-                                         "textureProjLodOffset(00Q20B00B10C",
-                                         "textureProjLodOffset(00W20B00B10C",
-                                         "textureProjLodOffset(00H30B00B10C",
-                                         "textureProjLodOffset(00Q30B00B10C",
-                                         "textureProjLodOffset(00W30B00B10C",
-                                         "textureProjLodOffset(00I30B00B20C",
-                                         "textureProjLodOffset(00R30B00B20C",
-                                         "textureProjLodOffset(00X30B00B20C",
-                                         "textureProjLodOffset(00c30B00B10C",
-                                         "texelFetchOffset(00H10C00C10C",
-                                         "texelFetchOffset(00Q10C00C10C",
-                                         "texelFetchOffset(00W10C00C10C",
-                                         "texelFetchOffset(00I20C00C20C",
-                                         "texelFetchOffset(00R20C00C20C",
-                                         "texelFetchOffset(00X20C00C20C",
-                                         "texelFetchOffset(00K20C00C10C",
-                                         "texelFetchOffset(00T20C00C10C",
-                                         "texelFetchOffset(00Z20C00C10C",
-                                         "textureGradOffset(00H10B10B10B10C",
-                                         "textureGradOffset(00Q10B10B10B10C",
-                                         "textureGradOffset(00W10B10B10B10C",
-                                         "textureGradOffset(00I20B20B20B20C",
-                                         "textureGradOffset(00R20B20B20B20C",
-                                         "textureGradOffset(00X20B20B20B20C",
-                                         "textureGradOffset(00c20B10B10B10C",
-                                         "textureGradOffset(00K20B10B10B10C",
-                                         "textureGradOffset(00T20B10B10B10C",
-                                         "textureGradOffset(00Z20B10B10B10C",
-                                         "textureGradOffset(00e30B10B10B10C",
-                                         "textureProjGradOffset(00H20B10B10B10C",
-                                         "textureProjGradOffset(00Q20B10B10B10C",
-                                         "textureProjGradOffset(00W20B10B10B10C",
-                                         "textureProjGradOffset(00H30B10B10B10C",
-                                         "textureProjGradOffset(00Q30B10B10B10C",
-                                         "textureProjGradOffset(00W30B10B10B10C",
-                                         "textureProjGradOffset(00I30B20B20B20C",
-                                         "textureProjGradOffset(00R30B20B20B20C",
-                                         "textureProjGradOffset(00X30B20B20B20C",
-                                         "textureProjGradOffset(00c30B10B10B10C",
-                                         "textureOffset(00H10B10C00B",
-                                         "textureOffset(00Q10B10C00B",
-                                         "textureOffset(00W10B10C00B",
-                                         "textureOffset(00I20B20C00B",
-                                         "textureOffset(00R20B20C00B",
-                                         "textureOffset(00X20B20C00B",
-                                         "textureOffset(00c20B10C00B",
-                                         "textureOffset(00K20B10C00B",
-                                         "textureOffset(00T20B10C00B",
-                                         "textureOffset(00Z20B10C00B",
-                                         "textureOffset(00e30B10C00B",
-                                         "textureProjOffset(00H20B10C00B",
-                                         "textureProjOffset(00Q20B10C00B",
-                                         "textureProjOffset(00W20B10C00B",
-                                         "textureProjOffset(00H30B10C00B",
-                                         "textureProjOffset(00Q30B10C00B",
-                                         "textureProjOffset(00W30B10C00B",
-                                         "textureProjOffset(00I30B20C00B",
-                                         "textureProjOffset(00R30B20C00B",
-                                         "textureProjOffset(00X30B20C00B",
-                                         "textureProjOffset(00c30B10C00B",
-                                         "textureGather(00H10B",
-                                         "textureGather(00Q10B",
-                                         "textureGather(00W10B",
-                                         "textureGather(00K20B",
-                                         "textureGather(00T20B",
-                                         "textureGather(00Z20B",
-                                         "textureGather(00J20B",
-                                         "textureGather(00S20B",
-                                         "textureGather(00Y20B",
-                                         "textureGather(00g30B",
-                                         "textureGather(00l30B",
-                                         "textureGather(00o30B",
-                                         "textureGather(00H10B00C",
-                                         "textureGather(00Q10B00C",
-                                         "textureGather(00W10B00C",
-                                         "textureGather(00K20B00C",
-                                         "textureGather(00T20B00C",
-                                         "textureGather(00Z20B00C",
-                                         "textureGather(00J20B00C",
-                                         "textureGather(00S20B00C",
-                                         "textureGather(00Y20B00C",
-                                         "textureGather(00g30B00C",
-                                         "textureGather(00l30B00C",
-                                         "textureGather(00o30B00C",
-                                         "textureGather(00h30B00B",
-                                         "textureGather(00c10B00B",
-                                         "textureGather(00e20B00B",
-                                         "textureGather(00d20B00B",
-                                         "textureGatherOffset(00H10B10C",
-                                         "textureGatherOffset(00Q10B10C",
-                                         "textureGatherOffset(00W10B10C",
-                                         "textureGatherOffset(00K20B10C",
-                                         "textureGatherOffset(00T20B10C",
-                                         "textureGatherOffset(00Z20B10C",
-                                         "textureGatherOffset(00H10B10C00C",
-                                         "textureGatherOffset(00Q10B10C00C",
-                                         "textureGatherOffset(00W10B10C00C",
-                                         "textureGatherOffset(00K20B10C00C",
-                                         "textureGatherOffset(00T20B10C00C",
-                                         "textureGatherOffset(00Z20B10C00C",
-                                         "textureGatherOffset(00c10B00B10C",
-                                         "textureGatherOffset(00e20B00B10C",
-                                         "textureGatherOffsets(00H10B10Cx4",
-                                         "textureGatherOffsets(00Q10B10Cx4",
-                                         "textureGatherOffsets(00W10B10Cx4",
-                                         "textureGatherOffsets(00K20B10Cx4",
-                                         "textureGatherOffsets(00T20B10Cx4",
-                                         "textureGatherOffsets(00Z20B10Cx4",
-                                         "textureGatherOffsets(00H10B10Cx400C",
-                                         "textureGatherOffsets(00Q10B10Cx400C",
-                                         "textureGatherOffsets(00W10B10Cx400C",
-                                         "textureGatherOffsets(00K20B10Cx400C",
-                                         "textureGatherOffsets(00T20B10Cx400C",
-                                         "textureGatherOffsets(00Z20B10Cx400C",
-                                         "textureGatherOffsets(00c10B00B10Cx4",
-                                         "textureGatherOffsets(00e20B00B10Cx4",
-                                         "textureQueryLOD(00H10B",
-                                         "textureQueryLOD(00Q10B",
-                                         "textureQueryLOD(00W10B",
-                                         "textureQueryLOD(00I20B",
-                                         "textureQueryLOD(00R20B",
-                                         "textureQueryLOD(00X20B",
-                                         "textureQueryLOD(00J20B",
-                                         "textureQueryLOD(00S20B",
-                                         "textureQueryLOD(00Y20B",
-                                         "textureQueryLOD(00K10B",
-                                         "textureQueryLOD(00T10B",
-                                         "textureQueryLOD(00Z10B",
-                                         "textureQueryLOD(00c10B",
-                                         "textureQueryLOD(00d20B",
-                                         "textureQueryLOD(00e10B",
-                                         "textureQueryLOD(00g20B",
-                                         "textureQueryLOD(00l20B",
-                                         "textureQueryLOD(00o20B",
-                                         "textureQueryLOD(00h20B",
-                                         "rgb_2_yuv(20B00G",
-                                         "yuv_2_rgb(20B00G",
-                                         "dFdx(00B",
-                                         "dFdx(10B",
-                                         "dFdx(20B",
-                                         "dFdx(30B",
-                                         "dFdy(00B",
-                                         "dFdy(10B",
-                                         "dFdy(20B",
-                                         "dFdy(30B",
-                                         "fwidth(00B",
-                                         "fwidth(10B",
-                                         "fwidth(20B",
-                                         "fwidth(30B",
-                                         "interpolateAtCentroid(00B",
-                                         "interpolateAtCentroid(10B",
-                                         "interpolateAtCentroid(20B",
-                                         "interpolateAtCentroid(30B",
-                                         "interpolateAtSample(00B00C",
-                                         "interpolateAtSample(10B00C",
-                                         "interpolateAtSample(20B00C",
-                                         "interpolateAtSample(30B00C",
-                                         "interpolateAtOffset(00B10B",
-                                         "interpolateAtOffset(10B10B",
-                                         "interpolateAtOffset(20B10B",
-                                         "interpolateAtOffset(30B10B",
-                                         "atomicCounter(00F",
-                                         "atomicCounterIncrement(00F",
-                                         "atomicCounterDecrement(00F",
-                                         "atomicAdd(00D00D",
-                                         "atomicAdd(00C00C",
-                                         "atomicMin(00D00D",
-                                         "atomicMin(00C00C",
-                                         "atomicMax(00D00D",
-                                         "atomicMax(00C00C",
-                                         "atomicAnd(00D00D",
-                                         "atomicAnd(00C00C",
-                                         "atomicOr(00D00D",
-                                         "atomicOr(00C00C",
-                                         "atomicXor(00D00D",
-                                         "atomicXor(00C00C",
-                                         "atomicExchange(00D00D",
-                                         "atomicExchange(00C00C",
-                                         "atomicCompSwap(00D00D00D",
-                                         "atomicCompSwap(00C00C00C",
-                                         "imageSize(00q",
-                                         "imageSize(00z",
-                                         "imageSize(01I",
-                                         "imageSize(00r",
-                                         "imageSize(01A",
-                                         "imageSize(01J",
-                                         "imageSize(00s",
-                                         "imageSize(01B",
-                                         "imageSize(01K",
-                                         "imageSize(00t",
-                                         "imageSize(01C",
-                                         "imageSize(01L",
-                                         "imageSize(00w",
-                                         "imageSize(01F",
-                                         "imageSize(01O",
-                                         "imageSize(00y",
-                                         "imageSize(01H",
-                                         "imageSize(01Q",
-                                         "imageStore(00q10C30B",
-                                         "imageStore(00z10C30C",
-                                         "imageStore(01I10C30D",
-                                         "imageStore(00r20C30B",
-                                         "imageStore(01A20C30C",
-                                         "imageStore(01J20C30D",
-                                         "imageStore(00s20C30B",
-                                         "imageStore(01B20C30C",
-                                         "imageStore(01K20C30D",
-                                         "imageStore(00t20C30B",
-                                         "imageStore(01C20C30C",
-                                         "imageStore(01L20C30D",
-                                         "imageStore(00w20C30B",
-                                         "imageStore(01F20C30C",
-                                         "imageStore(01O20C30D",
-                                         "imageStore(00y00C30B",
-                                         "imageStore(01H00C30C",
-                                         "imageStore(01Q00C30D",
-                                         "imageLoad(00q10C",
-                                         "imageLoad(00z10C",
-                                         "imageLoad(01I10C",
-                                         "imageLoad(00r20C",
-                                         "imageLoad(01A20C",
-                                         "imageLoad(01J20C",
-                                         "imageLoad(00s20C",
-                                         "imageLoad(01B20C",
-                                         "imageLoad(01K20C",
-                                         "imageLoad(00t20C",
-                                         "imageLoad(01C20C",
-                                         "imageLoad(01L20C",
-                                         "imageLoad(00w20C",
-                                         "imageLoad(01F20C",
-                                         "imageLoad(01O20C",
-                                         "imageLoad(00y00C",
-                                         "imageLoad(01H00C",
-                                         "imageLoad(01Q00C",
-                                         "imageAtomicAdd(00q10C00D",
-                                         "imageAtomicAdd(00z10C00D",
-                                         "imageAtomicAdd(01I10C00D",
-                                         "imageAtomicAdd(00r20C00D",
-                                         "imageAtomicAdd(01A20C00D",
-                                         "imageAtomicAdd(01J20C00D",
-                                         "imageAtomicAdd(00t20C00D",
-                                         "imageAtomicAdd(01C20C00D",
-                                         "imageAtomicAdd(01L20C00D",
-                                         "imageAtomicAdd(00y00C00D",
-                                         "imageAtomicAdd(01H00C00D",
-                                         "imageAtomicAdd(01Q00C00D",
-                                         "imageAtomicAdd(00s20C00D",
-                                         "imageAtomicAdd(01B20C00D",
-                                         "imageAtomicAdd(01K20C00D",
-                                         "imageAtomicAdd(00w20C00D",
-                                         "imageAtomicAdd(01F20C00D",
-                                         "imageAtomicAdd(01O20C00D",
-                                         "imageAtomicAdd(00q10C00C",
-                                         "imageAtomicAdd(00z10C00C",
-                                         "imageAtomicAdd(01I10C00C",
-                                         "imageAtomicAdd(00r20C00C",
-                                         "imageAtomicAdd(01A20C00C",
-                                         "imageAtomicAdd(01J20C00C",
-                                         "imageAtomicAdd(00t20C00C",
-                                         "imageAtomicAdd(01C20C00C",
-                                         "imageAtomicAdd(01L20C00C",
-                                         "imageAtomicAdd(00y00C00C",
-                                         "imageAtomicAdd(01H00C00C",
-                                         "imageAtomicAdd(01Q00C00C",
-                                         "imageAtomicAdd(00s20C00C",
-                                         "imageAtomicAdd(01B20C00C",
-                                         "imageAtomicAdd(01K20C00C",
-                                         "imageAtomicAdd(00w20C00C",
-                                         "imageAtomicAdd(01F20C00C",
-                                         "imageAtomicAdd(01O20C00C",
-                                         "imageAtomicMin(00q10C00D",
-                                         "imageAtomicMin(00z10C00D",
-                                         "imageAtomicMin(01I10C00D",
-                                         "imageAtomicMin(00r20C00D",
-                                         "imageAtomicMin(01A20C00D",
-                                         "imageAtomicMin(01J20C00D",
-                                         "imageAtomicMin(00t20C00D",
-                                         "imageAtomicMin(01C20C00D",
-                                         "imageAtomicMin(01L20C00D",
-                                         "imageAtomicMin(00y00C00D",
-                                         "imageAtomicMin(01H00C00D",
-                                         "imageAtomicMin(01Q00C00D",
-                                         "imageAtomicMin(00s20C00D",
-                                         "imageAtomicMin(01B20C00D",
-                                         "imageAtomicMin(01K20C00D",
-                                         "imageAtomicMin(00w20C00D",
-                                         "imageAtomicMin(01F20C00D",
-                                         "imageAtomicMin(01O20C00D",
-                                         "imageAtomicMin(00q10C00C",
-                                         "imageAtomicMin(00z10C00C",
-                                         "imageAtomicMin(01I10C00C",
-                                         "imageAtomicMin(00r20C00C",
-                                         "imageAtomicMin(01A20C00C",
-                                         "imageAtomicMin(01J20C00C",
-                                         "imageAtomicMin(00t20C00C",
-                                         "imageAtomicMin(01C20C00C",
-                                         "imageAtomicMin(01L20C00C",
-                                         "imageAtomicMin(00y00C00C",
-                                         "imageAtomicMin(01H00C00C",
-                                         "imageAtomicMin(01Q00C00C",
-                                         "imageAtomicMin(00s20C00C",
-                                         "imageAtomicMin(01B20C00C",
-                                         "imageAtomicMin(01K20C00C",
-                                         "imageAtomicMin(00w20C00C",
-                                         "imageAtomicMin(01F20C00C",
-                                         "imageAtomicMin(01O20C00C",
-                                         "imageAtomicMax(00q10C00D",
-                                         "imageAtomicMax(00z10C00D",
-                                         "imageAtomicMax(01I10C00D",
-                                         "imageAtomicMax(00r20C00D",
-                                         "imageAtomicMax(01A20C00D",
-                                         "imageAtomicMax(01J20C00D",
-                                         "imageAtomicMax(00t20C00D",
-                                         "imageAtomicMax(01C20C00D",
-                                         "imageAtomicMax(01L20C00D",
-                                         "imageAtomicMax(00y00C00D",
-                                         "imageAtomicMax(01H00C00D",
-                                         "imageAtomicMax(01Q00C00D",
-                                         "imageAtomicMax(00s20C00D",
-                                         "imageAtomicMax(01B20C00D",
-                                         "imageAtomicMax(01K20C00D",
-                                         "imageAtomicMax(00w20C00D",
-                                         "imageAtomicMax(01F20C00D",
-                                         "imageAtomicMax(01O20C00D",
-                                         "imageAtomicMax(00q10C00C",
-                                         "imageAtomicMax(00z10C00C",
-                                         "imageAtomicMax(01I10C00C",
-                                         "imageAtomicMax(00r20C00C",
-                                         "imageAtomicMax(01A20C00C",
-                                         "imageAtomicMax(01J20C00C",
-                                         "imageAtomicMax(00t20C00C",
-                                         "imageAtomicMax(01C20C00C",
-                                         "imageAtomicMax(01L20C00C",
-                                         "imageAtomicMax(00y00C00C",
-                                         "imageAtomicMax(01H00C00C",
-                                         "imageAtomicMax(01Q00C00C",
-                                         "imageAtomicMax(00s20C00C",
-                                         "imageAtomicMax(01B20C00C",
-                                         "imageAtomicMax(01K20C00C",
-                                         "imageAtomicMax(00w20C00C",
-                                         "imageAtomicMax(01F20C00C",
-                                         "imageAtomicMax(01O20C00C",
-                                         "imageAtomicAnd(00q10C00D",
-                                         "imageAtomicAnd(00z10C00D",
-                                         "imageAtomicAnd(01I10C00D",
-                                         "imageAtomicAnd(00r20C00D",
-                                         "imageAtomicAnd(01A20C00D",
-                                         "imageAtomicAnd(01J20C00D",
-                                         "imageAtomicAnd(00t20C00D",
-                                         "imageAtomicAnd(01C20C00D",
-                                         "imageAtomicAnd(01L20C00D",
-                                         "imageAtomicAnd(00y00C00D",
-                                         "imageAtomicAnd(01H00C00D",
-                                         "imageAtomicAnd(01Q00C00D",
-                                         "imageAtomicAnd(00s20C00D",
-                                         "imageAtomicAnd(01B20C00D",
-                                         "imageAtomicAnd(01K20C00D",
-                                         "imageAtomicAnd(00w20C00D",
-                                         "imageAtomicAnd(01F20C00D",
-                                         "imageAtomicAnd(01O20C00D",
-                                         "imageAtomicAnd(00q10C00C",
-                                         "imageAtomicAnd(00z10C00C",
-                                         "imageAtomicAnd(01I10C00C",
-                                         "imageAtomicAnd(00r20C00C",
-                                         "imageAtomicAnd(01A20C00C",
-                                         "imageAtomicAnd(01J20C00C",
-                                         "imageAtomicAnd(00t20C00C",
-                                         "imageAtomicAnd(01C20C00C",
-                                         "imageAtomicAnd(01L20C00C",
-                                         "imageAtomicAnd(00y00C00C",
-                                         "imageAtomicAnd(01H00C00C",
-                                         "imageAtomicAnd(01Q00C00C",
-                                         "imageAtomicAnd(00s20C00C",
-                                         "imageAtomicAnd(01B20C00C",
-                                         "imageAtomicAnd(01K20C00C",
-                                         "imageAtomicAnd(00w20C00C",
-                                         "imageAtomicAnd(01F20C00C",
-                                         "imageAtomicAnd(01O20C00C",
-                                         "imageAtomicOr(00q10C00D",
-                                         "imageAtomicOr(00z10C00D",
-                                         "imageAtomicOr(01I10C00D",
-                                         "imageAtomicOr(00r20C00D",
-                                         "imageAtomicOr(01A20C00D",
-                                         "imageAtomicOr(01J20C00D",
-                                         "imageAtomicOr(00t20C00D",
-                                         "imageAtomicOr(01C20C00D",
-                                         "imageAtomicOr(01L20C00D",
-                                         "imageAtomicOr(00y00C00D",
-                                         "imageAtomicOr(01H00C00D",
-                                         "imageAtomicOr(01Q00C00D",
-                                         "imageAtomicOr(00s20C00D",
-                                         "imageAtomicOr(01B20C00D",
-                                         "imageAtomicOr(01K20C00D",
-                                         "imageAtomicOr(00w20C00D",
-                                         "imageAtomicOr(01F20C00D",
-                                         "imageAtomicOr(01O20C00D",
-                                         "imageAtomicOr(00q10C00C",
-                                         "imageAtomicOr(00z10C00C",
-                                         "imageAtomicOr(01I10C00C",
-                                         "imageAtomicOr(00r20C00C",
-                                         "imageAtomicOr(01A20C00C",
-                                         "imageAtomicOr(01J20C00C",
-                                         "imageAtomicOr(00t20C00C",
-                                         "imageAtomicOr(01C20C00C",
-                                         "imageAtomicOr(01L20C00C",
-                                         "imageAtomicOr(00y00C00C",
-                                         "imageAtomicOr(01H00C00C",
-                                         "imageAtomicOr(01Q00C00C",
-                                         "imageAtomicOr(00s20C00C",
-                                         "imageAtomicOr(01B20C00C",
-                                         "imageAtomicOr(01K20C00C",
-                                         "imageAtomicOr(00w20C00C",
-                                         "imageAtomicOr(01F20C00C",
-                                         "imageAtomicOr(01O20C00C",
-                                         "imageAtomicXor(00q10C00D",
-                                         "imageAtomicXor(00z10C00D",
-                                         "imageAtomicXor(01I10C00D",
-                                         "imageAtomicXor(00r20C00D",
-                                         "imageAtomicXor(01A20C00D",
-                                         "imageAtomicXor(01J20C00D",
-                                         "imageAtomicXor(00t20C00D",
-                                         "imageAtomicXor(01C20C00D",
-                                         "imageAtomicXor(01L20C00D",
-                                         "imageAtomicXor(00y00C00D",
-                                         "imageAtomicXor(01H00C00D",
-                                         "imageAtomicXor(01Q00C00D",
-                                         "imageAtomicXor(00s20C00D",
-                                         "imageAtomicXor(01B20C00D",
-                                         "imageAtomicXor(01K20C00D",
-                                         "imageAtomicXor(00w20C00D",
-                                         "imageAtomicXor(01F20C00D",
-                                         "imageAtomicXor(01O20C00D",
-                                         "imageAtomicXor(00q10C00C",
-                                         "imageAtomicXor(00z10C00C",
-                                         "imageAtomicXor(01I10C00C",
-                                         "imageAtomicXor(00r20C00C",
-                                         "imageAtomicXor(01A20C00C",
-                                         "imageAtomicXor(01J20C00C",
-                                         "imageAtomicXor(00t20C00C",
-                                         "imageAtomicXor(01C20C00C",
-                                         "imageAtomicXor(01L20C00C",
-                                         "imageAtomicXor(00y00C00C",
-                                         "imageAtomicXor(01H00C00C",
-                                         "imageAtomicXor(01Q00C00C",
-                                         "imageAtomicXor(00s20C00C",
-                                         "imageAtomicXor(01B20C00C",
-                                         "imageAtomicXor(01K20C00C",
-                                         "imageAtomicXor(00w20C00C",
-                                         "imageAtomicXor(01F20C00C",
-                                         "imageAtomicXor(01O20C00C",
-                                         "imageAtomicExchange(00q10C00D",
-                                         "imageAtomicExchange(00z10C00D",
-                                         "imageAtomicExchange(01I10C00D",
-                                         "imageAtomicExchange(00r20C00D",
-                                         "imageAtomicExchange(01A20C00D",
-                                         "imageAtomicExchange(01J20C00D",
-                                         "imageAtomicExchange(00t20C00D",
-                                         "imageAtomicExchange(01C20C00D",
-                                         "imageAtomicExchange(01L20C00D",
-                                         "imageAtomicExchange(00y00C00D",
-                                         "imageAtomicExchange(01H00C00D",
-                                         "imageAtomicExchange(01Q00C00D",
-                                         "imageAtomicExchange(00s20C00D",
-                                         "imageAtomicExchange(01B20C00D",
-                                         "imageAtomicExchange(01K20C00D",
-                                         "imageAtomicExchange(00w20C00D",
-                                         "imageAtomicExchange(01F20C00D",
-                                         "imageAtomicExchange(01O20C00D",
-                                         "imageAtomicExchange(00q10C00C",
-                                         "imageAtomicExchange(00z10C00C",
-                                         "imageAtomicExchange(01I10C00C",
-                                         "imageAtomicExchange(00r20C00C",
-                                         "imageAtomicExchange(01A20C00C",
-                                         "imageAtomicExchange(01J20C00C",
-                                         "imageAtomicExchange(00t20C00C",
-                                         "imageAtomicExchange(01C20C00C",
-                                         "imageAtomicExchange(01L20C00C",
-                                         "imageAtomicExchange(00y00C00C",
-                                         "imageAtomicExchange(01H00C00C",
-                                         "imageAtomicExchange(01Q00C00C",
-                                         "imageAtomicExchange(00s20C00C",
-                                         "imageAtomicExchange(01B20C00C",
-                                         "imageAtomicExchange(01K20C00C",
-                                         "imageAtomicExchange(00w20C00C",
-                                         "imageAtomicExchange(01F20C00C",
-                                         "imageAtomicExchange(01O20C00C",
-                                         "imageAtomicExchange(00q10C00B",
-                                         "imageAtomicExchange(00z10C00B",
-                                         "imageAtomicExchange(01I10C00B",
-                                         "imageAtomicExchange(00r20C00B",
-                                         "imageAtomicExchange(01A20C00B",
-                                         "imageAtomicExchange(01J20C00B",
-                                         "imageAtomicExchange(00t20C00B",
-                                         "imageAtomicExchange(01C20C00B",
-                                         "imageAtomicExchange(01L20C00B",
-                                         "imageAtomicExchange(00y00C00B",
-                                         "imageAtomicExchange(01H00C00B",
-                                         "imageAtomicExchange(01Q00C00B",
-                                         "imageAtomicExchange(00s20C00B",
-                                         "imageAtomicExchange(01B20C00B",
-                                         "imageAtomicExchange(01K20C00B",
-                                         "imageAtomicExchange(00w20C00B",
-                                         "imageAtomicExchange(01F20C00B",
-                                         "imageAtomicExchange(01O20C00B",
-                                         "imageAtomicCompSwap(00q10C00D00D",
-                                         "imageAtomicCompSwap(00z10C00D00D",
-                                         "imageAtomicCompSwap(01I10C00D00D",
-                                         "imageAtomicCompSwap(00r20C00D00D",
-                                         "imageAtomicCompSwap(01A20C00D00D",
-                                         "imageAtomicCompSwap(01J20C00D00D",
-                                         "imageAtomicCompSwap(00t20C00D00D",
-                                         "imageAtomicCompSwap(01C20C00D00D",
-                                         "imageAtomicCompSwap(01L20C00D00D",
-                                         "imageAtomicCompSwap(00y00C00D00D",
-                                         "imageAtomicCompSwap(01H00C00D00D",
-                                         "imageAtomicCompSwap(01Q00C00D00D",
-                                         "imageAtomicCompSwap(00s20C00D00D",
-                                         "imageAtomicCompSwap(01B20C00D00D",
-                                         "imageAtomicCompSwap(01K20C00D00D",
-                                         "imageAtomicCompSwap(00w20C00D00D",
-                                         "imageAtomicCompSwap(01F20C00D00D",
-                                         "imageAtomicCompSwap(01O20C00D00D",
-                                         "imageAtomicCompSwap(00q10C00C00C",
-                                         "imageAtomicCompSwap(00z10C00C00C",
-                                         "imageAtomicCompSwap(01I10C00C00C",
-                                         "imageAtomicCompSwap(00r20C00C00C",
-                                         "imageAtomicCompSwap(01A20C00C00C",
-                                         "imageAtomicCompSwap(01J20C00C00C",
-                                         "imageAtomicCompSwap(00t20C00C00C",
-                                         "imageAtomicCompSwap(01C20C00C00C",
-                                         "imageAtomicCompSwap(01L20C00C00C",
-                                         "imageAtomicCompSwap(00y00C00C00C",
-                                         "imageAtomicCompSwap(01H00C00C00C",
-                                         "imageAtomicCompSwap(01Q00C00C00C",
-                                         "imageAtomicCompSwap(00s20C00C00C",
-                                         "imageAtomicCompSwap(01B20C00C00C",
-                                         "imageAtomicCompSwap(01K20C00C00C",
-                                         "imageAtomicCompSwap(00w20C00C00C",
-                                         "imageAtomicCompSwap(01F20C00C00C",
-                                         "imageAtomicCompSwap(01O20C00C00C",
-                                         "pixelLocalLoadANGLE(01R",
-                                         "pixelLocalLoadANGLE(01S",
-                                         "pixelLocalLoadANGLE(01T",
-                                         "pixelLocalStoreANGLE(01R30B",
-                                         "pixelLocalStoreANGLE(01S30C",
-                                         "pixelLocalStoreANGLE(01T30D",
-                                         "beginInvocationInterlockNV(",
-                                         "endInvocationInterlockNV(",
-                                         "beginFragmentShaderOrderingINTEL(",
-                                         "beginInvocationInterlockARB(",
-                                         "endInvocationInterlockARB(",
-                                         "memoryBarrier(",
-                                         "memoryBarrierAtomicCounter(",
-                                         "memoryBarrierBuffer(",
-                                         "memoryBarrierImage(",
-                                         "barrier(",
-                                         "memoryBarrierShared(",
-                                         "groupMemoryBarrier(",
-                                         "EmitVertex(",
-                                         "EndPrimitive(",
-                                         "subpassLoad(01U",
-                                         "subpassLoad(01V",
-                                         "subpassLoad(01W",
-                                         "numSamples(",
-                                         "samplePosition(00D",
-                                         "interpolateAtCenter(00B",
-                                         "interpolateAtCenter(10B",
-                                         "interpolateAtCenter(20B",
-                                         "interpolateAtCenter(30B",
-                                         "loopForwardProgress(",
-                                         "saturate(00B",
-                                         "saturate(10B",
-                                         "saturate(20B",
-                                         "saturate(30B",
-                                         "gl_DepthRangeParameters",
-                                         "gl_DepthRange",
-                                         "gl_NumSamples",
-                                         "gl_MaxVertexAttribs",
-                                         "gl_MaxVertexUniformVectors",
-                                         "gl_MaxVertexTextureImageUnits",
-                                         "gl_MaxCombinedTextureImageUnits",
-                                         "gl_MaxTextureImageUnits",
-                                         "gl_MaxFragmentUniformVectors",
-                                         "gl_MaxVaryingVectors",
-                                         "gl_MaxDrawBuffers",
-                                         "gl_MaxDualSourceDrawBuffersEXT",
-                                         "gl_MaxVertexOutputVectors",
-                                         "gl_MaxFragmentInputVectors",
-                                         "gl_MinProgramTexelOffset",
-                                         "gl_MaxProgramTexelOffset",
-                                         "gl_MaxImageUnits",
-                                         "gl_MaxVertexImageUniforms",
-                                         "gl_MaxFragmentImageUniforms",
-                                         "gl_MaxComputeImageUniforms",
-                                         "gl_MaxCombinedImageUniforms",
-                                         "gl_MaxCombinedShaderOutputResources",
-                                         "gl_MaxComputeWorkGroupCount",
-                                         "gl_MaxComputeWorkGroupSize",
-                                         "gl_MaxComputeUniformComponents",
-                                         "gl_MaxComputeTextureImageUnits",
-                                         "gl_MaxComputeAtomicCounters",
-                                         "gl_MaxComputeAtomicCounterBuffers",
-                                         "gl_MaxVertexAtomicCounters",
-                                         "gl_MaxFragmentAtomicCounters",
-                                         "gl_MaxCombinedAtomicCounters",
-                                         "gl_MaxAtomicCounterBindings",
-                                         "gl_MaxVertexAtomicCounterBuffers",
-                                         "gl_MaxFragmentAtomicCounterBuffers",
-                                         "gl_MaxCombinedAtomicCounterBuffers",
-                                         "gl_MaxAtomicCounterBufferSize",
-                                         "gl_MaxGeometryInputComponents",
-                                         "gl_MaxGeometryOutputComponents",
-                                         "gl_MaxGeometryImageUniforms",
-                                         "gl_MaxGeometryTextureImageUnits",
-                                         "gl_MaxGeometryOutputVertices",
-                                         "gl_MaxGeometryTotalOutputComponents",
-                                         "gl_MaxGeometryUniformComponents",
-                                         "gl_MaxGeometryAtomicCounters",
-                                         "gl_MaxGeometryAtomicCounterBuffers",
-                                         "gl_MaxTessControlInputComponents",
-                                         "gl_MaxTessControlOutputComponents",
-                                         "gl_MaxTessControlTextureImageUnits",
-                                         "gl_MaxTessControlUniformComponents",
-                                         "gl_MaxTessControlTotalOutputComponents",
-                                         "gl_MaxTessControlImageUniforms",
-                                         "gl_MaxTessControlAtomicCounters",
-                                         "gl_MaxTessControlAtomicCounterBuffers",
-                                         "gl_MaxTessPatchComponents",
-                                         "gl_MaxPatchVertices",
-                                         "gl_MaxTessGenLevel",
-                                         "gl_MaxTessEvaluationInputComponents",
-                                         "gl_MaxTessEvaluationOutputComponents",
-                                         "gl_MaxTessEvaluationTextureImageUnits",
-                                         "gl_MaxTessEvaluationUniformComponents",
-                                         "gl_MaxTessEvaluationImageUniforms",
-                                         "gl_MaxTessEvaluationAtomicCounters",
-                                         "gl_MaxTessEvaluationAtomicCounterBuffers",
-                                         "gl_MaxSamples",
-                                         "gl_MaxClipDistances",
-                                         "gl_MaxCullDistances",
-                                         "gl_MaxCombinedClipAndCullDistances",
-                                         "gl_FragCoord",
-                                         "gl_FrontFacing",
-                                         "gl_PointCoord",
-                                         "gl_FragColor",
-                                         "gl_FragData",
-                                         "gl_FragDepth",
-                                         "gl_HelperInvocation",
-                                         "gl_SecondaryFragColorEXT",
-                                         "gl_SecondaryFragDataEXT",
-                                         "gl_FragDepthEXT",
-                                         "gl_LastFragData",
-                                         "gl_LastFragColor",
-                                         "gl_LastFragColorARM",
-                                         "gl_LastFragDepthARM",
-                                         "gl_LastFragStencilARM",
-                                         "gl_PrimitiveID",
-                                         "gl_Layer",
-                                         "gl_SampleID",
-                                         "gl_SamplePosition",
-                                         "gl_SampleMaskIn",
-                                         "gl_SampleMask",
-                                         "gl_Position",
-                                         "gl_PointSize",
-                                         "gl_InstanceID",
-                                         "gl_InstanceIndex",
-                                         "gl_VertexID",
-                                         "gl_VertexIndex",
-                                         "gl_DrawID",
-                                         "gl_BaseVertex",
-                                         "gl_BaseInstance",
-                                         "angle_BaseVertex",
-                                         "angle_BaseInstance",
-                                         "gl_ClipDistance",
-                                         "gl_NumWorkGroups",
-                                         "gl_WorkGroupSize",
-                                         "gl_WorkGroupID",
-                                         "gl_LocalInvocationID",
-                                         "gl_GlobalInvocationID",
-                                         "gl_LocalInvocationIndex",
-                                         "gl_PrimitiveIDIn",
-                                         "gl_InvocationID",
-                                         "gl_PerVertex",
-                                         "gl_in",
-                                         "gl_PatchVerticesIn",
-                                         "gl_TessLevelOuter",
-                                         "gl_TessLevelInner",
-                                         "gl_out",
-                                         "gl_BoundingBox",
-                                         "gl_BoundingBoxEXT",
-                                         "gl_BoundingBoxOES",
-                                         "gl_TessCoord",
-                                         "gl_ViewID_OVR",
-                                         "gl_CullDistance"};
+// All mangled names back to back.
+constexpr char kMangledNames[] =
+    "radians(00B"
+    "radians(10B"
+    "radians(20B"
+    "radians(30B"
+    "degrees(00B"
+    "degrees(10B"
+    "degrees(20B"
+    "degrees(30B"
+    "sin(00B"
+    "sin(10B"
+    "sin(20B"
+    "sin(30B"
+    "cos(00B"
+    "cos(10B"
+    "cos(20B"
+    "cos(30B"
+    "tan(00B"
+    "tan(10B"
+    "tan(20B"
+    "tan(30B"
+    "asin(00B"
+    "asin(10B"
+    "asin(20B"
+    "asin(30B"
+    "acos(00B"
+    "acos(10B"
+    "acos(20B"
+    "acos(30B"
+    "atan(00B00B"
+    "atan(10B10B"
+    "atan(20B20B"
+    "atan(30B30B"
+    "atan(00B"
+    "atan(10B"
+    "atan(20B"
+    "atan(30B"
+    "sinh(00B"
+    "sinh(10B"
+    "sinh(20B"
+    "sinh(30B"
+    "cosh(00B"
+    "cosh(10B"
+    "cosh(20B"
+    "cosh(30B"
+    "tanh(00B"
+    "tanh(10B"
+    "tanh(20B"
+    "tanh(30B"
+    "asinh(00B"
+    "asinh(10B"
+    "asinh(20B"
+    "asinh(30B"
+    "acosh(00B"
+    "acosh(10B"
+    "acosh(20B"
+    "acosh(30B"
+    "atanh(00B"
+    "atanh(10B"
+    "atanh(20B"
+    "atanh(30B"
+    "pow(00B00B"
+    "pow(10B10B"
+    "pow(20B20B"
+    "pow(30B30B"
+    "exp(00B"
+    "exp(10B"
+    "exp(20B"
+    "exp(30B"
+    "log(00B"
+    "log(10B"
+    "log(20B"
+    "log(30B"
+    "exp2(00B"
+    "exp2(10B"
+    "exp2(20B"
+    "exp2(30B"
+    "log2(00B"
+    "log2(10B"
+    "log2(20B"
+    "log2(30B"
+    "sqrt(00B"
+    "sqrt(10B"
+    "sqrt(20B"
+    "sqrt(30B"
+    "inversesqrt(00B"
+    "inversesqrt(10B"
+    "inversesqrt(20B"
+    "inversesqrt(30B"
+    "abs(00B"
+    "abs(10B"
+    "abs(20B"
+    "abs(30B"
+    "abs(00C"
+    "abs(10C"
+    "abs(20C"
+    "abs(30C"
+    "sign(00B"
+    "sign(10B"
+    "sign(20B"
+    "sign(30B"
+    "sign(00C"
+    "sign(10C"
+    "sign(20C"
+    "sign(30C"
+    "floor(00B"
+    "floor(10B"
+    "floor(20B"
+    "floor(30B"
+    "trunc(00B"
+    "trunc(10B"
+    "trunc(20B"
+    "trunc(30B"
+    "round(00B"
+    "round(10B"
+    "round(20B"
+    "round(30B"
+    "roundEven(00B"
+    "roundEven(10B"
+    "roundEven(20B"
+    "roundEven(30B"
+    "ceil(00B"
+    "ceil(10B"
+    "ceil(20B"
+    "ceil(30B"
+    "fract(00B"
+    "fract(10B"
+    "fract(20B"
+    "fract(30B"
+    "mod(00B00B"
+    "mod(10B00B"
+    "mod(20B00B"
+    "mod(30B00B"
+    "mod(10B10B"
+    "mod(20B20B"
+    "mod(30B30B"
+    "min(00B00B"
+    "min(10B00B"
+    "min(20B00B"
+    "min(30B00B"
+    "min(10B10B"
+    "min(20B20B"
+    "min(30B30B"
+    "min(00C00C"
+    "min(10C10C"
+    "min(20C20C"
+    "min(30C30C"
+    "min(10C00C"
+    "min(20C00C"
+    "min(30C00C"
+    "min(00D00D"
+    "min(10D10D"
+    "min(20D20D"
+    "min(30D30D"
+    "min(10D00D"
+    "min(20D00D"
+    "min(30D00D"
+    "max(00B00B"
+    "max(10B00B"
+    "max(20B00B"
+    "max(30B00B"
+    "max(10B10B"
+    "max(20B20B"
+    "max(30B30B"
+    "max(00C00C"
+    "max(10C10C"
+    "max(20C20C"
+    "max(30C30C"
+    "max(10C00C"
+    "max(20C00C"
+    "max(30C00C"
+    "max(00D00D"
+    "max(10D10D"
+    "max(20D20D"
+    "max(30D30D"
+    "max(10D00D"
+    "max(20D00D"
+    "max(30D00D"
+    "clamp(00B00B00B"
+    "clamp(10B00B00B"
+    "clamp(20B00B00B"
+    "clamp(30B00B00B"
+    "clamp(10B10B10B"
+    "clamp(20B20B20B"
+    "clamp(30B30B30B"
+    "clamp(00C00C00C"
+    "clamp(10C00C00C"
+    "clamp(20C00C00C"
+    "clamp(30C00C00C"
+    "clamp(10C10C10C"
+    "clamp(20C20C20C"
+    "clamp(30C30C30C"
+    "clamp(00D00D00D"
+    "clamp(10D00D00D"
+    "clamp(20D00D00D"
+    "clamp(30D00D00D"
+    "clamp(10D10D10D"
+    "clamp(20D20D20D"
+    "clamp(30D30D30D"
+    "mix(00B00B00B"
+    "mix(10B10B00B"
+    "mix(20B20B00B"
+    "mix(30B30B00B"
+    "mix(10B10B10B"
+    "mix(20B20B20B"
+    "mix(30B30B30B"
+    "mix(00B00B00E"
+    "mix(10B10B10E"
+    "mix(20B20B20E"
+    "mix(30B30B30E"
+    "mix(00C00C00E"
+    "mix(10C10C10E"
+    "mix(20C20C20E"
+    "mix(30C30C30E"
+    "mix(00D00D00E"
+    "mix(10D10D10E"
+    "mix(20D20D20E"
+    "mix(30D30D30E"
+    "mix(00E00E00E"
+    "mix(10E10E10E"
+    "mix(20E20E20E"
+    "mix(30E30E30E"
+    "step(00B00B"
+    "step(10B10B"
+    "step(20B20B"
+    "step(30B30B"
+    "step(00B10B"
+    "step(00B20B"
+    "step(00B30B"
+    "smoothstep(00B00B00B"
+    "smoothstep(10B10B10B"
+    "smoothstep(20B20B20B"
+    "smoothstep(30B30B30B"
+    "smoothstep(00B00B10B"
+    "smoothstep(00B00B20B"
+    "smoothstep(00B00B30B"
+    "modf(00B00B"
+    "modf(10B10B"
+    "modf(20B20B"
+    "modf(30B30B"
+    "isnan(00B"
+    "isnan(10B"
+    "isnan(20B"
+    "isnan(30B"
+    "isinf(00B"
+    "isinf(10B"
+    "isinf(20B"
+    "isinf(30B"
+    "floatBitsToInt(00B"
+    "floatBitsToInt(10B"
+    "floatBitsToInt(20B"
+    "floatBitsToInt(30B"
+    "floatBitsToUint(00B"
+    "floatBitsToUint(10B"
+    "floatBitsToUint(20B"
+    "floatBitsToUint(30B"
+    "intBitsToFloat(00C"
+    "intBitsToFloat(10C"
+    "intBitsToFloat(20C"
+    "intBitsToFloat(30C"
+    "uintBitsToFloat(00D"
+    "uintBitsToFloat(10D"
+    "uintBitsToFloat(20D"
+    "uintBitsToFloat(30D"
+    "fma(00B00B00B"
+    "fma(10B10B10B"
+    "fma(20B20B20B"
+    "fma(30B30B30B"
+    "frexp(00B00C"
+    "frexp(10B10C"
+    "frexp(20B20C"
+    "frexp(30B30C"
+    "ldexp(00B00C"
+    "ldexp(10B10C"
+    "ldexp(20B20C"
+    "ldexp(30B30C"
+    "packSnorm2x16(10B"
+    "packHalf2x16(10B"
+    "unpackSnorm2x16(00D"
+    "unpackHalf2x16(00D"
+    "packUnorm2x16(10B"
+    "unpackUnorm2x16(00D"
+    "packUnorm4x8(30B"
+    "packSnorm4x8(30B"
+    "unpackUnorm4x8(00D"
+    "unpackSnorm4x8(00D"
+    "length(00B"
+    "length(10B"
+    "length(20B"
+    "length(30B"
+    "distance(00B00B"
+    "distance(10B10B"
+    "distance(20B20B"
+    "distance(30B30B"
+    "dot(00B00B"
+    "dot(10B10B"
+    "dot(20B20B"
+    "dot(30B30B"
+    "cross(20B20B"
+    "normalize(00B"
+    "normalize(10B"
+    "normalize(20B"
+    "normalize(30B"
+    "faceforward(00B00B00B"
+    "faceforward(10B10B10B"
+    "faceforward(20B20B20B"
+    "faceforward(30B30B30B"
+    "reflect(00B00B"
+    "reflect(10B10B"
+    "reflect(20B20B"
+    "reflect(30B30B"
+    "refract(00B00B00B"
+    "refract(10B10B00B"
+    "refract(20B20B00B"
+    "refract(30B30B00B"
+    "matrixCompMult(50B50B"
+    "matrixCompMult(A0BA0B"
+    "matrixCompMult(F0BF0B"
+    "matrixCompMult(90B90B"
+    "matrixCompMult(60B60B"
+    "matrixCompMult(D0BD0B"
+    "matrixCompMult(70B70B"
+    "matrixCompMult(E0BE0B"
+    "matrixCompMult(B0BB0B"
+    "outerProduct(10B10B"
+    "outerProduct(20B20B"
+    "outerProduct(30B30B"
+    "outerProduct(20B10B"
+    "outerProduct(10B20B"
+    "outerProduct(30B10B"
+    "outerProduct(10B30B"
+    "outerProduct(30B20B"
+    "outerProduct(20B30B"
+    "transpose(50B"
+    "transpose(A0B"
+    "transpose(F0B"
+    "transpose(60B"
+    "transpose(90B"
+    "transpose(70B"
+    "transpose(D0B"
+    "transpose(B0B"
+    "transpose(E0B"
+    "determinant(50B"
+    "determinant(A0B"
+    "determinant(F0B"
+    "inverse(50B"
+    "inverse(A0B"
+    "inverse(F0B"
+    "lessThan(10B10B"
+    "lessThan(20B20B"
+    "lessThan(30B30B"
+    "lessThan(10C10C"
+    "lessThan(20C20C"
+    "lessThan(30C30C"
+    "lessThan(10D10D"
+    "lessThan(20D20D"
+    "lessThan(30D30D"
+    "lessThanEqual(10B10B"
+    "lessThanEqual(20B20B"
+    "lessThanEqual(30B30B"
+    "lessThanEqual(10C10C"
+    "lessThanEqual(20C20C"
+    "lessThanEqual(30C30C"
+    "lessThanEqual(10D10D"
+    "lessThanEqual(20D20D"
+    "lessThanEqual(30D30D"
+    "greaterThan(10B10B"
+    "greaterThan(20B20B"
+    "greaterThan(30B30B"
+    "greaterThan(10C10C"
+    "greaterThan(20C20C"
+    "greaterThan(30C30C"
+    "greaterThan(10D10D"
+    "greaterThan(20D20D"
+    "greaterThan(30D30D"
+    "greaterThanEqual(10B10B"
+    "greaterThanEqual(20B20B"
+    "greaterThanEqual(30B30B"
+    "greaterThanEqual(10C10C"
+    "greaterThanEqual(20C20C"
+    "greaterThanEqual(30C30C"
+    "greaterThanEqual(10D10D"
+    "greaterThanEqual(20D20D"
+    "greaterThanEqual(30D30D"
+    "equal(10B10B"
+    "equal(20B20B"
+    "equal(30B30B"
+    "equal(10C10C"
+    "equal(20C20C"
+    "equal(30C30C"
+    "equal(10D10D"
+    "equal(20D20D"
+    "equal(30D30D"
+    "equal(10E10E"
+    "equal(20E20E"
+    "equal(30E30E"
+    "notEqual(10B10B"
+    "notEqual(20B20B"
+    "notEqual(30B30B"
+    "notEqual(10C10C"
+    "notEqual(20C20C"
+    "notEqual(30C30C"
+    "notEqual(10D10D"
+    "notEqual(20D20D"
+    "notEqual(30D30D"
+    "notEqual(10E10E"
+    "notEqual(20E20E"
+    "notEqual(30E30E"
+    "any(10E"
+    "any(20E"
+    "any(30E"
+    "all(10E"
+    "all(20E"
+    "all(30E"
+    "not(10E"
+    "not(20E"
+    "not(30E"
+    "bitfieldExtract(00C00C00C"
+    "bitfieldExtract(10C00C00C"
+    "bitfieldExtract(20C00C00C"
+    "bitfieldExtract(30C00C00C"
+    "bitfieldExtract(00D00C00C"
+    "bitfieldExtract(10D00C00C"
+    "bitfieldExtract(20D00C00C"
+    "bitfieldExtract(30D00C00C"
+    "bitfieldInsert(00C00C00C00C"
+    "bitfieldInsert(10C10C00C00C"
+    "bitfieldInsert(20C20C00C00C"
+    "bitfieldInsert(30C30C00C00C"
+    "bitfieldInsert(00D00D00C00C"
+    "bitfieldInsert(10D10D00C00C"
+    "bitfieldInsert(20D20D00C00C"
+    "bitfieldInsert(30D30D00C00C"
+    "bitfieldReverse(00C"
+    "bitfieldReverse(10C"
+    "bitfieldReverse(20C"
+    "bitfieldReverse(30C"
+    "bitfieldReverse(00D"
+    "bitfieldReverse(10D"
+    "bitfieldReverse(20D"
+    "bitfieldReverse(30D"
+    "bitCount(00C"
+    "bitCount(10C"
+    "bitCount(20C"
+    "bitCount(30C"
+    "bitCount(00D"
+    "bitCount(10D"
+    "bitCount(20D"
+    "bitCount(30D"
+    "findLSB(00C"
+    "findLSB(10C"
+    "findLSB(20C"
+    "findLSB(30C"
+    "findLSB(00D"
+    "findLSB(10D"
+    "findLSB(20D"
+    "findLSB(30D"
+    "findMSB(00C"
+    "findMSB(10C"
+    "findMSB(20C"
+    "findMSB(30C"
+    "findMSB(00D"
+    "findMSB(10D"
+    "findMSB(20D"
+    "findMSB(30D"
+    "uaddCarry(00D00D00D"
+    "uaddCarry(10D10D10D"
+    "uaddCarry(20D20D20D"
+    "uaddCarry(30D30D30D"
+    "usubBorrow(00D00D00D"
+    "usubBorrow(10D10D10D"
+    "usubBorrow(20D20D20D"
+    "usubBorrow(30D30D30D"
+    "umulExtended(00D00D00D00D"
+    "umulExtended(10D10D10D10D"
+    "umulExtended(20D20D20D20D"
+    "umulExtended(30D30D30D30D"
+    "imulExtended(00C00C00C00C"
+    "imulExtended(10C10C10C10C"
+    "imulExtended(20C20C20C20C"
+    "imulExtended(30C30C30C30C"
+    "texture2D(00H10B"
+    "texture2DProj(00H20B"
+    "texture2DProj(00H30B"
+    "textureCube(00J20B"
+    "texture3D(00I20B"
+    "texture3DProj(00I30B"
+    "shadow2DEXT(00c20B"
+    "shadow2DProjEXT(00c30B"
+    "texture2D(00L10B"
+    "texture2DProj(00L20B"
+    "texture2DProj(00L30B"
+    "texture2DRect(00N10B"
+    "texture2DRectProj(00N20B"
+    "texture2DRectProj(00N30B"
+    "texture2DGradEXT(00H10B10B10B"
+    "texture2DProjGradEXT(00H20B10B10B"
+    "texture2DProjGradEXT(00H30B10B10B"
+    "textureCubeGradEXT(00J20B20B20B"
+    "textureVideoWEBGL(00p10B"
+    "texture2D(00H10B00B"
+    "texture2DProj(00H20B00B"
+    "texture2DProj(00H30B00B"
+    "textureCube(00J20B00B"
+    "texture3D(00I20B00B"
+    "texture3DProj(00I30B00B"
+    "texture3DLod(00I20B00B"
+    "texture3DProjLod(00I30B00B"
+    "texture2DLod(00H10B00B"
+    "texture2DProjLod(00H20B00B"
+    "texture2DProjLod(00H30B00B"
+    "textureCubeLod(00J20B00B"
+    "texture2DLodEXT(00H10B00B"
+    "texture2DProjLodEXT(00H20B00B"
+    "texture2DProjLodEXT(00H30B00B"
+    "textureCubeLodEXT(00J20B00B"
+    "texture(00H10B"
+    "texture(00Q10B"
+    "texture(00W10B"
+    "texture(00I20B"
+    "texture(00R20B"
+    "texture(00X20B"
+    "texture(00J20B"
+    "texture(00S20B"
+    "texture(00Y20B"
+    "texture(00K20B"
+    "texture(00T20B"
+    "texture(00Z20B"
+    "texture(00c20B"
+    "texture(00d30B"
+    "texture(00e30B"
+    "texture(00g30B"
+    "texture(00l30B"
+    "texture(00o30B"
+    "texture(00h30B00B"
+    "texture(00L10B"
+    "texture(00M10B"
+    "texture(00N10B"
+    "texture(00p10B"
+    "textureProj(00H20B"
+    "textureProj(00Q20B"
+    "textureProj(00W20B"
+    "textureProj(00H30B"
+    "textureProj(00Q30B"
+    "textureProj(00W30B"
+    "textureProj(00I30B"
+    "textureProj(00R30B"
+    "textureProj(00X30B"
+    "textureProj(00c30B"
+    "textureProj(00L20B"
+    "textureProj(00L30B"
+    "textureProj(00M20B"
+    "textureProj(00M30B"
+    "textureProj(00N20B"
+    "textureProj(00N30B"
+    "textureLod(00H10B00B"
+    "textureLod(00Q10B00B"
+    "textureLod(00W10B00B"
+    "textureLod(00I20B00B"
+    "textureLod(00R20B00B"
+    "textureLod(00X20B00B"
+    "textureLod(00J20B00B"
+    "textureLod(00S20B00B"
+    "textureLod(00Y20B00B"
+    "textureLod(00K20B00B"
+    "textureLod(00T20B00B"
+    "textureLod(00Z20B00B"
+    "textureLod(00c20B00B"
+    "textureLod(00d30B00B"
+    "textureLod(00e30B00B"
+    "textureLod(00h30B00B00B"
+    "textureLod(00g30B00B"
+    "textureLod(00l30B00B"
+    "textureLod(00o30B00B"
+    "textureSize(00H00C"
+    "textureSize(00Q00C"
+    "textureSize(00W00C"
+    "textureSize(00I00C"
+    "textureSize(00R00C"
+    "textureSize(00X00C"
+    "textureSize(00J00C"
+    "textureSize(00S00C"
+    "textureSize(00Y00C"
+    "textureSize(00K00C"
+    "textureSize(00T00C"
+    "textureSize(00Z00C"
+    "textureSize(00c00C"
+    "textureSize(00d00C"
+    "textureSize(00e00C"
+    "textureSize(00g00C"
+    "textureSize(00l00C"
+    "textureSize(00o00C"
+    "textureSize(00h00C"
+    "textureSize(00f"
+    "textureSize(00k"
+    "textureSize(00n"
+    "textureSize(00O"
+    "textureSize(00U"
+    "textureSize(00a"
+    "textureSize(00P"
+    "textureSize(00V"
+    "textureSize(00b"
+    "textureSize(00L00C"
+    "textureSize(00M00C"
+    "textureProjLod(00H20B00B"
+    "textureProjLod(00Q20B00B"
+    "textureProjLod(00W20B00B"
+    "textureProjLod(00H30B00B"
+    "textureProjLod(00Q30B00B"
+    "textureProjLod(00W30B00B"
+    "textureProjLod(00I30B00B"
+    "textureProjLod(00R30B00B"
+    "textureProjLod(00X30B00B"
+    "textureProjLod(00c30B00B"
+    "texelFetch(00H10C00C"
+    "texelFetch(00Q10C00C"
+    "texelFetch(00W10C00C"
+    "texelFetch(00I20C00C"
+    "texelFetch(00R20C00C"
+    "texelFetch(00X20C00C"
+    "texelFetch(00K20C00C"
+    "texelFetch(00T20C00C"
+    "texelFetch(00Z20C00C"
+    "texelFetch(00f00C"
+    "texelFetch(00k00C"
+    "texelFetch(00n00C"
+    "texelFetch(00O10C00C"
+    "texelFetch(00U10C00C"
+    "texelFetch(00a10C00C"
+    "texelFetch(00P20C00C"
+    "texelFetch(00V20C00C"
+    "texelFetch(00b20C00C"
+    "texelFetch(00L10C00C"
+    "texelFetch(00M10C00C"
+    "textureGrad(00H10B10B10B"
+    "textureGrad(00Q10B10B10B"
+    "textureGrad(00W10B10B10B"
+    "textureGrad(00I20B20B20B"
+    "textureGrad(00R20B20B20B"
+    "textureGrad(00X20B20B20B"
+    "textureGrad(00J20B20B20B"
+    "textureGrad(00S20B20B20B"
+    "textureGrad(00Y20B20B20B"
+    "textureGrad(00c20B10B10B"
+    "textureGrad(00d30B20B20B"
+    "textureGrad(00K20B10B10B"
+    "textureGrad(00T20B10B10B"
+    "textureGrad(00Z20B10B10B"
+    "textureGrad(00e30B10B10B"
+    "textureGrad(00g30B20B20B"
+    "textureGrad(00l30B20B20B"
+    "textureGrad(00o30B20B20B"
+    "textureProjGrad(00H20B10B10B"
+    "textureProjGrad(00Q20B10B10B"
+    "textureProjGrad(00W20B10B10B"
+    "textureProjGrad(00H30B10B10B"
+    "textureProjGrad(00Q30B10B10B"
+    "textureProjGrad(00W30B10B10B"
+    "textureProjGrad(00I30B20B20B"
+    "textureProjGrad(00R30B20B20B"
+    "textureProjGrad(00X30B20B20B"
+    "textureProjGrad(00c30B10B10B"
+    "texture(00H10B00B"
+    "texture(00Q10B00B"
+    "texture(00W10B00B"
+    "texture(00I20B00B"
+    "texture(00R20B00B"
+    "texture(00X20B00B"
+    "texture(00J20B00B"
+    "texture(00S20B00B"
+    "texture(00Y20B00B"
+    "texture(00K20B00B"
+    "texture(00T20B00B"
+    "texture(00Z20B00B"
+    "textureProj(00H20B00B"
+    "textureProj(00Q20B00B"
+    "textureProj(00W20B00B"
+    "textureProj(00H30B00B"
+    "textureProj(00Q30B00B"
+    "textureProj(00W30B00B"
+    "textureProj(00I30B00B"
+    "textureProj(00R30B00B"
+    "textureProj(00X30B00B"
+    "texture(00c20B00B"
+    "texture(00d30B00B"
+    "textureProj(00c30B00B"
+    "texture(00e30B00B"
+    "texture(00g30B00B"
+    "texture(00l30B00B"
+    "texture(00o30B00B"
+    "texture(00h30B00B00B"
+    "texture(00L10B00B"
+    "textureProj(00L20B00B"
+    "textureProj(00L30B00B"
+    "texture(00M10B00B"
+    "textureProj(00M20B00B"
+    "textureProj(00M30B00B"
+    "textureOffset(00H10B10C"
+    "textureOffset(00Q10B10C"
+    "textureOffset(00W10B10C"
+    "textureOffset(00I20B20C"
+    "textureOffset(00R20B20C"
+    "textureOffset(00X20B20C"
+    "textureOffset(00c20B10C"
+    "textureOffset(00K20B10C"
+    "textureOffset(00T20B10C"
+    "textureOffset(00Z20B10C"
+    "textureOffset(00e30B10C"
+    "textureProjOffset(00H20B10C"
+    "textureProjOffset(00Q20B10C"
+    "textureProjOffset(00W20B10C"
+    "textureProjOffset(00H30B10C"
+    "textureProjOffset(00Q30B10C"
+    "textureProjOffset(00W30B10C"
+    "textureProjOffset(00I30B20C"
+    "textureProjOffset(00R30B20C"
+    "textureProjOffset(00X30B20C"
+    "textureProjOffset(00c30B10C"
+    "textureLodOffset(00H10B00B10C"
+    "textureLodOffset(00Q10B00B10C"
+    "textureLodOffset(00W10B00B10C"
+    "textureLodOffset(00I20B00B20C"
+    "textureLodOffset(00R20B00B20C"
+    "textureLodOffset(00X20B00B20C"
+    "textureLodOffset(00c20B00B10C"
+    "textureLodOffset(00K20B00B10C"
+    "textureLodOffset(00T20B00B10C"
+    "textureLodOffset(00Z20B00B10C"
+    "textureLodOffset(00e30B00B10C"
+    "textureProjLodOffset(00H20B00B10C"
+    "textureProjLodOffset(00Q20B00B10C"
+    "textureProjLodOffset(00W20B00B10C"
+    "textureProjLodOffset(00H30B00B10C"
+    "textureProjLodOffset(00Q30B00B10C"
+    "textureProjLodOffset(00W30B00B10C"
+    "textureProjLodOffset(00I30B00B20C"
+    "textureProjLodOffset(00R30B00B20C"
+    "textureProjLodOffset(00X30B00B20C"
+    "textureProjLodOffset(00c30B00B10C"
+    "texelFetchOffset(00H10C00C10C"
+    "texelFetchOffset(00Q10C00C10C"
+    "texelFetchOffset(00W10C00C10C"
+    "texelFetchOffset(00I20C00C20C"
+    "texelFetchOffset(00R20C00C20C"
+    "texelFetchOffset(00X20C00C20C"
+    "texelFetchOffset(00K20C00C10C"
+    "texelFetchOffset(00T20C00C10C"
+    "texelFetchOffset(00Z20C00C10C"
+    "textureGradOffset(00H10B10B10B10C"
+    "textureGradOffset(00Q10B10B10B10C"
+    "textureGradOffset(00W10B10B10B10C"
+    "textureGradOffset(00I20B20B20B20C"
+    "textureGradOffset(00R20B20B20B20C"
+    "textureGradOffset(00X20B20B20B20C"
+    "textureGradOffset(00c20B10B10B10C"
+    "textureGradOffset(00K20B10B10B10C"
+    "textureGradOffset(00T20B10B10B10C"
+    "textureGradOffset(00Z20B10B10B10C"
+    "textureGradOffset(00e30B10B10B10C"
+    "textureProjGradOffset(00H20B10B10B10C"
+    "textureProjGradOffset(00Q20B10B10B10C"
+    "textureProjGradOffset(00W20B10B10B10C"
+    "textureProjGradOffset(00H30B10B10B10C"
+    "textureProjGradOffset(00Q30B10B10B10C"
+    "textureProjGradOffset(00W30B10B10B10C"
+    "textureProjGradOffset(00I30B20B20B20C"
+    "textureProjGradOffset(00R30B20B20B20C"
+    "textureProjGradOffset(00X30B20B20B20C"
+    "textureProjGradOffset(00c30B10B10B10C"
+    "textureOffset(00H10B10C00B"
+    "textureOffset(00Q10B10C00B"
+    "textureOffset(00W10B10C00B"
+    "textureOffset(00I20B20C00B"
+    "textureOffset(00R20B20C00B"
+    "textureOffset(00X20B20C00B"
+    "textureOffset(00c20B10C00B"
+    "textureOffset(00K20B10C00B"
+    "textureOffset(00T20B10C00B"
+    "textureOffset(00Z20B10C00B"
+    "textureOffset(00e30B10C00B"
+    "textureProjOffset(00H20B10C00B"
+    "textureProjOffset(00Q20B10C00B"
+    "textureProjOffset(00W20B10C00B"
+    "textureProjOffset(00H30B10C00B"
+    "textureProjOffset(00Q30B10C00B"
+    "textureProjOffset(00W30B10C00B"
+    "textureProjOffset(00I30B20C00B"
+    "textureProjOffset(00R30B20C00B"
+    "textureProjOffset(00X30B20C00B"
+    "textureProjOffset(00c30B10C00B"
+    "textureGather(00H10B"
+    "textureGather(00Q10B"
+    "textureGather(00W10B"
+    "textureGather(00K20B"
+    "textureGather(00T20B"
+    "textureGather(00Z20B"
+    "textureGather(00J20B"
+    "textureGather(00S20B"
+    "textureGather(00Y20B"
+    "textureGather(00g30B"
+    "textureGather(00l30B"
+    "textureGather(00o30B"
+    "textureGather(00H10B00C"
+    "textureGather(00Q10B00C"
+    "textureGather(00W10B00C"
+    "textureGather(00K20B00C"
+    "textureGather(00T20B00C"
+    "textureGather(00Z20B00C"
+    "textureGather(00J20B00C"
+    "textureGather(00S20B00C"
+    "textureGather(00Y20B00C"
+    "textureGather(00g30B00C"
+    "textureGather(00l30B00C"
+    "textureGather(00o30B00C"
+    "textureGather(00h30B00B"
+    "textureGather(00c10B00B"
+    "textureGather(00e20B00B"
+    "textureGather(00d20B00B"
+    "textureGatherOffset(00H10B10C"
+    "textureGatherOffset(00Q10B10C"
+    "textureGatherOffset(00W10B10C"
+    "textureGatherOffset(00K20B10C"
+    "textureGatherOffset(00T20B10C"
+    "textureGatherOffset(00Z20B10C"
+    "textureGatherOffset(00H10B10C00C"
+    "textureGatherOffset(00Q10B10C00C"
+    "textureGatherOffset(00W10B10C00C"
+    "textureGatherOffset(00K20B10C00C"
+    "textureGatherOffset(00T20B10C00C"
+    "textureGatherOffset(00Z20B10C00C"
+    "textureGatherOffset(00c10B00B10C"
+    "textureGatherOffset(00e20B00B10C"
+    "textureGatherOffsets(00H10B10Cx4"
+    "textureGatherOffsets(00Q10B10Cx4"
+    "textureGatherOffsets(00W10B10Cx4"
+    "textureGatherOffsets(00K20B10Cx4"
+    "textureGatherOffsets(00T20B10Cx4"
+    "textureGatherOffsets(00Z20B10Cx4"
+    "textureGatherOffsets(00H10B10Cx400C"
+    "textureGatherOffsets(00Q10B10Cx400C"
+    "textureGatherOffsets(00W10B10Cx400C"
+    "textureGatherOffsets(00K20B10Cx400C"
+    "textureGatherOffsets(00T20B10Cx400C"
+    "textureGatherOffsets(00Z20B10Cx400C"
+    "textureGatherOffsets(00c10B00B10Cx4"
+    "textureGatherOffsets(00e20B00B10Cx4"
+    "textureQueryLOD(00H10B"
+    "textureQueryLOD(00Q10B"
+    "textureQueryLOD(00W10B"
+    "textureQueryLOD(00I20B"
+    "textureQueryLOD(00R20B"
+    "textureQueryLOD(00X20B"
+    "textureQueryLOD(00J20B"
+    "textureQueryLOD(00S20B"
+    "textureQueryLOD(00Y20B"
+    "textureQueryLOD(00K10B"
+    "textureQueryLOD(00T10B"
+    "textureQueryLOD(00Z10B"
+    "textureQueryLOD(00c10B"
+    "textureQueryLOD(00d20B"
+    "textureQueryLOD(00e10B"
+    "textureQueryLOD(00g20B"
+    "textureQueryLOD(00l20B"
+    "textureQueryLOD(00o20B"
+    "textureQueryLOD(00h20B"
+    "rgb_2_yuv(20B00G"
+    "yuv_2_rgb(20B00G"
+    "dFdx(00B"
+    "dFdx(10B"
+    "dFdx(20B"
+    "dFdx(30B"
+    "dFdy(00B"
+    "dFdy(10B"
+    "dFdy(20B"
+    "dFdy(30B"
+    "fwidth(00B"
+    "fwidth(10B"
+    "fwidth(20B"
+    "fwidth(30B"
+    "interpolateAtCentroid(00B"
+    "interpolateAtCentroid(10B"
+    "interpolateAtCentroid(20B"
+    "interpolateAtCentroid(30B"
+    "interpolateAtSample(00B00C"
+    "interpolateAtSample(10B00C"
+    "interpolateAtSample(20B00C"
+    "interpolateAtSample(30B00C"
+    "interpolateAtOffset(00B10B"
+    "interpolateAtOffset(10B10B"
+    "interpolateAtOffset(20B10B"
+    "interpolateAtOffset(30B10B"
+    "atomicCounter(00F"
+    "atomicCounterIncrement(00F"
+    "atomicCounterDecrement(00F"
+    "atomicAdd(00D00D"
+    "atomicAdd(00C00C"
+    "atomicMin(00D00D"
+    "atomicMin(00C00C"
+    "atomicMax(00D00D"
+    "atomicMax(00C00C"
+    "atomicAnd(00D00D"
+    "atomicAnd(00C00C"
+    "atomicOr(00D00D"
+    "atomicOr(00C00C"
+    "atomicXor(00D00D"
+    "atomicXor(00C00C"
+    "atomicExchange(00D00D"
+    "atomicExchange(00C00C"
+    "atomicCompSwap(00D00D00D"
+    "atomicCompSwap(00C00C00C"
+    "imageSize(00q"
+    "imageSize(00z"
+    "imageSize(01I"
+    "imageSize(00r"
+    "imageSize(01A"
+    "imageSize(01J"
+    "imageSize(00s"
+    "imageSize(01B"
+    "imageSize(01K"
+    "imageSize(00t"
+    "imageSize(01C"
+    "imageSize(01L"
+    "imageSize(00w"
+    "imageSize(01F"
+    "imageSize(01O"
+    "imageSize(00y"
+    "imageSize(01H"
+    "imageSize(01Q"
+    "imageStore(00q10C30B"
+    "imageStore(00z10C30C"
+    "imageStore(01I10C30D"
+    "imageStore(00r20C30B"
+    "imageStore(01A20C30C"
+    "imageStore(01J20C30D"
+    "imageStore(00s20C30B"
+    "imageStore(01B20C30C"
+    "imageStore(01K20C30D"
+    "imageStore(00t20C30B"
+    "imageStore(01C20C30C"
+    "imageStore(01L20C30D"
+    "imageStore(00w20C30B"
+    "imageStore(01F20C30C"
+    "imageStore(01O20C30D"
+    "imageStore(00y00C30B"
+    "imageStore(01H00C30C"
+    "imageStore(01Q00C30D"
+    "imageLoad(00q10C"
+    "imageLoad(00z10C"
+    "imageLoad(01I10C"
+    "imageLoad(00r20C"
+    "imageLoad(01A20C"
+    "imageLoad(01J20C"
+    "imageLoad(00s20C"
+    "imageLoad(01B20C"
+    "imageLoad(01K20C"
+    "imageLoad(00t20C"
+    "imageLoad(01C20C"
+    "imageLoad(01L20C"
+    "imageLoad(00w20C"
+    "imageLoad(01F20C"
+    "imageLoad(01O20C"
+    "imageLoad(00y00C"
+    "imageLoad(01H00C"
+    "imageLoad(01Q00C"
+    "imageAtomicAdd(00q10C00D"
+    "imageAtomicAdd(00z10C00D"
+    "imageAtomicAdd(01I10C00D"
+    "imageAtomicAdd(00r20C00D"
+    "imageAtomicAdd(01A20C00D"
+    "imageAtomicAdd(01J20C00D"
+    "imageAtomicAdd(00t20C00D"
+    "imageAtomicAdd(01C20C00D"
+    "imageAtomicAdd(01L20C00D"
+    "imageAtomicAdd(00y00C00D"
+    "imageAtomicAdd(01H00C00D"
+    "imageAtomicAdd(01Q00C00D"
+    "imageAtomicAdd(00s20C00D"
+    "imageAtomicAdd(01B20C00D"
+    "imageAtomicAdd(01K20C00D"
+    "imageAtomicAdd(00w20C00D"
+    "imageAtomicAdd(01F20C00D"
+    "imageAtomicAdd(01O20C00D"
+    "imageAtomicAdd(00q10C00C"
+    "imageAtomicAdd(00z10C00C"
+    "imageAtomicAdd(01I10C00C"
+    "imageAtomicAdd(00r20C00C"
+    "imageAtomicAdd(01A20C00C"
+    "imageAtomicAdd(01J20C00C"
+    "imageAtomicAdd(00t20C00C"
+    "imageAtomicAdd(01C20C00C"
+    "imageAtomicAdd(01L20C00C"
+    "imageAtomicAdd(00y00C00C"
+    "imageAtomicAdd(01H00C00C"
+    "imageAtomicAdd(01Q00C00C"
+    "imageAtomicAdd(00s20C00C"
+    "imageAtomicAdd(01B20C00C"
+    "imageAtomicAdd(01K20C00C"
+    "imageAtomicAdd(00w20C00C"
+    "imageAtomicAdd(01F20C00C"
+    "imageAtomicAdd(01O20C00C"
+    "imageAtomicMin(00q10C00D"
+    "imageAtomicMin(00z10C00D"
+    "imageAtomicMin(01I10C00D"
+    "imageAtomicMin(00r20C00D"
+    "imageAtomicMin(01A20C00D"
+    "imageAtomicMin(01J20C00D"
+    "imageAtomicMin(00t20C00D"
+    "imageAtomicMin(01C20C00D"
+    "imageAtomicMin(01L20C00D"
+    "imageAtomicMin(00y00C00D"
+    "imageAtomicMin(01H00C00D"
+    "imageAtomicMin(01Q00C00D"
+    "imageAtomicMin(00s20C00D"
+    "imageAtomicMin(01B20C00D"
+    "imageAtomicMin(01K20C00D"
+    "imageAtomicMin(00w20C00D"
+    "imageAtomicMin(01F20C00D"
+    "imageAtomicMin(01O20C00D"
+    "imageAtomicMin(00q10C00C"
+    "imageAtomicMin(00z10C00C"
+    "imageAtomicMin(01I10C00C"
+    "imageAtomicMin(00r20C00C"
+    "imageAtomicMin(01A20C00C"
+    "imageAtomicMin(01J20C00C"
+    "imageAtomicMin(00t20C00C"
+    "imageAtomicMin(01C20C00C"
+    "imageAtomicMin(01L20C00C"
+    "imageAtomicMin(00y00C00C"
+    "imageAtomicMin(01H00C00C"
+    "imageAtomicMin(01Q00C00C"
+    "imageAtomicMin(00s20C00C"
+    "imageAtomicMin(01B20C00C"
+    "imageAtomicMin(01K20C00C"
+    "imageAtomicMin(00w20C00C"
+    "imageAtomicMin(01F20C00C"
+    "imageAtomicMin(01O20C00C"
+    "imageAtomicMax(00q10C00D"
+    "imageAtomicMax(00z10C00D"
+    "imageAtomicMax(01I10C00D"
+    "imageAtomicMax(00r20C00D"
+    "imageAtomicMax(01A20C00D"
+    "imageAtomicMax(01J20C00D"
+    "imageAtomicMax(00t20C00D"
+    "imageAtomicMax(01C20C00D"
+    "imageAtomicMax(01L20C00D"
+    "imageAtomicMax(00y00C00D"
+    "imageAtomicMax(01H00C00D"
+    "imageAtomicMax(01Q00C00D"
+    "imageAtomicMax(00s20C00D"
+    "imageAtomicMax(01B20C00D"
+    "imageAtomicMax(01K20C00D"
+    "imageAtomicMax(00w20C00D"
+    "imageAtomicMax(01F20C00D"
+    "imageAtomicMax(01O20C00D"
+    "imageAtomicMax(00q10C00C"
+    "imageAtomicMax(00z10C00C"
+    "imageAtomicMax(01I10C00C"
+    "imageAtomicMax(00r20C00C"
+    "imageAtomicMax(01A20C00C"
+    "imageAtomicMax(01J20C00C"
+    "imageAtomicMax(00t20C00C"
+    "imageAtomicMax(01C20C00C"
+    "imageAtomicMax(01L20C00C"
+    "imageAtomicMax(00y00C00C"
+    "imageAtomicMax(01H00C00C"
+    "imageAtomicMax(01Q00C00C"
+    "imageAtomicMax(00s20C00C"
+    "imageAtomicMax(01B20C00C"
+    "imageAtomicMax(01K20C00C"
+    "imageAtomicMax(00w20C00C"
+    "imageAtomicMax(01F20C00C"
+    "imageAtomicMax(01O20C00C"
+    "imageAtomicAnd(00q10C00D"
+    "imageAtomicAnd(00z10C00D"
+    "imageAtomicAnd(01I10C00D"
+    "imageAtomicAnd(00r20C00D"
+    "imageAtomicAnd(01A20C00D"
+    "imageAtomicAnd(01J20C00D"
+    "imageAtomicAnd(00t20C00D"
+    "imageAtomicAnd(01C20C00D"
+    "imageAtomicAnd(01L20C00D"
+    "imageAtomicAnd(00y00C00D"
+    "imageAtomicAnd(01H00C00D"
+    "imageAtomicAnd(01Q00C00D"
+    "imageAtomicAnd(00s20C00D"
+    "imageAtomicAnd(01B20C00D"
+    "imageAtomicAnd(01K20C00D"
+    "imageAtomicAnd(00w20C00D"
+    "imageAtomicAnd(01F20C00D"
+    "imageAtomicAnd(01O20C00D"
+    "imageAtomicAnd(00q10C00C"
+    "imageAtomicAnd(00z10C00C"
+    "imageAtomicAnd(01I10C00C"
+    "imageAtomicAnd(00r20C00C"
+    "imageAtomicAnd(01A20C00C"
+    "imageAtomicAnd(01J20C00C"
+    "imageAtomicAnd(00t20C00C"
+    "imageAtomicAnd(01C20C00C"
+    "imageAtomicAnd(01L20C00C"
+    "imageAtomicAnd(00y00C00C"
+    "imageAtomicAnd(01H00C00C"
+    "imageAtomicAnd(01Q00C00C"
+    "imageAtomicAnd(00s20C00C"
+    "imageAtomicAnd(01B20C00C"
+    "imageAtomicAnd(01K20C00C"
+    "imageAtomicAnd(00w20C00C"
+    "imageAtomicAnd(01F20C00C"
+    "imageAtomicAnd(01O20C00C"
+    "imageAtomicOr(00q10C00D"
+    "imageAtomicOr(00z10C00D"
+    "imageAtomicOr(01I10C00D"
+    "imageAtomicOr(00r20C00D"
+    "imageAtomicOr(01A20C00D"
+    "imageAtomicOr(01J20C00D"
+    "imageAtomicOr(00t20C00D"
+    "imageAtomicOr(01C20C00D"
+    "imageAtomicOr(01L20C00D"
+    "imageAtomicOr(00y00C00D"
+    "imageAtomicOr(01H00C00D"
+    "imageAtomicOr(01Q00C00D"
+    "imageAtomicOr(00s20C00D"
+    "imageAtomicOr(01B20C00D"
+    "imageAtomicOr(01K20C00D"
+    "imageAtomicOr(00w20C00D"
+    "imageAtomicOr(01F20C00D"
+    "imageAtomicOr(01O20C00D"
+    "imageAtomicOr(00q10C00C"
+    "imageAtomicOr(00z10C00C"
+    "imageAtomicOr(01I10C00C"
+    "imageAtomicOr(00r20C00C"
+    "imageAtomicOr(01A20C00C"
+    "imageAtomicOr(01J20C00C"
+    "imageAtomicOr(00t20C00C"
+    "imageAtomicOr(01C20C00C"
+    "imageAtomicOr(01L20C00C"
+    "imageAtomicOr(00y00C00C"
+    "imageAtomicOr(01H00C00C"
+    "imageAtomicOr(01Q00C00C"
+    "imageAtomicOr(00s20C00C"
+    "imageAtomicOr(01B20C00C"
+    "imageAtomicOr(01K20C00C"
+    "imageAtomicOr(00w20C00C"
+    "imageAtomicOr(01F20C00C"
+    "imageAtomicOr(01O20C00C"
+    "imageAtomicXor(00q10C00D"
+    "imageAtomicXor(00z10C00D"
+    "imageAtomicXor(01I10C00D"
+    "imageAtomicXor(00r20C00D"
+    "imageAtomicXor(01A20C00D"
+    "imageAtomicXor(01J20C00D"
+    "imageAtomicXor(00t20C00D"
+    "imageAtomicXor(01C20C00D"
+    "imageAtomicXor(01L20C00D"
+    "imageAtomicXor(00y00C00D"
+    "imageAtomicXor(01H00C00D"
+    "imageAtomicXor(01Q00C00D"
+    "imageAtomicXor(00s20C00D"
+    "imageAtomicXor(01B20C00D"
+    "imageAtomicXor(01K20C00D"
+    "imageAtomicXor(00w20C00D"
+    "imageAtomicXor(01F20C00D"
+    "imageAtomicXor(01O20C00D"
+    "imageAtomicXor(00q10C00C"
+    "imageAtomicXor(00z10C00C"
+    "imageAtomicXor(01I10C00C"
+    "imageAtomicXor(00r20C00C"
+    "imageAtomicXor(01A20C00C"
+    "imageAtomicXor(01J20C00C"
+    "imageAtomicXor(00t20C00C"
+    "imageAtomicXor(01C20C00C"
+    "imageAtomicXor(01L20C00C"
+    "imageAtomicXor(00y00C00C"
+    "imageAtomicXor(01H00C00C"
+    "imageAtomicXor(01Q00C00C"
+    "imageAtomicXor(00s20C00C"
+    "imageAtomicXor(01B20C00C"
+    "imageAtomicXor(01K20C00C"
+    "imageAtomicXor(00w20C00C"
+    "imageAtomicXor(01F20C00C"
+    "imageAtomicXor(01O20C00C"
+    "imageAtomicExchange(00q10C00D"
+    "imageAtomicExchange(00z10C00D"
+    "imageAtomicExchange(01I10C00D"
+    "imageAtomicExchange(00r20C00D"
+    "imageAtomicExchange(01A20C00D"
+    "imageAtomicExchange(01J20C00D"
+    "imageAtomicExchange(00t20C00D"
+    "imageAtomicExchange(01C20C00D"
+    "imageAtomicExchange(01L20C00D"
+    "imageAtomicExchange(00y00C00D"
+    "imageAtomicExchange(01H00C00D"
+    "imageAtomicExchange(01Q00C00D"
+    "imageAtomicExchange(00s20C00D"
+    "imageAtomicExchange(01B20C00D"
+    "imageAtomicExchange(01K20C00D"
+    "imageAtomicExchange(00w20C00D"
+    "imageAtomicExchange(01F20C00D"
+    "imageAtomicExchange(01O20C00D"
+    "imageAtomicExchange(00q10C00C"
+    "imageAtomicExchange(00z10C00C"
+    "imageAtomicExchange(01I10C00C"
+    "imageAtomicExchange(00r20C00C"
+    "imageAtomicExchange(01A20C00C"
+    "imageAtomicExchange(01J20C00C"
+    "imageAtomicExchange(00t20C00C"
+    "imageAtomicExchange(01C20C00C"
+    "imageAtomicExchange(01L20C00C"
+    "imageAtomicExchange(00y00C00C"
+    "imageAtomicExchange(01H00C00C"
+    "imageAtomicExchange(01Q00C00C"
+    "imageAtomicExchange(00s20C00C"
+    "imageAtomicExchange(01B20C00C"
+    "imageAtomicExchange(01K20C00C"
+    "imageAtomicExchange(00w20C00C"
+    "imageAtomicExchange(01F20C00C"
+    "imageAtomicExchange(01O20C00C"
+    "imageAtomicExchange(00q10C00B"
+    "imageAtomicExchange(00z10C00B"
+    "imageAtomicExchange(01I10C00B"
+    "imageAtomicExchange(00r20C00B"
+    "imageAtomicExchange(01A20C00B"
+    "imageAtomicExchange(01J20C00B"
+    "imageAtomicExchange(00t20C00B"
+    "imageAtomicExchange(01C20C00B"
+    "imageAtomicExchange(01L20C00B"
+    "imageAtomicExchange(00y00C00B"
+    "imageAtomicExchange(01H00C00B"
+    "imageAtomicExchange(01Q00C00B"
+    "imageAtomicExchange(00s20C00B"
+    "imageAtomicExchange(01B20C00B"
+    "imageAtomicExchange(01K20C00B"
+    "imageAtomicExchange(00w20C00B"
+    "imageAtomicExchange(01F20C00B"
+    "imageAtomicExchange(01O20C00B"
+    "imageAtomicCompSwap(00q10C00D00D"
+    "imageAtomicCompSwap(00z10C00D00D"
+    "imageAtomicCompSwap(01I10C00D00D"
+    "imageAtomicCompSwap(00r20C00D00D"
+    "imageAtomicCompSwap(01A20C00D00D"
+    "imageAtomicCompSwap(01J20C00D00D"
+    "imageAtomicCompSwap(00t20C00D00D"
+    "imageAtomicCompSwap(01C20C00D00D"
+    "imageAtomicCompSwap(01L20C00D00D"
+    "imageAtomicCompSwap(00y00C00D00D"
+    "imageAtomicCompSwap(01H00C00D00D"
+    "imageAtomicCompSwap(01Q00C00D00D"
+    "imageAtomicCompSwap(00s20C00D00D"
+    "imageAtomicCompSwap(01B20C00D00D"
+    "imageAtomicCompSwap(01K20C00D00D"
+    "imageAtomicCompSwap(00w20C00D00D"
+    "imageAtomicCompSwap(01F20C00D00D"
+    "imageAtomicCompSwap(01O20C00D00D"
+    "imageAtomicCompSwap(00q10C00C00C"
+    "imageAtomicCompSwap(00z10C00C00C"
+    "imageAtomicCompSwap(01I10C00C00C"
+    "imageAtomicCompSwap(00r20C00C00C"
+    "imageAtomicCompSwap(01A20C00C00C"
+    "imageAtomicCompSwap(01J20C00C00C"
+    "imageAtomicCompSwap(00t20C00C00C"
+    "imageAtomicCompSwap(01C20C00C00C"
+    "imageAtomicCompSwap(01L20C00C00C"
+    "imageAtomicCompSwap(00y00C00C00C"
+    "imageAtomicCompSwap(01H00C00C00C"
+    "imageAtomicCompSwap(01Q00C00C00C"
+    "imageAtomicCompSwap(00s20C00C00C"
+    "imageAtomicCompSwap(01B20C00C00C"
+    "imageAtomicCompSwap(01K20C00C00C"
+    "imageAtomicCompSwap(00w20C00C00C"
+    "imageAtomicCompSwap(01F20C00C00C"
+    "imageAtomicCompSwap(01O20C00C00C"
+    "pixelLocalLoadANGLE(01R"
+    "pixelLocalLoadANGLE(01S"
+    "pixelLocalLoadANGLE(01T"
+    "pixelLocalStoreANGLE(01R30B"
+    "pixelLocalStoreANGLE(01S30C"
+    "pixelLocalStoreANGLE(01T30D"
+    "beginInvocationInterlockNV("
+    "endInvocationInterlockNV("
+    "beginFragmentShaderOrderingINTEL("
+    "beginInvocationInterlockARB("
+    "endInvocationInterlockARB("
+    "memoryBarrier("
+    "memoryBarrierAtomicCounter("
+    "memoryBarrierBuffer("
+    "memoryBarrierImage("
+    "barrier("
+    "memoryBarrierShared("
+    "groupMemoryBarrier("
+    "EmitVertex("
+    "EndPrimitive("
+    "subpassLoad(01U"
+    "subpassLoad(01V"
+    "subpassLoad(01W"
+    "numSamples("
+    "samplePosition(00D"
+    "interpolateAtCenter(00B"
+    "interpolateAtCenter(10B"
+    "interpolateAtCenter(20B"
+    "interpolateAtCenter(30B"
+    "loopForwardProgress("
+    "saturate(00B"
+    "saturate(10B"
+    "saturate(20B"
+    "saturate(30B"
+    "gl_DepthRangeParameters"
+    "gl_DepthRange"
+    "gl_NumSamples"
+    "gl_MaxVertexAttribs"
+    "gl_MaxVertexUniformVectors"
+    "gl_MaxVertexTextureImageUnits"
+    "gl_MaxCombinedTextureImageUnits"
+    "gl_MaxTextureImageUnits"
+    "gl_MaxFragmentUniformVectors"
+    "gl_MaxVaryingVectors"
+    "gl_MaxDrawBuffers"
+    "gl_MaxDualSourceDrawBuffersEXT"
+    "gl_MaxVertexOutputVectors"
+    "gl_MaxFragmentInputVectors"
+    "gl_MinProgramTexelOffset"
+    "gl_MaxProgramTexelOffset"
+    "gl_MaxImageUnits"
+    "gl_MaxVertexImageUniforms"
+    "gl_MaxFragmentImageUniforms"
+    "gl_MaxComputeImageUniforms"
+    "gl_MaxCombinedImageUniforms"
+    "gl_MaxCombinedShaderOutputResources"
+    "gl_MaxComputeWorkGroupCount"
+    "gl_MaxComputeWorkGroupSize"
+    "gl_MaxComputeUniformComponents"
+    "gl_MaxComputeTextureImageUnits"
+    "gl_MaxComputeAtomicCounters"
+    "gl_MaxComputeAtomicCounterBuffers"
+    "gl_MaxVertexAtomicCounters"
+    "gl_MaxFragmentAtomicCounters"
+    "gl_MaxCombinedAtomicCounters"
+    "gl_MaxAtomicCounterBindings"
+    "gl_MaxVertexAtomicCounterBuffers"
+    "gl_MaxFragmentAtomicCounterBuffers"
+    "gl_MaxCombinedAtomicCounterBuffers"
+    "gl_MaxAtomicCounterBufferSize"
+    "gl_MaxGeometryInputComponents"
+    "gl_MaxGeometryOutputComponents"
+    "gl_MaxGeometryImageUniforms"
+    "gl_MaxGeometryTextureImageUnits"
+    "gl_MaxGeometryOutputVertices"
+    "gl_MaxGeometryTotalOutputComponents"
+    "gl_MaxGeometryUniformComponents"
+    "gl_MaxGeometryAtomicCounters"
+    "gl_MaxGeometryAtomicCounterBuffers"
+    "gl_MaxTessControlInputComponents"
+    "gl_MaxTessControlOutputComponents"
+    "gl_MaxTessControlTextureImageUnits"
+    "gl_MaxTessControlUniformComponents"
+    "gl_MaxTessControlTotalOutputComponents"
+    "gl_MaxTessControlImageUniforms"
+    "gl_MaxTessControlAtomicCounters"
+    "gl_MaxTessControlAtomicCounterBuffers"
+    "gl_MaxTessPatchComponents"
+    "gl_MaxPatchVertices"
+    "gl_MaxTessGenLevel"
+    "gl_MaxTessEvaluationInputComponents"
+    "gl_MaxTessEvaluationOutputComponents"
+    "gl_MaxTessEvaluationTextureImageUnits"
+    "gl_MaxTessEvaluationUniformComponents"
+    "gl_MaxTessEvaluationImageUniforms"
+    "gl_MaxTessEvaluationAtomicCounters"
+    "gl_MaxTessEvaluationAtomicCounterBuffers"
+    "gl_MaxSamples"
+    "gl_MaxClipDistances"
+    "gl_MaxCullDistances"
+    "gl_MaxCombinedClipAndCullDistances"
+    "gl_FragCoord"
+    "gl_FrontFacing"
+    "gl_PointCoord"
+    "gl_FragColor"
+    "gl_FragData"
+    "gl_FragDepth"
+    "gl_HelperInvocation"
+    "gl_SecondaryFragColorEXT"
+    "gl_SecondaryFragDataEXT"
+    "gl_FragDepthEXT"
+    "gl_LastFragData"
+    "gl_LastFragColor"
+    "gl_LastFragColorARM"
+    "gl_LastFragDepthARM"
+    "gl_LastFragStencilARM"
+    "gl_PrimitiveID"
+    "gl_Layer"
+    "gl_SampleID"
+    "gl_SamplePosition"
+    "gl_SampleMaskIn"
+    "gl_SampleMask"
+    "gl_Position"
+    "gl_PointSize"
+    "gl_InstanceID"
+    "gl_InstanceIndex"
+    "gl_VertexID"
+    "gl_VertexIndex"
+    "gl_DrawID"
+    "gl_BaseVertex"
+    "gl_BaseInstance"
+    "angle_BaseVertex"
+    "angle_BaseInstance"
+    "gl_ClipDistance"
+    "gl_NumWorkGroups"
+    "gl_WorkGroupSize"
+    "gl_WorkGroupID"
+    "gl_LocalInvocationID"
+    "gl_GlobalInvocationID"
+    "gl_LocalInvocationIndex"
+    "gl_PrimitiveIDIn"
+    "gl_InvocationID"
+    "gl_PerVertex"
+    "gl_in"
+    "gl_PatchVerticesIn"
+    "gl_TessLevelOuter"
+    "gl_TessLevelInner"
+    "gl_out"
+    "gl_BoundingBox"
+    "gl_BoundingBoxEXT"
+    "gl_BoundingBoxOES"
+    "gl_TessCoord"
+    "gl_ViewID_OVR"
+    "gl_CullDistance";
+
+// Flat array of offsets from a symbol into kMangledNames.  The last offset is the end of the last
+// name.
+constexpr uint16_t kMangledNameOffsets[] = {
+    0,      // radians_00B
+    11,     // radians_10B
+    22,     // radians_20B
+    33,     // radians_30B
+    44,     // degrees_00B
+    55,     // degrees_10B
+    66,     // degrees_20B
+    77,     // degrees_30B
+    88,     // sin_00B
+    95,     // sin_10B
+    102,    // sin_20B
+    109,    // sin_30B
+    116,    // cos_00B
+    123,    // cos_10B
+    130,    // cos_20B
+    137,    // cos_30B
+    144,    // tan_00B
+    151,    // tan_10B
+    158,    // tan_20B
+    165,    // tan_30B
+    172,    // asin_00B
+    180,    // asin_10B
+    188,    // asin_20B
+    196,    // asin_30B
+    204,    // acos_00B
+    212,    // acos_10B
+    220,    // acos_20B
+    228,    // acos_30B
+    236,    // atan_00B00B
+    247,    // atan_10B10B
+    258,    // atan_20B20B
+    269,    // atan_30B30B
+    280,    // atan_00B
+    288,    // atan_10B
+    296,    // atan_20B
+    304,    // atan_30B
+    312,    // sinh_00B
+    320,    // sinh_10B
+    328,    // sinh_20B
+    336,    // sinh_30B
+    344,    // cosh_00B
+    352,    // cosh_10B
+    360,    // cosh_20B
+    368,    // cosh_30B
+    376,    // tanh_00B
+    384,    // tanh_10B
+    392,    // tanh_20B
+    400,    // tanh_30B
+    408,    // asinh_00B
+    417,    // asinh_10B
+    426,    // asinh_20B
+    435,    // asinh_30B
+    444,    // acosh_00B
+    453,    // acosh_10B
+    462,    // acosh_20B
+    471,    // acosh_30B
+    480,    // atanh_00B
+    489,    // atanh_10B
+    498,    // atanh_20B
+    507,    // atanh_30B
+    516,    // pow_00B00B
+    526,    // pow_10B10B
+    536,    // pow_20B20B
+    546,    // pow_30B30B
+    556,    // exp_00B
+    563,    // exp_10B
+    570,    // exp_20B
+    577,    // exp_30B
+    584,    // log_00B
+    591,    // log_10B
+    598,    // log_20B
+    605,    // log_30B
+    612,    // exp2_00B
+    620,    // exp2_10B
+    628,    // exp2_20B
+    636,    // exp2_30B
+    644,    // log2_00B
+    652,    // log2_10B
+    660,    // log2_20B
+    668,    // log2_30B
+    676,    // sqrt_00B
+    684,    // sqrt_10B
+    692,    // sqrt_20B
+    700,    // sqrt_30B
+    708,    // inversesqrt_00B
+    723,    // inversesqrt_10B
+    738,    // inversesqrt_20B
+    753,    // inversesqrt_30B
+    768,    // abs_00B
+    775,    // abs_10B
+    782,    // abs_20B
+    789,    // abs_30B
+    796,    // abs_00C
+    803,    // abs_10C
+    810,    // abs_20C
+    817,    // abs_30C
+    824,    // sign_00B
+    832,    // sign_10B
+    840,    // sign_20B
+    848,    // sign_30B
+    856,    // sign_00C
+    864,    // sign_10C
+    872,    // sign_20C
+    880,    // sign_30C
+    888,    // floor_00B
+    897,    // floor_10B
+    906,    // floor_20B
+    915,    // floor_30B
+    924,    // trunc_00B
+    933,    // trunc_10B
+    942,    // trunc_20B
+    951,    // trunc_30B
+    960,    // round_00B
+    969,    // round_10B
+    978,    // round_20B
+    987,    // round_30B
+    996,    // roundEven_00B
+    1009,   // roundEven_10B
+    1022,   // roundEven_20B
+    1035,   // roundEven_30B
+    1048,   // ceil_00B
+    1056,   // ceil_10B
+    1064,   // ceil_20B
+    1072,   // ceil_30B
+    1080,   // fract_00B
+    1089,   // fract_10B
+    1098,   // fract_20B
+    1107,   // fract_30B
+    1116,   // mod_00B00B
+    1126,   // mod_10B00B
+    1136,   // mod_20B00B
+    1146,   // mod_30B00B
+    1156,   // mod_10B10B
+    1166,   // mod_20B20B
+    1176,   // mod_30B30B
+    1186,   // min_00B00B
+    1196,   // min_10B00B
+    1206,   // min_20B00B
+    1216,   // min_30B00B
+    1226,   // min_10B10B
+    1236,   // min_20B20B
+    1246,   // min_30B30B
+    1256,   // min_00C00C
+    1266,   // min_10C10C
+    1276,   // min_20C20C
+    1286,   // min_30C30C
+    1296,   // min_10C00C
+    1306,   // min_20C00C
+    1316,   // min_30C00C
+    1326,   // min_00D00D
+    1336,   // min_10D10D
+    1346,   // min_20D20D
+    1356,   // min_30D30D
+    1366,   // min_10D00D
+    1376,   // min_20D00D
+    1386,   // min_30D00D
+    1396,   // max_00B00B
+    1406,   // max_10B00B
+    1416,   // max_20B00B
+    1426,   // max_30B00B
+    1436,   // max_10B10B
+    1446,   // max_20B20B
+    1456,   // max_30B30B
+    1466,   // max_00C00C
+    1476,   // max_10C10C
+    1486,   // max_20C20C
+    1496,   // max_30C30C
+    1506,   // max_10C00C
+    1516,   // max_20C00C
+    1526,   // max_30C00C
+    1536,   // max_00D00D
+    1546,   // max_10D10D
+    1556,   // max_20D20D
+    1566,   // max_30D30D
+    1576,   // max_10D00D
+    1586,   // max_20D00D
+    1596,   // max_30D00D
+    1606,   // clamp_00B00B00B
+    1621,   // clamp_10B00B00B
+    1636,   // clamp_20B00B00B
+    1651,   // clamp_30B00B00B
+    1666,   // clamp_10B10B10B
+    1681,   // clamp_20B20B20B
+    1696,   // clamp_30B30B30B
+    1711,   // clamp_00C00C00C
+    1726,   // clamp_10C00C00C
+    1741,   // clamp_20C00C00C
+    1756,   // clamp_30C00C00C
+    1771,   // clamp_10C10C10C
+    1786,   // clamp_20C20C20C
+    1801,   // clamp_30C30C30C
+    1816,   // clamp_00D00D00D
+    1831,   // clamp_10D00D00D
+    1846,   // clamp_20D00D00D
+    1861,   // clamp_30D00D00D
+    1876,   // clamp_10D10D10D
+    1891,   // clamp_20D20D20D
+    1906,   // clamp_30D30D30D
+    1921,   // mix_00B00B00B
+    1934,   // mix_10B10B00B
+    1947,   // mix_20B20B00B
+    1960,   // mix_30B30B00B
+    1973,   // mix_10B10B10B
+    1986,   // mix_20B20B20B
+    1999,   // mix_30B30B30B
+    2012,   // mix_00B00B00E
+    2025,   // mix_10B10B10E
+    2038,   // mix_20B20B20E
+    2051,   // mix_30B30B30E
+    2064,   // mix_00C00C00E
+    2077,   // mix_10C10C10E
+    2090,   // mix_20C20C20E
+    2103,   // mix_30C30C30E
+    2116,   // mix_00D00D00E
+    2129,   // mix_10D10D10E
+    2142,   // mix_20D20D20E
+    2155,   // mix_30D30D30E
+    2168,   // mix_00E00E00E
+    2181,   // mix_10E10E10E
+    2194,   // mix_20E20E20E
+    2207,   // mix_30E30E30E
+    2220,   // step_00B00B
+    2231,   // step_10B10B
+    2242,   // step_20B20B
+    2253,   // step_30B30B
+    2264,   // step_00B10B
+    2275,   // step_00B20B
+    2286,   // step_00B30B
+    2297,   // smoothstep_00B00B00B
+    2317,   // smoothstep_10B10B10B
+    2337,   // smoothstep_20B20B20B
+    2357,   // smoothstep_30B30B30B
+    2377,   // smoothstep_00B00B10B
+    2397,   // smoothstep_00B00B20B
+    2417,   // smoothstep_00B00B30B
+    2437,   // modf_00B00B
+    2448,   // modf_10B10B
+    2459,   // modf_20B20B
+    2470,   // modf_30B30B
+    2481,   // isnan_00B
+    2490,   // isnan_10B
+    2499,   // isnan_20B
+    2508,   // isnan_30B
+    2517,   // isinf_00B
+    2526,   // isinf_10B
+    2535,   // isinf_20B
+    2544,   // isinf_30B
+    2553,   // floatBitsToInt_00B
+    2571,   // floatBitsToInt_10B
+    2589,   // floatBitsToInt_20B
+    2607,   // floatBitsToInt_30B
+    2625,   // floatBitsToUint_00B
+    2644,   // floatBitsToUint_10B
+    2663,   // floatBitsToUint_20B
+    2682,   // floatBitsToUint_30B
+    2701,   // intBitsToFloat_00C
+    2719,   // intBitsToFloat_10C
+    2737,   // intBitsToFloat_20C
+    2755,   // intBitsToFloat_30C
+    2773,   // uintBitsToFloat_00D
+    2792,   // uintBitsToFloat_10D
+    2811,   // uintBitsToFloat_20D
+    2830,   // uintBitsToFloat_30D
+    2849,   // fma_00B00B00B
+    2862,   // fma_10B10B10B
+    2875,   // fma_20B20B20B
+    2888,   // fma_30B30B30B
+    2901,   // frexp_00B00C
+    2913,   // frexp_10B10C
+    2925,   // frexp_20B20C
+    2937,   // frexp_30B30C
+    2949,   // ldexp_00B00C
+    2961,   // ldexp_10B10C
+    2973,   // ldexp_20B20C
+    2985,   // ldexp_30B30C
+    2997,   // packSnorm2x16_10B
+    3014,   // packHalf2x16_10B
+    3030,   // unpackSnorm2x16_00D
+    3049,   // unpackHalf2x16_00D
+    3067,   // packUnorm2x16_10B
+    3084,   // unpackUnorm2x16_00D
+    3103,   // packUnorm4x8_30B
+    3119,   // packSnorm4x8_30B
+    3135,   // unpackUnorm4x8_00D
+    3153,   // unpackSnorm4x8_00D
+    3171,   // length_00B
+    3181,   // length_10B
+    3191,   // length_20B
+    3201,   // length_30B
+    3211,   // distance_00B00B
+    3226,   // distance_10B10B
+    3241,   // distance_20B20B
+    3256,   // distance_30B30B
+    3271,   // dot_00B00B
+    3281,   // dot_10B10B
+    3291,   // dot_20B20B
+    3301,   // dot_30B30B
+    3311,   // cross_20B20B
+    3323,   // normalize_00B
+    3336,   // normalize_10B
+    3349,   // normalize_20B
+    3362,   // normalize_30B
+    3375,   // faceforward_00B00B00B
+    3396,   // faceforward_10B10B10B
+    3417,   // faceforward_20B20B20B
+    3438,   // faceforward_30B30B30B
+    3459,   // reflect_00B00B
+    3473,   // reflect_10B10B
+    3487,   // reflect_20B20B
+    3501,   // reflect_30B30B
+    3515,   // refract_00B00B00B
+    3532,   // refract_10B10B00B
+    3549,   // refract_20B20B00B
+    3566,   // refract_30B30B00B
+    3583,   // matrixCompMult_50B50B
+    3604,   // matrixCompMult_A0BA0B
+    3625,   // matrixCompMult_F0BF0B
+    3646,   // matrixCompMult_90B90B
+    3667,   // matrixCompMult_60B60B
+    3688,   // matrixCompMult_D0BD0B
+    3709,   // matrixCompMult_70B70B
+    3730,   // matrixCompMult_E0BE0B
+    3751,   // matrixCompMult_B0BB0B
+    3772,   // outerProduct_10B10B
+    3791,   // outerProduct_20B20B
+    3810,   // outerProduct_30B30B
+    3829,   // outerProduct_20B10B
+    3848,   // outerProduct_10B20B
+    3867,   // outerProduct_30B10B
+    3886,   // outerProduct_10B30B
+    3905,   // outerProduct_30B20B
+    3924,   // outerProduct_20B30B
+    3943,   // transpose_50B
+    3956,   // transpose_A0B
+    3969,   // transpose_F0B
+    3982,   // transpose_60B
+    3995,   // transpose_90B
+    4008,   // transpose_70B
+    4021,   // transpose_D0B
+    4034,   // transpose_B0B
+    4047,   // transpose_E0B
+    4060,   // determinant_50B
+    4075,   // determinant_A0B
+    4090,   // determinant_F0B
+    4105,   // inverse_50B
+    4116,   // inverse_A0B
+    4127,   // inverse_F0B
+    4138,   // lessThan_10B10B
+    4153,   // lessThan_20B20B
+    4168,   // lessThan_30B30B
+    4183,   // lessThan_10C10C
+    4198,   // lessThan_20C20C
+    4213,   // lessThan_30C30C
+    4228,   // lessThan_10D10D
+    4243,   // lessThan_20D20D
+    4258,   // lessThan_30D30D
+    4273,   // lessThanEqual_10B10B
+    4293,   // lessThanEqual_20B20B
+    4313,   // lessThanEqual_30B30B
+    4333,   // lessThanEqual_10C10C
+    4353,   // lessThanEqual_20C20C
+    4373,   // lessThanEqual_30C30C
+    4393,   // lessThanEqual_10D10D
+    4413,   // lessThanEqual_20D20D
+    4433,   // lessThanEqual_30D30D
+    4453,   // greaterThan_10B10B
+    4471,   // greaterThan_20B20B
+    4489,   // greaterThan_30B30B
+    4507,   // greaterThan_10C10C
+    4525,   // greaterThan_20C20C
+    4543,   // greaterThan_30C30C
+    4561,   // greaterThan_10D10D
+    4579,   // greaterThan_20D20D
+    4597,   // greaterThan_30D30D
+    4615,   // greaterThanEqual_10B10B
+    4638,   // greaterThanEqual_20B20B
+    4661,   // greaterThanEqual_30B30B
+    4684,   // greaterThanEqual_10C10C
+    4707,   // greaterThanEqual_20C20C
+    4730,   // greaterThanEqual_30C30C
+    4753,   // greaterThanEqual_10D10D
+    4776,   // greaterThanEqual_20D20D
+    4799,   // greaterThanEqual_30D30D
+    4822,   // equal_10B10B
+    4834,   // equal_20B20B
+    4846,   // equal_30B30B
+    4858,   // equal_10C10C
+    4870,   // equal_20C20C
+    4882,   // equal_30C30C
+    4894,   // equal_10D10D
+    4906,   // equal_20D20D
+    4918,   // equal_30D30D
+    4930,   // equal_10E10E
+    4942,   // equal_20E20E
+    4954,   // equal_30E30E
+    4966,   // notEqual_10B10B
+    4981,   // notEqual_20B20B
+    4996,   // notEqual_30B30B
+    5011,   // notEqual_10C10C
+    5026,   // notEqual_20C20C
+    5041,   // notEqual_30C30C
+    5056,   // notEqual_10D10D
+    5071,   // notEqual_20D20D
+    5086,   // notEqual_30D30D
+    5101,   // notEqual_10E10E
+    5116,   // notEqual_20E20E
+    5131,   // notEqual_30E30E
+    5146,   // any_10E
+    5153,   // any_20E
+    5160,   // any_30E
+    5167,   // all_10E
+    5174,   // all_20E
+    5181,   // all_30E
+    5188,   // not_10E
+    5195,   // not_20E
+    5202,   // not_30E
+    5209,   // bitfieldExtract_00C00C00C
+    5234,   // bitfieldExtract_10C00C00C
+    5259,   // bitfieldExtract_20C00C00C
+    5284,   // bitfieldExtract_30C00C00C
+    5309,   // bitfieldExtract_00D00C00C
+    5334,   // bitfieldExtract_10D00C00C
+    5359,   // bitfieldExtract_20D00C00C
+    5384,   // bitfieldExtract_30D00C00C
+    5409,   // bitfieldInsert_00C00C00C00C
+    5436,   // bitfieldInsert_10C10C00C00C
+    5463,   // bitfieldInsert_20C20C00C00C
+    5490,   // bitfieldInsert_30C30C00C00C
+    5517,   // bitfieldInsert_00D00D00C00C
+    5544,   // bitfieldInsert_10D10D00C00C
+    5571,   // bitfieldInsert_20D20D00C00C
+    5598,   // bitfieldInsert_30D30D00C00C
+    5625,   // bitfieldReverse_00C
+    5644,   // bitfieldReverse_10C
+    5663,   // bitfieldReverse_20C
+    5682,   // bitfieldReverse_30C
+    5701,   // bitfieldReverse_00D
+    5720,   // bitfieldReverse_10D
+    5739,   // bitfieldReverse_20D
+    5758,   // bitfieldReverse_30D
+    5777,   // bitCount_00C
+    5789,   // bitCount_10C
+    5801,   // bitCount_20C
+    5813,   // bitCount_30C
+    5825,   // bitCount_00D
+    5837,   // bitCount_10D
+    5849,   // bitCount_20D
+    5861,   // bitCount_30D
+    5873,   // findLSB_00C
+    5884,   // findLSB_10C
+    5895,   // findLSB_20C
+    5906,   // findLSB_30C
+    5917,   // findLSB_00D
+    5928,   // findLSB_10D
+    5939,   // findLSB_20D
+    5950,   // findLSB_30D
+    5961,   // findMSB_00C
+    5972,   // findMSB_10C
+    5983,   // findMSB_20C
+    5994,   // findMSB_30C
+    6005,   // findMSB_00D
+    6016,   // findMSB_10D
+    6027,   // findMSB_20D
+    6038,   // findMSB_30D
+    6049,   // uaddCarry_00D00D00D
+    6068,   // uaddCarry_10D10D10D
+    6087,   // uaddCarry_20D20D20D
+    6106,   // uaddCarry_30D30D30D
+    6125,   // usubBorrow_00D00D00D
+    6145,   // usubBorrow_10D10D10D
+    6165,   // usubBorrow_20D20D20D
+    6185,   // usubBorrow_30D30D30D
+    6205,   // umulExtended_00D00D00D00D
+    6230,   // umulExtended_10D10D10D10D
+    6255,   // umulExtended_20D20D20D20D
+    6280,   // umulExtended_30D30D30D30D
+    6305,   // imulExtended_00C00C00C00C
+    6330,   // imulExtended_10C10C10C10C
+    6355,   // imulExtended_20C20C20C20C
+    6380,   // imulExtended_30C30C30C30C
+    6405,   // texture2D_00H10B
+    6421,   // texture2DProj_00H20B
+    6441,   // texture2DProj_00H30B
+    6461,   // textureCube_00J20B
+    6479,   // texture3D_00I20B
+    6495,   // texture3DProj_00I30B
+    6515,   // shadow2DEXT_00c20B
+    6533,   // shadow2DProjEXT_00c30B
+    6555,   // texture2D_00L10B
+    6571,   // texture2DProj_00L20B
+    6591,   // texture2DProj_00L30B
+    6611,   // texture2DRect_00N10B
+    6631,   // texture2DRectProj_00N20B
+    6655,   // texture2DRectProj_00N30B
+    6679,   // texture2DGradEXT_00H10B10B10B
+    6708,   // texture2DProjGradEXT_00H20B10B10B
+    6741,   // texture2DProjGradEXT_00H30B10B10B
+    6774,   // textureCubeGradEXT_00J20B20B20B
+    6805,   // textureVideoWEBGL_00p10B
+    6829,   // texture2D_00H10B00B
+    6848,   // texture2DProj_00H20B00B
+    6871,   // texture2DProj_00H30B00B
+    6894,   // textureCube_00J20B00B
+    6915,   // texture3D_00I20B00B
+    6934,   // texture3DProj_00I30B00B
+    6957,   // texture3DLod_00I20B00B
+    6979,   // texture3DProjLod_00I30B00B
+    7005,   // texture2DLod_00H10B00B
+    7027,   // texture2DProjLod_00H20B00B
+    7053,   // texture2DProjLod_00H30B00B
+    7079,   // textureCubeLod_00J20B00B
+    7103,   // texture2DLodEXT_00H10B00B
+    7128,   // texture2DProjLodEXT_00H20B00B
+    7157,   // texture2DProjLodEXT_00H30B00B
+    7186,   // textureCubeLodEXT_00J20B00B
+    7213,   // texture_00H10B
+    7227,   // texture_00Q10B
+    7241,   // texture_00W10B
+    7255,   // texture_00I20B
+    7269,   // texture_00R20B
+    7283,   // texture_00X20B
+    7297,   // texture_00J20B
+    7311,   // texture_00S20B
+    7325,   // texture_00Y20B
+    7339,   // texture_00K20B
+    7353,   // texture_00T20B
+    7367,   // texture_00Z20B
+    7381,   // texture_00c20B
+    7395,   // texture_00d30B
+    7409,   // texture_00e30B
+    7423,   // texture_00g30B
+    7437,   // texture_00l30B
+    7451,   // texture_00o30B
+    7465,   // texture_00h30B00B
+    7482,   // texture_00L10B
+    7496,   // texture_00M10B
+    7510,   // texture_00N10B
+    7524,   // texture_00p10B
+    7538,   // textureProj_00H20B
+    7556,   // textureProj_00Q20B
+    7574,   // textureProj_00W20B
+    7592,   // textureProj_00H30B
+    7610,   // textureProj_00Q30B
+    7628,   // textureProj_00W30B
+    7646,   // textureProj_00I30B
+    7664,   // textureProj_00R30B
+    7682,   // textureProj_00X30B
+    7700,   // textureProj_00c30B
+    7718,   // textureProj_00L20B
+    7736,   // textureProj_00L30B
+    7754,   // textureProj_00M20B
+    7772,   // textureProj_00M30B
+    7790,   // textureProj_00N20B
+    7808,   // textureProj_00N30B
+    7826,   // textureLod_00H10B00B
+    7846,   // textureLod_00Q10B00B
+    7866,   // textureLod_00W10B00B
+    7886,   // textureLod_00I20B00B
+    7906,   // textureLod_00R20B00B
+    7926,   // textureLod_00X20B00B
+    7946,   // textureLod_00J20B00B
+    7966,   // textureLod_00S20B00B
+    7986,   // textureLod_00Y20B00B
+    8006,   // textureLod_00K20B00B
+    8026,   // textureLod_00T20B00B
+    8046,   // textureLod_00Z20B00B
+    8066,   // textureLod_00c20B00B
+    8086,   // textureLod_00d30B00B
+    8106,   // textureLod_00e30B00B
+    8126,   // textureLod_00h30B00B00B
+    8149,   // textureLod_00g30B00B
+    8169,   // textureLod_00l30B00B
+    8189,   // textureLod_00o30B00B
+    8209,   // textureSize_00H00C
+    8227,   // textureSize_00Q00C
+    8245,   // textureSize_00W00C
+    8263,   // textureSize_00I00C
+    8281,   // textureSize_00R00C
+    8299,   // textureSize_00X00C
+    8317,   // textureSize_00J00C
+    8335,   // textureSize_00S00C
+    8353,   // textureSize_00Y00C
+    8371,   // textureSize_00K00C
+    8389,   // textureSize_00T00C
+    8407,   // textureSize_00Z00C
+    8425,   // textureSize_00c00C
+    8443,   // textureSize_00d00C
+    8461,   // textureSize_00e00C
+    8479,   // textureSize_00g00C
+    8497,   // textureSize_00l00C
+    8515,   // textureSize_00o00C
+    8533,   // textureSize_00h00C
+    8551,   // textureSize_00f
+    8566,   // textureSize_00k
+    8581,   // textureSize_00n
+    8596,   // textureSize_00O
+    8611,   // textureSize_00U
+    8626,   // textureSize_00a
+    8641,   // textureSize_00P
+    8656,   // textureSize_00V
+    8671,   // textureSize_00b
+    8686,   // textureSize_00L00C
+    8704,   // textureSize_00M00C
+    8722,   // textureProjLod_00H20B00B
+    8746,   // textureProjLod_00Q20B00B
+    8770,   // textureProjLod_00W20B00B
+    8794,   // textureProjLod_00H30B00B
+    8818,   // textureProjLod_00Q30B00B
+    8842,   // textureProjLod_00W30B00B
+    8866,   // textureProjLod_00I30B00B
+    8890,   // textureProjLod_00R30B00B
+    8914,   // textureProjLod_00X30B00B
+    8938,   // textureProjLod_00c30B00B
+    8962,   // texelFetch_00H10C00C
+    8982,   // texelFetch_00Q10C00C
+    9002,   // texelFetch_00W10C00C
+    9022,   // texelFetch_00I20C00C
+    9042,   // texelFetch_00R20C00C
+    9062,   // texelFetch_00X20C00C
+    9082,   // texelFetch_00K20C00C
+    9102,   // texelFetch_00T20C00C
+    9122,   // texelFetch_00Z20C00C
+    9142,   // texelFetch_00f00C
+    9159,   // texelFetch_00k00C
+    9176,   // texelFetch_00n00C
+    9193,   // texelFetch_00O10C00C
+    9213,   // texelFetch_00U10C00C
+    9233,   // texelFetch_00a10C00C
+    9253,   // texelFetch_00P20C00C
+    9273,   // texelFetch_00V20C00C
+    9293,   // texelFetch_00b20C00C
+    9313,   // texelFetch_00L10C00C
+    9333,   // texelFetch_00M10C00C
+    9353,   // textureGrad_00H10B10B10B
+    9377,   // textureGrad_00Q10B10B10B
+    9401,   // textureGrad_00W10B10B10B
+    9425,   // textureGrad_00I20B20B20B
+    9449,   // textureGrad_00R20B20B20B
+    9473,   // textureGrad_00X20B20B20B
+    9497,   // textureGrad_00J20B20B20B
+    9521,   // textureGrad_00S20B20B20B
+    9545,   // textureGrad_00Y20B20B20B
+    9569,   // textureGrad_00c20B10B10B
+    9593,   // textureGrad_00d30B20B20B
+    9617,   // textureGrad_00K20B10B10B
+    9641,   // textureGrad_00T20B10B10B
+    9665,   // textureGrad_00Z20B10B10B
+    9689,   // textureGrad_00e30B10B10B
+    9713,   // textureGrad_00g30B20B20B
+    9737,   // textureGrad_00l30B20B20B
+    9761,   // textureGrad_00o30B20B20B
+    9785,   // textureProjGrad_00H20B10B10B
+    9813,   // textureProjGrad_00Q20B10B10B
+    9841,   // textureProjGrad_00W20B10B10B
+    9869,   // textureProjGrad_00H30B10B10B
+    9897,   // textureProjGrad_00Q30B10B10B
+    9925,   // textureProjGrad_00W30B10B10B
+    9953,   // textureProjGrad_00I30B20B20B
+    9981,   // textureProjGrad_00R30B20B20B
+    10009,  // textureProjGrad_00X30B20B20B
+    10037,  // textureProjGrad_00c30B10B10B
+    10065,  // texture_00H10B00B
+    10082,  // texture_00Q10B00B
+    10099,  // texture_00W10B00B
+    10116,  // texture_00I20B00B
+    10133,  // texture_00R20B00B
+    10150,  // texture_00X20B00B
+    10167,  // texture_00J20B00B
+    10184,  // texture_00S20B00B
+    10201,  // texture_00Y20B00B
+    10218,  // texture_00K20B00B
+    10235,  // texture_00T20B00B
+    10252,  // texture_00Z20B00B
+    10269,  // textureProj_00H20B00B
+    10290,  // textureProj_00Q20B00B
+    10311,  // textureProj_00W20B00B
+    10332,  // textureProj_00H30B00B
+    10353,  // textureProj_00Q30B00B
+    10374,  // textureProj_00W30B00B
+    10395,  // textureProj_00I30B00B
+    10416,  // textureProj_00R30B00B
+    10437,  // textureProj_00X30B00B
+    10458,  // texture_00c20B00B
+    10475,  // texture_00d30B00B
+    10492,  // textureProj_00c30B00B
+    10513,  // texture_00e30B00B
+    10530,  // texture_00g30B00B
+    10547,  // texture_00l30B00B
+    10564,  // texture_00o30B00B
+    10581,  // texture_00h30B00B00B
+    10601,  // texture_00L10B00B
+    10618,  // textureProj_00L20B00B
+    10639,  // textureProj_00L30B00B
+    10660,  // texture_00M10B00B
+    10677,  // textureProj_00M20B00B
+    10698,  // textureProj_00M30B00B
+    10719,  // textureOffset_00H10B10C
+    10742,  // textureOffset_00Q10B10C
+    10765,  // textureOffset_00W10B10C
+    10788,  // textureOffset_00I20B20C
+    10811,  // textureOffset_00R20B20C
+    10834,  // textureOffset_00X20B20C
+    10857,  // textureOffset_00c20B10C
+    10880,  // textureOffset_00K20B10C
+    10903,  // textureOffset_00T20B10C
+    10926,  // textureOffset_00Z20B10C
+    10949,  // textureOffset_00e30B10C
+    10972,  // textureProjOffset_00H20B10C
+    10999,  // textureProjOffset_00Q20B10C
+    11026,  // textureProjOffset_00W20B10C
+    11053,  // textureProjOffset_00H30B10C
+    11080,  // textureProjOffset_00Q30B10C
+    11107,  // textureProjOffset_00W30B10C
+    11134,  // textureProjOffset_00I30B20C
+    11161,  // textureProjOffset_00R30B20C
+    11188,  // textureProjOffset_00X30B20C
+    11215,  // textureProjOffset_00c30B10C
+    11242,  // textureLodOffset_00H10B00B10C
+    11271,  // textureLodOffset_00Q10B00B10C
+    11300,  // textureLodOffset_00W10B00B10C
+    11329,  // textureLodOffset_00I20B00B20C
+    11358,  // textureLodOffset_00R20B00B20C
+    11387,  // textureLodOffset_00X20B00B20C
+    11416,  // textureLodOffset_00c20B00B10C
+    11445,  // textureLodOffset_00K20B00B10C
+    11474,  // textureLodOffset_00T20B00B10C
+    11503,  // textureLodOffset_00Z20B00B10C
+    11532,  // textureLodOffset_00e30B00B10C
+    11561,  // textureProjLodOffset_00H20B00B10C
+    11594,  // textureProjLodOffset_00Q20B00B10C
+    11627,  // textureProjLodOffset_00W20B00B10C
+    11660,  // textureProjLodOffset_00H30B00B10C
+    11693,  // textureProjLodOffset_00Q30B00B10C
+    11726,  // textureProjLodOffset_00W30B00B10C
+    11759,  // textureProjLodOffset_00I30B00B20C
+    11792,  // textureProjLodOffset_00R30B00B20C
+    11825,  // textureProjLodOffset_00X30B00B20C
+    11858,  // textureProjLodOffset_00c30B00B10C
+    11891,  // texelFetchOffset_00H10C00C10C
+    11920,  // texelFetchOffset_00Q10C00C10C
+    11949,  // texelFetchOffset_00W10C00C10C
+    11978,  // texelFetchOffset_00I20C00C20C
+    12007,  // texelFetchOffset_00R20C00C20C
+    12036,  // texelFetchOffset_00X20C00C20C
+    12065,  // texelFetchOffset_00K20C00C10C
+    12094,  // texelFetchOffset_00T20C00C10C
+    12123,  // texelFetchOffset_00Z20C00C10C
+    12152,  // textureGradOffset_00H10B10B10B10C
+    12185,  // textureGradOffset_00Q10B10B10B10C
+    12218,  // textureGradOffset_00W10B10B10B10C
+    12251,  // textureGradOffset_00I20B20B20B20C
+    12284,  // textureGradOffset_00R20B20B20B20C
+    12317,  // textureGradOffset_00X20B20B20B20C
+    12350,  // textureGradOffset_00c20B10B10B10C
+    12383,  // textureGradOffset_00K20B10B10B10C
+    12416,  // textureGradOffset_00T20B10B10B10C
+    12449,  // textureGradOffset_00Z20B10B10B10C
+    12482,  // textureGradOffset_00e30B10B10B10C
+    12515,  // textureProjGradOffset_00H20B10B10B10C
+    12552,  // textureProjGradOffset_00Q20B10B10B10C
+    12589,  // textureProjGradOffset_00W20B10B10B10C
+    12626,  // textureProjGradOffset_00H30B10B10B10C
+    12663,  // textureProjGradOffset_00Q30B10B10B10C
+    12700,  // textureProjGradOffset_00W30B10B10B10C
+    12737,  // textureProjGradOffset_00I30B20B20B20C
+    12774,  // textureProjGradOffset_00R30B20B20B20C
+    12811,  // textureProjGradOffset_00X30B20B20B20C
+    12848,  // textureProjGradOffset_00c30B10B10B10C
+    12885,  // textureOffset_00H10B10C00B
+    12911,  // textureOffset_00Q10B10C00B
+    12937,  // textureOffset_00W10B10C00B
+    12963,  // textureOffset_00I20B20C00B
+    12989,  // textureOffset_00R20B20C00B
+    13015,  // textureOffset_00X20B20C00B
+    13041,  // textureOffset_00c20B10C00B
+    13067,  // textureOffset_00K20B10C00B
+    13093,  // textureOffset_00T20B10C00B
+    13119,  // textureOffset_00Z20B10C00B
+    13145,  // textureOffset_00e30B10C00B
+    13171,  // textureProjOffset_00H20B10C00B
+    13201,  // textureProjOffset_00Q20B10C00B
+    13231,  // textureProjOffset_00W20B10C00B
+    13261,  // textureProjOffset_00H30B10C00B
+    13291,  // textureProjOffset_00Q30B10C00B
+    13321,  // textureProjOffset_00W30B10C00B
+    13351,  // textureProjOffset_00I30B20C00B
+    13381,  // textureProjOffset_00R30B20C00B
+    13411,  // textureProjOffset_00X30B20C00B
+    13441,  // textureProjOffset_00c30B10C00B
+    13471,  // textureGather_00H10B
+    13491,  // textureGather_00Q10B
+    13511,  // textureGather_00W10B
+    13531,  // textureGather_00K20B
+    13551,  // textureGather_00T20B
+    13571,  // textureGather_00Z20B
+    13591,  // textureGather_00J20B
+    13611,  // textureGather_00S20B
+    13631,  // textureGather_00Y20B
+    13651,  // textureGather_00g30B
+    13671,  // textureGather_00l30B
+    13691,  // textureGather_00o30B
+    13711,  // textureGather_00H10B00C
+    13734,  // textureGather_00Q10B00C
+    13757,  // textureGather_00W10B00C
+    13780,  // textureGather_00K20B00C
+    13803,  // textureGather_00T20B00C
+    13826,  // textureGather_00Z20B00C
+    13849,  // textureGather_00J20B00C
+    13872,  // textureGather_00S20B00C
+    13895,  // textureGather_00Y20B00C
+    13918,  // textureGather_00g30B00C
+    13941,  // textureGather_00l30B00C
+    13964,  // textureGather_00o30B00C
+    13987,  // textureGather_00h30B00B
+    14010,  // textureGather_00c10B00B
+    14033,  // textureGather_00e20B00B
+    14056,  // textureGather_00d20B00B
+    14079,  // textureGatherOffset_00H10B10C
+    14108,  // textureGatherOffset_00Q10B10C
+    14137,  // textureGatherOffset_00W10B10C
+    14166,  // textureGatherOffset_00K20B10C
+    14195,  // textureGatherOffset_00T20B10C
+    14224,  // textureGatherOffset_00Z20B10C
+    14253,  // textureGatherOffset_00H10B10C00C
+    14285,  // textureGatherOffset_00Q10B10C00C
+    14317,  // textureGatherOffset_00W10B10C00C
+    14349,  // textureGatherOffset_00K20B10C00C
+    14381,  // textureGatherOffset_00T20B10C00C
+    14413,  // textureGatherOffset_00Z20B10C00C
+    14445,  // textureGatherOffset_00c10B00B10C
+    14477,  // textureGatherOffset_00e20B00B10C
+    14509,  // textureGatherOffsets_00H10B10Cx4
+    14541,  // textureGatherOffsets_00Q10B10Cx4
+    14573,  // textureGatherOffsets_00W10B10Cx4
+    14605,  // textureGatherOffsets_00K20B10Cx4
+    14637,  // textureGatherOffsets_00T20B10Cx4
+    14669,  // textureGatherOffsets_00Z20B10Cx4
+    14701,  // textureGatherOffsets_00H10B10Cx400C
+    14736,  // textureGatherOffsets_00Q10B10Cx400C
+    14771,  // textureGatherOffsets_00W10B10Cx400C
+    14806,  // textureGatherOffsets_00K20B10Cx400C
+    14841,  // textureGatherOffsets_00T20B10Cx400C
+    14876,  // textureGatherOffsets_00Z20B10Cx400C
+    14911,  // textureGatherOffsets_00c10B00B10Cx4
+    14946,  // textureGatherOffsets_00e20B00B10Cx4
+    14981,  // textureQueryLOD_00H10B
+    15003,  // textureQueryLOD_00Q10B
+    15025,  // textureQueryLOD_00W10B
+    15047,  // textureQueryLOD_00I20B
+    15069,  // textureQueryLOD_00R20B
+    15091,  // textureQueryLOD_00X20B
+    15113,  // textureQueryLOD_00J20B
+    15135,  // textureQueryLOD_00S20B
+    15157,  // textureQueryLOD_00Y20B
+    15179,  // textureQueryLOD_00K10B
+    15201,  // textureQueryLOD_00T10B
+    15223,  // textureQueryLOD_00Z10B
+    15245,  // textureQueryLOD_00c10B
+    15267,  // textureQueryLOD_00d20B
+    15289,  // textureQueryLOD_00e10B
+    15311,  // textureQueryLOD_00g20B
+    15333,  // textureQueryLOD_00l20B
+    15355,  // textureQueryLOD_00o20B
+    15377,  // textureQueryLOD_00h20B
+    15399,  // rgb_2_yuv_20B00G
+    15415,  // yuv_2_rgb_20B00G
+    15431,  // dFdx_00B
+    15439,  // dFdx_10B
+    15447,  // dFdx_20B
+    15455,  // dFdx_30B
+    15463,  // dFdy_00B
+    15471,  // dFdy_10B
+    15479,  // dFdy_20B
+    15487,  // dFdy_30B
+    15495,  // fwidth_00B
+    15505,  // fwidth_10B
+    15515,  // fwidth_20B
+    15525,  // fwidth_30B
+    15535,  // interpolateAtCentroid_00B
+    15560,  // interpolateAtCentroid_10B
+    15585,  // interpolateAtCentroid_20B
+    15610,  // interpolateAtCentroid_30B
+    15635,  // interpolateAtSample_00B00C
+    15661,  // interpolateAtSample_10B00C
+    15687,  // interpolateAtSample_20B00C
+    15713,  // interpolateAtSample_30B00C
+    15739,  // interpolateAtOffset_00B10B
+    15765,  // interpolateAtOffset_10B10B
+    15791,  // interpolateAtOffset_20B10B
+    15817,  // interpolateAtOffset_30B10B
+    15843,  // atomicCounter_00F
+    15860,  // atomicCounterIncrement_00F
+    15886,  // atomicCounterDecrement_00F
+    15912,  // atomicAdd_00D00D
+    15928,  // atomicAdd_00C00C
+    15944,  // atomicMin_00D00D
+    15960,  // atomicMin_00C00C
+    15976,  // atomicMax_00D00D
+    15992,  // atomicMax_00C00C
+    16008,  // atomicAnd_00D00D
+    16024,  // atomicAnd_00C00C
+    16040,  // atomicOr_00D00D
+    16055,  // atomicOr_00C00C
+    16070,  // atomicXor_00D00D
+    16086,  // atomicXor_00C00C
+    16102,  // atomicExchange_00D00D
+    16123,  // atomicExchange_00C00C
+    16144,  // atomicCompSwap_00D00D00D
+    16168,  // atomicCompSwap_00C00C00C
+    16192,  // imageSize_00q
+    16205,  // imageSize_00z
+    16218,  // imageSize_01I
+    16231,  // imageSize_00r
+    16244,  // imageSize_01A
+    16257,  // imageSize_01J
+    16270,  // imageSize_00s
+    16283,  // imageSize_01B
+    16296,  // imageSize_01K
+    16309,  // imageSize_00t
+    16322,  // imageSize_01C
+    16335,  // imageSize_01L
+    16348,  // imageSize_00w
+    16361,  // imageSize_01F
+    16374,  // imageSize_01O
+    16387,  // imageSize_00y
+    16400,  // imageSize_01H
+    16413,  // imageSize_01Q
+    16426,  // imageStore_00q10C30B
+    16446,  // imageStore_00z10C30C
+    16466,  // imageStore_01I10C30D
+    16486,  // imageStore_00r20C30B
+    16506,  // imageStore_01A20C30C
+    16526,  // imageStore_01J20C30D
+    16546,  // imageStore_00s20C30B
+    16566,  // imageStore_01B20C30C
+    16586,  // imageStore_01K20C30D
+    16606,  // imageStore_00t20C30B
+    16626,  // imageStore_01C20C30C
+    16646,  // imageStore_01L20C30D
+    16666,  // imageStore_00w20C30B
+    16686,  // imageStore_01F20C30C
+    16706,  // imageStore_01O20C30D
+    16726,  // imageStore_00y00C30B
+    16746,  // imageStore_01H00C30C
+    16766,  // imageStore_01Q00C30D
+    16786,  // imageLoad_00q10C
+    16802,  // imageLoad_00z10C
+    16818,  // imageLoad_01I10C
+    16834,  // imageLoad_00r20C
+    16850,  // imageLoad_01A20C
+    16866,  // imageLoad_01J20C
+    16882,  // imageLoad_00s20C
+    16898,  // imageLoad_01B20C
+    16914,  // imageLoad_01K20C
+    16930,  // imageLoad_00t20C
+    16946,  // imageLoad_01C20C
+    16962,  // imageLoad_01L20C
+    16978,  // imageLoad_00w20C
+    16994,  // imageLoad_01F20C
+    17010,  // imageLoad_01O20C
+    17026,  // imageLoad_00y00C
+    17042,  // imageLoad_01H00C
+    17058,  // imageLoad_01Q00C
+    17074,  // imageAtomicAdd_00q10C00D
+    17098,  // imageAtomicAdd_00z10C00D
+    17122,  // imageAtomicAdd_01I10C00D
+    17146,  // imageAtomicAdd_00r20C00D
+    17170,  // imageAtomicAdd_01A20C00D
+    17194,  // imageAtomicAdd_01J20C00D
+    17218,  // imageAtomicAdd_00t20C00D
+    17242,  // imageAtomicAdd_01C20C00D
+    17266,  // imageAtomicAdd_01L20C00D
+    17290,  // imageAtomicAdd_00y00C00D
+    17314,  // imageAtomicAdd_01H00C00D
+    17338,  // imageAtomicAdd_01Q00C00D
+    17362,  // imageAtomicAdd_00s20C00D
+    17386,  // imageAtomicAdd_01B20C00D
+    17410,  // imageAtomicAdd_01K20C00D
+    17434,  // imageAtomicAdd_00w20C00D
+    17458,  // imageAtomicAdd_01F20C00D
+    17482,  // imageAtomicAdd_01O20C00D
+    17506,  // imageAtomicAdd_00q10C00C
+    17530,  // imageAtomicAdd_00z10C00C
+    17554,  // imageAtomicAdd_01I10C00C
+    17578,  // imageAtomicAdd_00r20C00C
+    17602,  // imageAtomicAdd_01A20C00C
+    17626,  // imageAtomicAdd_01J20C00C
+    17650,  // imageAtomicAdd_00t20C00C
+    17674,  // imageAtomicAdd_01C20C00C
+    17698,  // imageAtomicAdd_01L20C00C
+    17722,  // imageAtomicAdd_00y00C00C
+    17746,  // imageAtomicAdd_01H00C00C
+    17770,  // imageAtomicAdd_01Q00C00C
+    17794,  // imageAtomicAdd_00s20C00C
+    17818,  // imageAtomicAdd_01B20C00C
+    17842,  // imageAtomicAdd_01K20C00C
+    17866,  // imageAtomicAdd_00w20C00C
+    17890,  // imageAtomicAdd_01F20C00C
+    17914,  // imageAtomicAdd_01O20C00C
+    17938,  // imageAtomicMin_00q10C00D
+    17962,  // imageAtomicMin_00z10C00D
+    17986,  // imageAtomicMin_01I10C00D
+    18010,  // imageAtomicMin_00r20C00D
+    18034,  // imageAtomicMin_01A20C00D
+    18058,  // imageAtomicMin_01J20C00D
+    18082,  // imageAtomicMin_00t20C00D
+    18106,  // imageAtomicMin_01C20C00D
+    18130,  // imageAtomicMin_01L20C00D
+    18154,  // imageAtomicMin_00y00C00D
+    18178,  // imageAtomicMin_01H00C00D
+    18202,  // imageAtomicMin_01Q00C00D
+    18226,  // imageAtomicMin_00s20C00D
+    18250,  // imageAtomicMin_01B20C00D
+    18274,  // imageAtomicMin_01K20C00D
+    18298,  // imageAtomicMin_00w20C00D
+    18322,  // imageAtomicMin_01F20C00D
+    18346,  // imageAtomicMin_01O20C00D
+    18370,  // imageAtomicMin_00q10C00C
+    18394,  // imageAtomicMin_00z10C00C
+    18418,  // imageAtomicMin_01I10C00C
+    18442,  // imageAtomicMin_00r20C00C
+    18466,  // imageAtomicMin_01A20C00C
+    18490,  // imageAtomicMin_01J20C00C
+    18514,  // imageAtomicMin_00t20C00C
+    18538,  // imageAtomicMin_01C20C00C
+    18562,  // imageAtomicMin_01L20C00C
+    18586,  // imageAtomicMin_00y00C00C
+    18610,  // imageAtomicMin_01H00C00C
+    18634,  // imageAtomicMin_01Q00C00C
+    18658,  // imageAtomicMin_00s20C00C
+    18682,  // imageAtomicMin_01B20C00C
+    18706,  // imageAtomicMin_01K20C00C
+    18730,  // imageAtomicMin_00w20C00C
+    18754,  // imageAtomicMin_01F20C00C
+    18778,  // imageAtomicMin_01O20C00C
+    18802,  // imageAtomicMax_00q10C00D
+    18826,  // imageAtomicMax_00z10C00D
+    18850,  // imageAtomicMax_01I10C00D
+    18874,  // imageAtomicMax_00r20C00D
+    18898,  // imageAtomicMax_01A20C00D
+    18922,  // imageAtomicMax_01J20C00D
+    18946,  // imageAtomicMax_00t20C00D
+    18970,  // imageAtomicMax_01C20C00D
+    18994,  // imageAtomicMax_01L20C00D
+    19018,  // imageAtomicMax_00y00C00D
+    19042,  // imageAtomicMax_01H00C00D
+    19066,  // imageAtomicMax_01Q00C00D
+    19090,  // imageAtomicMax_00s20C00D
+    19114,  // imageAtomicMax_01B20C00D
+    19138,  // imageAtomicMax_01K20C00D
+    19162,  // imageAtomicMax_00w20C00D
+    19186,  // imageAtomicMax_01F20C00D
+    19210,  // imageAtomicMax_01O20C00D
+    19234,  // imageAtomicMax_00q10C00C
+    19258,  // imageAtomicMax_00z10C00C
+    19282,  // imageAtomicMax_01I10C00C
+    19306,  // imageAtomicMax_00r20C00C
+    19330,  // imageAtomicMax_01A20C00C
+    19354,  // imageAtomicMax_01J20C00C
+    19378,  // imageAtomicMax_00t20C00C
+    19402,  // imageAtomicMax_01C20C00C
+    19426,  // imageAtomicMax_01L20C00C
+    19450,  // imageAtomicMax_00y00C00C
+    19474,  // imageAtomicMax_01H00C00C
+    19498,  // imageAtomicMax_01Q00C00C
+    19522,  // imageAtomicMax_00s20C00C
+    19546,  // imageAtomicMax_01B20C00C
+    19570,  // imageAtomicMax_01K20C00C
+    19594,  // imageAtomicMax_00w20C00C
+    19618,  // imageAtomicMax_01F20C00C
+    19642,  // imageAtomicMax_01O20C00C
+    19666,  // imageAtomicAnd_00q10C00D
+    19690,  // imageAtomicAnd_00z10C00D
+    19714,  // imageAtomicAnd_01I10C00D
+    19738,  // imageAtomicAnd_00r20C00D
+    19762,  // imageAtomicAnd_01A20C00D
+    19786,  // imageAtomicAnd_01J20C00D
+    19810,  // imageAtomicAnd_00t20C00D
+    19834,  // imageAtomicAnd_01C20C00D
+    19858,  // imageAtomicAnd_01L20C00D
+    19882,  // imageAtomicAnd_00y00C00D
+    19906,  // imageAtomicAnd_01H00C00D
+    19930,  // imageAtomicAnd_01Q00C00D
+    19954,  // imageAtomicAnd_00s20C00D
+    19978,  // imageAtomicAnd_01B20C00D
+    20002,  // imageAtomicAnd_01K20C00D
+    20026,  // imageAtomicAnd_00w20C00D
+    20050,  // imageAtomicAnd_01F20C00D
+    20074,  // imageAtomicAnd_01O20C00D
+    20098,  // imageAtomicAnd_00q10C00C
+    20122,  // imageAtomicAnd_00z10C00C
+    20146,  // imageAtomicAnd_01I10C00C
+    20170,  // imageAtomicAnd_00r20C00C
+    20194,  // imageAtomicAnd_01A20C00C
+    20218,  // imageAtomicAnd_01J20C00C
+    20242,  // imageAtomicAnd_00t20C00C
+    20266,  // imageAtomicAnd_01C20C00C
+    20290,  // imageAtomicAnd_01L20C00C
+    20314,  // imageAtomicAnd_00y00C00C
+    20338,  // imageAtomicAnd_01H00C00C
+    20362,  // imageAtomicAnd_01Q00C00C
+    20386,  // imageAtomicAnd_00s20C00C
+    20410,  // imageAtomicAnd_01B20C00C
+    20434,  // imageAtomicAnd_01K20C00C
+    20458,  // imageAtomicAnd_00w20C00C
+    20482,  // imageAtomicAnd_01F20C00C
+    20506,  // imageAtomicAnd_01O20C00C
+    20530,  // imageAtomicOr_00q10C00D
+    20553,  // imageAtomicOr_00z10C00D
+    20576,  // imageAtomicOr_01I10C00D
+    20599,  // imageAtomicOr_00r20C00D
+    20622,  // imageAtomicOr_01A20C00D
+    20645,  // imageAtomicOr_01J20C00D
+    20668,  // imageAtomicOr_00t20C00D
+    20691,  // imageAtomicOr_01C20C00D
+    20714,  // imageAtomicOr_01L20C00D
+    20737,  // imageAtomicOr_00y00C00D
+    20760,  // imageAtomicOr_01H00C00D
+    20783,  // imageAtomicOr_01Q00C00D
+    20806,  // imageAtomicOr_00s20C00D
+    20829,  // imageAtomicOr_01B20C00D
+    20852,  // imageAtomicOr_01K20C00D
+    20875,  // imageAtomicOr_00w20C00D
+    20898,  // imageAtomicOr_01F20C00D
+    20921,  // imageAtomicOr_01O20C00D
+    20944,  // imageAtomicOr_00q10C00C
+    20967,  // imageAtomicOr_00z10C00C
+    20990,  // imageAtomicOr_01I10C00C
+    21013,  // imageAtomicOr_00r20C00C
+    21036,  // imageAtomicOr_01A20C00C
+    21059,  // imageAtomicOr_01J20C00C
+    21082,  // imageAtomicOr_00t20C00C
+    21105,  // imageAtomicOr_01C20C00C
+    21128,  // imageAtomicOr_01L20C00C
+    21151,  // imageAtomicOr_00y00C00C
+    21174,  // imageAtomicOr_01H00C00C
+    21197,  // imageAtomicOr_01Q00C00C
+    21220,  // imageAtomicOr_00s20C00C
+    21243,  // imageAtomicOr_01B20C00C
+    21266,  // imageAtomicOr_01K20C00C
+    21289,  // imageAtomicOr_00w20C00C
+    21312,  // imageAtomicOr_01F20C00C
+    21335,  // imageAtomicOr_01O20C00C
+    21358,  // imageAtomicXor_00q10C00D
+    21382,  // imageAtomicXor_00z10C00D
+    21406,  // imageAtomicXor_01I10C00D
+    21430,  // imageAtomicXor_00r20C00D
+    21454,  // imageAtomicXor_01A20C00D
+    21478,  // imageAtomicXor_01J20C00D
+    21502,  // imageAtomicXor_00t20C00D
+    21526,  // imageAtomicXor_01C20C00D
+    21550,  // imageAtomicXor_01L20C00D
+    21574,  // imageAtomicXor_00y00C00D
+    21598,  // imageAtomicXor_01H00C00D
+    21622,  // imageAtomicXor_01Q00C00D
+    21646,  // imageAtomicXor_00s20C00D
+    21670,  // imageAtomicXor_01B20C00D
+    21694,  // imageAtomicXor_01K20C00D
+    21718,  // imageAtomicXor_00w20C00D
+    21742,  // imageAtomicXor_01F20C00D
+    21766,  // imageAtomicXor_01O20C00D
+    21790,  // imageAtomicXor_00q10C00C
+    21814,  // imageAtomicXor_00z10C00C
+    21838,  // imageAtomicXor_01I10C00C
+    21862,  // imageAtomicXor_00r20C00C
+    21886,  // imageAtomicXor_01A20C00C
+    21910,  // imageAtomicXor_01J20C00C
+    21934,  // imageAtomicXor_00t20C00C
+    21958,  // imageAtomicXor_01C20C00C
+    21982,  // imageAtomicXor_01L20C00C
+    22006,  // imageAtomicXor_00y00C00C
+    22030,  // imageAtomicXor_01H00C00C
+    22054,  // imageAtomicXor_01Q00C00C
+    22078,  // imageAtomicXor_00s20C00C
+    22102,  // imageAtomicXor_01B20C00C
+    22126,  // imageAtomicXor_01K20C00C
+    22150,  // imageAtomicXor_00w20C00C
+    22174,  // imageAtomicXor_01F20C00C
+    22198,  // imageAtomicXor_01O20C00C
+    22222,  // imageAtomicExchange_00q10C00D
+    22251,  // imageAtomicExchange_00z10C00D
+    22280,  // imageAtomicExchange_01I10C00D
+    22309,  // imageAtomicExchange_00r20C00D
+    22338,  // imageAtomicExchange_01A20C00D
+    22367,  // imageAtomicExchange_01J20C00D
+    22396,  // imageAtomicExchange_00t20C00D
+    22425,  // imageAtomicExchange_01C20C00D
+    22454,  // imageAtomicExchange_01L20C00D
+    22483,  // imageAtomicExchange_00y00C00D
+    22512,  // imageAtomicExchange_01H00C00D
+    22541,  // imageAtomicExchange_01Q00C00D
+    22570,  // imageAtomicExchange_00s20C00D
+    22599,  // imageAtomicExchange_01B20C00D
+    22628,  // imageAtomicExchange_01K20C00D
+    22657,  // imageAtomicExchange_00w20C00D
+    22686,  // imageAtomicExchange_01F20C00D
+    22715,  // imageAtomicExchange_01O20C00D
+    22744,  // imageAtomicExchange_00q10C00C
+    22773,  // imageAtomicExchange_00z10C00C
+    22802,  // imageAtomicExchange_01I10C00C
+    22831,  // imageAtomicExchange_00r20C00C
+    22860,  // imageAtomicExchange_01A20C00C
+    22889,  // imageAtomicExchange_01J20C00C
+    22918,  // imageAtomicExchange_00t20C00C
+    22947,  // imageAtomicExchange_01C20C00C
+    22976,  // imageAtomicExchange_01L20C00C
+    23005,  // imageAtomicExchange_00y00C00C
+    23034,  // imageAtomicExchange_01H00C00C
+    23063,  // imageAtomicExchange_01Q00C00C
+    23092,  // imageAtomicExchange_00s20C00C
+    23121,  // imageAtomicExchange_01B20C00C
+    23150,  // imageAtomicExchange_01K20C00C
+    23179,  // imageAtomicExchange_00w20C00C
+    23208,  // imageAtomicExchange_01F20C00C
+    23237,  // imageAtomicExchange_01O20C00C
+    23266,  // imageAtomicExchange_00q10C00B
+    23295,  // imageAtomicExchange_00z10C00B
+    23324,  // imageAtomicExchange_01I10C00B
+    23353,  // imageAtomicExchange_00r20C00B
+    23382,  // imageAtomicExchange_01A20C00B
+    23411,  // imageAtomicExchange_01J20C00B
+    23440,  // imageAtomicExchange_00t20C00B
+    23469,  // imageAtomicExchange_01C20C00B
+    23498,  // imageAtomicExchange_01L20C00B
+    23527,  // imageAtomicExchange_00y00C00B
+    23556,  // imageAtomicExchange_01H00C00B
+    23585,  // imageAtomicExchange_01Q00C00B
+    23614,  // imageAtomicExchange_00s20C00B
+    23643,  // imageAtomicExchange_01B20C00B
+    23672,  // imageAtomicExchange_01K20C00B
+    23701,  // imageAtomicExchange_00w20C00B
+    23730,  // imageAtomicExchange_01F20C00B
+    23759,  // imageAtomicExchange_01O20C00B
+    23788,  // imageAtomicCompSwap_00q10C00D00D
+    23820,  // imageAtomicCompSwap_00z10C00D00D
+    23852,  // imageAtomicCompSwap_01I10C00D00D
+    23884,  // imageAtomicCompSwap_00r20C00D00D
+    23916,  // imageAtomicCompSwap_01A20C00D00D
+    23948,  // imageAtomicCompSwap_01J20C00D00D
+    23980,  // imageAtomicCompSwap_00t20C00D00D
+    24012,  // imageAtomicCompSwap_01C20C00D00D
+    24044,  // imageAtomicCompSwap_01L20C00D00D
+    24076,  // imageAtomicCompSwap_00y00C00D00D
+    24108,  // imageAtomicCompSwap_01H00C00D00D
+    24140,  // imageAtomicCompSwap_01Q00C00D00D
+    24172,  // imageAtomicCompSwap_00s20C00D00D
+    24204,  // imageAtomicCompSwap_01B20C00D00D
+    24236,  // imageAtomicCompSwap_01K20C00D00D
+    24268,  // imageAtomicCompSwap_00w20C00D00D
+    24300,  // imageAtomicCompSwap_01F20C00D00D
+    24332,  // imageAtomicCompSwap_01O20C00D00D
+    24364,  // imageAtomicCompSwap_00q10C00C00C
+    24396,  // imageAtomicCompSwap_00z10C00C00C
+    24428,  // imageAtomicCompSwap_01I10C00C00C
+    24460,  // imageAtomicCompSwap_00r20C00C00C
+    24492,  // imageAtomicCompSwap_01A20C00C00C
+    24524,  // imageAtomicCompSwap_01J20C00C00C
+    24556,  // imageAtomicCompSwap_00t20C00C00C
+    24588,  // imageAtomicCompSwap_01C20C00C00C
+    24620,  // imageAtomicCompSwap_01L20C00C00C
+    24652,  // imageAtomicCompSwap_00y00C00C00C
+    24684,  // imageAtomicCompSwap_01H00C00C00C
+    24716,  // imageAtomicCompSwap_01Q00C00C00C
+    24748,  // imageAtomicCompSwap_00s20C00C00C
+    24780,  // imageAtomicCompSwap_01B20C00C00C
+    24812,  // imageAtomicCompSwap_01K20C00C00C
+    24844,  // imageAtomicCompSwap_00w20C00C00C
+    24876,  // imageAtomicCompSwap_01F20C00C00C
+    24908,  // imageAtomicCompSwap_01O20C00C00C
+    24940,  // pixelLocalLoadANGLE_01R
+    24963,  // pixelLocalLoadANGLE_01S
+    24986,  // pixelLocalLoadANGLE_01T
+    25009,  // pixelLocalStoreANGLE_01R30B
+    25036,  // pixelLocalStoreANGLE_01S30C
+    25063,  // pixelLocalStoreANGLE_01T30D
+    25090,  // beginInvocationInterlockNV_
+    25117,  // endInvocationInterlockNV_
+    25142,  // beginFragmentShaderOrderingINTEL_
+    25175,  // beginInvocationInterlockARB_
+    25203,  // endInvocationInterlockARB_
+    25229,  // memoryBarrier_
+    25243,  // memoryBarrierAtomicCounter_
+    25270,  // memoryBarrierBuffer_
+    25290,  // memoryBarrierImage_
+    25309,  // barrier_
+    25317,  // memoryBarrierShared_
+    25337,  // groupMemoryBarrier_
+    25356,  // EmitVertex_
+    25367,  // EndPrimitive_
+    25380,  // subpassLoad_01U
+    25395,  // subpassLoad_01V
+    25410,  // subpassLoad_01W
+    25425,  // numSamples_
+    25436,  // samplePosition_00D
+    25454,  // interpolateAtCenter_00B
+    25477,  // interpolateAtCenter_10B
+    25500,  // interpolateAtCenter_20B
+    25523,  // interpolateAtCenter_30B
+    25546,  // loopForwardProgress_
+    25566,  // saturate_00B
+    25578,  // saturate_10B
+    25590,  // saturate_20B
+    25602,  // saturate_30B
+    25614,  // gl_DepthRangeParameters
+    25637,  // gl_DepthRange
+    25650,  // gl_NumSamples
+    25663,  // gl_MaxVertexAttribs
+    25682,  // gl_MaxVertexUniformVectors
+    25708,  // gl_MaxVertexTextureImageUnits
+    25737,  // gl_MaxCombinedTextureImageUnits
+    25768,  // gl_MaxTextureImageUnits
+    25791,  // gl_MaxFragmentUniformVectors
+    25819,  // gl_MaxVaryingVectors
+    25839,  // gl_MaxDrawBuffers
+    25856,  // gl_MaxDualSourceDrawBuffersEXT
+    25886,  // gl_MaxVertexOutputVectors
+    25911,  // gl_MaxFragmentInputVectors
+    25937,  // gl_MinProgramTexelOffset
+    25961,  // gl_MaxProgramTexelOffset
+    25985,  // gl_MaxImageUnits
+    26001,  // gl_MaxVertexImageUniforms
+    26026,  // gl_MaxFragmentImageUniforms
+    26053,  // gl_MaxComputeImageUniforms
+    26079,  // gl_MaxCombinedImageUniforms
+    26106,  // gl_MaxCombinedShaderOutputResources
+    26141,  // gl_MaxComputeWorkGroupCount
+    26168,  // gl_MaxComputeWorkGroupSize
+    26194,  // gl_MaxComputeUniformComponents
+    26224,  // gl_MaxComputeTextureImageUnits
+    26254,  // gl_MaxComputeAtomicCounters
+    26281,  // gl_MaxComputeAtomicCounterBuffers
+    26314,  // gl_MaxVertexAtomicCounters
+    26340,  // gl_MaxFragmentAtomicCounters
+    26368,  // gl_MaxCombinedAtomicCounters
+    26396,  // gl_MaxAtomicCounterBindings
+    26423,  // gl_MaxVertexAtomicCounterBuffers
+    26455,  // gl_MaxFragmentAtomicCounterBuffers
+    26489,  // gl_MaxCombinedAtomicCounterBuffers
+    26523,  // gl_MaxAtomicCounterBufferSize
+    26552,  // gl_MaxGeometryInputComponents
+    26581,  // gl_MaxGeometryOutputComponents
+    26611,  // gl_MaxGeometryImageUniforms
+    26638,  // gl_MaxGeometryTextureImageUnits
+    26669,  // gl_MaxGeometryOutputVertices
+    26697,  // gl_MaxGeometryTotalOutputComponents
+    26732,  // gl_MaxGeometryUniformComponents
+    26763,  // gl_MaxGeometryAtomicCounters
+    26791,  // gl_MaxGeometryAtomicCounterBuffers
+    26825,  // gl_MaxTessControlInputComponents
+    26857,  // gl_MaxTessControlOutputComponents
+    26890,  // gl_MaxTessControlTextureImageUnits
+    26924,  // gl_MaxTessControlUniformComponents
+    26958,  // gl_MaxTessControlTotalOutputComponents
+    26996,  // gl_MaxTessControlImageUniforms
+    27026,  // gl_MaxTessControlAtomicCounters
+    27057,  // gl_MaxTessControlAtomicCounterBuffers
+    27094,  // gl_MaxTessPatchComponents
+    27119,  // gl_MaxPatchVertices
+    27138,  // gl_MaxTessGenLevel
+    27156,  // gl_MaxTessEvaluationInputComponents
+    27191,  // gl_MaxTessEvaluationOutputComponents
+    27227,  // gl_MaxTessEvaluationTextureImageUnits
+    27264,  // gl_MaxTessEvaluationUniformComponents
+    27301,  // gl_MaxTessEvaluationImageUniforms
+    27334,  // gl_MaxTessEvaluationAtomicCounters
+    27368,  // gl_MaxTessEvaluationAtomicCounterBuffers
+    27408,  // gl_MaxSamples
+    27421,  // gl_MaxClipDistances
+    27440,  // gl_MaxCullDistances
+    27459,  // gl_MaxCombinedClipAndCullDistances
+    27493,  // gl_FragCoord
+    27505,  // gl_FrontFacing
+    27519,  // gl_PointCoord
+    27532,  // gl_FragColor
+    27544,  // gl_FragData
+    27555,  // gl_FragDepth
+    27567,  // gl_HelperInvocation
+    27586,  // gl_SecondaryFragColorEXT
+    27610,  // gl_SecondaryFragDataEXT
+    27633,  // gl_FragDepthEXT
+    27648,  // gl_LastFragData
+    27663,  // gl_LastFragColor
+    27679,  // gl_LastFragColorARM
+    27698,  // gl_LastFragDepthARM
+    27717,  // gl_LastFragStencilARM
+    27738,  // gl_PrimitiveID
+    27752,  // gl_Layer
+    27760,  // gl_SampleID
+    27771,  // gl_SamplePosition
+    27788,  // gl_SampleMaskIn
+    27803,  // gl_SampleMask
+    27816,  // gl_Position
+    27827,  // gl_PointSize
+    27839,  // gl_InstanceID
+    27852,  // gl_InstanceIndex
+    27868,  // gl_VertexID
+    27879,  // gl_VertexIndex
+    27893,  // gl_DrawID
+    27902,  // gl_BaseVertex
+    27915,  // gl_BaseInstance
+    27930,  // angle_BaseVertex
+    27946,  // angle_BaseInstance
+    27964,  // gl_ClipDistance
+    27979,  // gl_NumWorkGroups
+    27995,  // gl_WorkGroupSize
+    28011,  // gl_WorkGroupID
+    28025,  // gl_LocalInvocationID
+    28045,  // gl_GlobalInvocationID
+    28066,  // gl_LocalInvocationIndex
+    28089,  // gl_PrimitiveIDIn
+    28105,  // gl_InvocationID
+    28120,  // gl_PerVertex
+    28132,  // gl_in
+    28137,  // gl_PatchVerticesIn
+    28155,  // gl_TessLevelOuter
+    28172,  // gl_TessLevelInner
+    28189,  // gl_out
+    28195,  // gl_BoundingBox
+    28209,  // gl_BoundingBoxEXT
+    28226,  // gl_BoundingBoxOES
+    28243,  // gl_TessCoord
+    28255,  // gl_ViewID_OVR
+    28268,  // gl_CullDistance
+    28283,
+};
 
 // Flat array of offsets from a symbol into the rules table.
 constexpr uint16_t kMangledOffsets[] = {
@@ -24121,15 +25551,15 @@ const TSymbol *TSymbolTable::findBuiltIn(const ImmutableString &name, int shader
         return nullptr;
 
     uint32_t nameHash = name.mangledNameHash();
-    if (nameHash >= 1423)
+
+    uint16_t nameOffset = BuiltInArray::kMangledNameOffsets[nameHash];
+    size_t nameLength   = BuiltInArray::kMangledNameOffsets[nameHash + 1] - nameOffset;
+    if (name.length() != nameLength ||
+        memcmp(name.data(), BuiltInArray::kMangledNames + nameOffset, nameLength) != 0)
     {
         return nullptr;
     }
 
-    const char *actualName = BuiltInArray::kMangledNames[nameHash];
-    if (name != actualName)
-        return nullptr;
-
     uint16_t startIndex = BuiltInArray::kMangledOffsets[nameHash];
     uint16_t nextIndex  = GetNextRuleIndex(nameHash);
 
@@ -24145,11 +25575,6 @@ bool TSymbolTable::isUnmangledBuiltInName(const ImmutableString &name,
         return false;
 
     uint32_t nameHash = name.unmangledNameHash();
-    if (nameHash >= 180)
-    {
-        return false;
-    }
-
     return BuiltInArray::unmangled[nameHash].matches(name, mShaderSpec, shaderVersion, mShaderType,
                                                      extensions);
 }
@@ -177,9 +177,9 @@ TType::TType(const TPublicType &p)
       precise(p.precise),
       interpolant(false),
       memoryQualifier(p.memoryQualifier),
-      layoutQualifier(p.layoutQualifier),
       primarySize(p.getPrimarySize()),
       secondarySize(p.getSecondarySize()),
+      mLayoutQualifier(nullptr),
       mArraySizesStorage(nullptr),
       mInterfaceBlock(nullptr),
       mStructure(nullptr),
@@ -189,6 +189,7 @@ TType::TType(const TPublicType &p)
 {
     ASSERT(primarySize <= 4);
     ASSERT(secondarySize <= 4);
+    setLayoutQualifier(p.layoutQualifier);
     if (p.isArray())
     {
         makeArrays(*p.arraySizes);
@@ -212,7 +213,7 @@ TType::TType(const TInterfaceBlock *interfaceBlockIn,
              TLayoutQualifier layoutQualifierIn)
     : TType(EbtInterfaceBlock, EbpUndefined, qualifierIn, 1, 1)
 {
-    layoutQualifier = layoutQualifierIn;
+    setLayoutQualifier(layoutQualifierIn);
     mInterfaceBlock = interfaceBlockIn;
 }
 
@@ -230,9 +231,9 @@ TType &TType::operator=(const TType &t)
     precise                   = t.precise;
     interpolant               = t.interpolant;
     memoryQualifier           = t.memoryQualifier;
-    layoutQualifier           = t.layoutQualifier;
     primarySize               = t.primarySize;
     secondarySize             = t.secondarySize;
+    mLayoutQualifier          = t.mLayoutQualifier;
     mArraySizesStorage        = nullptr;
     mInterfaceBlock           = t.mInterfaceBlock;
     mStructure                = t.mStructure;
@@ -255,6 +256,18 @@ TType &TType::operator=(const TType &t)
     return *this;
 }
 
+void TType::setLayoutQualifier(const TLayoutQualifier &lq)
+{
+    if (lq.isEmpty() && lq.locationsSpecified == 0 && !lq.rasterOrdered)
+    {
+        mLayoutQualifier = nullptr;
+        return;
+    }
+
+    void *storage    = GetGlobalPoolAllocator()->allocate(sizeof(TLayoutQualifier));
+    mLayoutQualifier = new (storage) TLayoutQualifier(lq);
+}
+
 bool TType::canBeConstructed() const
 {
     switch (type)
@@ -118,9 +118,9 @@ class TType
           precise(false),
           interpolant(false),
           memoryQualifier(TMemoryQualifier::Create()),
-          layoutQualifier(TLayoutQualifier::Create()),
           primarySize(ps),
           secondarySize(ss),
+          mLayoutQualifier(nullptr),
           mArraySizes(arraySizes),
           mArraySizesStorage(nullptr),
           mInterfaceBlock(nullptr),
@@ -138,9 +138,9 @@ class TType
           precise(t.precise),
           interpolant(t.interpolant),
           memoryQualifier(t.memoryQualifier),
-          layoutQualifier(t.layoutQualifier),
           primarySize(t.primarySize),
           secondarySize(t.secondarySize),
+          mLayoutQualifier(t.mLayoutQualifier),
           mArraySizes(t.mArraySizes),
           mArraySizesStorage(t.mArraySizesStorage),
           mInterfaceBlock(t.mInterfaceBlock),
@@ -173,8 +173,11 @@ class TType
     TMemoryQualifier getMemoryQualifier() const { return memoryQualifier; }
     void setMemoryQualifier(const TMemoryQualifier &mq) { memoryQualifier = mq; }
 
-    TLayoutQualifier getLayoutQualifier() const { return layoutQualifier; }
-    void setLayoutQualifier(TLayoutQualifier lq) { layoutQualifier = lq; }
+    const TLayoutQualifier &getLayoutQualifier() const
+    {
+        return mLayoutQualifier ? *mLayoutQualifier : kEmptyLayoutQualifier;
+    }
+    void setLayoutQualifier(const TLayoutQualifier &lq);
 
     uint8_t getNominalSize() const { return primarySize; }
     uint8_t getSecondarySize() const { return secondarySize; }
@@ -381,10 +384,16 @@ class TType
     bool interpolant;
 
     TMemoryQualifier memoryQualifier;
-    TLayoutQualifier layoutQualifier;
     uint8_t primarySize;    // size of vector or cols matrix
     uint8_t secondarySize;  // rows of a matrix
 
+    // Most types have no layout qualifier, and the layout qualifier is larger than the rest of the
+    // type, so it's kept out of the type, in the pool.  This is nullptr if the layout qualifier is
+    // empty.  The layout qualifier is never modified after it's allocated, so copies of the type
+    // share it.
+    static constexpr TLayoutQualifier kEmptyLayoutQualifier = TLayoutQualifier::Create();
+    const TLayoutQualifier *mLayoutQualifier;
+
     // Used to make an array type. Outermost array size is stored at the end of the vector. Having 0
     // in this vector means an unsized array.
     angle::Span<const unsigned int> mArraySizes;
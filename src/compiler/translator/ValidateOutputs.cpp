@@ -13,6 +13,7 @@
 
 #include "compiler/translator/InfoSink.h"
 #include "compiler/translator/ParseContext.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 
 namespace sh
@@ -219,6 +220,32 @@ void ValidateOutputsTraverser::validate(TDiagnostics *diagnostics) const
     }
 }
 
+class ValidateOutputsPass : public TFusablePass
+{
+  public:
+    ValidateOutputsPass(const TExtensionBehavior &extBehavior,
+                        const ShBuiltInResources &resources,
+                        bool usesPixelLocalStorage,
+                        bool isWebGL,
+                        TDiagnostics *diagnostics)
+        : mTraverser(extBehavior, resources, usesPixelLocalStorage, isWebGL),
+          mDiagnostics(diagnostics)
+    {}
+
+    TIntermTraverser *getTraverser() override { return &mTraverser; }
+
+    bool finish(TCompiler *compiler, TIntermBlock *root) override
+    {
+        int numErrorsBefore = mDiagnostics->numErrors();
+        mTraverser.validate(mDiagnostics);
+        return (mDiagnostics->numErrors() == numErrorsBefore);
+    }
+
+  private:
+    ValidateOutputsTraverser mTraverser;
+    TDiagnostics *mDiagnostics;
+};
+
 }  // anonymous namespace
 
 bool ValidateOutputs(TIntermBlock *root,
@@ -228,12 +255,19 @@ bool ValidateOutputs(TIntermBlock *root,
                      bool isWebGL,
                      TDiagnostics *diagnostics)
 {
-    ValidateOutputsTraverser validateOutputs(extBehavior, resources, usesPixelLocalStorage,
-                                             isWebGL);
-    root->traverse(&validateOutputs);
-    int numErrorsBefore = diagnostics->numErrors();
-    validateOutputs.validate(diagnostics);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    ValidateOutputsPass pass(extBehavior, resources, usesPixelLocalStorage, isWebGL, diagnostics);
+    root->traverse(pass.getTraverser());
+    return pass.finish(nullptr, root);
+}
+
+std::unique_ptr<TFusablePass> CreateValidateOutputsPass(const TExtensionBehavior &extBehavior,
+                                                        const ShBuiltInResources &resources,
+                                                        bool usesPixelLocalStorage,
+                                                        bool isWebGL,
+                                                        TDiagnostics *diagnostics)
+{
+    return std::make_unique<ValidateOutputsPass>(extBehavior, resources, usesPixelLocalStorage,
+                                                 isWebGL, diagnostics);
 }
 
 }  // namespace sh
@@ -13,12 +13,15 @@
 
 #include <GLSLANG/ShaderLang.h>
 
+#include <memory>
+
 #include "compiler/translator/ExtensionBehavior.h"
 
 namespace sh
 {
 
 class TCompiler;
+class TFusablePass;
 class TIntermBlock;
 class TDiagnostics;
 
@@ -30,6 +33,13 @@ bool ValidateOutputs(TIntermBlock *root,
                      bool isWebGL,
                      TDiagnostics *diagnostics);
 
+// ValidateOutputs as a pass to run in a TFusedTraverser.
+std::unique_ptr<TFusablePass> CreateValidateOutputsPass(const TExtensionBehavior &extBehavior,
+                                                        const ShBuiltInResources &resources,
+                                                        bool usesPixelLocalStorage,
+                                                        bool isWebGL,
+                                                        TDiagnostics *diagnostics);
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_VALIDATEOUTPUTS_H_
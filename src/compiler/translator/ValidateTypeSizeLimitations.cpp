@@ -13,6 +13,7 @@
 #include "compiler/translator/Symbol.h"
 #include "compiler/translator/SymbolTable.h"
 #include "compiler/translator/blocklayout.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 #include "compiler/translator/util.h"
 
@@ -335,16 +336,41 @@ class ValidateTypeSizeLimitationsTraverser : public TIntermTraverser
     angle::base::CheckedNumeric<size_t> mTotalPrivateVariablesSize;
 };
 
+class ValidateTypeSizeLimitationsPass : public TFusablePass
+{
+  public:
+    ValidateTypeSizeLimitationsPass(TSymbolTable *symbolTable, TDiagnostics *diagnostics)
+        : mTraverser(symbolTable, diagnostics), mDiagnostics(diagnostics)
+    {}
+
+    TIntermTraverser *getTraverser() override { return &mTraverser; }
+
+    bool finish(TCompiler *compiler, TIntermBlock *root) override
+    {
+        mTraverser.validateTotalPrivateVariableSize();
+        return mDiagnostics->numErrors() == 0;
+    }
+
+  private:
+    ValidateTypeSizeLimitationsTraverser mTraverser;
+    TDiagnostics *mDiagnostics;
+};
+
 }  // namespace
 
 bool ValidateTypeSizeLimitations(TIntermNode *root,
                                  TSymbolTable *symbolTable,
                                  TDiagnostics *diagnostics)
 {
-    ValidateTypeSizeLimitationsTraverser validate(symbolTable, diagnostics);
-    root->traverse(&validate);
-    validate.validateTotalPrivateVariableSize();
-    return diagnostics->numErrors() == 0;
+    ValidateTypeSizeLimitationsPass pass(symbolTable, diagnostics);
+    root->traverse(pass.getTraverser());
+    return pass.finish(nullptr, nullptr);
+}
+
+std::unique_ptr<TFusablePass> CreateValidateTypeSizeLimitationsPass(TSymbolTable *symbolTable,
+                                                                    TDiagnostics *diagnostics)
+{
+    return std::make_unique<ValidateTypeSizeLimitationsPass>(symbolTable, diagnostics);
 }
 
 }  // namespace sh
@@ -7,12 +7,15 @@
 #ifndef COMPILER_TRANSLATOR_VALIDATETYPESIZELIMITATIONS_H_
 #define COMPILER_TRANSLATOR_VALIDATETYPESIZELIMITATIONS_H_
 
+#include <memory>
+
 #include "compiler/translator/IntermNode.h"
 
 namespace sh
 {
 
 class TDiagnostics;
+class TFusablePass;
 
 // Returns true if the given shader does not violate certain
 // implementation-defined limits on the size of variables' types.
@@ -20,6 +23,10 @@ bool ValidateTypeSizeLimitations(TIntermNode *root,
                                  TSymbolTable *symbolTable,
                                  TDiagnostics *diagnostics);
 
+// ValidateTypeSizeLimitations as a pass to run in a TFusedTraverser.
+std::unique_ptr<TFusablePass> CreateValidateTypeSizeLimitationsPass(TSymbolTable *symbolTable,
+                                                                    TDiagnostics *diagnostics);
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_VALIDATETYPESIZELIMITATIONS_H_
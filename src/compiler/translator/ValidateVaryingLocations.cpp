@@ -11,6 +11,7 @@
 
 #include "compiler/translator/Diagnostics.h"
 #include "compiler/translator/SymbolTable.h"
+#include "compiler/translator/tree_util/FusedTraverser.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 #include "compiler/translator/util.h"
 
@@ -341,6 +342,27 @@ void ValidateVaryingLocationsTraverser::validate(TDiagnostics *diagnostics)
                                               mShaderType);
 }
 
+class ValidateVaryingLocationsPass : public TFusablePass
+{
+  public:
+    ValidateVaryingLocationsPass(TDiagnostics *diagnostics, GLenum shaderType)
+        : mTraverser(shaderType), mDiagnostics(diagnostics)
+    {}
+
+    TIntermTraverser *getTraverser() override { return &mTraverser; }
+
+    bool finish(TCompiler *compiler, TIntermBlock *root) override
+    {
+        int numErrorsBefore = mDiagnostics->numErrors();
+        mTraverser.validate(mDiagnostics);
+        return (mDiagnostics->numErrors() == numErrorsBefore);
+    }
+
+  private:
+    ValidateVaryingLocationsTraverser mTraverser;
+    TDiagnostics *mDiagnostics;
+};
+
 }  // anonymous namespace
 
 unsigned int CalculateVaryingLocationCount(const TType &varyingType, GLenum shaderType)
@@ -358,11 +380,15 @@ unsigned int CalculateVaryingLocationCount(const TType &varyingType, GLenum shad
 
 bool ValidateVaryingLocations(TIntermBlock *root, TDiagnostics *diagnostics, GLenum shaderType)
 {
-    ValidateVaryingLocationsTraverser varyingValidator(shaderType);
-    root->traverse(&varyingValidator);
-    int numErrorsBefore = diagnostics->numErrors();
-    varyingValidator.validate(diagnostics);
-    return (diagnostics->numErrors() == numErrorsBefore);
+    ValidateVaryingLocationsPass pass(diagnostics, shaderType);
+    root->traverse(pass.getTraverser());
+    return pass.finish(nullptr, root);
+}
+
+std::unique_ptr<TFusablePass> CreateValidateVaryingLocationsPass(TDiagnostics *diagnostics,
+                                                                 GLenum shaderType)
+{
+    return std::make_unique<ValidateVaryingLocationsPass>(diagnostics, shaderType);
 }
 
 }  // namespace sh
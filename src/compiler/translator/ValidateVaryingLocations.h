@@ -10,11 +10,14 @@
 #ifndef COMPILER_TRANSLATOR_VALIDATEVARYINGLOCATIONS_H_
 #define COMPILER_TRANSLATOR_VALIDATEVARYINGLOCATIONS_H_
 
+#include <memory>
+
 #include "GLSLANG/ShaderVars.h"
 
 namespace sh
 {
 
+class TFusablePass;
 class TIntermBlock;
 class TIntermSymbol;
 class TDiagnostics;
@@ -22,6 +25,9 @@ class TType;
 
 unsigned int CalculateVaryingLocationCount(const TType &varyingType, GLenum shaderType);
 bool ValidateVaryingLocations(TIntermBlock *root, TDiagnostics *diagnostics, GLenum shaderType);
+// ValidateVaryingLocations as a pass to run in a TFusedTraverser.
+std::unique_ptr<TFusablePass> CreateValidateVaryingLocationsPass(TDiagnostics *diagnostics,
+                                                                 GLenum shaderType);
 
 }  // namespace sh
 
@@ -1,11 +1,4 @@
-#!/usr/bin/env vpython3
-#
-# [VPYTHON:BEGIN]
-# wheel: <
-#   name: "infra/python/wheels/perfect-hash-py2_py3"
-#   version: "version:0.2.1"
-# >
-# [VPYTHON:END]
+#!/usr/bin/env python3
 #
 # Copyright 2018 The ANGLE Project Authors. All rights reserved.
 # Use of this source code is governed by a BSD-style license that can be
@@ -15,10 +8,6 @@
 #  Code generation for the built-in symbol tables.
 import sys
 
-# Conditional import enables getting inputs/outputs with python3 instead of vpython3
-if len(sys.argv) < 2:
-    from perfect_hash import generate_hash, Hash2
-
 from collections import OrderedDict
 import argparse
 import copy
@@ -26,7 +15,6 @@ import hashlib
 import json
 import re
 import os
-import random
 
 template_immutablestring_cpp = """// GENERATED FILE - DO NOT EDIT.
 // Generated by {script_name} using data from {variable_data_source_name} and
@@ -38,7 +26,7 @@ template_immutablestring_cpp = """// GENERATED FILE - DO NOT EDIT.
 //
 // ImmutableString_autogen.cpp: Wrapper for static or pool allocated char arrays, that are guaranteed to be
 // valid and unchanged for the duration of the compilation.
-// Implements mangledNameHash using perfect hash function from gen_builtin_symbols.py
+// Implements mangledNameHash using the perfect hash function generated by gen_builtin_symbols.py
 
 #include "compiler/translator/ImmutableString.h"
 
@@ -51,63 +39,81 @@ std::ostream &operator<<(std::ostream &os, const ImmutableString &str)
 
 }}
 
-#if defined(_MSC_VER)
-#    pragma warning(disable : 4309)  // truncation of constant value
-#endif
-
-
 namespace
 {{
 
-constexpr int mangledkT1[] = {{{mangled_S1}}};
-constexpr int mangledkT2[] = {{{mangled_S2}}};
-constexpr int mangledkG[] = {{{mangled_G}}};
+constexpr uint64_t kHashMultiplier = 0x9E3779B97F4A7C15ull;
 
-int MangledHashG(const char *key, const int *T)
+// Loads eight characters as a little-endian word, so that the hash doesn't depend on endianness.
+// Compilers turn this into a single load on little-endian targets.
+uint64_t LoadWord(const char *chars)
 {{
-    int sum = 0;
-
-    for (int i = 0; key[i] != '\\0'; i++)
-    {{
-        sum += T[i] * key[i];
-        sum %= {mangled_NG};
-    }}
-    return mangledkG[sum];
+    const uint8_t *bytes = reinterpret_cast<const uint8_t *>(chars);
+    return static_cast<uint64_t>(bytes[0]) | static_cast<uint64_t>(bytes[1]) << 8 |
+           static_cast<uint64_t>(bytes[2]) << 16 | static_cast<uint64_t>(bytes[3]) << 24 |
+           static_cast<uint64_t>(bytes[4]) << 32 | static_cast<uint64_t>(bytes[5]) << 40 |
+           static_cast<uint64_t>(bytes[6]) << 48 | static_cast<uint64_t>(bytes[7]) << 56;
 }}
 
-int MangledPerfectHash(const char *key)
+uint64_t MixWord(uint64_t hash, uint64_t word)
 {{
-    if (strlen(key) > {mangled_NS})
-        return 0;
-
-    return (MangledHashG(key, mangledkT1) + MangledHashG(key, mangledkT2)) % {mangled_NG};
+    hash = (hash ^ word) * kHashMultiplier;
+    return hash ^ (hash >> 29);
 }}
 
-constexpr int unmangledkT1[] = {{{unmangled_S1}}};
-constexpr int unmangledkT2[] = {{{unmangled_S2}}};
-constexpr int unmangledkG[] = {{{unmangled_G}}};
-
-int UnmangledHashG(const char *key, const int *T)
+// Hashes the name eight characters at a time.  Unless the name is shorter than that, the last word
+// overlaps the previous one instead of being padded.
+uint64_t HashName(const char *name, size_t length, uint64_t seed)
 {{
-    int sum = 0;
+    uint64_t hash = seed ^ (length * kHashMultiplier);
 
-    for (int i = 0; key[i] != '\\0'; i++)
+    if (length < 8)
     {{
-        sum += T[i] * key[i];
-        sum %= {unmangled_NG};
+        uint64_t word = 0;
+        for (size_t index = 0; index < length; ++index)
+        {{
+            word |= static_cast<uint64_t>(static_cast<uint8_t>(name[index])) << (index * 8);
+        }}
+        hash = MixWord(hash, word);
     }}
-    return unmangledkG[sum];
+    else
+    {{
+        for (size_t offset = 0; offset + 8 < length; offset += 8)
+        {{
+            hash = MixWord(hash, LoadWord(name + offset));
+        }}
+        hash = MixWord(hash, LoadWord(name + length - 8));
+    }}
+
+    hash *= kHashMultiplier;
+    return hash ^ (hash >> 32);
 }}
 
-int UnmangledPerfectHash(const char *key)
+// The two halves of the name hash select two vertices of the graph built by
+// gen_builtin_symbols.py, whose labels add up to the index of the name in the built-in tables.
+template <size_t kGraphSize>
+uint32_t GraphLabelSum(const char *name,
+                       size_t length,
+                       uint64_t seed,
+                       const uint16_t (&labels)[kGraphSize])
 {{
-    if (strlen(key) > {unmangled_NS})
-        return 0;
-
-    return (UnmangledHashG(key, unmangledkT1) + UnmangledHashG(key, unmangledkT2)) % {unmangled_NG};
+    const uint64_t hash    = HashName(name, length, seed);
+    const uint64_t vertex1 = ((hash >> 32) * kGraphSize) >> 32;
+    const uint64_t vertex2 = ((hash & 0xFFFFFFFFu) * kGraphSize) >> 32;
+    return labels[vertex1] + labels[vertex2];
 }}
 
-}}
+constexpr uint64_t kMangledSeed = {mangled_seed};
+
+constexpr uint16_t kMangledGraphLabels[] = {{
+{mangled_graph_labels}}};
+
+constexpr uint64_t kUnmangledSeed = {unmangled_seed};
+
+constexpr uint16_t kUnmangledGraphLabels[] = {{
+{unmangled_graph_labels}}};
+
+}}  // anonymous namespace
 
 namespace sh
 {{
@@ -128,12 +134,12 @@ const size_t ImmutableString::FowlerNollVoHash<8>::kFnvOffsetBasis =
 
 uint32_t ImmutableString::mangledNameHash() const
 {{
-    return MangledPerfectHash(data());
+    return GraphLabelSum(data(), length(), kMangledSeed, kMangledGraphLabels) % {num_mangled_names};
 }}
 
 uint32_t ImmutableString::unmangledNameHash() const
 {{
-    return UnmangledPerfectHash(data());
+    return GraphLabelSum(data(), length(), kUnmangledSeed, kUnmangledGraphLabels) % {num_unmangled_names};
 }}
 
 }}  // namespace sh
@@ -316,9 +322,14 @@ constexpr SymbolRule kRules[] = {{
 {mangled_rules}
 }};
 
-// Flat array of all mangled names.
-constexpr const char *kMangledNames[] = {{
-{mangled_names_array}
+// All mangled names back to back.
+constexpr char kMangledNames[] =
+{mangled_names_array};
+
+// Flat array of offsets from a symbol into kMangledNames.  The last offset is the end of the last
+// name.
+constexpr uint16_t kMangledNameOffsets[] = {{
+{mangled_name_offsets_array}
 }};
 
 // Flat array of offsets from a symbol into the rules table.
@@ -360,12 +371,14 @@ const TSymbol *TSymbolTable::findBuiltIn(const ImmutableString &name,
         return nullptr;
 
     uint32_t nameHash = name.mangledNameHash();
-    if (nameHash >= {num_mangled_names})
-        return nullptr;
 
-    const char *actualName = BuiltInArray::kMangledNames[nameHash];
-    if (name != actualName)
+    uint16_t nameOffset = BuiltInArray::kMangledNameOffsets[nameHash];
+    size_t nameLength = BuiltInArray::kMangledNameOffsets[nameHash + 1] - nameOffset;
+    if (name.length() != nameLength ||
+        memcmp(name.data(), BuiltInArray::kMangledNames + nameOffset, nameLength) != 0)
+    {{
         return nullptr;
+    }}
 
     uint16_t startIndex = BuiltInArray::kMangledOffsets[nameHash];
     uint16_t nextIndex = GetNextRuleIndex(nameHash);
@@ -381,9 +394,6 @@ bool TSymbolTable::isUnmangledBuiltInName(const ImmutableString &name,
         return false;
 
     uint32_t nameHash = name.unmangledNameHash();
-    if (nameHash >= {num_unmangled_names})
-        return false;
-
     return BuiltInArray::unmangled[nameHash].matches(name, mShaderSpec, shaderVersion, mShaderType, extensions);
 }}
 
@@ -782,6 +792,9 @@ class GroupedList:
     def get_names(self):
         return self.names
 
+    def get_name_offsets(self):
+        return self.name_offsets
+
     def get_offsets(self):
         return self.offsets
 
@@ -812,8 +825,10 @@ class GroupedList:
                 })
 
         self.names = []
+        self.name_offsets = []
         self.offsets = []
         self.rules = []
+        name_offset = 0
         for hash_val in range(0, self.num_names):
             if hash_val in self.objs:
                 data = self.objs[hash_val]
@@ -855,15 +870,22 @@ class GroupedList:
                 name_underscore = name.replace("(", "_")
 
                 self.names.append('"%s"' % name)
+                self.name_offsets.append("%d, // %s" % (name_offset, name_underscore))
                 self.offsets.append("%d, // %s" % (self.rule_offset, name_underscore))
                 self.rules.append("%s" % self.format_rules(rules))
 
                 self.rule_offset += len(rules)
+                name_offset += len(name)
 
             else:
                 self.names.append('""')
+                self.name_offsets.append('%d, // Empty' % name_offset)
                 self.offsets.append('%d, // Empty' % self.rule_offset)
 
+        if name_offset > 0xFFFF:
+            raise Exception('Mangled names do not fit in kMangledNames with 16-bit offsets')
+        self.name_offsets.append('%d,' % name_offset)
+
 
 class UnmangledGroupedList:
     """"Class for storing a list of unmangled objects grouped by symbol table level and condition."""
@@ -1194,15 +1216,85 @@ class FunctionsData:
             search_index += direction
 
 
-class HashFunction:
+class PerfectHash:
+    """Order-preserving minimal perfect hash function over a list of names.
+
+    Each name is an edge between the two vertices of a graph selected by the two halves of its
+    64-bit hash.  If the graph is acyclic, the vertices can be labeled such that the labels at the
+    ends of each edge add up to the index of its name (the CHM algorithm).  Otherwise another seed
+    is tried.  Must match HashName and GraphLabelSum in template_immutablestring_cpp."""
+
+    HASH_MULTIPLIER = 0x9E3779B97F4A7C15
+    MASK_64 = 0xFFFFFFFFFFFFFFFF
+    # Vertices per name.  Above 2, the graph is acyclic with a probability that doesn't depend on
+    # the number of names.
+    GRAPH_SIZE_RATIO = 2.1
+
+    def __init__(self, names):
+        self.num_names = len(names)
+        if self.num_names > 0xFFFF:
+            raise Exception('Too many names for 16-bit graph labels')
+        self.graph_size = int(self.num_names * self.GRAPH_SIZE_RATIO) + 1
+        self.seed = 0
+        while not self.label_graph(names):
+            self.seed += 1
 
-    def __init__(self, f1, f2, G):
-        self.f1 = f1
-        self.f2 = f2
-        self.G = G
+    @classmethod
+    def hash_name(cls, name, seed):
+        data = name.encode()
+
+        def mix_word(hash, word):
+            hash = ((hash ^ word) * cls.HASH_MULTIPLIER) & cls.MASK_64
+            return hash ^ (hash >> 29)
+
+        if len(data) < 8:
+            words = [data]
+        else:
+            words = [data[offset:offset + 8] for offset in range(0, len(data) - 8, 8)]
+            words.append(data[-8:])
+
+        hash = seed ^ ((len(data) * cls.HASH_MULTIPLIER) & cls.MASK_64)
+        for word in words:
+            hash = mix_word(hash, int.from_bytes(word, 'little'))
+        hash = (hash * cls.HASH_MULTIPLIER) & cls.MASK_64
+        return hash ^ (hash >> 32)
+
+    def get_vertices(self, name):
+        hash = self.hash_name(name, self.seed)
+        return ((hash >> 32) * self.graph_size) >> 32, ((hash & 0xFFFFFFFF) * self.graph_size) >> 32
+
+    def label_graph(self, names):
+        edges = [[] for vertex in range(self.graph_size)]
+        for index, name in enumerate(names):
+            vertex1, vertex2 = self.get_vertices(name)
+            if vertex1 == vertex2:
+                return False
+            edges[vertex1].append((vertex2, index))
+            edges[vertex2].append((vertex1, index))
+
+        labels = [None] * self.graph_size
+        for root in range(self.graph_size):
+            if labels[root] is not None:
+                continue
+            labels[root] = 0
+            stack = [(root, None)]
+            while stack:
+                vertex, parent_edge = stack.pop()
+                for neighbor, index in edges[vertex]:
+                    if index == parent_edge:
+                        continue
+                    if labels[neighbor] is not None:
+                        # The graph has a cycle.
+                        return False
+                    labels[neighbor] = (index - labels[vertex]) % self.num_names
+                    stack.append((neighbor, index))
+
+        self.labels = labels
+        return True
 
-    def hash(self, key):
-        return (self.G[self.f1(key)] + self.G[self.f2(key)]) % len(self.G)
+    def hash(self, name):
+        vertex1, vertex2 = self.get_vertices(name)
+        return (self.labels[vertex1] + self.labels[vertex2]) % self.num_names
 
 
 def get_parsed_functions(functions_txt_filename):
@@ -1927,24 +2019,16 @@ def generate_files(args, functions_txt_filename, variables_json_filename,
     # Hashing mangled names
     mangled_names = list(dict.fromkeys(mangled_names))
     num_mangled_names = len(mangled_names)
-    mangled_names_dict = dict(zip(mangled_names, range(0, len(mangled_names))))
     # Generate the perfect hash function
-    f1, f2, mangled_G = generate_hash(mangled_names_dict, Hash2)
-    mangled_hashfn = HashFunction(f1, f2, mangled_G)
-    mangled_S1 = f1.salt
-    mangled_S2 = f2.salt
+    mangled_hashfn = PerfectHash(mangled_names)
     # Array for querying mangled builtins
     mangled_builtins = GroupedList(mangled_hashfn, num_mangled_names)
 
     # Hashing unmangled names
     unmangled_names = list(dict.fromkeys(unmangled_names))
     num_unmangled_names = len(unmangled_names)
-    unmangled_names_dict = dict(zip(unmangled_names, range(0, len(unmangled_names))))
     # Generate the perfect hash function
-    f1, f2, unmangled_G = generate_hash(unmangled_names_dict, Hash2)
-    unmangled_hashfn = HashFunction(f1, f2, unmangled_G)
-    unmangled_S1 = f1.salt
-    unmangled_S2 = f2.salt
+    unmangled_hashfn = PerfectHash(unmangled_names)
     # Array for querying unmangled builtins
     unmangled_function_if_statements = UnmangledGroupedList(unmangled_hashfn, num_unmangled_names)
 
@@ -1994,7 +2078,9 @@ def generate_files(args, functions_txt_filename, variables_json_filename,
         'init_member_variables':
             '\n'.join(variables.init_member_variables),
         'mangled_names_array':
-            ',\n'.join(mangled_builtins.get_names()),
+            '\n'.join(mangled_builtins.get_names()),
+        'mangled_name_offsets_array':
+            '\n'.join(mangled_builtins.get_name_offsets()),
         'mangled_offsets_array':
             '\n'.join(mangled_builtins.get_offsets()),
         'mangled_rules':
@@ -2013,26 +2099,14 @@ def generate_files(args, functions_txt_filename, variables_json_filename,
             '\n'.join(symbols.script_generated_hash_tests.keys()),
         'unmangled_script_generated_hash_tests':
             '\n'.join(symbols.unmangled_script_generated_hash_tests.keys()),
-        'mangled_S1':
-            str(mangled_S1).replace('[', ' ').replace(']', ' '),
-        'mangled_S2':
-            str(mangled_S2).replace('[', ' ').replace(']', ' '),
-        'mangled_G':
-            str(mangled_G).replace('[', ' ').replace(']', ' '),
-        'mangled_NG':
-            len(mangled_G),
-        'mangled_NS':
-            len(mangled_S1),
-        'unmangled_S1':
-            str(unmangled_S1).replace('[', ' ').replace(']', ' '),
-        'unmangled_S2':
-            str(unmangled_S2).replace('[', ' ').replace(']', ' '),
-        'unmangled_G':
-            str(unmangled_G).replace('[', ' ').replace(']', ' '),
-        'unmangled_NG':
-            len(unmangled_G),
-        'unmangled_NS':
-            len(unmangled_S1),
+        'mangled_seed':
+            mangled_hashfn.seed,
+        'mangled_graph_labels':
+            ', '.join(str(label) for label in mangled_hashfn.labels),
+        'unmangled_seed':
+            unmangled_hashfn.seed,
+        'unmangled_graph_labels':
+            ', '.join(str(label) for label in unmangled_hashfn.labels),
     }
 
     with open(immutablestring_cpp_filename, 'wt') as outfile_cpp:
@@ -2061,7 +2135,6 @@ def generate_files(args, functions_txt_filename, variables_json_filename,
 
 
 def main():
-    random.seed(0)
     set_working_dir()
 
     parser = argparse.ArgumentParser()
@@ -3916,8 +3916,12 @@ void yyfree(void *ptr, yyscan_t yyscanner)
 yy_size_t string_input(char *buf, yy_size_t max_size, yyscan_t yyscanner)
 {
     angle::pp::Token token;
-    yyget_extra(yyscanner)->getPreprocessor().lex(&token);
-    yy_size_t len = token.type == angle::pp::Token::LAST ? 0 : token.text.size();
+    TParseContext *context = yyget_extra(yyscanner);
+    context->getPreprocessor().lex(&token);
+    // Stop parsing once constant folding has exceeded the compile time budget.
+    yy_size_t len = token.type == angle::pp::Token::LAST || context->isCompileTimeBudgetExceeded()
+                        ? 0
+                        : token.text.size();
     if (len < max_size)
     {
         memcpy(buf, token.text.c_str(), len);
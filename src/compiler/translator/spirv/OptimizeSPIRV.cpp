@@ -0,0 +1,803 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeSPIRV: Lightweight optimizations of the SPIR-V generated by OutputSPIRV.
+//
+
+#include "compiler/translator/spirv/OptimizeSPIRV.h"
+
+#include <algorithm>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/debug.h"
+#include "common/hash_containers.h"
+#include "common/hash_utils.h"
+#include "common/spirv/spirv_instruction_parser_autogen.h"
+
+namespace spirv = angle::spirv;
+
+namespace sh
+{
+namespace
+{
+constexpr uint32_t kInvalidIndex = 0xFFFF'FFFFu;
+
+// How the operands of an instruction are treated by the optimizer.
+enum class OperandLayout
+{
+    // The operands are not known.  Every word could be an id.
+    Unknown,
+    // OpName and OpDecorate, which are removed if their target is removed.  The target is not
+    // considered a use.
+    DebugOrDecoration,
+    // A side-effect-free instruction with a result type and id.  It can be removed if the result is
+    // unused.
+    Pure,
+    // An instruction with side effects.
+    SideEffect,
+};
+
+// Calls |visitId| for the index of every word of the instruction that is known to be an id
+// operand.  The result type and id are not visited.  Returns how the operands are treated.  If the
+// operands are not known, every word after the opcode is visited.
+template <typename VisitId>
+OperandLayout ForEachIdOperand(const uint32_t *instruction,
+                               spv::Op op,
+                               uint32_t length,
+                               VisitId &&visitId)
+{
+    auto visitRange = [&](uint32_t first, uint32_t last) {
+        for (uint32_t index = first; index < std::min(last, length); ++index)
+        {
+            visitId(index);
+        }
+    };
+
+    // Image instructions have a few ids, followed by an optional image operands mask and ids for
+    // the image operands.
+    auto visitImageOperands = [&](uint32_t first, uint32_t idCount) {
+        visitRange(first, first + idCount);
+        visitRange(first + idCount + 1, length);
+    };
+
+    switch (op)
+    {
+        case spv::OpName:
+        case spv::OpDecorate:
+            return OperandLayout::DebugOrDecoration;
+
+        case spv::OpMemberName:
+        case spv::OpMemberDecorate:
+            // These target types, which are never removed.
+            return OperandLayout::SideEffect;
+
+        case spv::OpUndef:
+        case spv::OpCopyObject:
+        case spv::OpSNegate:
+        case spv::OpFNegate:
+        case spv::OpIAdd:
+        case spv::OpFAdd:
+        case spv::OpISub:
+        case spv::OpFSub:
+        case spv::OpIMul:
+        case spv::OpFMul:
+        case spv::OpUDiv:
+        case spv::OpSDiv:
+        case spv::OpFDiv:
+        case spv::OpUMod:
+        case spv::OpSRem:
+        case spv::OpSMod:
+        case spv::OpFRem:
+        case spv::OpFMod:
+        case spv::OpVectorTimesScalar:
+        case spv::OpMatrixTimesScalar:
+        case spv::OpVectorTimesMatrix:
+        case spv::OpMatrixTimesVector:
+        case spv::OpMatrixTimesMatrix:
+        case spv::OpOuterProduct:
+        case spv::OpDot:
+        case spv::OpIAddCarry:
+        case spv::OpISubBorrow:
+        case spv::OpUMulExtended:
+        case spv::OpSMulExtended:
+        case spv::OpShiftRightLogical:
+        case spv::OpShiftRightArithmetic:
+        case spv::OpShiftLeftLogical:
+        case spv::OpBitwiseOr:
+        case spv::OpBitwiseXor:
+        case spv::OpBitwiseAnd:
+        case spv::OpNot:
+        case spv::OpBitFieldInsert:
+        case spv::OpBitFieldSExtract:
+        case spv::OpBitFieldUExtract:
+        case spv::OpBitReverse:
+        case spv::OpBitCount:
+        case spv::OpAny:
+        case spv::OpAll:
+        case spv::OpIsNan:
+        case spv::OpIsInf:
+        case spv::OpLogicalEqual:
+        case spv::OpLogicalNotEqual:
+        case spv::OpLogicalOr:
+        case spv::OpLogicalAnd:
+        case spv::OpLogicalNot:
+        case spv::OpSelect:
+        case spv::OpIEqual:
+        case spv::OpINotEqual:
+        case spv::OpUGreaterThan:
+        case spv::OpSGreaterThan:
+        case spv::OpUGreaterThanEqual:
+        case spv::OpSGreaterThanEqual:
+        case spv::OpULessThan:
+        case spv::OpSLessThan:
+        case spv::OpULessThanEqual:
+        case spv::OpSLessThanEqual:
+        case spv::OpFOrdEqual:
+        case spv::OpFUnordEqual:
+        case spv::OpFOrdNotEqual:
+        case spv::OpFUnordNotEqual:
+        case spv::OpFOrdLessThan:
+        case spv::OpFUnordLessThan:
+        case spv::OpFOrdGreaterThan:
+        case spv::OpFUnordGreaterThan:
+        case spv::OpFOrdLessThanEqual:
+        case spv::OpFUnordLessThanEqual:
+        case spv::OpFOrdGreaterThanEqual:
+        case spv::OpFUnordGreaterThanEqual:
+        case spv::OpConvertFToU:
+        case spv::OpConvertFToS:
+        case spv::OpConvertSToF:
+        case spv::OpConvertUToF:
+        case spv::OpUConvert:
+        case spv::OpSConvert:
+        case spv::OpFConvert:
+        case spv::OpQuantizeToF16:
+        case spv::OpBitcast:
+        case spv::OpTranspose:
+        case spv::OpCompositeConstruct:
+        case spv::OpAccessChain:
+        case spv::OpInBoundsAccessChain:
+        case spv::OpSampledImage:
+        case spv::OpImage:
+        case spv::OpImageQuerySizeLod:
+        case spv::OpImageQuerySize:
+        case spv::OpImageQueryLod:
+        case spv::OpImageQueryLevels:
+        case spv::OpImageQuerySamples:
+        case spv::OpDPdx:
+        case spv::OpDPdy:
+        case spv::OpFwidth:
+        case spv::OpDPdxFine:
+        case spv::OpDPdyFine:
+        case spv::OpFwidthFine:
+        case spv::OpDPdxCoarse:
+        case spv::OpDPdyCoarse:
+        case spv::OpFwidthCoarse:
+        case spv::OpPhi:
+            visitRange(3, length);
+            return OperandLayout::Pure;
+
+        case spv::OpLoad:
+            // Loads with memory operands are left alone.
+            visitRange(3, 4);
+            return length == 4 ? OperandLayout::Pure : OperandLayout::SideEffect;
+        case spv::OpCompositeExtract:
+            visitRange(3, 4);
+            return OperandLayout::Pure;
+        case spv::OpCompositeInsert:
+        case spv::OpVectorShuffle:
+            visitRange(3, 5);
+            return OperandLayout::Pure;
+
+        case spv::OpImageSampleImplicitLod:
+        case spv::OpImageSampleExplicitLod:
+        case spv::OpImageSampleProjImplicitLod:
+        case spv::OpImageSampleProjExplicitLod:
+        case spv::OpImageFetch:
+        case spv::OpImageRead:
+            visitImageOperands(3, 2);
+            return OperandLayout::Pure;
+        case spv::OpImageSampleDrefImplicitLod:
+        case spv::OpImageSampleDrefExplicitLod:
+        case spv::OpImageSampleProjDrefImplicitLod:
+        case spv::OpImageSampleProjDrefExplicitLod:
+        case spv::OpImageGather:
+        case spv::OpImageDrefGather:
+            visitImageOperands(3, 3);
+            return OperandLayout::Pure;
+        case spv::OpImageWrite:
+            visitImageOperands(1, 3);
+            return OperandLayout::SideEffect;
+
+        case spv::OpVariable:
+            // The optional initializer.
+            visitRange(4, 5);
+            return OperandLayout::SideEffect;
+        case spv::OpStore:
+            visitRange(1, 3);
+            return OperandLayout::SideEffect;
+        case spv::OpFunctionCall:
+            visitRange(3, length);
+            return OperandLayout::SideEffect;
+        case spv::OpExtInst:
+            // The instruction set id (never removed) and instruction number are skipped.
+            visitRange(5, length);
+            return OperandLayout::SideEffect;
+        case spv::OpReturnValue:
+        case spv::OpBranch:
+        case spv::OpSelectionMerge:
+            visitRange(1, 2);
+            return OperandLayout::SideEffect;
+        case spv::OpLoopMerge:
+            visitRange(1, 3);
+            return OperandLayout::SideEffect;
+        case spv::OpSwitch:
+            // The selector and default label.  The labels of the cases are not visited, they are
+            // never removed.
+            visitRange(1, 3);
+            return OperandLayout::SideEffect;
+        case spv::OpBranchConditional:
+            // Branch weights are skipped.
+            visitRange(1, 4);
+            return OperandLayout::SideEffect;
+
+        case spv::OpAtomicLoad:
+        case spv::OpAtomicExchange:
+        case spv::OpAtomicCompareExchange:
+        case spv::OpAtomicIIncrement:
+        case spv::OpAtomicIDecrement:
+        case spv::OpAtomicIAdd:
+        case spv::OpAtomicISub:
+        case spv::OpAtomicSMin:
+        case spv::OpAtomicUMin:
+        case spv::OpAtomicSMax:
+        case spv::OpAtomicUMax:
+        case spv::OpAtomicAnd:
+        case spv::OpAtomicOr:
+        case spv::OpAtomicXor:
+            visitRange(3, length);
+            return OperandLayout::SideEffect;
+        case spv::OpAtomicStore:
+        case spv::OpControlBarrier:
+        case spv::OpMemoryBarrier:
+            visitRange(1, length);
+            return OperandLayout::SideEffect;
+
+        default:
+            visitRange(1, length);
+            return OperandLayout::Unknown;
+    }
+}
+
+struct Instruction
+{
+    uint32_t offset;
+    uint32_t length;
+    spv::Op op;
+    OperandLayout layout;
+    bool removed;
+};
+
+// Whether loads from pointers in this storage class can be forwarded.  Other storage classes can be
+// written by other invocations (or by this one through an OpStore to an aliasing pointer in
+// SPIR-V 1.3, where storage buffers are in the Uniform storage class).
+bool IsForwardableStorageClass(uint32_t storageClass)
+{
+    switch (storageClass)
+    {
+        case spv::StorageClassFunction:
+        case spv::StorageClassPrivate:
+        case spv::StorageClassInput:
+        case spv::StorageClassUniformConstant:
+        case spv::StorageClassPushConstant:
+            return true;
+        default:
+            return false;
+    }
+}
+
+struct InstructionKeyHash
+{
+    size_t operator()(const std::vector<uint32_t> &key) const
+    {
+        return angle::ComputeGenericHash(key.data(), key.size() * sizeof(uint32_t));
+    }
+};
+
+// A function-local variable that is only ever the pointer of OpLoad and OpStore instructions, so
+// it can't be aliased.
+struct LocalVariable
+{
+    uint32_t instructionIndex  = kInvalidIndex;
+    bool isOnlyLoadedAndStored = true;
+    uint32_t loadCount         = 0;
+    std::vector<uint32_t> storeIndices;
+};
+
+class SPIRVOptimizer : angle::NonCopyable
+{
+  public:
+    explicit SPIRVOptimizer(spirv::Blob *spirvBlob) : mSpirvBlob(*spirvBlob) {}
+
+    void optimize();
+
+  private:
+    void analyze();
+    void forwardValues();
+    void countUses();
+    void removeDeadCode();
+    void removeInstruction(uint32_t instructionIndex);
+    void outputSpirv();
+
+    uint32_t resolve(uint32_t id) const
+    {
+        while (mReplacements[id] != 0)
+        {
+            id = mReplacements[id];
+        }
+        return id;
+    }
+    bool isIdRemoved(uint32_t id) const
+    {
+        return mReplacements[id] != 0 ||
+               (mDefinitions[id] != kInvalidIndex && mInstructions[mDefinitions[id]].removed);
+    }
+
+    spirv::Blob &mSpirvBlob;
+    std::vector<Instruction> mInstructions;
+
+    // Per id: the index of the instruction that defines it (for removable instructions only), the
+    // id that replaces it, whether it is used by an instruction whose operands are not known, and
+    // how many times it's used.
+    std::vector<uint32_t> mDefinitions;
+    std::vector<uint32_t> mReplacements;
+    std::vector<bool> mHasUnknownUse;
+    std::vector<uint32_t> mUseCounts;
+
+    // Per id: whether it's the target of a decoration (such as RelaxedPrecision), and whether it's
+    // a pointer in a storage class whose loads can be forwarded.
+    std::vector<bool> mIsDecorated;
+    std::vector<bool> mIsForwardablePointer;
+
+    // Function-local variables indexed by their id.
+    angle::HashMap<uint32_t, LocalVariable> mLocalVariables;
+
+    // Instructions whose removal is pending.
+    std::vector<uint32_t> mRemoveQueue;
+};
+
+void SPIRVOptimizer::optimize()
+{
+    analyze();
+    forwardValues();
+    countUses();
+    removeDeadCode();
+    outputSpirv();
+}
+
+void SPIRVOptimizer::analyze()
+{
+    const uint32_t idBound = mSpirvBlob[spirv::kHeaderIndexIndexBound];
+    mDefinitions.resize(idBound, kInvalidIndex);
+    mReplacements.resize(idBound, 0);
+    mHasUnknownUse.resize(idBound, false);
+    mUseCounts.resize(idBound, 0);
+    mIsDecorated.resize(idBound, false);
+    mIsForwardablePointer.resize(idBound, false);
+
+    // The storage class of pointer types.
+    angle::HashMap<uint32_t, uint32_t> pointerTypeStorageClasses;
+
+    bool inFunction = false;
+    for (uint32_t offset = spirv::kHeaderIndexInstructions; offset < mSpirvBlob.size();)
+    {
+        const uint32_t *instruction = &mSpirvBlob[offset];
+
+        spv::Op op;
+        uint32_t length;
+        spirv::GetInstructionOpAndLength(instruction, &op, &length);
+        ASSERT(offset + length <= mSpirvBlob.size());
+
+        const uint32_t instructionIndex = static_cast<uint32_t>(mInstructions.size());
+
+        // Collect the uses of the function-local variables, and the ids used in unknown ways.
+        const OperandLayout layout =
+            ForEachIdOperand(instruction, op, length, [&](uint32_t wordIndex) {
+                const uint32_t id = instruction[wordIndex];
+                if (id >= idBound)
+                {
+                    return;
+                }
+
+                auto variable = mLocalVariables.find(id);
+                if (variable != mLocalVariables.end())
+                {
+                    const bool isLoadPointer = op == spv::OpLoad && wordIndex == 3 && length == 4;
+                    const bool isStorePointer =
+                        op == spv::OpStore && wordIndex == 1 && length == 3;
+                    if (isLoadPointer)
+                    {
+                        ++variable->second.loadCount;
+                    }
+                    else if (isStorePointer)
+                    {
+                        variable->second.storeIndices.push_back(instructionIndex);
+                    }
+                    else
+                    {
+                        variable->second.isOnlyLoadedAndStored = false;
+                    }
+                }
+            });
+
+        if (layout == OperandLayout::Unknown)
+        {
+            for (uint32_t wordIndex = 1; wordIndex < length; ++wordIndex)
+            {
+                if (instruction[wordIndex] < idBound)
+                {
+                    mHasUnknownUse[instruction[wordIndex]] = true;
+                }
+            }
+        }
+
+        switch (op)
+        {
+            case spv::OpFunction:
+                inFunction = true;
+                break;
+            case spv::OpFunctionEnd:
+                inFunction = false;
+                break;
+            case spv::OpDecorate:
+                mIsDecorated[instruction[1]] = true;
+                break;
+            case spv::OpTypePointer:
+                pointerTypeStorageClasses[instruction[1]] = instruction[2];
+                break;
+            case spv::OpVariable:
+            case spv::OpFunctionParameter:
+            case spv::OpAccessChain:
+            case spv::OpInBoundsAccessChain:
+            {
+                auto storageClass = pointerTypeStorageClasses.find(instruction[1]);
+                mIsForwardablePointer[instruction[2]] =
+                    storageClass != pointerTypeStorageClasses.end() &&
+                    IsForwardableStorageClass(storageClass->second);
+
+                if (op == spv::OpVariable && inFunction &&
+                    instruction[3] == spv::StorageClassFunction)
+                {
+                    mLocalVariables[instruction[2]].instructionIndex = instructionIndex;
+                    mDefinitions[instruction[2]]                     = instructionIndex;
+                }
+                else if (layout == OperandLayout::Pure)
+                {
+                    mDefinitions[instruction[2]] = instructionIndex;
+                }
+                break;
+            }
+            default:
+                if (layout == OperandLayout::Pure)
+                {
+                    mDefinitions[instruction[2]] = instructionIndex;
+                }
+                break;
+        }
+
+        mInstructions.push_back({offset, length, op, layout, false});
+        offset += length;
+    }
+}
+
+void SPIRVOptimizer::forwardValues()
+{
+    // The value each local variable is known to hold in the current block, if any.  Since the
+    // variables are only loaded and stored directly, only a store to the same variable changes the
+    // value.
+    angle::HashMap<uint32_t, uint32_t> knownValues;
+    // The last store to each local variable in the current block, if the variable is not loaded
+    // after it.  The store is dead if the variable is stored to again, or if the function returns.
+    angle::HashMap<uint32_t, uint32_t> pendingStores;
+    // The value other pointers are known to hold in the current block.  These may alias, so any
+    // store through them (or call, etc) forgets the values.
+    angle::HashMap<uint32_t, uint32_t> knownMemoryValues;
+    // The side-effect-free instructions in the current block, keyed by their opcode, result type
+    // and operands.
+    angle::HashMap<std::vector<uint32_t>, uint32_t, InstructionKeyHash> availableValues;
+    std::vector<uint32_t> key;
+
+    auto isLocalVariable = [&](uint32_t variableId) {
+        auto variable = mLocalVariables.find(variableId);
+        return variable != mLocalVariables.end() && variable->second.isOnlyLoadedAndStored;
+    };
+
+    for (uint32_t instructionIndex = 0; instructionIndex < mInstructions.size();
+         ++instructionIndex)
+    {
+        Instruction &instruction = mInstructions[instructionIndex];
+        const uint32_t *words    = &mSpirvBlob[instruction.offset];
+        switch (instruction.op)
+        {
+            case spv::OpLabel:
+                knownValues.clear();
+                pendingStores.clear();
+                knownMemoryValues.clear();
+                availableValues.clear();
+                break;
+
+            case spv::OpReturn:
+            case spv::OpReturnValue:
+            case spv::OpKill:
+            case spv::OpTerminateInvocation:
+            case spv::OpUnreachable:
+                for (const auto &store : pendingStores)
+                {
+                    mInstructions[store.second].removed = true;
+                }
+                break;
+
+            case spv::OpVariable:
+                if (isLocalVariable(words[2]) && instruction.length > 4)
+                {
+                    // The variables are declared in the first block of the function, so the
+                    // initializer is the value in the rest of the block.
+                    knownValues[words[2]] = resolve(words[4]);
+                }
+                break;
+
+            case spv::OpStore:
+            {
+                if (isLocalVariable(words[1]))
+                {
+                    auto pendingStore = pendingStores.find(words[1]);
+                    if (pendingStore != pendingStores.end())
+                    {
+                        mInstructions[pendingStore->second].removed = true;
+                    }
+                    pendingStores[words[1]] = instructionIndex;
+                    knownValues[words[1]]   = resolve(words[2]);
+                    break;
+                }
+
+                const uint32_t pointerId = resolve(words[1]);
+                knownMemoryValues.clear();
+                if (mIsForwardablePointer[pointerId] && instruction.length == 3)
+                {
+                    knownMemoryValues[pointerId] = resolve(words[2]);
+                }
+                break;
+            }
+
+            case spv::OpLoad:
+            {
+                if (instruction.length != 4)
+                {
+                    break;
+                }
+
+                const bool isLocal       = isLocalVariable(words[3]);
+                const uint32_t resultId  = words[2];
+                const uint32_t pointerId = resolve(words[3]);
+                if (!isLocal && !mIsForwardablePointer[pointerId])
+                {
+                    break;
+                }
+
+                angle::HashMap<uint32_t, uint32_t> &values =
+                    isLocal ? knownValues : knownMemoryValues;
+                auto knownValue = values.find(pointerId);
+                if (knownValue == values.end() || mHasUnknownUse[resultId])
+                {
+                    // The variable is read, so the previous store is needed.  The loaded value can
+                    // be used by the following loads.
+                    pendingStores.erase(pointerId);
+                    values[pointerId] = resultId;
+                    break;
+                }
+
+                // Replace the result of the load with the known value.  The known value is
+                // defined earlier in the block, so it dominates the uses of the result.
+                mReplacements[resultId] = knownValue->second;
+                instruction.removed     = true;
+                if (isLocal)
+                {
+                    --mLocalVariables[pointerId].loadCount;
+                }
+                break;
+            }
+
+            case spv::OpUndef:
+            case spv::OpPhi:
+            case spv::OpImageRead:
+                // These are not redundant even with the same operands.  Storage images can be
+                // written between reads.
+                break;
+
+            default:
+                if (instruction.layout == OperandLayout::Pure)
+                {
+                    // Reuse the result of an identical instruction earlier in the block.  Results
+                    // with decorations are left alone, as their precision may differ.
+                    const uint32_t resultId = words[2];
+                    if (mIsDecorated[resultId] || mHasUnknownUse[resultId])
+                    {
+                        break;
+                    }
+
+                    key.assign(words, words + instruction.length);
+                    key[2] = 0;
+                    ForEachIdOperand(words, instruction.op, instruction.length,
+                                     [&](uint32_t wordIndex) {
+                                         if (words[wordIndex] < mReplacements.size())
+                                         {
+                                             key[wordIndex] = resolve(words[wordIndex]);
+                                         }
+                                     });
+
+                    auto availableValue = availableValues.find(key);
+                    if (availableValue != availableValues.end())
+                    {
+                        mReplacements[resultId] = availableValue->second;
+                        instruction.removed     = true;
+                    }
+                    else
+                    {
+                        availableValues[key] = resultId;
+                    }
+                }
+                else if (instruction.layout != OperandLayout::DebugOrDecoration)
+                {
+                    // Calls, extended instructions (some of which write through pointers) and
+                    // unknown instructions may write to any pointer.
+                    if (instruction.op == spv::OpFunctionCall || instruction.op == spv::OpExtInst ||
+                        instruction.layout == OperandLayout::Unknown)
+                    {
+                        knownMemoryValues.clear();
+                    }
+                }
+                break;
+        }
+    }
+}
+
+void SPIRVOptimizer::countUses()
+{
+    for (const Instruction &instruction : mInstructions)
+    {
+        if (instruction.removed)
+        {
+            continue;
+        }
+
+        const uint32_t *words = &mSpirvBlob[instruction.offset];
+        ForEachIdOperand(words, instruction.op, instruction.length, [&](uint32_t wordIndex) {
+            if (words[wordIndex] < mUseCounts.size())
+            {
+                ++mUseCounts[resolve(words[wordIndex])];
+            }
+        });
+    }
+}
+
+void SPIRVOptimizer::removeDeadCode()
+{
+    // Variables that are never loaded are removed along with their stores.
+    for (const auto &variable : mLocalVariables)
+    {
+        if (variable.second.isOnlyLoadedAndStored && variable.second.loadCount == 0)
+        {
+            mRemoveQueue.push_back(variable.second.instructionIndex);
+        }
+    }
+
+    // Side-effect-free instructions with unused results are removed too.  The reserved ids are
+    // kept, as the SPIR-V transformer may look for them.
+    for (uint32_t id = vk::spirv::kIdFirstUnreserved; id < mDefinitions.size(); ++id)
+    {
+        const uint32_t instructionIndex = mDefinitions[id];
+        if (instructionIndex != kInvalidIndex && mUseCounts[id] == 0 && !mHasUnknownUse[id] &&
+            mInstructions[instructionIndex].layout == OperandLayout::Pure &&
+            !mInstructions[instructionIndex].removed)
+        {
+            mRemoveQueue.push_back(instructionIndex);
+        }
+    }
+
+    while (!mRemoveQueue.empty())
+    {
+        const uint32_t instructionIndex = mRemoveQueue.back();
+        mRemoveQueue.pop_back();
+        removeInstruction(instructionIndex);
+    }
+}
+
+void SPIRVOptimizer::removeInstruction(uint32_t instructionIndex)
+{
+    Instruction &instruction = mInstructions[instructionIndex];
+    if (instruction.removed)
+    {
+        return;
+    }
+    instruction.removed = true;
+
+    const uint32_t *words = &mSpirvBlob[instruction.offset];
+
+    if (instruction.op == spv::OpVariable)
+    {
+        for (uint32_t storeIndex : mLocalVariables[words[2]].storeIndices)
+        {
+            removeInstruction(storeIndex);
+        }
+    }
+    else if (instruction.op == spv::OpLoad)
+    {
+        auto variable = mLocalVariables.find(words[3]);
+        if (variable != mLocalVariables.end() && variable->second.isOnlyLoadedAndStored &&
+            --variable->second.loadCount == 0)
+        {
+            mRemoveQueue.push_back(variable->second.instructionIndex);
+        }
+    }
+
+    // Removing the instruction may leave the instructions that define its operands unused.
+    ForEachIdOperand(words, instruction.op, instruction.length, [&](uint32_t wordIndex) {
+        if (words[wordIndex] >= mUseCounts.size())
+        {
+            return;
+        }
+
+        const uint32_t id = resolve(words[wordIndex]);
+        ASSERT(mUseCounts[id] > 0);
+        if (--mUseCounts[id] == 0 && id >= vk::spirv::kIdFirstUnreserved &&
+            !mHasUnknownUse[id] && mDefinitions[id] != kInvalidIndex &&
+            mInstructions[mDefinitions[id]].layout == OperandLayout::Pure)
+        {
+            mRemoveQueue.push_back(mDefinitions[id]);
+        }
+    });
+}
+
+void SPIRVOptimizer::outputSpirv()
+{
+    spirv::Blob result;
+    result.reserve(mSpirvBlob.size());
+    result.insert(result.end(), mSpirvBlob.begin(),
+                  mSpirvBlob.begin() + spirv::kHeaderIndexInstructions);
+
+    for (const Instruction &instruction : mInstructions)
+    {
+        const uint32_t *words = &mSpirvBlob[instruction.offset];
+        if (instruction.removed ||
+            (instruction.layout == OperandLayout::DebugOrDecoration && isIdRemoved(words[1])))
+        {
+            continue;
+        }
+
+        const size_t resultOffset = result.size();
+        result.insert(result.end(), words, words + instruction.length);
+
+        // Replace the operands whose results were forwarded.  Unknown instructions never use them.
+        if (instruction.layout != OperandLayout::Unknown)
+        {
+            ForEachIdOperand(words, instruction.op, instruction.length, [&](uint32_t wordIndex) {
+                if (words[wordIndex] < mReplacements.size())
+                {
+                    result[resultOffset + wordIndex] = resolve(words[wordIndex]);
+                }
+            });
+        }
+    }
+
+    mSpirvBlob = std::move(result);
+}
+}  // anonymous namespace
+
+void OptimizeSPIRV(spirv::Blob *spirvBlob)
+{
+    SPIRVOptimizer optimizer(spirvBlob);
+    optimizer.optimize();
+}
+}  // namespace sh
@@ -0,0 +1,34 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeSPIRV: Lightweight optimizations of the SPIR-V generated by OutputSPIRV, run when
+// ShCompileOptions::optimizeSPIRV is set.  These are a small fraction of what spirv-opt does, but
+// take a single pass over the module to analyze it:
+//
+// - Loads whose value is already known in the same block (from a previous store to or load from
+//   a function-local variable, or a load from memory that nothing could have written since) are
+//   removed, and their results are replaced with that value.
+// - Identical side-effect-free instructions in the same block are replaced with the first one.
+// - Stores to function-local variables that are overwritten before being loaded, or are still
+//   pending when the function returns, are removed.
+// - Function-local variables that are no longer loaded are removed along with their stores.
+// - Side-effect-free instructions whose results are unused are removed.
+//
+// The ids of the module are not renumbered, and nothing is done to global variables, types,
+// functions or the non-semantic instructions, which the SPIR-V transformer of the Vulkan backend
+// relies on.  The result is deterministic.
+//
+
+#ifndef COMPILER_TRANSLATOR_SPIRV_OPTIMIZESPIRV_H_
+#define COMPILER_TRANSLATOR_SPIRV_OPTIMIZESPIRV_H_
+
+#include "common/spirv/spirv_types.h"
+
+namespace sh
+{
+void OptimizeSPIRV(angle::spirv::Blob *spirvBlob);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_SPIRV_OPTIMIZESPIRV_H_
@@ -15,6 +15,7 @@
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/StaticType.h"
 #include "compiler/translator/spirv/BuildSPIRV.h"
+#include "compiler/translator/spirv/OptimizeSPIRV.h"
 #include "compiler/translator/tree_util/FindPreciseNodes.h"
 #include "compiler/translator/tree_util/IntermTraverse.h"
 
@@ -6489,6 +6490,12 @@ spirv::Blob OutputSPIRVTraverser::getSpirv()
     // Validate that correct SPIR-V was generated
     ASSERT(spirv::Validate(result));
 
+    if (mCompileOptions.optimizeSPIRV)
+    {
+        OptimizeSPIRV(&result);
+        ASSERT(spirv::Validate(result));
+    }
+
 #if ANGLE_DEBUG_SPIRV_GENERATION
     // Disassemble and log the generated SPIR-V for debugging.
     spvtools::SpirvTools spirvTools(mCompileOptions.emitSPIRV14 ? SPV_ENV_VULKAN_1_1_SPIRV_1_4
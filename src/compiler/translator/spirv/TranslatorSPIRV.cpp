@@ -747,6 +747,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 {
     if (getShaderType() == GL_VERTEX_SHADER)
     {
+        beginPass("ShaderBuiltinsWorkaround");
         if (!ShaderBuiltinsWorkaround(this, root, &getSymbolTable(), compileOptions))
         {
             return false;
@@ -795,6 +796,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                                        UnsupportedFunctionArgs::ArrayOfArrayOfSamplerOrImage,
                                        UnsupportedFunctionArgs::AtomicCounter,
                                        UnsupportedFunctionArgs::Image};
+    beginPass("MonomorphizeUnsupportedFunctions");
     if (!MonomorphizeUnsupportedFunctions(this, root, &getSymbolTable(), args))
     {
         return false;
@@ -802,6 +804,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
     if (aggregateTypesUsedForUniforms > 0)
     {
+        beginPass("SeparateStructFromUniformDeclarations");
         if (!SeparateStructFromUniformDeclarations(this, root, &getSymbolTable()))
         {
             return false;
@@ -809,6 +812,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
         int removedUniformsCount;
 
+        beginPass("RewriteStructSamplers");
         if (!RewriteStructSamplers(this, root, &getSymbolTable(), &removedUniformsCount))
         {
             return false;
@@ -816,6 +820,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         defaultUniformCount -= removedUniformsCount;
     }
 
+    beginPass("RewriteArrayOfArrayOfOpaqueUniforms");
     // Replace array of array of opaque uniforms with a flattened array.  This is run after
     // MonomorphizeUnsupportedFunctions and RewriteStructSamplers so that it's not possible for an
     // array of array of opaque type to be partially subscripted and passed to a function.
@@ -824,6 +829,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         return false;
     }
 
+    beginPass("FlagSamplersForTexelFetch");
     if (!FlagSamplersForTexelFetch(this, root, &getSymbolTable(), &mUniforms))
     {
         return false;
@@ -833,6 +839,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
     if (defaultUniformCount > 0)
     {
+        beginPass("DeclareDefaultUniforms");
         if (!DeclareDefaultUniforms(this, root, &getSymbolTable(), packedShaderType))
         {
             return false;
@@ -854,6 +861,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
     if (r32fImageCount > 0 && compileOptions.emulateR32fImageAtomicExchange)
     {
+        beginPass("RewriteR32fImages");
         if (!RewriteR32fImages(this, root, &getSymbolTable()))
         {
             return false;
@@ -865,6 +873,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         // ANGLEUniforms.acbBufferOffsets
         const TIntermTyped *acbBufferOffsets = driverUniforms->getAcbBufferOffsets();
         const TVariable *atomicCounters      = nullptr;
+        beginPass("RewriteAtomicCounters");
         if (!RewriteAtomicCounters(this, root, &getSymbolTable(), acbBufferOffsets,
                                    &atomicCounters))
         {
@@ -875,6 +884,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
     }
     else if (getShaderVersion() >= 310)
     {
+        beginPass("RemoveAtomicCounterBuiltins");
         // Vulkan doesn't support Atomic Storage as a Storage Class, but we've seen
         // cases where builtins are using it even with no active atomic counters.
         // This pass simply removes those builtins in that scenario.
@@ -886,6 +896,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
     if (packedShaderType != gl::ShaderType::Compute)
     {
+        beginPass("ReplaceGLDepthRangeWithDriverUniform");
         if (!ReplaceGLDepthRangeWithDriverUniform(this, root, driverUniforms, &getSymbolTable()))
         {
             return false;
@@ -935,6 +946,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
     {
         if (compileOptions.addVulkanXfbExtensionSupportCode)
         {
+            beginPass("AddXfbExtensionSupport");
             // Add support code for transform feedback extension.
             if (!AddXfbExtensionSupport(this, root, &getSymbolTable(), driverUniforms))
             {
@@ -942,6 +954,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             }
         }
 
+        beginPass("AddVertexTransformationSupport");
         // Add support code for pre-rotation and depth correction in the vertex processing stages.
         if (!AddVertexTransformationSupport(this, compileOptions, root, &getSymbolTable(),
                                             driverUniforms))
@@ -952,11 +965,13 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
     if (IsExtensionEnabled(getExtensionBehavior(), TExtension::EXT_YUV_target))
     {
+        beginPass("EmulateYUVBuiltIns");
         if (!EmulateYUVBuiltIns(this, root, &getSymbolTable()))
         {
             return false;
         }
 
+        beginPass("ReswizzleYUVTextureAccess");
         if (!ReswizzleYUVTextureAccess(this, root, &getSymbolTable()))
         {
             return false;
@@ -967,6 +982,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         IsExtensionEnabled(getExtensionBehavior(), TExtension::OES_EGL_image_external) ||
         IsExtensionEnabled(getExtensionBehavior(), TExtension::OES_EGL_image_external_essl3))
     {
+        beginPass("RewriteSamplerExternalTexelFetch");
         if (!RewriteSamplerExternalTexelFetch(this, root, &getSymbolTable()))
         {
             return false;
@@ -1067,6 +1083,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 const TVariable *samplePositionBuiltin =
                     static_cast<const TVariable *>(getSymbolTable().findBuiltIn(
                         ImmutableString("gl_SamplePosition"), getShaderVersion()));
+                beginPass("RotateAndFlipBuiltinVariable");
                 if (!RotateAndFlipBuiltinVariable(this, root, GetMainSequence(root), swapXY, flipXY,
                                                   &getSymbolTable(), samplePositionBuiltin,
                                                   kFlippedPointCoordName, pivot))
@@ -1077,6 +1094,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
             if (usesFragCoord)
             {
+                beginPass("InsertFragCoordCorrection");
                 if (!InsertFragCoordCorrection(this, compileOptions, root, GetMainSequence(root),
                                                &getSymbolTable(), driverUniforms))
                 {
@@ -1084,6 +1102,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 }
             }
 
+            beginPass("EmulateFragColorData");
             // Emulate gl_FragColor and gl_FragData with normal output variables.
             if (!EmulateFragColorData(this, root, &getSymbolTable(), hasGLSecondaryFragData))
             {
@@ -1095,6 +1114,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             // Emulate framebuffer fetch if used.
             if (HasFramebufferFetch(getExtensionBehavior(), compileOptions))
             {
+                beginPass("EmulateFramebufferFetch");
                 if (!EmulateFramebufferFetch(this, root, &inputAttachmentMap))
                 {
                     return false;
@@ -1118,11 +1138,13 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             // emulation.  Declare their SPIR-V ids.
             assignInputAttachmentIds(inputAttachmentMap);
 
+            beginPass("RewriteDfdy");
             if (!RewriteDfdy(this, root, &getSymbolTable(), getShaderVersion(), driverUniforms))
             {
                 return false;
             }
 
+            beginPass("RewriteInterpolateAtOffset");
             if (!RewriteInterpolateAtOffset(this, root, &getSymbolTable(), getShaderVersion(),
                                             driverUniforms))
             {
@@ -1137,6 +1159,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
             if (hasGLSampleMask)
             {
                 TIntermTyped *numSamples = driverUniforms->getNumSamples();
+                beginPass("RewriteSampleMask");
                 if (!RewriteSampleMask(this, root, &getSymbolTable(), numSamples))
                 {
                     return false;
@@ -1148,6 +1171,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                     static_cast<const TVariable *>(getSymbolTable().findBuiltIn(
                         ImmutableString("gl_NumSamples"), getShaderVersion()));
                 TIntermTyped *numSamples = driverUniforms->getNumSamples();
+                beginPass("ReplaceVariableWithTyped");
                 if (!ReplaceVariableWithTyped(this, root, numSamplesVar, numSamples))
                 {
                     return false;
@@ -1163,6 +1187,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
                 }
             }
 
+            beginPass("EmulateDithering");
             if (!EmulateDithering(this, compileOptions, root, &getSymbolTable(), specConst,
                                   driverUniforms))
             {
@@ -1176,6 +1201,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         {
             if (compileOptions.addVulkanXfbEmulationSupportCode)
             {
+                beginPass("AddXfbEmulationSupport");
                 // Add support code for transform feedback emulation.  Only applies to vertex shader
                 // as tessellation and geometry shader transform feedback capture require
                 // VK_EXT_transform_feedback.
@@ -1189,6 +1215,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
         }
 
         case gl::ShaderType::Geometry:
+            beginPass("ClampGLLayer");
             if (!ClampGLLayer(this, root, &getSymbolTable(), driverUniforms))
             {
                 return false;
@@ -1197,6 +1224,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
         case gl::ShaderType::TessControl:
         {
+            beginPass("ReplaceGLBoundingBoxWithGlobal");
             if (!ReplaceGLBoundingBoxWithGlobal(this, root, &getSymbolTable(), getShaderVersion()))
             {
                 return false;
@@ -1234,6 +1262,7 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
     // generation treat them mostly like usual I/O blocks.
     const TVariable *inputPerVertex  = nullptr;
     const TVariable *outputPerVertex = nullptr;
+    beginPass("DeclarePerVertexBlocks");
     if (!DeclarePerVertexBlocks(this, root, &getSymbolTable(), &inputPerVertex, &outputPerVertex))
     {
         return false;
@@ -1279,6 +1308,7 @@ bool TranslatorSPIRV::translate(TIntermBlock *root,
         return false;
     }
 
+    beginPass("OutputSPIRV");
     return OutputSPIRV(this, root, compileOptions, mUniqueToSpirvIdMap, mFirstUnusedSpirvId);
 }
 
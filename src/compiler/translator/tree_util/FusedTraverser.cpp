@@ -0,0 +1,262 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.cpp: Runs several passes in a single traversal of the AST.
+//
+
+#include "compiler/translator/tree_util/FusedTraverser.h"
+
+namespace sh
+{
+
+TFusedTraverser::TFusedTraverser() : TIntermTraverser(true, true, true) {}
+
+TFusedTraverser::~TFusedTraverser() = default;
+
+void TFusedTraverser::addPass(std::unique_ptr<TFusablePass> &&pass)
+{
+    TIntermTraverser *traverser = pass->getTraverser();
+    mPasses.push_back({std::move(pass), traverser, -1});
+}
+
+bool TFusedTraverser::run(TCompiler *compiler, TIntermBlock *root)
+{
+    root->traverse(this);
+
+    for (FusedPass &fusedPass : mPasses)
+    {
+        ASSERT(fusedPass.skipDepth < 0);
+        if (!fusedPass.pass->finish(compiler, root))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void TFusedTraverser::syncTraversalState(TIntermTraverser *traverser) const
+{
+    // A traverser that sees the current node has entered the same blocks as this one.  Only the
+    // positions in the innermost two blocks are used by insertions.
+    ASSERT(traverser->mParentBlockStack.size() == mParentBlockStack.size());
+    const size_t blockCount = mParentBlockStack.size();
+    for (size_t index = blockCount > 2 ? blockCount - 2 : 0; index < blockCount; ++index)
+    {
+        traverser->mParentBlockStack[index].pos = mParentBlockStack[index].pos;
+    }
+
+    traverser->mCurrentChildIndex = mCurrentChildIndex;
+    traverser->mInGlobalScope     = mInGlobalScope;
+}
+
+bool TFusedTraverser::visitNode(Visit visit, TIntermNode *node, TIntermBlock *block)
+{
+    const int depth  = getCurrentTraversalDepth();
+    bool anyVisiting = false;
+
+    for (FusedPass &fusedPass : mPasses)
+    {
+        if (fusedPass.skipDepth >= 0)
+        {
+            // The traverser resumes after the subtree it skipped.
+            if (visit == PostVisit && fusedPass.skipDepth == depth)
+            {
+                fusedPass.skipDepth = -1;
+            }
+            continue;
+        }
+
+        TIntermTraverser *traverser = fusedPass.traverser;
+        bool visitChildren          = true;
+
+        if (visit == PreVisit)
+        {
+            visitChildren = traverser->incrementDepth(node);
+            if (block != nullptr)
+            {
+                traverser->pushParentBlock(block);
+            }
+        }
+        syncTraversalState(traverser);
+
+        switch (visit)
+        {
+            case PreVisit:
+                if (visitChildren && traverser->preVisit)
+                {
+                    visitChildren = node->visit(PreVisit, traverser);
+                }
+                break;
+            case InVisit:
+                if (traverser->inVisit)
+                {
+                    visitChildren = node->visit(InVisit, traverser);
+                }
+                break;
+            case PostVisit:
+                if (traverser->postVisit)
+                {
+                    node->visit(PostVisit, traverser);
+                }
+                visitChildren = false;
+                break;
+        }
+
+        if (!visitChildren)
+        {
+            // The traverser is done with this node, either because it has been fully visited or
+            // because the traverser skips the rest of it.
+            if (block != nullptr)
+            {
+                traverser->popParentBlock();
+            }
+            traverser->decrementDepth();
+
+            if (visit != PostVisit)
+            {
+                fusedPass.skipDepth = depth;
+            }
+        }
+
+        anyVisiting = anyVisiting || visitChildren;
+    }
+
+    if (visit == PostVisit || anyVisiting)
+    {
+        return true;
+    }
+
+    // No traverser is interested in the rest of this node, so the walk skips it.  The PostVisit
+    // that would have resumed the traversers skipping it doesn't happen, so resume them now.
+    for (FusedPass &fusedPass : mPasses)
+    {
+        if (fusedPass.skipDepth == depth)
+        {
+            fusedPass.skipDepth = -1;
+        }
+    }
+    return false;
+}
+
+void TFusedTraverser::visitLeaf(TIntermNode *node)
+{
+    for (FusedPass &fusedPass : mPasses)
+    {
+        if (fusedPass.skipDepth >= 0)
+        {
+            continue;
+        }
+
+        TIntermTraverser *traverser = fusedPass.traverser;
+        // Leaves are visited regardless of the depth limit, like in TIntermSymbol::traverse.
+        (void)traverser->incrementDepth(node);
+        syncTraversalState(traverser);
+        node->visit(PreVisit, traverser);
+        traverser->decrementDepth();
+    }
+}
+
+void TFusedTraverser::visitSymbol(TIntermSymbol *node)
+{
+    visitLeaf(node);
+}
+
+void TFusedTraverser::visitConstantUnion(TIntermConstantUnion *node)
+{
+    visitLeaf(node);
+}
+
+bool TFusedTraverser::visitSwizzle(Visit visit, TIntermSwizzle *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitBinary(Visit visit, TIntermBinary *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitUnary(Visit visit, TIntermUnary *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitTernary(Visit visit, TIntermTernary *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitIfElse(Visit visit, TIntermIfElse *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitSwitch(Visit visit, TIntermSwitch *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitCase(Visit visit, TIntermCase *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+void TFusedTraverser::visitFunctionPrototype(TIntermFunctionPrototype *node)
+{
+    visitLeaf(node);
+}
+
+bool TFusedTraverser::visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitAggregate(Visit visit, TIntermAggregate *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitBlock(Visit visit, TIntermBlock *node)
+{
+    return visitNode(visit, node, node);
+}
+
+bool TFusedTraverser::visitGlobalQualifierDeclaration(Visit visit,
+                                                      TIntermGlobalQualifierDeclaration *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitDeclaration(Visit visit, TIntermDeclaration *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitLoop(Visit visit, TIntermLoop *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+bool TFusedTraverser::visitBranch(Visit visit, TIntermBranch *node)
+{
+    return visitNode(visit, node, nullptr);
+}
+
+void TFusedTraverser::visitPreprocessorDirective(TIntermPreprocessorDirective *node)
+{
+    // Preprocessor directives are visited without entering them, see
+    // TIntermPreprocessorDirective::traverse.
+    for (FusedPass &fusedPass : mPasses)
+    {
+        if (fusedPass.skipDepth < 0)
+        {
+            syncTraversalState(fusedPass.traverser);
+            fusedPass.traverser->visitPreprocessorDirective(node);
+        }
+    }
+}
+
+}  // namespace sh
@@ -0,0 +1,92 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser.h: Runs several passes in a single traversal of the AST.
+//
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
+
+#include <memory>
+
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+// A pass that can share its traversal of the tree with other passes.  Its traverser gathers
+// information or queues replacements during the traversal, and finish() completes the pass once the
+// traversal is done.
+class TFusablePass : angle::NonCopyable
+{
+  public:
+    virtual ~TFusablePass() {}
+
+    virtual TIntermTraverser *getTraverser() = 0;
+
+    // Returns false if the pass failed, in which case the passes after it are not finished.
+    [[nodiscard]] virtual bool finish(TCompiler *compiler, TIntermBlock *root) = 0;
+};
+
+// Walks the tree once on behalf of several passes.  Each pass's traverser is visited exactly as it
+// would be in a traversal of its own: the same visits in the same order, with the same path, child
+// indices, parent blocks and global scope tracking.  A pass that skips a subtree only stops seeing
+// that subtree, and the subtree is pruned from the walk once no pass is interested in it.
+//
+// The fused passes must not depend on each other's results, since they all see the tree as it was
+// before the traversal.  Their traversers must use the default traverse*() functions, so a
+// TLValueTrackingTraverser can't be fused.  Passes may queue replacements as long as they don't
+// touch the same nodes; the replacements are applied in finish(), in the order the passes were
+// added.
+class TFusedTraverser : public TIntermTraverser
+{
+  public:
+    TFusedTraverser();
+    ~TFusedTraverser() override;
+
+    void addPass(std::unique_ptr<TFusablePass> &&pass);
+
+    // Traverses |root| for all the passes, then finishes them in order.
+    [[nodiscard]] bool run(TCompiler *compiler, TIntermBlock *root);
+
+    void visitSymbol(TIntermSymbol *node) override;
+    void visitConstantUnion(TIntermConstantUnion *node) override;
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override;
+    bool visitBinary(Visit visit, TIntermBinary *node) override;
+    bool visitUnary(Visit visit, TIntermUnary *node) override;
+    bool visitTernary(Visit visit, TIntermTernary *node) override;
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override;
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override;
+    bool visitCase(Visit visit, TIntermCase *node) override;
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override;
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override;
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override;
+    bool visitBlock(Visit visit, TIntermBlock *node) override;
+    bool visitGlobalQualifierDeclaration(Visit visit,
+                                         TIntermGlobalQualifierDeclaration *node) override;
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override;
+    bool visitLoop(Visit visit, TIntermLoop *node) override;
+    bool visitBranch(Visit visit, TIntermBranch *node) override;
+    void visitPreprocessorDirective(TIntermPreprocessorDirective *node) override;
+
+  private:
+    struct FusedPass
+    {
+        std::unique_ptr<TFusablePass> pass;
+        TIntermTraverser *traverser;
+        // Depth of the node whose subtree the traverser skips, or -1 if it sees the current node.
+        int skipDepth;
+    };
+
+    bool visitNode(Visit visit, TIntermNode *node, TIntermBlock *block);
+    void visitLeaf(TIntermNode *node);
+    void syncTraversalState(TIntermTraverser *traverser) const;
+
+    std::vector<FusedPass> mPasses;
+};
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_FUSEDTRAVERSER_H_
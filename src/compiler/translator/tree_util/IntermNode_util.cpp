@@ -428,6 +428,44 @@ TIntermBlock *EnsureLoopBodyBlock(TIntermNode *node)
     return EnsureBlock(node);
 }
 
+TIntermBlock *DeepCopyTree(const TIntermBlock &root)
+{
+    ASSERT(root.isTreeRoot());
+
+    // Function definitions and prototypes can't be deep copied on their own, since their copies
+    // would declare the same function again in the same tree.
+    TIntermBlock *rootCopy = new TIntermBlock();
+    rootCopy->setLine(root.getLine());
+    rootCopy->setIsTreeRoot();
+    for (TIntermNode *node : *root.getSequence())
+    {
+        TIntermFunctionDefinition *definition = node->getAsFunctionDefinition();
+        TIntermFunctionPrototype *prototype   = node->getAsFunctionPrototypeNode();
+        TIntermNode *nodeCopy                 = nullptr;
+
+        if (definition)
+        {
+            TIntermFunctionPrototype *prototypeCopy =
+                new TIntermFunctionPrototype(definition->getFunction());
+            prototypeCopy->setLine(definition->getFunctionPrototype()->getLine());
+            nodeCopy = new TIntermFunctionDefinition(prototypeCopy,
+                                                     definition->getBody()->deepCopy());
+        }
+        else if (prototype)
+        {
+            nodeCopy = new TIntermFunctionPrototype(prototype->getFunction());
+        }
+        else
+        {
+            nodeCopy = node->deepCopy();
+        }
+
+        nodeCopy->setLine(node->getLine());
+        rootCopy->appendStatement(nodeCopy);
+    }
+    return rootCopy;
+}
+
 TIntermSymbol *ReferenceGlobalVariable(const ImmutableString &name, const TSymbolTable &symbolTable)
 {
     const TSymbol *symbol = symbolTable.findGlobal(name);
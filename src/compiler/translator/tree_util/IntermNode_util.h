@@ -108,6 +108,10 @@ TIntermBlock *EnsureBlock(TIntermNode *node);
 // If the input node is not a block node, put it inside a block node and return that.
 TIntermBlock *EnsureLoopBodyBlock(TIntermNode *node);
 
+// Copies the tree of a whole shader, including its function definitions, so that the copy can be
+// transformed without affecting the original.  The copy refers to the same symbols.
+TIntermBlock *DeepCopyTree(const TIntermBlock &root);
+
 // Should be called from inside Compiler::compileTreeImpl() where the global level is in scope.
 TIntermSymbol *ReferenceGlobalVariable(const ImmutableString &name,
                                        const TSymbolTable &symbolTable);
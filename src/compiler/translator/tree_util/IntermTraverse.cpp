@@ -14,6 +14,15 @@
 
 namespace sh
 {
+namespace
+{
+thread_local uint64_t *gTraversalNodeVisitCounter = nullptr;
+}  // anonymous namespace
+
+void SetTraversalNodeVisitCounter(uint64_t *counter)
+{
+    gTraversalNodeVisitCounter = counter;
+}
 
 // Traverse the intermediate representation tree, and call a node type specific visit function for
 // each node. Traversal is done recursively through the node member function traverse(). Nodes with
@@ -222,7 +231,8 @@ TIntermTraverser::TIntermTraverser(bool preVisit,
       mMaxAllowedDepth(std::numeric_limits<int>::max()),
       mInGlobalScope(true),
       mSymbolTable(symbolTable),
-      mCurrentChildIndex(0)
+      mCurrentChildIndex(0),
+      mNodeVisitCounter(gTraversalNodeVisitCounter)
 {
     // Only enabling inVisit is not supported.
     ASSERT(!(inVisit && !preVisit && !postVisit));
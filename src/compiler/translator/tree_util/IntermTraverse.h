@@ -120,6 +120,10 @@ class TIntermTraverser : angle::NonCopyable
         ScopedNodeInTraversalPath(TIntermTraverser *traverser, TIntermNode *current)
             : mTraverser(traverser)
         {
+            if (mTraverser->mNodeVisitCounter != nullptr)
+            {
+                ++*mTraverser->mNodeVisitCounter;
+            }
             mWithinDepthLimit = mTraverser->incrementDepth(current);
         }
         ~ScopedNodeInTraversalPath() { mTraverser->decrementDepth(); }
@@ -134,6 +138,8 @@ class TIntermTraverser : angle::NonCopyable
     friend void TIntermSymbol::traverse(TIntermTraverser *);
     friend void TIntermConstantUnion::traverse(TIntermTraverser *);
     friend void TIntermFunctionPrototype::traverse(TIntermTraverser *);
+    // The fused traverser keeps the bookkeeping of the traversers it runs up to date.
+    friend class TFusedTraverser;
 
     TIntermNode *getParentNode() const
     {
@@ -333,8 +339,16 @@ class TIntermTraverser : angle::NonCopyable
 
     // All the code blocks from the root to the current node's parent during traversal.
     std::vector<ParentBlock> mParentBlockStack;
+
+    // Counts the nodes this traverser enters when pass statistics are collected, null otherwise.
+    // Set once on construction.
+    uint64_t *mNodeVisitCounter;
 };
 
+// While set, traversers created on the calling thread add the number of nodes they enter to
+// |*counter|.  Used to attribute tree walks to translation passes.
+void SetTraversalNodeVisitCounter(uint64_t *counter);
+
 // Traverser parent class that tracks where a node is a destination of a write operation and so is
 // required to be an l-value.
 class TLValueTrackingTraverser : public TIntermTraverser
@@ -0,0 +1,214 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImageSIMD_unittest.cpp: Checks that the vectorized Load* row converters produce exactly the
+// same bytes as the scalar loops.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "image_util/loadimage.h"
+#include "image_util/loadimage_simd.h"
+
+using namespace angle;
+using namespace angle::priv;
+
+namespace
+{
+struct LoadFunctionInfo
+{
+    const char *name;
+    LoadRowConversion conversion;
+    LoadImageFunction loadFunction;
+    size_t inputPixelBytes;
+    size_t outputPixelBytes;
+};
+
+constexpr LoadFunctionInfo kLoadFunctions[] = {
+    {"RGB8ToBGRX8", LoadRowConversion::RGB8ToBGRX8, LoadRGB8ToBGRX8, 3, 4},
+    {"RGBA8ToBGRA8", LoadRowConversion::RGBA8ToBGRA8, LoadRGBA8ToBGRA8, 4, 4},
+    {"LA8ToRGBA8", LoadRowConversion::LA8ToRGBA8, LoadLA8ToRGBA8, 2, 4},
+    {"RGBA4ToRGBA8", LoadRowConversion::RGBA4ToRGBA8, LoadRGBA4ToRGBA8, 2, 4},
+    {"RGB5A1ToRGBA8", LoadRowConversion::RGB5A1ToRGBA8, LoadRGB5A1ToRGBA8, 2, 4},
+    {"RGB16FToRG11B10F", LoadRowConversion::RGB16FToRG11B10F, LoadRGB16FToRG11B10F, 6, 4},
+    {"D24S8ToS8D24", LoadRowConversion::D24S8ToS8D24, LoadD24S8ToS8D24, 4, 4},
+    {"D24S8ToD32F", LoadRowConversion::D24S8ToD32F, LoadD24S8ToD32F, 4, 4},
+    {"D24S8ToD32FS8X24", LoadRowConversion::D24S8ToD32FS8X24, LoadD24S8ToD32FS8X24, 4, 8},
+    {"X24S8ToS8", LoadRowConversion::X24S8ToS8, LoadX24S8ToS8, 4, 1},
+};
+
+constexpr LoadRowSIMDLevel kSIMDLevels[] = {LoadRowSIMDLevel::Vector128,
+                                            LoadRowSIMDLevel::Vector256};
+
+class LoadImageSIMDTest : public testing::Test
+{
+  protected:
+    void TearDown() override { SetMaxLoadRowSIMDLevelForTesting(LoadRowSIMDLevel::Vector256); }
+
+    // Loads |input| with the scalar path and with every SIMD level the CPU supports, and expects
+    // identical output.  Rows and slices are padded so that the converters see unaligned rows.
+    void runLoad(const LoadFunctionInfo &info,
+                 const std::vector<uint8_t> &input,
+                 size_t width,
+                 size_t height,
+                 size_t depth)
+    {
+        const size_t inputRowPitch    = width * info.inputPixelBytes + 4;
+        const size_t inputDepthPitch  = inputRowPitch * height + 4;
+        const size_t outputRowPitch   = width * info.outputPixelBytes + 4;
+        const size_t outputDepthPitch = outputRowPitch * height + 4;
+        ASSERT_GE(input.size(), inputDepthPitch * depth);
+
+        // Fill the output with a pattern so that any pixel the converters skip shows up.
+        std::vector<uint8_t> expected(outputDepthPitch * depth, 0xCD);
+        SetMaxLoadRowSIMDLevelForTesting(LoadRowSIMDLevel::None);
+        info.loadFunction(ImageLoadContext(), width, height, depth, input.data(), inputRowPitch,
+                          inputDepthPitch, expected.data(), outputRowPitch, outputDepthPitch);
+
+        for (LoadRowSIMDLevel level : kSIMDLevels)
+        {
+            if (GetLoadRowFunctionAtLevel(info.conversion, level) == nullptr)
+            {
+                continue;
+            }
+
+            std::vector<uint8_t> actual(outputDepthPitch * depth, 0xCD);
+            SetMaxLoadRowSIMDLevelForTesting(level);
+            info.loadFunction(ImageLoadContext(), width, height, depth, input.data(),
+                              inputRowPitch, inputDepthPitch, actual.data(), outputRowPitch,
+                              outputDepthPitch);
+            EXPECT_EQ(expected, actual) << info.name << " level " << static_cast<int>(level)
+                                        << " width " << width;
+        }
+    }
+};
+
+// Random input across a range of widths, covering the vector loops and their scalar remainders.
+TEST_F(LoadImageSIMDTest, MatchesScalar)
+{
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+    for (const LoadFunctionInfo &info : kLoadFunctions)
+    {
+        for (size_t width : {1, 2, 3, 4, 5, 7, 8, 9, 12, 15, 16, 17, 24, 31, 32, 33, 47, 64, 100,
+                             257})
+        {
+            constexpr size_t kHeight = 3;
+            constexpr size_t kDepth  = 2;
+
+            std::vector<uint8_t> input(((width * info.inputPixelBytes + 4) * kHeight + 4) *
+                                       kDepth);
+            for (uint8_t &byte : input)
+            {
+                byte = static_cast<uint8_t>(byteDistribution(generator));
+            }
+
+            runLoad(info, input, width, kHeight, kDepth);
+        }
+    }
+}
+
+// Every half float value, including denormals, infinities, NaNs and negative numbers, must
+// convert to the same float11 and float10 bits as gl::float32ToFloat11/10.
+TEST_F(LoadImageSIMDTest, RGB16FToRG11B10FAllHalves)
+{
+    const LoadFunctionInfo &info = kLoadFunctions[5];
+    ASSERT_EQ(info.conversion, LoadRowConversion::RGB16FToRG11B10F);
+
+    // Three channels per pixel; rotate the values through the channels on each row so every
+    // half is converted to both float11 and float10.
+    constexpr size_t kWidth  = (0x10000 + 2) / 3;
+    constexpr size_t kHeight = 3;
+
+    const size_t inputRowPitch = kWidth * info.inputPixelBytes + 4;
+    std::vector<uint8_t> input((inputRowPitch * kHeight + 4));
+    for (size_t y = 0; y < kHeight; ++y)
+    {
+        uint16_t *row = reinterpret_cast<uint16_t *>(input.data() + y * inputRowPitch);
+        for (size_t i = 0; i < kWidth * 3; ++i)
+        {
+            row[i] = static_cast<uint16_t>(i + y);
+        }
+    }
+
+    runLoad(info, input, kWidth, kHeight, 1);
+}
+
+struct ETCLoadFunctionInfo
+{
+    const char *name;
+    LoadImageFunction loadFunction;
+    size_t inputBlockBytes;
+    // Bytes per pixel for decoding loads, bytes per block for transcoding loads.
+    size_t outputBytes;
+    bool transcodes;
+};
+
+constexpr ETCLoadFunctionInfo kETCLoadFunctions[] = {
+    {"ETC1RGB8ToRGBA8", LoadETC1RGB8ToRGBA8, 8, 4, false},
+    {"ETC2RGB8A1ToRGBA8", LoadETC2RGB8A1ToRGBA8, 8, 4, false},
+    {"ETC2RGBA8ToRGBA8", LoadETC2RGBA8ToRGBA8, 16, 4, false},
+    {"EACR11ToR8", LoadEACR11ToR8, 8, 1, false},
+    {"EACR11SToR8", LoadEACR11SToR8, 8, 1, false},
+    {"EACRG11ToRG8", LoadEACRG11ToRG8, 16, 2, false},
+    {"EACRG11SToRG8", LoadEACRG11SToRG8, 16, 2, false},
+    {"ETC2RGB8ToBC1", LoadETC2RGB8ToBC1, 8, 8, true},
+    {"ETC2RGB8A1ToBC1", LoadETC2RGB8A1ToBC1, 8, 8, true},
+    {"ETC2RGBA8ToBC3", LoadETC2RGBA8ToBC3, 16, 16, true},
+    {"EACR11ToBC4", LoadEACR11ToBC4, 8, 8, true},
+    {"EACR11SToBC4", LoadEACR11SToBC4, 8, 8, true},
+    {"EACRG11SToBC5", LoadEACRG11SToBC5, 16, 16, true},
+};
+
+// Random ETC and EAC blocks, which cover every block mode, decoded or transcoded with and without
+// the vectorized block decoders.
+TEST_F(LoadImageSIMDTest, ETCMatchesScalar)
+{
+    std::mt19937 generator(0);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+    for (const ETCLoadFunctionInfo &info : kETCLoadFunctions)
+    {
+        for (size_t size : {4, 5, 7, 16, 30, 64})
+        {
+            // Transcoded BCn images keep the ETC block layout, so only whole blocks are compared.
+            if (info.transcodes && size % 4 != 0)
+            {
+                continue;
+            }
+
+            const size_t blocks          = (size + 3) / 4;
+            const size_t inputRowPitch   = blocks * info.inputBlockBytes + 4;
+            const size_t inputDepthPitch = inputRowPitch * blocks;
+
+            // Transcoded output has a row and a column per block.
+            const size_t outputSize       = info.transcodes ? blocks : size;
+            const size_t outputRowPitch   = outputSize * info.outputBytes + 4;
+            const size_t outputDepthPitch = outputRowPitch * outputSize;
+
+            std::vector<uint8_t> input(inputDepthPitch);
+            for (uint8_t &byte : input)
+            {
+                byte = static_cast<uint8_t>(byteDistribution(generator));
+            }
+
+            std::vector<uint8_t> expected(outputDepthPitch, 0xCD);
+            SetMaxLoadRowSIMDLevelForTesting(LoadRowSIMDLevel::None);
+            info.loadFunction(ImageLoadContext(), size, size, 1, input.data(), inputRowPitch,
+                              inputDepthPitch, expected.data(), outputRowPitch, outputDepthPitch);
+
+            std::vector<uint8_t> actual(outputDepthPitch, 0xCD);
+            SetMaxLoadRowSIMDLevelForTesting(LoadRowSIMDLevel::Vector256);
+            info.loadFunction(ImageLoadContext(), size, size, 1, input.data(), inputRowPitch,
+                              inputDepthPitch, actual.data(), outputRowPitch, outputDepthPitch);
+
+            EXPECT_EQ(expected, actual) << info.name << " size " << size;
+        }
+    }
+}
+}  // anonymous namespace
@@ -11,6 +11,7 @@
 #include "common/mathutil.h"
 #include "common/platform.h"
 #include "image_util/imageformats.h"
+#include "image_util/loadimage_simd.h"
 
 #if defined(ANGLE_PLATFORM_WINDOWS) && !defined(_M_ARM) && !defined(_M_ARM64)
 #    if defined(_MSC_VER)
@@ -355,6 +356,9 @@ void LoadLA8ToRGBA8(const ImageLoadContext &context,
                     size_t outputRowPitch,
                     size_t outputDepthPitch)
 {
+    const priv::LoadRowFunction loadRowSIMD =
+        priv::GetLoadRowFunction(priv::LoadRowConversion::LA8ToRGBA8);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -363,7 +367,8 @@ void LoadLA8ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = loadRowSIMD ? loadRowSIMD(source, dest, width) : 0;
+            for (; x < width; x++)
             {
                 dest[4 * x + 0] = source[2 * x + 0];
                 dest[4 * x + 1] = source[2 * x + 0];
@@ -527,6 +532,9 @@ void LoadRGB8ToBGRX8(const ImageLoadContext &context,
                      size_t outputRowPitch,
                      size_t outputDepthPitch)
 {
+    const priv::LoadRowFunction loadRowSIMD =
+        priv::GetLoadRowFunction(priv::LoadRowConversion::RGB8ToBGRX8);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -535,7 +543,8 @@ void LoadRGB8ToBGRX8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = loadRowSIMD ? loadRowSIMD(source, dest, width) : 0;
+            for (; x < width; x++)
             {
                 dest[4 * x + 0] = source[x * 3 + 2];
                 dest[4 * x + 1] = source[x * 3 + 1];
@@ -685,8 +694,11 @@ void LoadRGBA8ToBGRA8(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
+    const priv::LoadRowFunction loadRowSIMD =
+        priv::GetLoadRowFunction(priv::LoadRowConversion::RGBA8ToBGRA8);
+
 #if defined(ANGLE_LOADIMAGE_USE_SSE)
-    if (supportsSSE2())
+    if (!loadRowSIMD && supportsSSE2())
     {
         __m128i brMask = _mm_set1_epi32(0x00ff00ff);
 
@@ -745,7 +757,8 @@ void LoadRGBA8ToBGRA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = loadRowSIMD ? loadRowSIMD(source, dest, width) : 0;
+            for (; x < width; x++)
             {
                 uint32_t rgba = source[x];
                 dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
@@ -891,6 +904,9 @@ void LoadRGBA4ToRGBA8(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
+    const priv::LoadRowFunction loadRowSIMD =
+        priv::GetLoadRowFunction(priv::LoadRowConversion::RGBA4ToRGBA8);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -899,7 +915,8 @@ void LoadRGBA4ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = loadRowSIMD ? loadRowSIMD(source, dest, width) : 0;
+            for (; x < width; x++)
             {
                 uint16_t rgba = source[x];
                 dest[4 * x + 0] =
@@ -1219,6 +1236,9 @@ void LoadRGB5A1ToRGBA8(const ImageLoadContext &context,
                        size_t outputRowPitch,
                        size_t outputDepthPitch)
 {
+    const priv::LoadRowFunction loadRowSIMD =
+        priv::GetLoadRowFunction(priv::LoadRowConversion::RGB5A1ToRGBA8);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -1227,7 +1247,8 @@ void LoadRGB5A1ToRGBA8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = loadRowSIMD ? loadRowSIMD(source, dest, width) : 0;
+            for (; x < width; x++)
             {
                 uint16_t rgba = source[x];
                 dest[4 * x + 0] =
@@ -1465,6 +1486,9 @@ void LoadRGB16FToRG11B10F(const ImageLoadContext &context,
                           size_t outputRowPitch,
                           size_t outputDepthPitch)
 {
+    const priv::LoadRowFunction loadRowSIMD =
+        priv::GetLoadRowFunction(priv::LoadRowConversion::RGB16FToRG11B10F);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -1473,7 +1497,8 @@ void LoadRGB16FToRG11B10F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = loadRowSIMD ? loadRowSIMD(source, dest, width) : 0;
+            for (; x < width; x++)
             {
                 dest[x] = (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 0])) << 0) |
                           (gl::float32ToFloat11(gl::float16ToFloat32(source[x * 3 + 1])) << 11) |
@@ -1523,6 +1548,9 @@ void LoadD24S8ToS8D24(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
+    const priv::LoadRowFunction loadRowSIMD =
+        priv::GetLoadRowFunction(priv::LoadRowConversion::D24S8ToS8D24);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -1531,7 +1559,8 @@ void LoadD24S8ToS8D24(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = loadRowSIMD ? loadRowSIMD(source, dest, width) : 0;
+            for (; x < width; x++)
             {
                 dest[x] = ANGLE_ROTL(source[x], 24);
             }
@@ -1550,6 +1579,9 @@ void LoadD24S8ToD32FS8X24(const ImageLoadContext &context,
                           size_t outputRowPitch,
                           size_t outputDepthPitch)
 {
+    const priv::LoadRowFunction loadRowSIMD =
+        priv::GetLoadRowFunction(priv::LoadRowConversion::D24S8ToD32FS8X24);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -1561,7 +1593,8 @@ void LoadD24S8ToD32FS8X24(const ImageLoadContext &context,
             uint32_t *destStencil =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch) +
                 1;
-            for (size_t x = 0; x < width; x++)
+            size_t x = loadRowSIMD ? loadRowSIMD(source, destDepth, width) : 0;
+            for (; x < width; x++)
             {
                 destDepth[x * 2]   = (source[x] >> 8) / static_cast<float>(0xFFFFFF);
                 destStencil[x * 2] = source[x] & 0xFF;
@@ -1581,6 +1614,9 @@ void LoadD24S8ToD32F(const ImageLoadContext &context,
                      size_t outputRowPitch,
                      size_t outputDepthPitch)
 {
+    const priv::LoadRowFunction loadRowSIMD =
+        priv::GetLoadRowFunction(priv::LoadRowConversion::D24S8ToD32F);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -1589,7 +1625,8 @@ void LoadD24S8ToD32F(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             float *destDepth =
                 priv::OffsetDataPointer<float>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = loadRowSIMD ? loadRowSIMD(source, destDepth, width) : 0;
+            for (; x < width; x++)
             {
                 destDepth[x] = (source[x] >> 8) / static_cast<float>(0xFFFFFF);
             }
@@ -1721,6 +1758,9 @@ void LoadX24S8ToS8(const ImageLoadContext &context,
                    size_t outputRowPitch,
                    size_t outputDepthPitch)
 {
+    const priv::LoadRowFunction loadRowSIMD =
+        priv::GetLoadRowFunction(priv::LoadRowConversion::X24S8ToS8);
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -1729,7 +1769,8 @@ void LoadX24S8ToS8(const ImageLoadContext &context,
                 input + (y * inputRowPitch) + (z * inputDepthPitch));
             uint8_t *destStencil =
                 reinterpret_cast<uint8_t *>(output + (y * outputRowPitch) + (z * outputDepthPitch));
-            for (size_t x = 0; x < width; x++)
+            size_t x = loadRowSIMD ? loadRowSIMD(source, destStencil, width) : 0;
+            for (; x < width; x++)
             {
                 destStencil[x] = (source[x] & 0xFF);
             }
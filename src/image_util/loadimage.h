@@ -28,6 +28,43 @@ struct ImageLoadContext
     std::shared_ptr<WorkerThreadPool> multiThreadPool;
 };
 
+using LoadImageFunction = void (*)(const ImageLoadContext &context,
+                                   size_t width,
+                                   size_t height,
+                                   size_t depth,
+                                   const uint8_t *input,
+                                   size_t inputRowPitch,
+                                   size_t inputDepthPitch,
+                                   uint8_t *output,
+                                   size_t outputRowPitch,
+                                   size_t outputDepthPitch);
+
+// Number of pixel rows covered by one row pitch of the input and of the output of a load
+// function.  Both are 1 for uncompressed data, and the block height for block-compressed data.
+struct LoadImageRowGrouping
+{
+    size_t inputRowsPerPitch  = 1;
+    size_t outputRowsPerPitch = 1;
+};
+
+// Runs |loadFunction| over the image, splitting the work into groups of slices or bands of rows
+// on context.multiThreadPool if the image is large enough to benefit.  Bands start on block
+// boundaries of both the input and the output as described by |rowGrouping|.  The load function
+// must address its rows and slices only through the given pitches, which rules out functions
+// that decode the whole image at once (ASTC) or read side data from the input (paletted).
+void ParallelLoadImage(const ImageLoadContext &context,
+                       LoadImageFunction loadFunction,
+                       const LoadImageRowGrouping &rowGrouping,
+                       size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch);
+
 void LoadA8ToRGBA8(const ImageLoadContext &context,
                    size_t width,
                    size_t height,
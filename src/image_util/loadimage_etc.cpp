@@ -8,10 +8,13 @@
 
 #include "image_util/loadimage.h"
 
+#include <string.h>
 #include <type_traits>
 #include "common/mathutil.h"
+#include "common/simd_utils.h"
 
 #include "image_util/imageformats.h"
+#include "image_util/loadimage_simd.h"
 
 namespace angle
 {
@@ -52,6 +55,328 @@ static IntensityModifier intensityModifierNonOpaque[] =
 
 static const int kNumPixelsInBlock = 16;
 
+// Modifier table for single channel blocks: ETC2 alpha and EAC R11 and RG11
+// clang-format off
+static const int8_t kSingleChannelModifierTable[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 }
+};
+// clang-format on
+
+// Blocks are decoded into a tile of 16 values in row-major order, which is then copied to the
+// image.  Building a tile from a palette and per-pixel indices maps directly onto byte shuffles,
+// so it is vectorized with SSE4.1 when the CPU has it.
+bool UseSIMDBlockDecoding()
+{
+#if defined(ANGLE_SIMD_X86)
+    return priv::IsLoadRowSIMDLevelEnabled(priv::LoadRowSIMDLevel::Vector128);
+#else
+    return false;
+#endif
+}
+
+// Copies the part of a decoded tile that lies inside the |w|x|h| image to |dest|.  |x| and |y|
+// are the coordinates of the block in the image.
+template <typename T>
+void StoreTile(const T *tile,
+               T *dest,
+               size_t x,
+               size_t y,
+               size_t w,
+               size_t h,
+               size_t destPixelStride,
+               size_t destRowPitch)
+{
+    if (destPixelStride == 1 && x + 4 <= w && y + 4 <= h)
+    {
+        // Whole block: fixed size copies.
+        for (size_t j = 0; j < 4; j++)
+        {
+            memcpy(reinterpret_cast<uint8_t *>(dest) + j * destRowPitch, tile + j * 4,
+                   4 * sizeof(T));
+        }
+        return;
+    }
+
+    const size_t columns = std::min<size_t>(4, w - x);
+    const size_t rows    = std::min<size_t>(4, h - y);
+    for (size_t j = 0; j < rows; j++)
+    {
+        T *row = reinterpret_cast<T *>(reinterpret_cast<uint8_t *>(dest) + j * destRowPitch);
+        if (destPixelStride == 1)
+        {
+            memcpy(row, tile + j * 4, columns * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = 0; i < columns; i++)
+            {
+                row[i * destPixelStride] = tile[j * 4 + i];
+            }
+        }
+    }
+}
+
+// Added to the palette indices of the pixels, in row-major order, so that pixels in the second
+// subblock of individual and differential blocks use the second half of the palette.  Indexed by
+// the flip bit; the last entry is for H and T blocks, which have a single palette.
+// clang-format off
+alignas(16) static const uint8_t kSubblockPaletteOffsets[3][16] =
+{
+    { 0, 0, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4 },
+    { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+};
+// clang-format on
+
+// Sets pixels[k] to palette[indices[k]] with the alpha channel replaced by alpha[k].
+void ExpandPalette(const R8G8B8A8 palette[8],
+                   const uint8_t indices[kNumPixelsInBlock],
+                   const uint8_t alpha[kNumPixelsInBlock],
+                   R8G8B8A8 pixels[kNumPixelsInBlock])
+{
+    for (size_t k = 0; k < kNumPixelsInBlock; k++)
+    {
+        pixels[k]   = palette[indices[k]];
+        pixels[k].A = alpha[k];
+    }
+}
+
+#if defined(ANGLE_SIMD_X86)
+// Byte shuffles that spread bytes 4 * n to 4 * n + 3 of a register over its four 32-bit lanes,
+// either to all bytes of each lane or to the alpha byte only.
+// clang-format off
+alignas(16) static const int8_t kBroadcastBytesToPixels[4][16] =
+{
+    { 0,  0,  0,  0,  1,  1,  1,  1,  2,  2,  2,  2,  3,  3,  3,  3 },
+    { 4,  4,  4,  4,  5,  5,  5,  5,  6,  6,  6,  6,  7,  7,  7,  7 },
+    { 8,  8,  8,  8,  9,  9,  9,  9, 10, 10, 10, 10, 11, 11, 11, 11 },
+    {12, 12, 12, 12, 13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15 },
+};
+alignas(16) static const int8_t kBroadcastBytesToAlpha[4][16] =
+{
+    {-1, -1, -1,  0, -1, -1, -1,  1, -1, -1, -1,  2, -1, -1, -1,  3 },
+    {-1, -1, -1,  4, -1, -1, -1,  5, -1, -1, -1,  6, -1, -1, -1,  7 },
+    {-1, -1, -1,  8, -1, -1, -1,  9, -1, -1, -1, 10, -1, -1, -1, 11 },
+    {-1, -1, -1, 12, -1, -1, -1, 13, -1, -1, -1, 14, -1, -1, -1, 15 },
+};
+// clang-format on
+
+// Computes the palette index of every pixel, in row-major order, from the index bits of an
+// individual, differential, H or T block.
+ANGLE_SIMD_TARGET_SSE41 __m128i GetPaletteIndicesSSE41(uint32_t msbBits,
+                                                       uint32_t lsbBits,
+                                                       const uint8_t subblockOffsets[16])
+{
+    // The index bits are in column-major order.
+    const __m128i pixelBitsLow  = _mm_setr_epi16(1 << 0, 1 << 4, 1 << 8, 1 << 12, 1 << 1, 1 << 5,
+                                                 1 << 9, 1 << 13);
+    const __m128i pixelBitsHigh = _mm_setr_epi16(1 << 2, 1 << 6, 1 << 10, 1 << 14, 1 << 3, 1 << 7,
+                                                 1 << 11, static_cast<int16_t>(1 << 15));
+
+    const __m128i msb = _mm_set1_epi16(static_cast<int16_t>(msbBits));
+    const __m128i lsb = _mm_set1_epi16(static_cast<int16_t>(lsbBits));
+    const __m128i msbSet =
+        _mm_packs_epi16(_mm_cmpeq_epi16(_mm_and_si128(msb, pixelBitsLow), pixelBitsLow),
+                        _mm_cmpeq_epi16(_mm_and_si128(msb, pixelBitsHigh), pixelBitsHigh));
+    const __m128i lsbSet =
+        _mm_packs_epi16(_mm_cmpeq_epi16(_mm_and_si128(lsb, pixelBitsLow), pixelBitsLow),
+                        _mm_cmpeq_epi16(_mm_and_si128(lsb, pixelBitsHigh), pixelBitsHigh));
+
+    const __m128i indices = _mm_or_si128(_mm_and_si128(msbSet, _mm_set1_epi8(2)),
+                                         _mm_and_si128(lsbSet, _mm_set1_epi8(1)));
+    return _mm_add_epi8(indices,
+                        _mm_load_si128(reinterpret_cast<const __m128i *>(subblockOffsets)));
+}
+
+// Returns the four colors of an individual or differential subblock with base color (r, g, b).
+ANGLE_SIMD_TARGET_SSE41 __m128i GetSubblockColorsSSE41(int r, int g, int b, const int modifiers[4])
+{
+    const __m128i base = _mm_setr_epi16(static_cast<int16_t>(r), static_cast<int16_t>(g),
+                                        static_cast<int16_t>(b), 255, static_cast<int16_t>(r),
+                                        static_cast<int16_t>(g), static_cast<int16_t>(b), 255);
+    const __m128i modifierWords = _mm_packs_epi32(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(modifiers)), _mm_setzero_si128());
+
+    // Add each modifier to the red, green and blue channels of its color.
+    const __m128i expandLow  = _mm_setr_epi8(0, 1, 0, 1, 0, 1, -1, -1, 2, 3, 2, 3, 2, 3, -1, -1);
+    const __m128i expandHigh = _mm_setr_epi8(4, 5, 4, 5, 4, 5, -1, -1, 6, 7, 6, 7, 6, 7, -1, -1);
+    const __m128i low        = _mm_add_epi16(base, _mm_shuffle_epi8(modifierWords, expandLow));
+    const __m128i high       = _mm_add_epi16(base, _mm_shuffle_epi8(modifierWords, expandHigh));
+    return _mm_packus_epi16(low, high);
+}
+
+// Sets pixels[k] to palette[indices[k]] with the alpha channel replaced by alpha[k], and returns
+// the indices through |indicesOut|.
+ANGLE_SIMD_TARGET_SSE41 void DecodePaletteTileSSE41(const R8G8B8A8 palette[8],
+                                                    uint32_t msbBits,
+                                                    uint32_t lsbBits,
+                                                    const uint8_t subblockOffsets[16],
+                                                    const uint8_t alpha[kNumPixelsInBlock],
+                                                    uint8_t indicesOut[kNumPixelsInBlock],
+                                                    R8G8B8A8 pixels[kNumPixelsInBlock])
+{
+    const __m128i indices = GetPaletteIndicesSSE41(msbBits, lsbBits, subblockOffsets);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(indicesOut), indices);
+
+    const __m128i paletteLow  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(palette));
+    const __m128i paletteHigh = _mm_loadu_si128(reinterpret_cast<const __m128i *>(palette + 4));
+    const __m128i alphaBytes  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(alpha));
+    const __m128i byteOffsets = _mm_setr_epi8(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3);
+    const __m128i entryMask   = _mm_set1_epi8(3);
+    const __m128i rgbMask     = _mm_set1_epi32(0x00FFFFFF);
+
+    // Turn the index of each pixel into the offset of its palette entry within either half of
+    // the palette, look the entry up in both halves and pick the right one.
+    const __m128i entryBytes = _mm_slli_epi16(_mm_and_si128(indices, entryMask), 2);
+    const __m128i highHalf   = _mm_cmpgt_epi8(indices, entryMask);
+
+    for (int quad = 0; quad < 4; quad++)
+    {
+        const __m128i broadcast =
+            _mm_load_si128(reinterpret_cast<const __m128i *>(kBroadcastBytesToPixels[quad]));
+        const __m128i entryOffsets =
+            _mm_add_epi8(_mm_shuffle_epi8(entryBytes, broadcast), byteOffsets);
+
+        const __m128i fromLow  = _mm_shuffle_epi8(paletteLow, entryOffsets);
+        const __m128i fromHigh = _mm_shuffle_epi8(paletteHigh, entryOffsets);
+        const __m128i rgba =
+            _mm_blendv_epi8(fromLow, fromHigh, _mm_shuffle_epi8(highHalf, broadcast));
+        const __m128i pixelAlpha = _mm_shuffle_epi8(
+            alphaBytes,
+            _mm_load_si128(reinterpret_cast<const __m128i *>(kBroadcastBytesToAlpha[quad])));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + quad * 4),
+                         _mm_or_si128(_mm_and_si128(rgba, rgbMask), pixelAlpha));
+    }
+}
+
+// Computes ((i * (h - o) + j * (v - o) + 2) >> 2) + o for the 16 pixels of a planar block, one
+// color channel at a time, and clamps the results to bytes.
+ANGLE_SIMD_TARGET_SSE41 __m128i DecodePlanarChannelSSE41(int o, int h, int v)
+{
+    const __m128i iValues    = _mm_setr_epi16(0, 1, 2, 3, 0, 1, 2, 3);
+    const __m128i jValuesLow = _mm_setr_epi16(0, 0, 0, 0, 1, 1, 1, 1);
+    const __m128i jValuesHi  = _mm_setr_epi16(2, 2, 2, 2, 3, 3, 3, 3);
+    const __m128i dh         = _mm_set1_epi16(static_cast<int16_t>(h - o));
+    const __m128i dv         = _mm_set1_epi16(static_cast<int16_t>(v - o));
+    const __m128i origin     = _mm_set1_epi16(static_cast<int16_t>(o));
+    const __m128i rounding   = _mm_set1_epi16(2);
+
+    const __m128i horizontal = _mm_add_epi16(_mm_mullo_epi16(iValues, dh), rounding);
+    __m128i low  = _mm_add_epi16(horizontal, _mm_mullo_epi16(jValuesLow, dv));
+    __m128i high = _mm_add_epi16(horizontal, _mm_mullo_epi16(jValuesHi, dv));
+    low          = _mm_add_epi16(_mm_srai_epi16(low, 2), origin);
+    high         = _mm_add_epi16(_mm_srai_epi16(high, 2), origin);
+    return _mm_packus_epi16(low, high);
+}
+
+ANGLE_SIMD_TARGET_SSE41 void DecodePlanarTileSSE41(const int origin[3],
+                                                   const int horizontal[3],
+                                                   const int vertical[3],
+                                                   const uint8_t alpha[kNumPixelsInBlock],
+                                                   R8G8B8A8 pixels[kNumPixelsInBlock])
+{
+    const __m128i r = DecodePlanarChannelSSE41(origin[0], horizontal[0], vertical[0]);
+    const __m128i g = DecodePlanarChannelSSE41(origin[1], horizontal[1], vertical[1]);
+    const __m128i b = DecodePlanarChannelSSE41(origin[2], horizontal[2], vertical[2]);
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(alpha));
+
+    const __m128i rgLow  = _mm_unpacklo_epi8(r, g);
+    const __m128i rgHigh = _mm_unpackhi_epi8(r, g);
+    const __m128i baLow  = _mm_unpacklo_epi8(b, a);
+    const __m128i baHigh = _mm_unpackhi_epi8(b, a);
+
+    __m128i *dest = reinterpret_cast<__m128i *>(pixels);
+    _mm_storeu_si128(dest + 0, _mm_unpacklo_epi16(rgLow, baLow));
+    _mm_storeu_si128(dest + 1, _mm_unpackhi_epi16(rgLow, baLow));
+    _mm_storeu_si128(dest + 2, _mm_unpacklo_epi16(rgHigh, baHigh));
+    _mm_storeu_si128(dest + 3, _mm_unpackhi_epi16(rgHigh, baHigh));
+}
+
+// Computes codeword + modifiers[indices[k]] * multiplier for the 16 pixels of a single channel
+// block, clamped to unsigned or signed bytes.
+ANGLE_SIMD_TARGET_SSE41 void DecodeSingleChannelTileSSE41(const int8_t modifiers[8],
+                                                          int codeword,
+                                                          int multiplier,
+                                                          bool isSigned,
+                                                          const uint8_t indices[kNumPixelsInBlock],
+                                                          uint8_t values[kNumPixelsInBlock])
+{
+    const __m128i modifierTable = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(modifiers));
+    const __m128i indexBytes    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices));
+    const __m128i pixelModifiers = _mm_shuffle_epi8(modifierTable, indexBytes);
+
+    const __m128i multiplierWords = _mm_set1_epi16(static_cast<int16_t>(multiplier));
+    const __m128i codewordWords   = _mm_set1_epi16(static_cast<int16_t>(codeword));
+    const __m128i low =
+        _mm_add_epi16(codewordWords, _mm_mullo_epi16(_mm_cvtepi8_epi16(pixelModifiers),
+                                                     multiplierWords));
+    const __m128i high = _mm_add_epi16(
+        codewordWords,
+        _mm_mullo_epi16(_mm_cvtepi8_epi16(_mm_srli_si128(pixelModifiers, 8)), multiplierWords));
+
+    const __m128i result = isSigned ? _mm_packs_epi16(low, high) : _mm_packus_epi16(low, high);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(values), result);
+}
+
+// Returns the 3-bit BC4 indices of the 16 |values| of a block ranging from |minValue| to
+// |maxValue|, computed exactly as ETC2Block::transcodeAsBC4 does in scalar code.
+ANGLE_SIMD_TARGET_SSE41 uint64_t GetBC4IndexBitsSSE41(const int values[kNumPixelsInBlock],
+                                                      int minValue,
+                                                      int maxValue)
+{
+    const __m128i minValues = _mm_set1_epi32(minValue);
+    const __m128 distance   = _mm_set1_ps(static_cast<float>(maxValue - minValue));
+    const __m128 seven      = _mm_set1_ps(7.0f);
+    const __m128 half       = _mm_set1_ps(0.5f);
+    const __m128 one        = _mm_set1_ps(1.0f);
+
+    __m128i quadIndices[4];
+    for (int quad = 0; quad < 4; quad++)
+    {
+        const __m128i quadValues =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + quad * 4));
+        const __m128 scaled = _mm_mul_ps(
+            _mm_div_ps(_mm_cvtepi32_ps(_mm_sub_epi32(quadValues, minValues)), distance), seven);
+
+        // roundf() rounds halfway cases away from zero; the values are never negative.
+        const __m128 truncated = _mm_round_ps(scaled, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+        const __m128 roundUp   = _mm_cmpge_ps(_mm_sub_ps(scaled, truncated), half);
+        quadIndices[quad] = _mm_cvttps_epi32(_mm_add_ps(truncated, _mm_and_ps(roundUp, one)));
+    }
+
+    // Map the interpolation weights to BC4 indices: 0 is the max value and 1 the min value.
+    const __m128i indexMap = _mm_setr_epi8(1, 7, 6, 5, 4, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i weights  = _mm_packus_epi16(_mm_packs_epi32(quadIndices[0], quadIndices[1]),
+                                              _mm_packs_epi32(quadIndices[2], quadIndices[3]));
+    uint8_t indices[kNumPixelsInBlock];
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(indices), _mm_shuffle_epi8(indexMap, weights));
+
+    uint64_t indexBits = 0;
+    for (size_t i = 0; i < kNumPixelsInBlock; i++)
+    {
+        indexBits |= static_cast<uint64_t>(indices[i]) << (3 * i);
+    }
+    return indexBits;
+}
+#endif  // defined(ANGLE_SIMD_X86)
+
 struct ETC2Block
 {
     // Decodes unsigned single or dual channel ETC2 block to 8-bit color
@@ -62,57 +387,78 @@ struct ETC2Block
                                    size_t h,
                                    size_t destPixelStride,
                                    size_t destRowPitch,
-                                   bool isSigned) const
+                                   bool isSigned,
+                                   bool useSIMD) const
     {
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        uint8_t values[kNumPixelsInBlock];
+        decodeSingleETC2ChannelTile(values, isSigned, useSIMD);
+        StoreTile(values, dest, x, y, w, h, destPixelStride, destRowPitch);
+    }
+
+    // Decodes all pixels of a single channel ETC2 block to 8-bit values in row-major order.
+    // Signed values are stored as their two's complement bytes.
+    void decodeSingleETC2ChannelTile(uint8_t values[kNumPixelsInBlock],
+                                     bool isSigned,
+                                     bool useSIMD) const
+    {
+        uint8_t indices[kNumPixelsInBlock];
+        getSingleChannelIndices(indices);
+
+        const int8_t *modifiers = kSingleChannelModifierTable[u.scblk.table_index];
+        const int codeword      = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+        const int multiplier    = u.scblk.multiplier;
+
+#if defined(ANGLE_SIMD_X86)
+        if (useSIMD)
         {
-            uint8_t *row = dest + (j * destRowPitch);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                uint8_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    *pixel = clampSByte(getSingleETC2Channel(i, j, isSigned));
-                }
-                else
-                {
-                    *pixel = clampByte(getSingleETC2Channel(i, j, isSigned));
-                }
-            }
+            DecodeSingleChannelTileSSE41(modifiers, codeword, multiplier, isSigned, indices,
+                                         values);
+            return;
+        }
+#endif
+
+        for (size_t k = 0; k < kNumPixelsInBlock; k++)
+        {
+            const int value = codeword + modifiers[indices[k]] * multiplier;
+            values[k] = isSigned ? static_cast<uint8_t>(clampSByte(value)) : clampByte(value);
         }
     }
 
     // Transcodes  block to BC4
     // For simplicity, R11 alpha use the same formula as Alpha8 to decode,
     // the result R8 may have some precision issue like multiplier == 0 case.
-    void transcodeAsBC4(uint8_t *dest, size_t x, size_t y, size_t w, size_t h, bool isSigned) const
+    void transcodeAsBC4(uint8_t *dest,
+                        size_t x,
+                        size_t y,
+                        size_t w,
+                        size_t h,
+                        bool isSigned,
+                        bool useSIMD) const
     {
         static constexpr int kIndexMap[] = {1, 7, 6, 5, 4, 3, 2, 0};
+        uint8_t values[kNumPixelsInBlock];
+        decodeSingleETC2ChannelTile(values, isSigned, useSIMD);
+
         int alpha[16];
-        size_t k     = 0;
         int minAlpha = std::numeric_limits<int>::max();
         int maxAlpha = std::numeric_limits<int>::min();
-        for (size_t j = 0; j < 4; j++)
+        for (size_t k = 0; k < kNumPixelsInBlock; k++)
         {
-            for (size_t i = 0; i < 4; i++)
-            {
-                if (isSigned)
-                {
-                    alpha[k] = clampSByte(getSingleETC2Channel(i, j, isSigned));
-                }
-                else
-                {
-                    alpha[k] = clampByte(getSingleETC2Channel(i, j, isSigned));
-                }
-                minAlpha = std::min(minAlpha, alpha[k]);
-                maxAlpha = std::max(maxAlpha, alpha[k]);
-                k++;
-            }
+            alpha[k] = isSigned ? static_cast<int8_t>(values[k]) : values[k];
+            minAlpha = std::min(minAlpha, alpha[k]);
+            maxAlpha = std::max(maxAlpha, alpha[k]);
         }
         uint64_t *result = (uint64_t *)dest;
         *result          = (maxAlpha & 0xff) | ((minAlpha & 0xff) << 8);
         if (minAlpha != maxAlpha)
         {
+#if defined(ANGLE_SIMD_X86)
+            if (useSIMD)
+            {
+                *result |= GetBC4IndexBitsSSE41(alpha, minAlpha, maxAlpha) << 16;
+                return;
+            }
+#endif
             float dist = static_cast<float>(maxAlpha - minAlpha);
             for (size_t i = 0; i < 16; i++)
             {
@@ -150,29 +496,32 @@ struct ETC2Block
                                   bool isSigned,
                                   bool isFloat) const
     {
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        uint8_t indices[kNumPixelsInBlock];
+        getSingleChannelIndices(indices);
+
+        const int8_t *modifiers = kSingleChannelModifierTable[u.scblk.table_index];
+        const int codeword      = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+        const int multiplier    = (u.scblk.multiplier == 0) ? 1 : u.scblk.multiplier * 8;
+
+        uint16_t values[kNumPixelsInBlock];
+        for (size_t k = 0; k < kNumPixelsInBlock; k++)
         {
-            uint16_t *row = reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(dest) +
-                                                         (j * destRowPitch));
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            const int value = codeword * 8 + 4 + modifiers[indices[k]] * multiplier;
+            if (isSigned)
             {
-                uint16_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    int16_t tempPixel =
-                        renormalizeEAC<int16_t>(getSingleEACChannel(i, j, isSigned));
-                    *pixel =
-                        isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
-                }
-                else
-                {
-                    uint16_t tempPixel =
-                        renormalizeEAC<uint16_t>(getSingleEACChannel(i, j, isSigned));
-                    *pixel =
-                        isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
-                }
+                int16_t tempPixel = renormalizeEAC<int16_t>(value);
+                values[k] =
+                    isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
+            }
+            else
+            {
+                uint16_t tempPixel = renormalizeEAC<uint16_t>(value);
+                values[k] =
+                    isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
             }
         }
+
+        StoreTile(values, dest, x, y, w, h, destPixelStride, destRowPitch);
     }
 
     // Decodes RGB block to rgba8
@@ -183,10 +532,27 @@ struct ETC2Block
                      size_t h,
                      size_t destRowPitch,
                      const uint8_t alphaValues[4][4],
-                     bool punchThroughAlpha) const
+                     bool punchThroughAlpha,
+                     bool useSIMD) const
+    {
+        R8G8B8A8 pixels[kNumPixelsInBlock];
+        decodeRGBTile(pixels, alphaValues, punchThroughAlpha, useSIMD);
+        StoreTile(pixels, reinterpret_cast<R8G8B8A8 *>(dest), x, y, w, h, 1, destRowPitch);
+    }
+
+    // Decodes all pixels of an RGB block in row-major order.  All modes but planar are decoded
+    // as a palette of up to 8 colors and a palette index per pixel.
+    void decodeRGBTile(R8G8B8A8 pixels[kNumPixelsInBlock],
+                       const uint8_t alphaValues[4][4],
+                       bool punchThroughAlpha,
+                       bool useSIMD) const
     {
         bool opaqueBit                  = u.idht.mode.idm.diffbit;
         bool nonOpaquePunchThroughAlpha = punchThroughAlpha && !opaqueBit;
+
+        R8G8B8A8 palette[8]            = {};
+        const uint8_t *subblockOffsets = kSubblockPaletteOffsets[2];
+
         // Select mode
         if (u.idht.mode.idm.diffbit || punchThroughAlpha)
         {
@@ -196,28 +562,53 @@ struct ETC2Block
             int b             = (block.B + block.dB);
             if (r < 0 || r > 31)
             {
-                decodeTBlock(dest, x, y, w, h, destRowPitch, alphaValues,
-                             nonOpaquePunchThroughAlpha);
+                getTBlockPalette(palette);
             }
             else if (g < 0 || g > 31)
             {
-                decodeHBlock(dest, x, y, w, h, destRowPitch, alphaValues,
-                             nonOpaquePunchThroughAlpha);
+                getHBlockPalette(palette);
             }
             else if (b < 0 || b > 31)
             {
-                decodePlanarBlock(dest, x, y, w, h, destRowPitch, alphaValues);
+                decodePlanarTile(pixels, alphaValues, useSIMD);
+                return;
             }
             else
             {
-                decodeDifferentialBlock(dest, x, y, w, h, destRowPitch, alphaValues,
-                                        nonOpaquePunchThroughAlpha);
+                getDifferentialBlockPalette(palette, nonOpaquePunchThroughAlpha, useSIMD);
+                subblockOffsets = kSubblockPaletteOffsets[u.idht.mode.idm.flipbit];
             }
         }
         else
         {
-            decodeIndividualBlock(dest, x, y, w, h, destRowPitch, alphaValues,
-                                  nonOpaquePunchThroughAlpha);
+            getIndividualBlockPalette(palette, nonOpaquePunchThroughAlpha, useSIMD);
+            subblockOffsets = kSubblockPaletteOffsets[u.idht.mode.idm.flipbit];
+        }
+
+        uint8_t paletteIndices[kNumPixelsInBlock];
+        const uint8_t *alpha = &alphaValues[0][0];
+#if defined(ANGLE_SIMD_X86)
+        if (useSIMD)
+        {
+            DecodePaletteTileSSE41(palette, getIndexMSBBits(), getIndexLSBBits(), subblockOffsets,
+                                   alpha, paletteIndices, pixels);
+        }
+        else
+#endif
+        {
+            getIndices(paletteIndices, subblockOffsets);
+            ExpandPalette(palette, paletteIndices, alpha, pixels);
+        }
+
+        if (nonOpaquePunchThroughAlpha)
+        {
+            for (size_t k = 0; k < kNumPixelsInBlock; k++)
+            {
+                if ((paletteIndices[k] & 3) == 2)  //  msb == 1 && lsb == 0
+                {
+                    pixels[k] = createRGBA(0, 0, 0, 0);
+                }
+            }
         }
     }
 
@@ -228,7 +619,8 @@ struct ETC2Block
                         size_t w,
                         size_t h,
                         const uint8_t alphaValues[4][4],
-                        bool punchThroughAlpha) const
+                        bool punchThroughAlpha,
+                        bool useSIMD) const
     {
         bool opaqueBit                  = u.idht.mode.idm.diffbit;
         bool nonOpaquePunchThroughAlpha = punchThroughAlpha && !opaqueBit;
@@ -249,7 +641,7 @@ struct ETC2Block
             }
             else if (b < 0 || b > 31)
             {
-                transcodePlanarBlockToBC1(dest, x, y, w, h, alphaValues);
+                transcodePlanarBlockToBC1(dest, x, y, w, h, alphaValues, useSIMD);
             }
             else
             {
@@ -475,14 +867,9 @@ struct ETC2Block
     static int extend_6to8bits(int x) { return (x << 2) | (x >> 4); }
     static int extend_7to8bits(int x) { return (x << 1) | (x >> 6); }
 
-    void decodeIndividualBlock(uint8_t *dest,
-                               size_t x,
-                               size_t y,
-                               size_t w,
-                               size_t h,
-                               size_t destRowPitch,
-                               const uint8_t alphaValues[4][4],
-                               bool nonOpaquePunchThroughAlpha) const
+    void getIndividualBlockPalette(R8G8B8A8 palette[8],
+                                   bool nonOpaquePunchThroughAlpha,
+                                   bool useSIMD) const
     {
         const auto &block = u.idht.mode.idm.colors.indiv;
         int r1            = extend_4to8bits(block.R1);
@@ -491,18 +878,13 @@ struct ETC2Block
         int r2            = extend_4to8bits(block.R2);
         int g2            = extend_4to8bits(block.G2);
         int b2            = extend_4to8bits(block.B2);
-        decodeIndividualOrDifferentialBlock(dest, x, y, w, h, destRowPitch, r1, g1, b1, r2, g2, b2,
-                                            alphaValues, nonOpaquePunchThroughAlpha);
+        getIndividualOrDifferentialBlockPalette(palette, r1, g1, b1, r2, g2, b2,
+                                                nonOpaquePunchThroughAlpha, useSIMD);
     }
 
-    void decodeDifferentialBlock(uint8_t *dest,
-                                 size_t x,
-                                 size_t y,
-                                 size_t w,
-                                 size_t h,
-                                 size_t destRowPitch,
-                                 const uint8_t alphaValues[4][4],
-                                 bool nonOpaquePunchThroughAlpha) const
+    void getDifferentialBlockPalette(R8G8B8A8 palette[8],
+                                     bool nonOpaquePunchThroughAlpha,
+                                     bool useSIMD) const
     {
         const auto &block = u.idht.mode.idm.colors.diff;
         int b1            = extend_5to8bits(block.B);
@@ -511,96 +893,48 @@ struct ETC2Block
         int r2            = extend_5to8bits(block.R + block.dR);
         int g2            = extend_5to8bits(block.G + block.dG);
         int b2            = extend_5to8bits(block.B + block.dB);
-        decodeIndividualOrDifferentialBlock(dest, x, y, w, h, destRowPitch, r1, g1, b1, r2, g2, b2,
-                                            alphaValues, nonOpaquePunchThroughAlpha);
+        getIndividualOrDifferentialBlockPalette(palette, r1, g1, b1, r2, g2, b2,
+                                                nonOpaquePunchThroughAlpha, useSIMD);
     }
 
-    void decodeIndividualOrDifferentialBlock(uint8_t *dest,
-                                             size_t x,
-                                             size_t y,
-                                             size_t w,
-                                             size_t h,
-                                             size_t destRowPitch,
-                                             int r1,
-                                             int g1,
-                                             int b1,
-                                             int r2,
-                                             int g2,
-                                             int b2,
-                                             const uint8_t alphaValues[4][4],
-                                             bool nonOpaquePunchThroughAlpha) const
+    // The first four entries are the colors of the first subblock, the last four the colors of
+    // the second subblock.
+    void getIndividualOrDifferentialBlockPalette(R8G8B8A8 palette[8],
+                                                 int r1,
+                                                 int g1,
+                                                 int b1,
+                                                 int r2,
+                                                 int g2,
+                                                 int b2,
+                                                 bool nonOpaquePunchThroughAlpha,
+                                                 bool useSIMD) const
     {
         const IntensityModifier *intensityModifier =
             nonOpaquePunchThroughAlpha ? intensityModifierNonOpaque : intensityModifierDefault;
 
-        R8G8B8A8 subblockColors0[4];
-        R8G8B8A8 subblockColors1[4];
-        for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
+#if defined(ANGLE_SIMD_X86)
+        if (useSIMD)
         {
-            const int i1                 = intensityModifier[u.idht.mode.idm.cw1][modifierIdx];
-            subblockColors0[modifierIdx] = createRGBA(r1 + i1, g1 + i1, b1 + i1);
-
-            const int i2                 = intensityModifier[u.idht.mode.idm.cw2][modifierIdx];
-            subblockColors1[modifierIdx] = createRGBA(r2 + i2, g2 + i2, b2 + i2);
+            const int *modifiers1   = intensityModifier[u.idht.mode.idm.cw1];
+            const int *modifiers2   = intensityModifier[u.idht.mode.idm.cw2];
+            __m128i *paletteVectors = reinterpret_cast<__m128i *>(palette);
+            _mm_storeu_si128(paletteVectors, GetSubblockColorsSSE41(r1, g1, b1, modifiers1));
+            _mm_storeu_si128(paletteVectors + 1, GetSubblockColorsSSE41(r2, g2, b2, modifiers2));
+            return;
         }
+#endif
 
-        if (u.idht.mode.idm.flipbit)
-        {
-            uint8_t *curPixel = dest;
-            for (size_t j = 0; j < 2 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors0[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-            for (size_t j = 2; j < 4 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors1[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-        }
-        else
-        {
-            uint8_t *curPixel = dest;
-            for (size_t j = 0; j < 4 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 2 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors0[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                for (size_t i = 2; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors1[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-        }
-        if (nonOpaquePunchThroughAlpha)
+        for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
         {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
+            const int i1         = intensityModifier[u.idht.mode.idm.cw1][modifierIdx];
+            palette[modifierIdx] = createRGBA(r1 + i1, g1 + i1, b1 + i1);
+
+            const int i2             = intensityModifier[u.idht.mode.idm.cw2][modifierIdx];
+            palette[4 + modifierIdx] = createRGBA(r2 + i2, g2 + i2, b2 + i2);
         }
     }
 
-    void decodeTBlock(uint8_t *dest,
-                      size_t x,
-                      size_t y,
-                      size_t w,
-                      size_t h,
-                      size_t destRowPitch,
-                      const uint8_t alphaValues[4][4],
-                      bool nonOpaquePunchThroughAlpha) const
+    void getTBlockPalette(R8G8B8A8 palette[8]) const
     {
         // Table C.8, distance index for T and H modes
         const auto &block = u.idht.mode.tm;
@@ -615,39 +949,13 @@ struct ETC2Block
         static int distance[8] = {3, 6, 11, 16, 23, 32, 41, 64};
         const int d            = distance[block.Tda << 1 | block.Tdb];
 
-        const R8G8B8A8 paintColors[4] = {
-            createRGBA(r1, g1, b1),
-            createRGBA(r2 + d, g2 + d, b2 + d),
-            createRGBA(r2, g2, b2),
-            createRGBA(r2 - d, g2 - d, b2 - d),
-        };
-
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
-        {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                row[i]   = paintColors[getIndex(i, j)];
-                row[i].A = alphaValues[j][i];
-            }
-            curPixel += destRowPitch;
-        }
-
-        if (nonOpaquePunchThroughAlpha)
-        {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
-        }
+        palette[0] = createRGBA(r1, g1, b1);
+        palette[1] = createRGBA(r2 + d, g2 + d, b2 + d);
+        palette[2] = createRGBA(r2, g2, b2);
+        palette[3] = createRGBA(r2 - d, g2 - d, b2 - d);
     }
 
-    void decodeHBlock(uint8_t *dest,
-                      size_t x,
-                      size_t y,
-                      size_t w,
-                      size_t h,
-                      size_t destRowPitch,
-                      const uint8_t alphaValues[4][4],
-                      bool nonOpaquePunchThroughAlpha) const
+    void getHBlockPalette(R8G8B8A8 palette[8]) const
     {
         // Table C.8, distance index for T and H modes
         const auto &block = u.idht.mode.hm;
@@ -664,38 +972,15 @@ struct ETC2Block
             ((r1 << 16 | g1 << 8 | b1) >= (r2 << 16 | g2 << 8 | b2) ? 1 : 0);
         const int d = distance[(block.Hda << 2) | (block.Hdb << 1) | orderingTrickBit];
 
-        const R8G8B8A8 paintColors[4] = {
-            createRGBA(r1 + d, g1 + d, b1 + d),
-            createRGBA(r1 - d, g1 - d, b1 - d),
-            createRGBA(r2 + d, g2 + d, b2 + d),
-            createRGBA(r2 - d, g2 - d, b2 - d),
-        };
-
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
-        {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                row[i]   = paintColors[getIndex(i, j)];
-                row[i].A = alphaValues[j][i];
-            }
-            curPixel += destRowPitch;
-        }
-
-        if (nonOpaquePunchThroughAlpha)
-        {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
-        }
+        palette[0] = createRGBA(r1 + d, g1 + d, b1 + d);
+        palette[1] = createRGBA(r1 - d, g1 - d, b1 - d);
+        palette[2] = createRGBA(r2 + d, g2 + d, b2 + d);
+        palette[3] = createRGBA(r2 - d, g2 - d, b2 - d);
     }
 
-    void decodePlanarBlock(uint8_t *dest,
-                           size_t x,
-                           size_t y,
-                           size_t w,
-                           size_t h,
-                           size_t pitch,
-                           const uint8_t alphaValues[4][4]) const
+    void decodePlanarTile(R8G8B8A8 pixels[kNumPixelsInBlock],
+                          const uint8_t alphaValues[4][4],
+                          bool useSIMD) const
     {
         int ro = extend_6to8bits(u.pblk.RO);
         int go = extend_7to8bits(u.pblk.GO1 << 6 | u.pblk.GO2);
@@ -708,22 +993,31 @@ struct ETC2Block
         int gv = extend_7to8bits(u.pblk.GVa << 2 | u.pblk.GVb);
         int bv = extend_6to8bits(u.pblk.BV);
 
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+#if defined(ANGLE_SIMD_X86)
+        if (useSIMD)
+        {
+            const int origin[3]     = {ro, go, bo};
+            const int horizontal[3] = {rh, gh, bh};
+            const int vertical[3]   = {rv, gv, bv};
+            DecodePlanarTileSSE41(origin, horizontal, vertical, &alphaValues[0][0], pixels);
+            return;
+        }
+#endif
+
+        for (size_t j = 0; j < 4; j++)
         {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
+            R8G8B8A8 *row = pixels + j * 4;
 
             int ry = static_cast<int>(j) * (rv - ro) + 2;
             int gy = static_cast<int>(j) * (gv - go) + 2;
             int by = static_cast<int>(j) * (bv - bo) + 2;
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            for (size_t i = 0; i < 4; i++)
             {
                 row[i] = createRGBA(((static_cast<int>(i) * (rh - ro) + ry) >> 2) + ro,
                                     ((static_cast<int>(i) * (gh - go) + gy) >> 2) + go,
                                     ((static_cast<int>(i) * (bh - bo) + by) >> 2) + bo,
                                     alphaValues[j][i]);
             }
-            curPixel += pitch;
         }
     }
 
@@ -737,25 +1031,30 @@ struct ETC2Block
         return (msb << 1) | lsb;
     }
 
-    void decodePunchThroughAlphaBlock(uint8_t *dest,
-                                      size_t x,
-                                      size_t y,
-                                      size_t w,
-                                      size_t h,
-                                      size_t destRowPitch) const
+    // The index bits for individual, differential, H and T modes, stored as two big-endian 16-bit
+    // words.  Bit x * 4 + y holds the bit of the pixel at (x, y).
+    uint32_t getIndexMSBBits() const
+    {
+        return u.idht.pixelIndexMSB[0] << 8 | u.idht.pixelIndexMSB[1];
+    }
+    uint32_t getIndexLSBBits() const
     {
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        return u.idht.pixelIndexLSB[0] << 8 | u.idht.pixelIndexLSB[1];
+    }
+
+    // Palette indices of all pixels in row-major order, plus the per-pixel |subblockOffsets|.
+    void getIndices(uint8_t indices[kNumPixelsInBlock], const uint8_t subblockOffsets[16]) const
+    {
+        const uint32_t msbBits = getIndexMSBBits();
+        const uint32_t lsbBits = getIndexLSBBits();
+        for (size_t j = 0; j < 4; j++)
         {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            for (size_t i = 0; i < 4; i++)
             {
-                if (getIndex(i, j) == 2)  //  msb == 1 && lsb == 0
-                {
-                    row[i] = createRGBA(0, 0, 0, 0);
-                }
+                const size_t bitIndex = i * 4 + j;
+                const size_t index = ((msbBits >> bitIndex) & 1) << 1 | ((lsbBits >> bitIndex) & 1);
+                indices[j * 4 + i] = static_cast<uint8_t>(index + subblockOffsets[j * 4 + i]);
             }
-            curPixel += destRowPitch;
         }
     }
 
@@ -1370,13 +1669,13 @@ struct ETC2Block
                                    size_t y,
                                    size_t w,
                                    size_t h,
-                                   const uint8_t alphaValues[4][4]) const
+                                   const uint8_t alphaValues[4][4],
+                                   bool useSIMD) const
     {
         static const size_t kNumColors = kNumPixelsInBlock;
 
         R8G8B8A8 rgbaBlock[kNumColors];
-        decodePlanarBlock(reinterpret_cast<uint8_t *>(rgbaBlock), x, y, w, h, sizeof(R8G8B8A8) * 4,
-                          alphaValues);
+        decodePlanarTile(rgbaBlock, alphaValues, useSIMD);
 
         // Planar block doesn't have a color table, fill indices as full
         int pixelIndices[kNumPixelsInBlock] = {0, 1, 2,  3,  4,  5,  6,  7,
@@ -1390,73 +1689,25 @@ struct ETC2Block
                 maxColorIndex, false);
     }
 
-    // Single channel utility functions
-    int getSingleEACChannel(size_t x, size_t y, bool isSigned) const
+    // Indices of a single channel block for all pixels in row-major order.  The 3-bit indices
+    // are stored in column-major order in the last 48 bits of the block, in big-endian order.
+    void getSingleChannelIndices(uint8_t indices[kNumPixelsInBlock]) const
     {
-        int codeword   = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        int multiplier = (u.scblk.multiplier == 0) ? 1 : u.scblk.multiplier * 8;
-        return codeword * 8 + 4 + getSingleChannelModifier(x, y) * multiplier;
-    }
-
-    int getSingleETC2Channel(size_t x, size_t y, bool isSigned) const
-    {
-        int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        return codeword + getSingleChannelModifier(x, y) * u.scblk.multiplier;
-    }
-
-    int getSingleChannelIndex(size_t x, size_t y) const
-    {
-        ASSERT(x < 4 && y < 4);
-
-        // clang-format off
-        switch (x * 4 + y)
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&u);
+        uint64_t indexBits   = 0;
+        for (size_t byteIndex = 2; byteIndex < 8; byteIndex++)
         {
-            case 0: return u.scblk.ma;
-            case 1: return u.scblk.mb;
-            case 2: return u.scblk.mc1 << 1 | u.scblk.mc2;
-            case 3: return u.scblk.md;
-            case 4: return u.scblk.me;
-            case 5: return u.scblk.mf1 << 2 | u.scblk.mf2;
-            case 6: return u.scblk.mg;
-            case 7: return u.scblk.mh;
-            case 8: return u.scblk.mi;
-            case 9: return u.scblk.mj;
-            case 10: return u.scblk.mk1 << 1 | u.scblk.mk2;
-            case 11: return u.scblk.ml;
-            case 12: return u.scblk.mm;
-            case 13: return u.scblk.mn1 << 2 | u.scblk.mn2;
-            case 14: return u.scblk.mo;
-            case 15: return u.scblk.mp;
-            default: UNREACHABLE(); return 0;
+            indexBits = indexBits << 8 | bytes[byteIndex];
         }
-        // clang-format on
-    }
 
-    int getSingleChannelModifier(size_t x, size_t y) const
-    {
-        // clang-format off
-        static const int modifierTable[16][8] =
+        for (size_t i = 0; i < 4; i++)
         {
-            { -3, -6,  -9, -15, 2, 5, 8, 14 },
-            { -3, -7, -10, -13, 2, 6, 9, 12 },
-            { -2, -5,  -8, -13, 1, 4, 7, 12 },
-            { -2, -4,  -6, -13, 1, 3, 5, 12 },
-            { -3, -6,  -8, -12, 2, 5, 7, 11 },
-            { -3, -7,  -9, -11, 2, 6, 8, 10 },
-            { -4, -7,  -8, -11, 3, 6, 7, 10 },
-            { -3, -5,  -8, -11, 2, 4, 7, 10 },
-            { -2, -6,  -8, -10, 1, 5, 7,  9 },
-            { -2, -5,  -8, -10, 1, 4, 7,  9 },
-            { -2, -4,  -8, -10, 1, 3, 7,  9 },
-            { -2, -5,  -7, -10, 1, 4, 6,  9 },
-            { -3, -4,  -7, -10, 2, 3, 6,  9 },
-            { -1, -2,  -3, -10, 0, 1, 2,  9 },
-            { -4, -6,  -8,  -9, 3, 5, 7,  8 },
-            { -3, -5,  -7,  -9, 2, 4, 6,  8 }
-        };
-        // clang-format on
-
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+            for (size_t j = 0; j < 4; j++)
+            {
+                const size_t pixelIndex = i * 4 + j;
+                indices[j * 4 + i] = static_cast<uint8_t>((indexBits >> (45 - pixelIndex * 3)) & 7);
+            }
+        }
     }
 };
 
@@ -1470,6 +1721,7 @@ static const uint8_t DefaultETCAlphaValues[4][4] =
 };
 
 // clang-format on
+template <bool isSigned>
 void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t width,
                     size_t height,
@@ -1479,9 +1731,10 @@ void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t inputDepthPitch,
                     uint8_t *output,
                     size_t outputRowPitch,
-                    size_t outputDepthPitch,
-                    bool isSigned)
+                    size_t outputDepthPitch)
 {
+    const bool useSIMD = UseSIMDBlockDecoding();
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1497,12 +1750,13 @@ void LoadR11EACToR8(const ImageLoadContext &context,
                 uint8_t *destPixels          = destRow + x;
 
                 sourceBlock->decodeAsSingleETC2Channel(destPixels, x, y, width, height, 1,
-                                                       outputRowPitch, isSigned);
+                                                       outputRowPitch, isSigned, useSIMD);
             }
         }
     }
 }
 
+template <bool isSigned>
 void LoadRG11EACToRG8(const ImageLoadContext &context,
                       size_t width,
                       size_t height,
@@ -1512,9 +1766,10 @@ void LoadRG11EACToRG8(const ImageLoadContext &context,
                       size_t inputDepthPitch,
                       uint8_t *output,
                       size_t outputRowPitch,
-                      size_t outputDepthPitch,
-                      bool isSigned)
+                      size_t outputDepthPitch)
 {
+    const bool useSIMD = UseSIMDBlockDecoding();
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1529,17 +1784,18 @@ void LoadRG11EACToRG8(const ImageLoadContext &context,
                 uint8_t *destPixelsRed          = destRow + (x * 2);
                 const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
                 sourceBlockRed->decodeAsSingleETC2Channel(destPixelsRed, x, y, width, height, 2,
-                                                          outputRowPitch, isSigned);
+                                                          outputRowPitch, isSigned, useSIMD);
 
                 uint8_t *destPixelsGreen          = destPixelsRed + 1;
                 const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
                 sourceBlockGreen->decodeAsSingleETC2Channel(destPixelsGreen, x, y, width, height, 2,
-                                                            outputRowPitch, isSigned);
+                                                            outputRowPitch, isSigned, useSIMD);
             }
         }
     }
 }
 
+template <bool isSigned, bool isFloat>
 void LoadR11EACToR16(const ImageLoadContext &context,
                      size_t width,
                      size_t height,
@@ -1549,9 +1805,7 @@ void LoadR11EACToR16(const ImageLoadContext &context,
                      size_t inputDepthPitch,
                      uint8_t *output,
                      size_t outputRowPitch,
-                     size_t outputDepthPitch,
-                     bool isSigned,
-                     bool isFloat)
+                     size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -1574,6 +1828,7 @@ void LoadR11EACToR16(const ImageLoadContext &context,
     }
 }
 
+template <bool isSigned, bool isFloat>
 void LoadRG11EACToRG16(const ImageLoadContext &context,
                        size_t width,
                        size_t height,
@@ -1583,9 +1838,7 @@ void LoadRG11EACToRG16(const ImageLoadContext &context,
                        size_t inputDepthPitch,
                        uint8_t *output,
                        size_t outputRowPitch,
-                       size_t outputDepthPitch,
-                       bool isSigned,
-                       bool isFloat)
+                       size_t outputDepthPitch)
 {
     for (size_t z = 0; z < depth; z++)
     {
@@ -1612,6 +1865,7 @@ void LoadRG11EACToRG16(const ImageLoadContext &context,
     }
 }
 
+template <bool punchthroughAlpha>
 void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                          size_t width,
                          size_t height,
@@ -1621,9 +1875,10 @@ void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                          size_t inputDepthPitch,
                          uint8_t *output,
                          size_t outputRowPitch,
-                         size_t outputDepthPitch,
-                         bool punchthroughAlpha)
+                         size_t outputDepthPitch)
 {
+    const bool useSIMD = UseSIMDBlockDecoding();
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1639,12 +1894,13 @@ void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                 uint8_t *destPixels          = destRow + (x * 4);
 
                 sourceBlock->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
-                                         DefaultETCAlphaValues, punchthroughAlpha);
+                                         DefaultETCAlphaValues, punchthroughAlpha, useSIMD);
             }
         }
     }
 }
 
+template <bool punchthroughAlpha>
 void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
                        size_t width,
                        size_t height,
@@ -1654,9 +1910,10 @@ void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
                        size_t inputDepthPitch,
                        uint8_t *output,
                        size_t outputRowPitch,
-                       size_t outputDepthPitch,
-                       bool punchthroughAlpha)
+                       size_t outputDepthPitch)
 {
+    const bool useSIMD = UseSIMDBlockDecoding();
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1672,12 +1929,13 @@ void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
                 uint8_t *destPixels          = destRow + (x * 2);
 
                 sourceBlock->transcodeAsBC1(destPixels, x, y, width, height, DefaultETCAlphaValues,
-                                            punchthroughAlpha);
+                                            punchthroughAlpha, useSIMD);
             }
         }
     }
 }
 
+template <bool punchthroughAlpha, bool isSigned>
 void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
                         size_t width,
                         size_t height,
@@ -1687,10 +1945,10 @@ void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
                         size_t inputDepthPitch,
                         uint8_t *output,
                         size_t outputRowPitch,
-                        size_t outputDepthPitch,
-                        bool punchthroughAlpha,
-                        bool isSigned)
+                        size_t outputDepthPitch)
 {
+    const bool useSIMD = UseSIMDBlockDecoding();
+
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y += 4)
@@ -1709,14 +1967,16 @@ void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
                 uint8_t *destRgbPixels          = destAlphaPixels + 8;
 
                 sourceRgbBlock->transcodeAsBC1(destRgbPixels, x, y, width, height,
-                                               DefaultETCAlphaValues, punchthroughAlpha);
+                                               DefaultETCAlphaValues, punchthroughAlpha, useSIMD);
 
-                sourceAlphaBlock->transcodeAsBC4(destAlphaPixels, x, y, width, height, isSigned);
+                sourceAlphaBlock->transcodeAsBC4(destAlphaPixels, x, y, width, height, isSigned,
+                                                 useSIMD);
             }
         }
     }
 }
 
+template <bool srgb>
 void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
                           size_t width,
                           size_t height,
@@ -1726,9 +1986,9 @@ void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
                           size_t inputDepthPitch,
                           uint8_t *output,
                           size_t outputRowPitch,
-                          size_t outputDepthPitch,
-                          bool srgb)
+                          size_t outputDepthPitch)
 {
+    const bool useSIMD = UseSIMDBlockDecoding();
     uint8_t decodedAlphaValues[4][4];
 
     for (size_t z = 0; z < depth; z++)
@@ -1743,19 +2003,96 @@ void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
             for (size_t x = 0; x < width; x += 4)
             {
                 const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
-                sourceBlockAlpha->decodeAsSingleETC2Channel(
-                    reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4,
-                    false);
+                sourceBlockAlpha->decodeSingleETC2ChannelTile(&decodedAlphaValues[0][0], false,
+                                                              useSIMD);
 
                 uint8_t *destPixels             = destRow + (x * 4);
                 const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
                 sourceBlockRGB->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
-                                            decodedAlphaValues, false);
+                                            decodedAlphaValues, false, useSIMD);
+            }
+        }
+    }
+}
+
+template <bool isSigned>
+void LoadEACR11ToBC4(const ImageLoadContext &context,
+                     size_t width,
+                     size_t height,
+                     size_t depth,
+                     const uint8_t *input,
+                     size_t inputRowPitch,
+                     size_t inputDepthPitch,
+                     uint8_t *output,
+                     size_t outputRowPitch,
+                     size_t outputDepthPitch)
+{
+    const bool useSIMD = UseSIMDBlockDecoding();
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const ETC2Block *sourceR11Block = sourceRow + (x / 4);
+                uint8_t *destR11Pixels          = destRow + (x * 2);
+                sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned,
+                                               useSIMD);
+            }
+        }
+    }
+}
+
+template <bool isSigned>
+void LoadEACRG11ToBC5(const ImageLoadContext &context,
+                      size_t width,
+                      size_t height,
+                      size_t depth,
+                      const uint8_t *input,
+                      size_t inputRowPitch,
+                      size_t inputDepthPitch,
+                      uint8_t *output,
+                      size_t outputRowPitch,
+                      size_t outputDepthPitch)
+{
+    const bool useSIMD = UseSIMDBlockDecoding();
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += 4)
+        {
+            const ETC2Block *sourceRow =
+                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                                outputDepthPitch);
+
+            for (size_t x = 0; x < width; x += 4)
+            {
+                const ETC2Block *sourceR11Block = sourceRow + (x / 2);
+                uint8_t *destR11Pixels          = destRow + (x * 4);
+
+                const ETC2Block *sourceG11Block = sourceR11Block + 1;
+                uint8_t *destG11Pixels          = destR11Pixels + 8;
+                sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned,
+                                               useSIMD);
+                sourceG11Block->transcodeAsBC4(destG11Pixels, x, y, width, height, isSigned,
+                                               useSIMD);
             }
         }
     }
 }
 
+// Each input row pitch holds a row of 4x4 blocks.  Decoded output has a row pitch per row of
+// pixels, and BCn output a row pitch per row of blocks.
+constexpr LoadImageRowGrouping kDecodeRowGrouping    = {4, 1};
+constexpr LoadImageRowGrouping kTranscodeRowGrouping = {4, 4};
+
 }  // anonymous namespace
 
 void LoadETC1RGB8ToRGBA8(const ImageLoadContext &context,
@@ -1769,8 +2106,9 @@ void LoadETC1RGB8ToRGBA8(const ImageLoadContext &context,
                          size_t outputRowPitch,
                          size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToRGBA8(context, width, height, depth, input, inputRowPitch, inputDepthPitch,
-                        output, outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadETC2RGB8ToRGBA8<false>, kDecodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC1RGB8ToBC1(const ImageLoadContext &context,
@@ -1784,8 +2122,9 @@ void LoadETC1RGB8ToBC1(const ImageLoadContext &context,
                        size_t outputRowPitch,
                        size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToBC1(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                      outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadETC2RGB8ToBC1<false>, kTranscodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACR11ToR8(const ImageLoadContext &context,
@@ -1799,8 +2138,9 @@ void LoadEACR11ToR8(const ImageLoadContext &context,
                     size_t outputRowPitch,
                     size_t outputDepthPitch)
 {
-    LoadR11EACToR8(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                   outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadR11EACToR8<false>, kDecodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACR11SToR8(const ImageLoadContext &context,
@@ -1814,8 +2154,9 @@ void LoadEACR11SToR8(const ImageLoadContext &context,
                      size_t outputRowPitch,
                      size_t outputDepthPitch)
 {
-    LoadR11EACToR8(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                   outputRowPitch, outputDepthPitch, true);
+    ParallelLoadImage(context, LoadR11EACToR8<true>, kDecodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACRG11ToRG8(const ImageLoadContext &context,
@@ -1829,8 +2170,9 @@ void LoadEACRG11ToRG8(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-    LoadRG11EACToRG8(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                     outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadRG11EACToRG8<false>, kDecodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACRG11SToRG8(const ImageLoadContext &context,
@@ -1844,8 +2186,9 @@ void LoadEACRG11SToRG8(const ImageLoadContext &context,
                        size_t outputRowPitch,
                        size_t outputDepthPitch)
 {
-    LoadRG11EACToRG8(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                     outputRowPitch, outputDepthPitch, true);
+    ParallelLoadImage(context, LoadRG11EACToRG8<true>, kDecodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACR11ToR16(const ImageLoadContext &context,
@@ -1859,8 +2202,9 @@ void LoadEACR11ToR16(const ImageLoadContext &context,
                      size_t outputRowPitch,
                      size_t outputDepthPitch)
 {
-    LoadR11EACToR16(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                    outputRowPitch, outputDepthPitch, false, false);
+    ParallelLoadImage(context, LoadR11EACToR16<false, false>, kDecodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACR11SToR16(const ImageLoadContext &context,
@@ -1874,8 +2218,9 @@ void LoadEACR11SToR16(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-    LoadR11EACToR16(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                    outputRowPitch, outputDepthPitch, true, false);
+    ParallelLoadImage(context, LoadR11EACToR16<true, false>, kDecodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACRG11ToRG16(const ImageLoadContext &context,
@@ -1889,8 +2234,9 @@ void LoadEACRG11ToRG16(const ImageLoadContext &context,
                        size_t outputRowPitch,
                        size_t outputDepthPitch)
 {
-    LoadRG11EACToRG16(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                      outputRowPitch, outputDepthPitch, false, false);
+    ParallelLoadImage(context, LoadRG11EACToRG16<false, false>, kDecodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACRG11SToRG16(const ImageLoadContext &context,
@@ -1904,8 +2250,9 @@ void LoadEACRG11SToRG16(const ImageLoadContext &context,
                         size_t outputRowPitch,
                         size_t outputDepthPitch)
 {
-    LoadRG11EACToRG16(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                      outputRowPitch, outputDepthPitch, true, false);
+    ParallelLoadImage(context, LoadRG11EACToRG16<true, false>, kDecodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACR11ToR16F(const ImageLoadContext &context,
@@ -1919,8 +2266,9 @@ void LoadEACR11ToR16F(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-    LoadR11EACToR16(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                    outputRowPitch, outputDepthPitch, false, true);
+    ParallelLoadImage(context, LoadR11EACToR16<false, true>, kDecodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACR11SToR16F(const ImageLoadContext &context,
@@ -1934,8 +2282,9 @@ void LoadEACR11SToR16F(const ImageLoadContext &context,
                        size_t outputRowPitch,
                        size_t outputDepthPitch)
 {
-    LoadR11EACToR16(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                    outputRowPitch, outputDepthPitch, true, true);
+    ParallelLoadImage(context, LoadR11EACToR16<true, true>, kDecodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACRG11ToRG16F(const ImageLoadContext &context,
@@ -1949,8 +2298,9 @@ void LoadEACRG11ToRG16F(const ImageLoadContext &context,
                         size_t outputRowPitch,
                         size_t outputDepthPitch)
 {
-    LoadRG11EACToRG16(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                      outputRowPitch, outputDepthPitch, false, true);
+    ParallelLoadImage(context, LoadRG11EACToRG16<false, true>, kDecodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACRG11SToRG16F(const ImageLoadContext &context,
@@ -1964,8 +2314,9 @@ void LoadEACRG11SToRG16F(const ImageLoadContext &context,
                          size_t outputRowPitch,
                          size_t outputDepthPitch)
 {
-    LoadRG11EACToRG16(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                      outputRowPitch, outputDepthPitch, true, true);
+    ParallelLoadImage(context, LoadRG11EACToRG16<true, true>, kDecodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
@@ -1979,8 +2330,9 @@ void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                          size_t outputRowPitch,
                          size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToRGBA8(context, width, height, depth, input, inputRowPitch, inputDepthPitch,
-                        output, outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadETC2RGB8ToRGBA8<false>, kDecodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
@@ -1994,8 +2346,9 @@ void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
                        size_t outputRowPitch,
                        size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToBC1(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                      outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadETC2RGB8ToBC1<false>, kTranscodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2SRGB8ToRGBA8(const ImageLoadContext &context,
@@ -2009,8 +2362,9 @@ void LoadETC2SRGB8ToRGBA8(const ImageLoadContext &context,
                           size_t outputRowPitch,
                           size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToRGBA8(context, width, height, depth, input, inputRowPitch, inputDepthPitch,
-                        output, outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadETC2RGB8ToRGBA8<false>, kDecodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2SRGB8ToBC1(const ImageLoadContext &context,
@@ -2024,8 +2378,9 @@ void LoadETC2SRGB8ToBC1(const ImageLoadContext &context,
                         size_t outputRowPitch,
                         size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToBC1(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                      outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadETC2RGB8ToBC1<false>, kTranscodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2RGB8A1ToRGBA8(const ImageLoadContext &context,
@@ -2039,8 +2394,9 @@ void LoadETC2RGB8A1ToRGBA8(const ImageLoadContext &context,
                            size_t outputRowPitch,
                            size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToRGBA8(context, width, height, depth, input, inputRowPitch, inputDepthPitch,
-                        output, outputRowPitch, outputDepthPitch, true);
+    ParallelLoadImage(context, LoadETC2RGB8ToRGBA8<true>, kDecodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2RGB8A1ToBC1(const ImageLoadContext &context,
@@ -2054,8 +2410,9 @@ void LoadETC2RGB8A1ToBC1(const ImageLoadContext &context,
                          size_t outputRowPitch,
                          size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToBC1(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                      outputRowPitch, outputDepthPitch, true);
+    ParallelLoadImage(context, LoadETC2RGB8ToBC1<true>, kTranscodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2SRGB8A1ToRGBA8(const ImageLoadContext &context,
@@ -2069,8 +2426,9 @@ void LoadETC2SRGB8A1ToRGBA8(const ImageLoadContext &context,
                             size_t outputRowPitch,
                             size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToRGBA8(context, width, height, depth, input, inputRowPitch, inputDepthPitch,
-                        output, outputRowPitch, outputDepthPitch, true);
+    ParallelLoadImage(context, LoadETC2RGB8ToRGBA8<true>, kDecodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2SRGB8A1ToBC1(const ImageLoadContext &context,
@@ -2084,8 +2442,9 @@ void LoadETC2SRGB8A1ToBC1(const ImageLoadContext &context,
                           size_t outputRowPitch,
                           size_t outputDepthPitch)
 {
-    LoadETC2RGB8ToBC1(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                      outputRowPitch, outputDepthPitch, true);
+    ParallelLoadImage(context, LoadETC2RGB8ToBC1<true>, kTranscodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
@@ -2099,8 +2458,9 @@ void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
                           size_t outputRowPitch,
                           size_t outputDepthPitch)
 {
-    LoadETC2RGBA8ToRGBA8(context, width, height, depth, input, inputRowPitch, inputDepthPitch,
-                         output, outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadETC2RGBA8ToRGBA8<false>, kDecodeRowGrouping, width, height,
+                      depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2SRGBA8ToSRGBA8(const ImageLoadContext &context,
@@ -2114,8 +2474,9 @@ void LoadETC2SRGBA8ToSRGBA8(const ImageLoadContext &context,
                             size_t outputRowPitch,
                             size_t outputDepthPitch)
 {
-    LoadETC2RGBA8ToRGBA8(context, width, height, depth, input, inputRowPitch, inputDepthPitch,
-                         output, outputRowPitch, outputDepthPitch, true);
+    ParallelLoadImage(context, LoadETC2RGBA8ToRGBA8<true>, kDecodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
@@ -2129,8 +2490,9 @@ void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
                         size_t outputRowPitch,
                         size_t outputDepthPitch)
 {
-    LoadETC2RGBA8ToBC3(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                       outputRowPitch, outputDepthPitch, false, false);
+    ParallelLoadImage(context, LoadETC2RGBA8ToBC3<false, false>, kTranscodeRowGrouping, width,
+                      height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadETC2SRGBA8ToBC3(const ImageLoadContext &context,
@@ -2144,74 +2506,9 @@ void LoadETC2SRGBA8ToBC3(const ImageLoadContext &context,
                          size_t outputRowPitch,
                          size_t outputDepthPitch)
 {
-    LoadETC2RGBA8ToBC3(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                       outputRowPitch, outputDepthPitch, false, false);
-}
-
-void LoadEACR11ToBC4(const ImageLoadContext &context,
-                     size_t width,
-                     size_t height,
-                     size_t depth,
-                     const uint8_t *input,
-                     size_t inputRowPitch,
-                     size_t inputDepthPitch,
-                     uint8_t *output,
-                     size_t outputRowPitch,
-                     size_t outputDepthPitch,
-                     bool isSigned)
-{
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
-
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceR11Block = sourceRow + (x / 4);
-                uint8_t *destR11Pixels          = destRow + (x * 2);
-                sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
-            }
-        }
-    }
-}
-
-void LoadEACRG11ToBC5(const ImageLoadContext &context,
-                      size_t width,
-                      size_t height,
-                      size_t depth,
-                      const uint8_t *input,
-                      size_t inputRowPitch,
-                      size_t inputDepthPitch,
-                      uint8_t *output,
-                      size_t outputRowPitch,
-                      size_t outputDepthPitch,
-                      bool isSigned)
-{
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
-
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceR11Block = sourceRow + (x / 2);
-                uint8_t *destR11Pixels          = destRow + (x * 4);
-
-                const ETC2Block *sourceG11Block = sourceR11Block + 1;
-                uint8_t *destG11Pixels          = destR11Pixels + 8;
-                sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
-                sourceG11Block->transcodeAsBC4(destG11Pixels, x, y, width, height, isSigned);
-            }
-        }
-    }
+    ParallelLoadImage(context, LoadETC2RGBA8ToBC3<false, false>, kTranscodeRowGrouping, width,
+                      height, depth, input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACR11ToBC4(const ImageLoadContext &context,
@@ -2225,8 +2522,9 @@ void LoadEACR11ToBC4(const ImageLoadContext &context,
                      size_t outputRowPitch,
                      size_t outputDepthPitch)
 {
-    LoadEACR11ToBC4(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                    outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadEACR11ToBC4<false>, kTranscodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACR11SToBC4(const ImageLoadContext &context,
@@ -2240,8 +2538,9 @@ void LoadEACR11SToBC4(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-    LoadEACR11ToBC4(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                    outputRowPitch, outputDepthPitch, true);
+    ParallelLoadImage(context, LoadEACR11ToBC4<true>, kTranscodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACRG11ToBC5(const ImageLoadContext &context,
@@ -2255,8 +2554,9 @@ void LoadEACRG11ToBC5(const ImageLoadContext &context,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-    LoadEACRG11ToBC5(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                     outputRowPitch, outputDepthPitch, false);
+    ParallelLoadImage(context, LoadEACRG11ToBC5<false>, kTranscodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 void LoadEACRG11SToBC5(const ImageLoadContext &context,
@@ -2270,8 +2570,9 @@ void LoadEACRG11SToBC5(const ImageLoadContext &context,
                        size_t outputRowPitch,
                        size_t outputDepthPitch)
 {
-    LoadEACRG11ToBC5(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
-                     outputRowPitch, outputDepthPitch, true);
+    ParallelLoadImage(context, LoadEACRG11ToBC5<true>, kTranscodeRowGrouping, width, height, depth,
+                      input, inputRowPitch, inputDepthPitch, output, outputRowPitch,
+                      outputDepthPitch);
 }
 
 }  // namespace angle
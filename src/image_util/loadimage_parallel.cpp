@@ -0,0 +1,171 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_parallel.cpp: Splits image load functions across worker threads.
+
+#include "image_util/loadimage.h"
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+
+#include "common/WorkerThread.h"
+
+namespace angle
+{
+namespace
+{
+// Images smaller than this many output bytes are loaded on the calling thread; below it, the
+// cost of waking workers exceeds the conversion itself.
+constexpr size_t kMinParallelLoadBytes = 1024 * 1024;
+
+// Each task is given at least this many output bytes of work.
+constexpr size_t kMinBytesPerTask = 256 * 1024;
+
+uint32_t MaxLoadTasks()
+{
+    static const uint32_t numTasks =
+        std::max(1u, std::min(16u, std::thread::hardware_concurrency()));
+    return numTasks;
+}
+
+struct LoadImageRegion
+{
+    size_t height;
+    size_t depth;
+    const uint8_t *input;
+    uint8_t *output;
+};
+
+class LoadImageTask final : public Closure
+{
+  public:
+    LoadImageTask(const ImageLoadContext &context,
+                  LoadImageFunction loadFunction,
+                  size_t width,
+                  const LoadImageRegion &region,
+                  size_t inputRowPitch,
+                  size_t inputDepthPitch,
+                  size_t outputRowPitch,
+                  size_t outputDepthPitch)
+        : mContext(context),
+          mLoadFunction(loadFunction),
+          mWidth(width),
+          mRegion(region),
+          mInputRowPitch(inputRowPitch),
+          mInputDepthPitch(inputDepthPitch),
+          mOutputRowPitch(outputRowPitch),
+          mOutputDepthPitch(outputDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        mLoadFunction(mContext, mWidth, mRegion.height, mRegion.depth, mRegion.input,
+                      mInputRowPitch, mInputDepthPitch, mRegion.output, mOutputRowPitch,
+                      mOutputDepthPitch);
+    }
+
+  private:
+    const ImageLoadContext &mContext;
+    LoadImageFunction mLoadFunction;
+    size_t mWidth;
+    LoadImageRegion mRegion;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+};
+}  // anonymous namespace
+
+void ParallelLoadImage(const ImageLoadContext &context,
+                       LoadImageFunction loadFunction,
+                       const LoadImageRowGrouping &rowGrouping,
+                       size_t width,
+                       size_t height,
+                       size_t depth,
+                       const uint8_t *input,
+                       size_t inputRowPitch,
+                       size_t inputDepthPitch,
+                       uint8_t *output,
+                       size_t outputRowPitch,
+                       size_t outputDepthPitch)
+{
+    const size_t outputRowGroupCount =
+        (height + rowGrouping.outputRowsPerPitch - 1) / rowGrouping.outputRowsPerPitch;
+    const size_t outputBytes = outputRowPitch * outputRowGroupCount * depth;
+
+    const std::shared_ptr<WorkerThreadPool> &pool = context.multiThreadPool;
+    const size_t maxTasks =
+        std::min<size_t>(MaxLoadTasks(), std::max<size_t>(1, outputBytes / kMinBytesPerTask));
+    if (!pool || !pool->isAsync() || outputBytes < kMinParallelLoadBytes || maxTasks < 2)
+    {
+        loadFunction(context, width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    // The tasks themselves must not try to parallelize further.
+    ImageLoadContext taskContext = context;
+    taskContext.multiThreadPool  = nullptr;
+
+    std::vector<LoadImageRegion> regions;
+    if (depth >= maxTasks)
+    {
+        // Array and 3D images: hand whole slices to each task.
+        const size_t slicesPerTask = (depth + maxTasks - 1) / maxTasks;
+        for (size_t z = 0; z < depth; z += slicesPerTask)
+        {
+            regions.push_back({height, std::min(slicesPerTask, depth - z),
+                               input + z * inputDepthPitch, output + z * outputDepthPitch});
+        }
+    }
+    else
+    {
+        // Split each slice into bands of rows that start on both input and output block
+        // boundaries.
+        const size_t rowAlignment =
+            std::lcm(rowGrouping.inputRowsPerPitch, rowGrouping.outputRowsPerPitch);
+        const size_t rowGroupCount = (height + rowAlignment - 1) / rowAlignment;
+        const size_t rowsPerTask   = ((rowGroupCount + maxTasks - 1) / maxTasks) * rowAlignment;
+        for (size_t y = 0; y < height; y += rowsPerTask)
+        {
+            regions.push_back(
+                {std::min(rowsPerTask, height - y), depth,
+                 input + (y / rowGrouping.inputRowsPerPitch) * inputRowPitch,
+                 output + (y / rowGrouping.outputRowsPerPitch) * outputRowPitch});
+        }
+    }
+
+    std::vector<std::shared_ptr<LoadImageTask>> tasks;
+    std::vector<std::shared_ptr<WaitableEvent>> waitEvents;
+    tasks.reserve(regions.size());
+    waitEvents.reserve(regions.size());
+
+    for (const LoadImageRegion &region : regions)
+    {
+        tasks.push_back(std::make_shared<LoadImageTask>(taskContext, loadFunction, width, region,
+                                                        inputRowPitch, inputDepthPitch,
+                                                        outputRowPitch, outputDepthPitch));
+    }
+
+    // Post all but the last task, and run the last one on this thread while waiting.
+    for (size_t taskIndex = 0; taskIndex + 1 < tasks.size(); ++taskIndex)
+    {
+        std::shared_ptr<WaitableEvent> waitEvent = pool->postWorkerTask(tasks[taskIndex]);
+        if (waitEvent)
+        {
+            waitEvents.push_back(std::move(waitEvent));
+        }
+        else
+        {
+            (*tasks[taskIndex])();
+        }
+    }
+    (*tasks.back())();
+
+    WaitableEvent::WaitMany(&waitEvents);
+}
+}  // namespace angle
@@ -0,0 +1,893 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_simd.cpp: Vectorized row converters for the most frequently used Load* functions.
+
+#include "image_util/loadimage_simd.h"
+
+#include <atomic>
+
+#include "common/debug.h"
+#include "common/simd_utils.h"
+
+namespace angle
+{
+namespace priv
+{
+namespace
+{
+std::atomic<LoadRowSIMDLevel> gMaxLoadRowSIMDLevel{LoadRowSIMDLevel::Vector256};
+
+// RGB16F -> RG11B10F works on the half float bits directly.  float11 and float10 have the same
+// exponent layout as float16, so every non-negative finite half converts by rounding its
+// mantissa to nearest even, clamping to the largest finite value.  Negative values become zero,
+// infinity stays infinity and NaNs keep their high mantissa bits, matching gl::float32ToFloat11
+// and gl::float32ToFloat10 applied to gl::float16ToFloat32.
+constexpr uint16_t kHalfInfinity    = 0x7C00;
+constexpr uint16_t kFloat11Infinity = 0x7C0;
+constexpr uint16_t kFloat11Max      = 0x7BF;
+constexpr uint16_t kFloat10Infinity = 0x3E0;
+constexpr uint16_t kFloat10Max      = 0x3DF;
+
+#if defined(ANGLE_SIMD_X86)
+ANGLE_SIMD_TARGET_SSE41 size_t LoadRowRGB8ToBGRX8SSE41(const void *source,
+                                                       void *dest,
+                                                       size_t width)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(source);
+    uint32_t *dst      = static_cast<uint32_t *>(dest);
+
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+    const __m128i alpha   = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+    // Each iteration reads 16 source bytes but only converts the first 12.
+    size_t x = 0;
+    for (; x + 6 <= width; x += 4)
+    {
+        __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 3 * x));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x),
+                         _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alpha));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_SSE41 size_t LoadRowRGBA8ToBGRA8SSE41(const void *source,
+                                                        void *dest,
+                                                        size_t width)
+{
+    const uint32_t *src = static_cast<const uint32_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), _mm_shuffle_epi8(rgba, shuffle));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_SSE41 size_t LoadRowLA8ToRGBA8SSE41(const void *source,
+                                                      void *dest,
+                                                      size_t width)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(source);
+    uint32_t *dst      = static_cast<uint32_t *>(dest);
+
+    const __m128i shuffleLo = _mm_setr_epi8(0, 0, 0, 1, 2, 2, 2, 3, 4, 4, 4, 5, 6, 6, 6, 7);
+    const __m128i shuffleHi =
+        _mm_setr_epi8(8, 8, 8, 9, 10, 10, 10, 11, 12, 12, 12, 13, 14, 14, 14, 15);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2 * x));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), _mm_shuffle_epi8(la, shuffleLo));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x + 4),
+                         _mm_shuffle_epi8(la, shuffleHi));
+    }
+    return x;
+}
+
+// Returns the RGBA4 pixels of |rgba| expanded to RGBA8 in |lo| (pixels 0-3) and |hi| (pixels 4-7).
+ANGLE_SIMD_TARGET_SSE41 void ExpandRGBA4SSE41(__m128i rgba, __m128i *lo, __m128i *hi)
+{
+    const __m128i nibbleMask = _mm_set1_epi16(0x0F0F);
+    const __m128i swapHalves =
+        _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+
+    // Per pixel, |br| holds the B and R nibbles and |ag| the A and G nibbles in separate bytes.
+    __m128i br = _mm_and_si128(_mm_srli_epi16(rgba, 4), nibbleMask);
+    __m128i ag = _mm_and_si128(rgba, nibbleMask);
+
+    // Interleaving gives B, A, R, G bytes per pixel; replicate each nibble and swap the halves.
+    __m128i bargLo = _mm_unpacklo_epi8(br, ag);
+    __m128i bargHi = _mm_unpackhi_epi8(br, ag);
+    bargLo         = _mm_or_si128(bargLo, _mm_slli_epi16(bargLo, 4));
+    bargHi         = _mm_or_si128(bargHi, _mm_slli_epi16(bargHi, 4));
+    *lo            = _mm_shuffle_epi8(bargLo, swapHalves);
+    *hi            = _mm_shuffle_epi8(bargHi, swapHalves);
+}
+
+ANGLE_SIMD_TARGET_SSE41 size_t LoadRowRGBA4ToRGBA8SSE41(const void *source,
+                                                        void *dest,
+                                                        size_t width)
+{
+    const uint16_t *src = static_cast<const uint16_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i lo, hi;
+        ExpandRGBA4SSE41(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x)), &lo, &hi);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x + 4), hi);
+    }
+    return x;
+}
+
+// Returns the RGB5A1 pixels of |rgba| expanded to RGBA8 in |lo| (pixels 0-3) and |hi| (pixels
+// 4-7).
+ANGLE_SIMD_TARGET_SSE41 void ExpandRGB5A1SSE41(__m128i rgba, __m128i *lo, __m128i *hi)
+{
+    const __m128i highBits = _mm_set1_epi16(0xF8);
+    const __m128i lowBits  = _mm_set1_epi16(0x07);
+    const __m128i one      = _mm_set1_epi16(1);
+    const __m128i byteMask = _mm_set1_epi16(0xFF);
+
+    __m128i r = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(rgba, 8), highBits),
+                             _mm_srli_epi16(rgba, 13));
+    __m128i g = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(rgba, 3), highBits),
+                             _mm_and_si128(_mm_srli_epi16(rgba, 8), lowBits));
+    __m128i b = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(rgba, 2), highBits),
+                             _mm_and_si128(_mm_srli_epi16(rgba, 3), lowBits));
+    __m128i a = _mm_and_si128(_mm_sub_epi16(_mm_setzero_si128(), _mm_and_si128(rgba, one)),
+                              byteMask);
+
+    __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+    __m128i ba = _mm_or_si128(b, _mm_slli_epi16(a, 8));
+    *lo        = _mm_unpacklo_epi16(rg, ba);
+    *hi        = _mm_unpackhi_epi16(rg, ba);
+}
+
+ANGLE_SIMD_TARGET_SSE41 size_t LoadRowRGB5A1ToRGBA8SSE41(const void *source,
+                                                         void *dest,
+                                                         size_t width)
+{
+    const uint16_t *src = static_cast<const uint16_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i lo, hi;
+        ExpandRGB5A1SSE41(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x)), &lo, &hi);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x + 4), hi);
+    }
+    return x;
+}
+
+// Converts eight halves to float11 (kMantissaDrop == 4) or float10 (kMantissaDrop == 5).
+template <int kMantissaDrop>
+ANGLE_SIMD_TARGET_SSE41 __m128i HalfToSmallFloatSSE41(__m128i half)
+{
+    constexpr uint16_t kInfinity     = kMantissaDrop == 4 ? kFloat11Infinity : kFloat10Infinity;
+    constexpr uint16_t kMax          = kMantissaDrop == 4 ? kFloat11Max : kFloat10Max;
+    constexpr uint16_t kMantissaMask = (1 << (10 - kMantissaDrop)) - 1;
+
+    const __m128i magnitude  = _mm_and_si128(half, _mm_set1_epi16(0x7FFF));
+    const __m128i isNegative = _mm_srai_epi16(half, 15);
+    const __m128i isNaN      = _mm_cmpgt_epi16(magnitude, _mm_set1_epi16(kHalfInfinity));
+    const __m128i isInfinity = _mm_cmpeq_epi16(magnitude, _mm_set1_epi16(kHalfInfinity));
+
+    // Round to nearest even: (m + (half ulp - 1) + lsb) >> drop.
+    __m128i lsb     = _mm_and_si128(_mm_srli_epi16(magnitude, kMantissaDrop), _mm_set1_epi16(1));
+    __m128i rounded = _mm_add_epi16(magnitude, _mm_set1_epi16((1 << (kMantissaDrop - 1)) - 1));
+    rounded         = _mm_srli_epi16(_mm_add_epi16(rounded, lsb), kMantissaDrop);
+    rounded         = _mm_min_epu16(rounded, _mm_set1_epi16(kMax));
+    rounded         = _mm_blendv_epi8(rounded, _mm_set1_epi16(kInfinity), isInfinity);
+    rounded         = _mm_andnot_si128(isNegative, rounded);
+
+    // NaN payload: the top mantissa bits, or'd with the mantissa shifted up by the NaN quirk of
+    // float32ToFloat11/10.
+    __m128i nanMantissa =
+        kMantissaDrop == 4
+            ? _mm_or_si128(_mm_srli_epi16(magnitude, 4), _mm_slli_epi16(magnitude, 2))
+            : _mm_or_si128(_mm_srli_epi16(magnitude, 5), magnitude);
+    __m128i nan = _mm_or_si128(_mm_and_si128(nanMantissa, _mm_set1_epi16(kMantissaMask)),
+                               _mm_set1_epi16(kInfinity));
+
+    return _mm_blendv_epi8(rounded, nan, isNaN);
+}
+
+ANGLE_SIMD_TARGET_SSE41 size_t LoadRowRGB16FToRG11B10FSSE41(const void *source,
+                                                            void *dest,
+                                                            size_t width)
+{
+    const uint16_t *src = static_cast<const uint16_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    // Shuffles that gather the R, G and B halves of eight pixels out of three registers, which
+    // hold halves 0-7, 8-15 and 16-23 respectively.
+    const __m128i r0 = _mm_setr_epi8(0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i r1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15, -1, -1, -1, -1);
+    const __m128i r2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, 10, 11);
+    const __m128i g0 = _mm_setr_epi8(2, 3, 8, 9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i g1 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 4, 5, 10, 11, -1, -1, -1, -1, -1, -1);
+    const __m128i g2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 6, 7, 12, 13);
+    const __m128i b0 = _mm_setr_epi8(4, 5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i b1 = _mm_setr_epi8(-1, -1, -1, -1, 0, 1, 6, 7, 12, 13, -1, -1, -1, -1, -1, -1);
+    const __m128i b2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, 8, 9, 14, 15);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        const __m128i *halves = reinterpret_cast<const __m128i *>(src + 3 * x);
+        __m128i in0           = _mm_loadu_si128(halves);
+        __m128i in1           = _mm_loadu_si128(halves + 1);
+        __m128i in2           = _mm_loadu_si128(halves + 2);
+
+        __m128i r = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(in0, r0), _mm_shuffle_epi8(in1, r1)),
+                                 _mm_shuffle_epi8(in2, r2));
+        __m128i g = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(in0, g0), _mm_shuffle_epi8(in1, g1)),
+                                 _mm_shuffle_epi8(in2, g2));
+        __m128i b = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(in0, b0), _mm_shuffle_epi8(in1, b1)),
+                                 _mm_shuffle_epi8(in2, b2));
+
+        r = HalfToSmallFloatSSE41<4>(r);
+        g = HalfToSmallFloatSSE41<4>(g);
+        b = HalfToSmallFloatSSE41<5>(b);
+
+        const __m128i zero = _mm_setzero_si128();
+        __m128i lo         = _mm_unpacklo_epi16(r, zero);
+        lo                 = _mm_or_si128(lo, _mm_slli_epi32(_mm_unpacklo_epi16(g, zero), 11));
+        lo                 = _mm_or_si128(lo, _mm_slli_epi32(_mm_unpacklo_epi16(b, zero), 22));
+        __m128i hi         = _mm_unpackhi_epi16(r, zero);
+        hi                 = _mm_or_si128(hi, _mm_slli_epi32(_mm_unpackhi_epi16(g, zero), 11));
+        hi                 = _mm_or_si128(hi, _mm_slli_epi32(_mm_unpackhi_epi16(b, zero), 22));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x + 4), hi);
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_SSE41 size_t LoadRowD24S8ToS8D24SSE41(const void *source,
+                                                        void *dest,
+                                                        size_t width)
+{
+    const uint32_t *src = static_cast<const uint32_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i ds = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x),
+                         _mm_or_si128(_mm_slli_epi32(ds, 24), _mm_srli_epi32(ds, 8)));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_SSE41 __m128 D24S8ToD32FSSE41(__m128i ds)
+{
+    // The 24-bit depth converts to float exactly, so the division rounds the same as the scalar
+    // path.
+    return _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(ds, 8)),
+                      _mm_set1_ps(static_cast<float>(0xFFFFFF)));
+}
+
+ANGLE_SIMD_TARGET_SSE41 size_t LoadRowD24S8ToD32FSSE41(const void *source,
+                                                       void *dest,
+                                                       size_t width)
+{
+    const uint32_t *src = static_cast<const uint32_t *>(source);
+    float *dst          = static_cast<float *>(dest);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i ds = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x));
+        _mm_storeu_ps(dst + x, D24S8ToD32FSSE41(ds));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_SSE41 size_t LoadRowD24S8ToD32FS8X24SSE41(const void *source,
+                                                            void *dest,
+                                                            size_t width)
+{
+    const uint32_t *src = static_cast<const uint32_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    const __m128i stencilMask = _mm_set1_epi32(0xFF);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i ds      = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + x));
+        __m128i depth   = _mm_castps_si128(D24S8ToD32FSSE41(ds));
+        __m128i stencil = _mm_and_si128(ds, stencilMask);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 2 * x),
+                         _mm_unpacklo_epi32(depth, stencil));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 2 * x + 4),
+                         _mm_unpackhi_epi32(depth, stencil));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_SSE41 size_t LoadRowX24S8ToS8SSE41(const void *source, void *dest, size_t width)
+{
+    const uint32_t *src = static_cast<const uint32_t *>(source);
+    uint8_t *dst        = static_cast<uint8_t *>(dest);
+
+    const __m128i stencilMask = _mm_set1_epi32(0xFF);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const __m128i *pixels = reinterpret_cast<const __m128i *>(src + x);
+        __m128i s0            = _mm_and_si128(_mm_loadu_si128(pixels), stencilMask);
+        __m128i s1            = _mm_and_si128(_mm_loadu_si128(pixels + 1), stencilMask);
+        __m128i s2            = _mm_and_si128(_mm_loadu_si128(pixels + 2), stencilMask);
+        __m128i s3            = _mm_and_si128(_mm_loadu_si128(pixels + 3), stencilMask);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + x),
+                         _mm_packus_epi16(_mm_packus_epi32(s0, s1), _mm_packus_epi32(s2, s3)));
+    }
+    return x;
+}
+
+// The AVX2 variants process two 128-bit lanes at a time.  Shuffles and unpacks work within each
+// lane, so results are put back in order with cross-lane permutes where needed.
+ANGLE_SIMD_TARGET_AVX2 size_t LoadRowRGB8ToBGRX8AVX2(const void *source, void *dest, size_t width)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(source);
+    uint32_t *dst      = static_cast<uint32_t *>(dest);
+
+    const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1,
+                                             2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+    const __m256i alpha   = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+
+    // Each lane reads 16 source bytes but only converts the first 12.
+    size_t x = 0;
+    for (; x + 10 <= width; x += 8)
+    {
+        __m128i lo  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 3 * x));
+        __m128i hi  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 3 * x + 12));
+        __m256i rgb = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x),
+                            _mm256_or_si256(_mm256_shuffle_epi8(rgb, shuffle), alpha));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2 size_t LoadRowRGBA8ToBGRA8AVX2(const void *source, void *dest, size_t width)
+{
+    const uint32_t *src = static_cast<const uint32_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    const __m256i shuffle =
+        _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5, 4,
+                         7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256i rgba = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + x));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x),
+                            _mm256_shuffle_epi8(rgba, shuffle));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2 size_t LoadRowLA8ToRGBA8AVX2(const void *source, void *dest, size_t width)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(source);
+    uint32_t *dst      = static_cast<uint32_t *>(dest);
+
+    // With the same eight pixels in both lanes, the low lane expands pixels 0-3 and the high lane
+    // pixels 4-7.
+    const __m256i shuffle =
+        _mm256_setr_epi8(0, 0, 0, 1, 2, 2, 2, 3, 4, 4, 4, 5, 6, 6, 6, 7, 8, 8, 8, 9, 10, 10, 10,
+                         11, 12, 12, 12, 13, 14, 14, 14, 15);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        __m128i la0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2 * x));
+        __m128i la1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2 * x + 16));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x),
+                            _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(la0), shuffle));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x + 8),
+                            _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(la1), shuffle));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2 size_t LoadRowRGBA4ToRGBA8AVX2(const void *source, void *dest, size_t width)
+{
+    const uint16_t *src = static_cast<const uint16_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    const __m256i nibbleMask = _mm256_set1_epi16(0x0F0F);
+    const __m256i swapHalves =
+        _mm256_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13, 2, 3, 0, 1, 6, 7, 4,
+                         5, 10, 11, 8, 9, 14, 15, 12, 13);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        __m256i rgba = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + x));
+        __m256i br   = _mm256_and_si256(_mm256_srli_epi16(rgba, 4), nibbleMask);
+        __m256i ag   = _mm256_and_si256(rgba, nibbleMask);
+
+        // Pixels 0-3 and 8-11 in |bargLo|, 4-7 and 12-15 in |bargHi|.
+        __m256i bargLo = _mm256_unpacklo_epi8(br, ag);
+        __m256i bargHi = _mm256_unpackhi_epi8(br, ag);
+        bargLo         = _mm256_or_si256(bargLo, _mm256_slli_epi16(bargLo, 4));
+        bargHi         = _mm256_or_si256(bargHi, _mm256_slli_epi16(bargHi, 4));
+        bargLo         = _mm256_shuffle_epi8(bargLo, swapHalves);
+        bargHi         = _mm256_shuffle_epi8(bargHi, swapHalves);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x),
+                            _mm256_permute2x128_si256(bargLo, bargHi, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x + 8),
+                            _mm256_permute2x128_si256(bargLo, bargHi, 0x31));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2 size_t LoadRowRGB5A1ToRGBA8AVX2(const void *source,
+                                                       void *dest,
+                                                       size_t width)
+{
+    const uint16_t *src = static_cast<const uint16_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    const __m256i highBits = _mm256_set1_epi16(0xF8);
+    const __m256i lowBits  = _mm256_set1_epi16(0x07);
+    const __m256i one      = _mm256_set1_epi16(1);
+    const __m256i byteMask = _mm256_set1_epi16(0xFF);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        __m256i rgba = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + x));
+
+        __m256i r = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(rgba, 8), highBits),
+                                    _mm256_srli_epi16(rgba, 13));
+        __m256i g = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(rgba, 3), highBits),
+                                    _mm256_and_si256(_mm256_srli_epi16(rgba, 8), lowBits));
+        __m256i b = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi16(rgba, 2), highBits),
+                                    _mm256_and_si256(_mm256_srli_epi16(rgba, 3), lowBits));
+        __m256i a = _mm256_and_si256(
+            _mm256_sub_epi16(_mm256_setzero_si256(), _mm256_and_si256(rgba, one)), byteMask);
+
+        __m256i rg = _mm256_or_si256(r, _mm256_slli_epi16(g, 8));
+        __m256i ba = _mm256_or_si256(b, _mm256_slli_epi16(a, 8));
+
+        // Pixels 0-3 and 8-11 in |lo|, 4-7 and 12-15 in |hi|.
+        __m256i lo = _mm256_unpacklo_epi16(rg, ba);
+        __m256i hi = _mm256_unpackhi_epi16(rg, ba);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x),
+                            _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x + 8),
+                            _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2 size_t LoadRowD24S8ToS8D24AVX2(const void *source, void *dest, size_t width)
+{
+    const uint32_t *src = static_cast<const uint32_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256i ds = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + x));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + x),
+                            _mm256_or_si256(_mm256_slli_epi32(ds, 24), _mm256_srli_epi32(ds, 8)));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2 __m256 D24S8ToD32FAVX2(__m256i ds)
+{
+    return _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(ds, 8)),
+                         _mm256_set1_ps(static_cast<float>(0xFFFFFF)));
+}
+
+ANGLE_SIMD_TARGET_AVX2 size_t LoadRowD24S8ToD32FAVX2(const void *source, void *dest, size_t width)
+{
+    const uint32_t *src = static_cast<const uint32_t *>(source);
+    float *dst          = static_cast<float *>(dest);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256i ds = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + x));
+        _mm256_storeu_ps(dst + x, D24S8ToD32FAVX2(ds));
+    }
+    return x;
+}
+
+ANGLE_SIMD_TARGET_AVX2 size_t LoadRowD24S8ToD32FS8X24AVX2(const void *source,
+                                                          void *dest,
+                                                          size_t width)
+{
+    const uint32_t *src = static_cast<const uint32_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    const __m256i stencilMask = _mm256_set1_epi32(0xFF);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256i ds      = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + x));
+        __m256i depth   = _mm256_castps_si256(D24S8ToD32FAVX2(ds));
+        __m256i stencil = _mm256_and_si256(ds, stencilMask);
+
+        // Pixels 0-1 and 4-5 in |lo|, 2-3 and 6-7 in |hi|.
+        __m256i lo = _mm256_unpacklo_epi32(depth, stencil);
+        __m256i hi = _mm256_unpackhi_epi32(depth, stencil);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 2 * x),
+                            _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + 2 * x + 8),
+                            _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    return x;
+}
+
+LoadRowFunction GetLoadRowFunctionSSE41(LoadRowConversion conversion)
+{
+    switch (conversion)
+    {
+        case LoadRowConversion::RGB8ToBGRX8:
+            return LoadRowRGB8ToBGRX8SSE41;
+        case LoadRowConversion::RGBA8ToBGRA8:
+            return LoadRowRGBA8ToBGRA8SSE41;
+        case LoadRowConversion::LA8ToRGBA8:
+            return LoadRowLA8ToRGBA8SSE41;
+        case LoadRowConversion::RGBA4ToRGBA8:
+            return LoadRowRGBA4ToRGBA8SSE41;
+        case LoadRowConversion::RGB5A1ToRGBA8:
+            return LoadRowRGB5A1ToRGBA8SSE41;
+        case LoadRowConversion::RGB16FToRG11B10F:
+            return LoadRowRGB16FToRG11B10FSSE41;
+        case LoadRowConversion::D24S8ToS8D24:
+            return LoadRowD24S8ToS8D24SSE41;
+        case LoadRowConversion::D24S8ToD32F:
+            return LoadRowD24S8ToD32FSSE41;
+        case LoadRowConversion::D24S8ToD32FS8X24:
+            return LoadRowD24S8ToD32FS8X24SSE41;
+        case LoadRowConversion::X24S8ToS8:
+            return LoadRowX24S8ToS8SSE41;
+        default:
+            UNREACHABLE();
+            return nullptr;
+    }
+}
+
+LoadRowFunction GetLoadRowFunctionAVX2(LoadRowConversion conversion)
+{
+    switch (conversion)
+    {
+        case LoadRowConversion::RGB8ToBGRX8:
+            return LoadRowRGB8ToBGRX8AVX2;
+        case LoadRowConversion::RGBA8ToBGRA8:
+            return LoadRowRGBA8ToBGRA8AVX2;
+        case LoadRowConversion::LA8ToRGBA8:
+            return LoadRowLA8ToRGBA8AVX2;
+        case LoadRowConversion::RGBA4ToRGBA8:
+            return LoadRowRGBA4ToRGBA8AVX2;
+        case LoadRowConversion::RGB5A1ToRGBA8:
+            return LoadRowRGB5A1ToRGBA8AVX2;
+        case LoadRowConversion::D24S8ToS8D24:
+            return LoadRowD24S8ToS8D24AVX2;
+        case LoadRowConversion::D24S8ToD32F:
+            return LoadRowD24S8ToD32FAVX2;
+        case LoadRowConversion::D24S8ToD32FS8X24:
+            return LoadRowD24S8ToD32FS8X24AVX2;
+        default:
+            // The three-channel half float deinterleave and the stencil narrowing do not gain
+            // from crossing lanes; the 128-bit versions are used instead.
+            return nullptr;
+    }
+}
+#endif  // defined(ANGLE_SIMD_X86)
+
+#if defined(ANGLE_SIMD_NEON)
+size_t LoadRowRGB8ToBGRX8NEON(const void *source, void *dest, size_t width)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(source);
+    uint8_t *dst       = static_cast<uint8_t *>(dest);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x3_t rgb = vld3q_u8(src + 3 * x);
+        uint8x16x4_t bgrx;
+        bgrx.val[0] = rgb.val[2];
+        bgrx.val[1] = rgb.val[1];
+        bgrx.val[2] = rgb.val[0];
+        bgrx.val[3] = vdupq_n_u8(0xFF);
+        vst4q_u8(dst + 4 * x, bgrx);
+    }
+    return x;
+}
+
+size_t LoadRowRGBA8ToBGRA8NEON(const void *source, void *dest, size_t width)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(source);
+    uint8_t *dst       = static_cast<uint8_t *>(dest);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x4_t rgba = vld4q_u8(src + 4 * x);
+        uint8x16_t r      = rgba.val[0];
+        rgba.val[0]       = rgba.val[2];
+        rgba.val[2]       = r;
+        vst4q_u8(dst + 4 * x, rgba);
+    }
+    return x;
+}
+
+size_t LoadRowLA8ToRGBA8NEON(const void *source, void *dest, size_t width)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(source);
+    uint8_t *dst       = static_cast<uint8_t *>(dest);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x2_t la = vld2q_u8(src + 2 * x);
+        uint8x16x4_t rgba;
+        rgba.val[0] = la.val[0];
+        rgba.val[1] = la.val[0];
+        rgba.val[2] = la.val[0];
+        rgba.val[3] = la.val[1];
+        vst4q_u8(dst + 4 * x, rgba);
+    }
+    return x;
+}
+
+size_t LoadRowRGBA4ToRGBA8NEON(const void *source, void *dest, size_t width)
+{
+    const uint16_t *src = static_cast<const uint16_t *>(source);
+    uint8_t *dst        = static_cast<uint8_t *>(dest);
+
+    const uint16x8_t nibbleMask = vdupq_n_u16(0xF);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        uint16x8_t rgba = vld1q_u16(src + x);
+        uint8x8x4_t out;
+        out.val[0] = vmovn_u16(vshrq_n_u16(rgba, 12));
+        out.val[1] = vmovn_u16(vandq_u16(vshrq_n_u16(rgba, 8), nibbleMask));
+        out.val[2] = vmovn_u16(vandq_u16(vshrq_n_u16(rgba, 4), nibbleMask));
+        out.val[3] = vmovn_u16(vandq_u16(rgba, nibbleMask));
+        for (uint8x8_t &channel : out.val)
+        {
+            channel = vorr_u8(channel, vshl_n_u8(channel, 4));
+        }
+        vst4_u8(dst + 4 * x, out);
+    }
+    return x;
+}
+
+size_t LoadRowRGB5A1ToRGBA8NEON(const void *source, void *dest, size_t width)
+{
+    const uint16_t *src = static_cast<const uint16_t *>(source);
+    uint8_t *dst        = static_cast<uint8_t *>(dest);
+
+    const uint16x8_t highBits = vdupq_n_u16(0xF8);
+    const uint16x8_t lowBits  = vdupq_n_u16(0x07);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        uint16x8_t rgba = vld1q_u16(src + x);
+        uint8x8x4_t out;
+        out.val[0] = vmovn_u16(
+            vorrq_u16(vandq_u16(vshrq_n_u16(rgba, 8), highBits), vshrq_n_u16(rgba, 13)));
+        out.val[1] = vmovn_u16(vorrq_u16(vandq_u16(vshrq_n_u16(rgba, 3), highBits),
+                                         vandq_u16(vshrq_n_u16(rgba, 8), lowBits)));
+        out.val[2] = vmovn_u16(vorrq_u16(vandq_u16(vshlq_n_u16(rgba, 2), highBits),
+                                         vandq_u16(vshrq_n_u16(rgba, 3), lowBits)));
+        out.val[3] = vmovn_u16(vtstq_u16(rgba, vdupq_n_u16(1)));
+        vst4_u8(dst + 4 * x, out);
+    }
+    return x;
+}
+
+// Converts eight halves to float11 (kMantissaDrop == 4) or float10 (kMantissaDrop == 5).
+template <int kMantissaDrop>
+uint16x8_t HalfToSmallFloatNEON(uint16x8_t half)
+{
+    constexpr uint16_t kInfinity     = kMantissaDrop == 4 ? kFloat11Infinity : kFloat10Infinity;
+    constexpr uint16_t kMax          = kMantissaDrop == 4 ? kFloat11Max : kFloat10Max;
+    constexpr uint16_t kMantissaMask = (1 << (10 - kMantissaDrop)) - 1;
+
+    const uint16x8_t magnitude  = vandq_u16(half, vdupq_n_u16(0x7FFF));
+    const uint16x8_t isNegative = vtstq_u16(half, vdupq_n_u16(0x8000));
+    const uint16x8_t isNaN      = vcgtq_u16(magnitude, vdupq_n_u16(kHalfInfinity));
+    const uint16x8_t isInfinity = vceqq_u16(magnitude, vdupq_n_u16(kHalfInfinity));
+
+    uint16x8_t lsb     = vandq_u16(vshrq_n_u16(magnitude, kMantissaDrop), vdupq_n_u16(1));
+    uint16x8_t rounded = vaddq_u16(magnitude, vdupq_n_u16((1 << (kMantissaDrop - 1)) - 1));
+    rounded            = vshrq_n_u16(vaddq_u16(rounded, lsb), kMantissaDrop);
+    rounded            = vminq_u16(rounded, vdupq_n_u16(kMax));
+    rounded            = vbslq_u16(isInfinity, vdupq_n_u16(kInfinity), rounded);
+    rounded            = vbicq_u16(rounded, isNegative);
+
+    uint16x8_t nanMantissa = kMantissaDrop == 4
+                                 ? vorrq_u16(vshrq_n_u16(magnitude, 4), vshlq_n_u16(magnitude, 2))
+                                 : vorrq_u16(vshrq_n_u16(magnitude, 5), magnitude);
+    uint16x8_t nan =
+        vorrq_u16(vandq_u16(nanMantissa, vdupq_n_u16(kMantissaMask)), vdupq_n_u16(kInfinity));
+
+    return vbslq_u16(isNaN, nan, rounded);
+}
+
+size_t LoadRowRGB16FToRG11B10FNEON(const void *source, void *dest, size_t width)
+{
+    const uint16_t *src = static_cast<const uint16_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        uint16x8x3_t rgb = vld3q_u16(src + 3 * x);
+        uint16x8_t r     = HalfToSmallFloatNEON<4>(rgb.val[0]);
+        uint16x8_t g     = HalfToSmallFloatNEON<4>(rgb.val[1]);
+        uint16x8_t b     = HalfToSmallFloatNEON<5>(rgb.val[2]);
+
+        uint32x4_t lo = vorrq_u32(vorrq_u32(vmovl_u16(vget_low_u16(r)),
+                                            vshll_n_u16(vget_low_u16(g), 11)),
+                                  vshlq_n_u32(vmovl_u16(vget_low_u16(b)), 22));
+        uint32x4_t hi = vorrq_u32(vorrq_u32(vmovl_u16(vget_high_u16(r)),
+                                            vshll_n_u16(vget_high_u16(g), 11)),
+                                  vshlq_n_u32(vmovl_u16(vget_high_u16(b)), 22));
+        vst1q_u32(dst + x, lo);
+        vst1q_u32(dst + x + 4, hi);
+    }
+    return x;
+}
+
+size_t LoadRowD24S8ToS8D24NEON(const void *source, void *dest, size_t width)
+{
+    const uint32_t *src = static_cast<const uint32_t *>(source);
+    uint32_t *dst       = static_cast<uint32_t *>(dest);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        uint32x4_t ds = vld1q_u32(src + x);
+        vst1q_u32(dst + x, vorrq_u32(vshlq_n_u32(ds, 24), vshrq_n_u32(ds, 8)));
+    }
+    return x;
+}
+
+size_t LoadRowX24S8ToS8NEON(const void *source, void *dest, size_t width)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(source);
+    uint8_t *dst       = static_cast<uint8_t *>(dest);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        // The stencil is the lowest byte of each little-endian pixel.
+        vst1q_u8(dst + x, vld4q_u8(src + 4 * x).val[0]);
+    }
+    return x;
+}
+
+LoadRowFunction GetLoadRowFunctionNEON(LoadRowConversion conversion)
+{
+    switch (conversion)
+    {
+        case LoadRowConversion::RGB8ToBGRX8:
+            return LoadRowRGB8ToBGRX8NEON;
+        case LoadRowConversion::RGBA8ToBGRA8:
+            return LoadRowRGBA8ToBGRA8NEON;
+        case LoadRowConversion::LA8ToRGBA8:
+            return LoadRowLA8ToRGBA8NEON;
+        case LoadRowConversion::RGBA4ToRGBA8:
+            return LoadRowRGBA4ToRGBA8NEON;
+        case LoadRowConversion::RGB5A1ToRGBA8:
+            return LoadRowRGB5A1ToRGBA8NEON;
+        case LoadRowConversion::RGB16FToRG11B10F:
+            return LoadRowRGB16FToRG11B10FNEON;
+        case LoadRowConversion::D24S8ToS8D24:
+            return LoadRowD24S8ToS8D24NEON;
+        case LoadRowConversion::X24S8ToS8:
+            return LoadRowX24S8ToS8NEON;
+        default:
+            // Single precision division is not available on all NEON targets, so the depth to
+            // float conversions stay scalar.
+            return nullptr;
+    }
+}
+#endif  // defined(ANGLE_SIMD_NEON)
+}  // anonymous namespace
+
+LoadRowFunction GetLoadRowFunctionAtLevel(LoadRowConversion conversion, LoadRowSIMDLevel level)
+{
+    switch (level)
+    {
+#if defined(ANGLE_SIMD_X86)
+        case LoadRowSIMDLevel::Vector128:
+            return SupportsSSE41() ? GetLoadRowFunctionSSE41(conversion) : nullptr;
+        case LoadRowSIMDLevel::Vector256:
+            return SupportsAVX2() ? GetLoadRowFunctionAVX2(conversion) : nullptr;
+#elif defined(ANGLE_SIMD_NEON)
+        case LoadRowSIMDLevel::Vector128:
+            return SupportsNEON() ? GetLoadRowFunctionNEON(conversion) : nullptr;
+#endif
+        default:
+            return nullptr;
+    }
+}
+
+LoadRowFunction GetLoadRowFunction(LoadRowConversion conversion)
+{
+    const LoadRowSIMDLevel maxLevel = gMaxLoadRowSIMDLevel.load(std::memory_order_relaxed);
+
+    if (maxLevel >= LoadRowSIMDLevel::Vector256)
+    {
+        if (LoadRowFunction function =
+                GetLoadRowFunctionAtLevel(conversion, LoadRowSIMDLevel::Vector256))
+        {
+            return function;
+        }
+    }
+    if (maxLevel >= LoadRowSIMDLevel::Vector128)
+    {
+        return GetLoadRowFunctionAtLevel(conversion, LoadRowSIMDLevel::Vector128);
+    }
+    return nullptr;
+}
+
+bool IsLoadRowSIMDLevelEnabled(LoadRowSIMDLevel level)
+{
+    if (level > gMaxLoadRowSIMDLevel.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    switch (level)
+    {
+        case LoadRowSIMDLevel::None:
+            return true;
+#if defined(ANGLE_SIMD_X86)
+        case LoadRowSIMDLevel::Vector128:
+            return SupportsSSE41();
+        case LoadRowSIMDLevel::Vector256:
+            return SupportsAVX2();
+#elif defined(ANGLE_SIMD_NEON)
+        case LoadRowSIMDLevel::Vector128:
+            return SupportsNEON();
+#endif
+        default:
+            return false;
+    }
+}
+
+void SetMaxLoadRowSIMDLevelForTesting(LoadRowSIMDLevel level)
+{
+    gMaxLoadRowSIMDLevel.store(level, std::memory_order_relaxed);
+}
+}  // namespace priv
+}  // namespace angle
@@ -0,0 +1,75 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_simd.h: Vectorized row converters for the most frequently used Load* functions.
+//
+// A Load* function fetches the row function for its conversion once per call, runs it on every
+// row and converts whatever pixels it left over with its own scalar loop.  The row functions
+// produce byte-identical output to the scalar loops.
+
+#ifndef IMAGEUTIL_LOADIMAGE_SIMD_H_
+#define IMAGEUTIL_LOADIMAGE_SIMD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace angle
+{
+namespace priv
+{
+// Converts a prefix of a row of |width| pixels from |source| to |dest| and returns the number of
+// pixels converted.  Never reads or writes past the end of the row.
+using LoadRowFunction = size_t (*)(const void *source, void *dest, size_t width);
+
+enum class LoadRowConversion : uint8_t
+{
+    RGB8ToBGRX8,
+    RGBA8ToBGRA8,
+    LA8ToRGBA8,
+    RGBA4ToRGBA8,
+    RGB5A1ToRGBA8,
+    RGB16FToRG11B10F,
+    D24S8ToS8D24,
+    D24S8ToD32F,
+    D24S8ToD32FS8X24,
+    X24S8ToS8,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+enum class LoadRowSIMDLevel : uint8_t
+{
+    None,
+    // SSE4.1 on x86, NEON on ARM.
+    Vector128,
+    // AVX2 on x86.
+    Vector256,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+// Returns the widest row function for |conversion| that the CPU supports, or nullptr if only the
+// scalar path is available.
+LoadRowFunction GetLoadRowFunction(LoadRowConversion conversion);
+
+// Returns the row function for |conversion| at exactly |level|, or nullptr if the CPU does not
+// support |level| or there is no implementation for it.
+LoadRowFunction GetLoadRowFunctionAtLevel(LoadRowConversion conversion, LoadRowSIMDLevel level);
+
+// Returns whether vector code at |level| may be used: the CPU supports it and it is not above the
+// cap set with SetMaxLoadRowSIMDLevelForTesting.  For loaders that vectorize whole blocks instead
+// of rows.
+bool IsLoadRowSIMDLevelEnabled(LoadRowSIMDLevel level);
+
+// Caps the level used by GetLoadRowFunction and IsLoadRowSIMDLevelEnabled, so tests can compare
+// the vector paths against the scalar ones.
+void SetMaxLoadRowSIMDLevelForTesting(LoadRowSIMDLevel level);
+}  // namespace priv
+}  // namespace angle
+
+#endif  // IMAGEUTIL_LOADIMAGE_SIMD_H_
@@ -16,11 +16,38 @@
 
 namespace egl
 {
+namespace
+{
+// Once this many compressAndPut tasks are in flight, further puts are compressed on the calling
+// thread, which bounds the memory held by uncompressed blobs.
+constexpr size_t kMaxPendingPuts = 32;
+}  // anonymous namespace
+
+class BlobCache::CompressAndPutTask final : public angle::Closure
+{
+  public:
+    CompressAndPutTask(BlobCache *blobCache,
+                       const BlobCache::Key &key,
+                       std::shared_ptr<PendingPut> pendingPut)
+        : mBlobCache(blobCache), mKey(key), mPendingPut(std::move(pendingPut))
+    {}
+
+    void operator()() override { mBlobCache->runPendingPut(mKey, mPendingPut); }
+
+  private:
+    BlobCache *mBlobCache;
+    BlobCache::Key mKey;
+    std::shared_ptr<PendingPut> mPendingPut;
+};
+
 BlobCache::BlobCache(size_t maxCacheSizeBytes)
     : mBlobCache(maxCacheSizeBytes), mSetBlobFunc(nullptr), mGetBlobFunc(nullptr)
 {}
 
-BlobCache::~BlobCache() {}
+BlobCache::~BlobCache()
+{
+    finishPendingPuts();
+}
 
 void BlobCache::put(const gl::Context *context,
                     const BlobCache::Key &key,
@@ -32,6 +59,7 @@ void BlobCache::put(const gl::Context *context,
     }
     else
     {
+        putDisk(key, value);
         populate(key, std::move(value), CacheSource::Memory);
     }
 }
@@ -41,8 +69,16 @@ bool BlobCache::compressAndPut(const gl::Context *context,
                                angle::MemoryBuffer &&uncompressedValue,
                                size_t *compressedSize)
 {
+    if (queueCompressAndPut(context, key, &uncompressedValue))
+    {
+        if (compressedSize != nullptr)
+            *compressedSize = 0;
+        return true;
+    }
+
     angle::MemoryBuffer compressedValue;
-    if (!angle::CompressBlob(uncompressedValue.size(), uncompressedValue.data(), &compressedValue))
+    if (!angle::CompressBlob(uncompressedValue.size(), uncompressedValue.data(), &compressedValue,
+                             getCompressionCodec()))
     {
         return false;
     }
@@ -52,6 +88,125 @@ bool BlobCache::compressAndPut(const gl::Context *context,
     return true;
 }
 
+bool BlobCache::queueCompressAndPut(const gl::Context *context,
+                                    const BlobCache::Key &key,
+                                    angle::MemoryBuffer *uncompressedValue)
+{
+    gl::BlobCacheCallbacks contextCallbacks;
+    if (context && context->areBlobCacheFuncsSet())
+    {
+        contextCallbacks = context->getState().getBlobCacheCallbacks();
+    }
+
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    if (!mCompressionPool)
+    {
+        return false;
+    }
+
+    auto iter = mPendingPuts.find(key);
+    if (iter != mPendingPuts.end())
+    {
+        // The task already queued for this key stores the newest value.
+        iter->second->uncompressedValue =
+            std::make_shared<angle::MemoryBuffer>(std::move(*uncompressedValue));
+        iter->second->contextCallbacks = contextCallbacks;
+        return true;
+    }
+
+    mPendingPutEvents.erase(
+        std::remove_if(mPendingPutEvents.begin(), mPendingPutEvents.end(),
+                       [](const std::shared_ptr<angle::WaitableEvent> &event) {
+                           return event->isReady();
+                       }),
+        mPendingPutEvents.end());
+    if (mPendingPutEvents.size() >= kMaxPendingPuts)
+    {
+        return false;
+    }
+
+    auto pendingPut = std::make_shared<PendingPut>();
+    pendingPut->uncompressedValue =
+        std::make_shared<angle::MemoryBuffer>(std::move(*uncompressedValue));
+    pendingPut->contextCallbacks = contextCallbacks;
+    mPendingPuts[key]            = pendingPut;
+
+    // The pool is async, so the task doesn't run on this thread while the lock is held.
+    mPendingPutEvents.push_back(mCompressionPool->postWorkerTask(
+        std::make_shared<CompressAndPutTask>(this, key, std::move(pendingPut))));
+    return true;
+}
+
+void BlobCache::runPendingPut(const BlobCache::Key &key,
+                              const std::shared_ptr<PendingPut> &pendingPut)
+{
+    std::shared_ptr<angle::MemoryBuffer> uncompressedValue;
+    angle::BlobCompressionCodec codec;
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        uncompressedValue = pendingPut->uncompressedValue;
+        codec             = mCompressionCodec;
+    }
+
+    while (true)
+    {
+        // Compress without holding the lock.  The buffer is never modified once queued; coalescing
+        // puts replace it instead.
+        angle::MemoryBuffer compressedValue;
+        const bool compressed = angle::CompressBlob(
+            uncompressedValue->size(), uncompressedValue->data(), &compressedValue, codec);
+
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        auto iter = mPendingPuts.find(key);
+        if (iter == mPendingPuts.end() || iter->second != pendingPut)
+        {
+            // Removed or cleared while compressing.
+            return;
+        }
+        if (pendingPut->uncompressedValue != uncompressedValue)
+        {
+            // A newer value was coalesced into this put while compressing.
+            uncompressedValue = pendingPut->uncompressedValue;
+            continue;
+        }
+
+        if (compressed)
+        {
+            putLocked(pendingPut->contextCallbacks, key, std::move(compressedValue));
+        }
+        else
+        {
+            WARN() << "Failed to compress binary blob for insertion into cache";
+        }
+        mPendingPuts.erase(iter);
+        return;
+    }
+}
+
+void BlobCache::putLocked(const gl::BlobCacheCallbacks &contextCallbacks,
+                          const BlobCache::Key &key,
+                          angle::MemoryBuffer &&value)
+{
+    if (contextCallbacks.setFunction != nullptr)
+    {
+        contextCallbacks.setFunction(key.data(), key.size(), value.data(), value.size(),
+                                     contextCallbacks.userParam);
+    }
+    else if (mSetBlobFunc != nullptr)
+    {
+        mSetBlobFunc(key.data(), key.size(), value.data(), value.size());
+    }
+    else
+    {
+        if (mDiskCache)
+        {
+            mDiskCache->put(key, value.data(), value.size());
+        }
+        const size_t valueSize = value.size();
+        mBlobCache.put(key, CacheEntry(std::move(value), CacheSource::Memory), valueSize);
+    }
+}
+
 void BlobCache::putApplication(const gl::Context *context,
                                const BlobCache::Key &key,
                                const angle::MemoryBuffer &value)
@@ -69,6 +224,19 @@ void BlobCache::putApplication(const gl::Context *context,
         std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
         mSetBlobFunc(key.data(), key.size(), value.data(), value.size());
     }
+    else
+    {
+        putDisk(key, value);
+    }
+}
+
+void BlobCache::putDisk(const BlobCache::Key &key, const angle::MemoryBuffer &value)
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    if (mDiskCache)
+    {
+        mDiskCache->put(key, value.data(), value.size());
+    }
 }
 
 void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
@@ -134,6 +302,11 @@ bool BlobCache::get(const gl::Context *context,
     {
         *valueOut = BlobCache::Value(entry->first.data(), entry->first.size());
     }
+    else if (mDiskCache && scratchBuffer != nullptr)
+    {
+        // The value is copied out, as the disk cache may remap its file on the next access.
+        result = mDiskCache->get(key, scratchBuffer, valueOut);
+    }
 
     return result;
 }
@@ -159,6 +332,26 @@ BlobCache::GetAndDecompressResult BlobCache::getAndDecompress(
 {
     ASSERT(uncompressedValueOut);
 
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        auto iter = mPendingPuts.find(key);
+        if (iter != mPendingPuts.end())
+        {
+            // Still queued for compression, answer from the uncompressed value.
+            const angle::MemoryBuffer &pendingValue = *iter->second->uncompressedValue;
+            if (pendingValue.size() > maxUncompressedDataSize ||
+                !uncompressedValueOut->resize(pendingValue.size()))
+            {
+                return GetAndDecompressResult::DecompressFailure;
+            }
+            if (!pendingValue.empty())
+            {
+                memcpy(uncompressedValueOut->data(), pendingValue.data(), pendingValue.size());
+            }
+            return GetAndDecompressResult::Success;
+        }
+    }
+
     Value compressedValue;
     if (!get(context, scratchBuffer, key, &compressedValue))
     {
@@ -183,6 +376,25 @@ void BlobCache::remove(const BlobCache::Key &key)
 {
     std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
     mBlobCache.eraseByKey(key);
+    mPendingPuts.erase(key);
+    if (mDiskCache)
+    {
+        mDiskCache->remove(key);
+    }
+}
+
+void BlobCache::clear()
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mBlobCache.clear();
+    mPendingPuts.clear();
+}
+
+void BlobCache::resize(size_t maxCacheSizeBytes)
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mBlobCache.resize(maxCacheSizeBytes);
+    mPendingPuts.clear();
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
@@ -203,7 +415,68 @@ bool BlobCache::areBlobCacheFuncsSet() const
 
 bool BlobCache::isCachingEnabled(const gl::Context *context) const
 {
-    return areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()) || maxSize() > 0;
+    return areBlobCacheFuncsSet() || (context && context->areBlobCacheFuncsSet()) ||
+           maxSize() > 0 || hasDiskCache();
+}
+
+void BlobCache::setDiskCache(std::unique_ptr<DiskBlobCache> diskCache)
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mDiskCache = std::move(diskCache);
+}
+
+bool BlobCache::hasDiskCache() const
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    return mDiskCache != nullptr;
+}
+
+void BlobCache::setAsyncCompressionPool(std::shared_ptr<angle::WorkerThreadPool> workerPool)
+{
+    // Tasks on a synchronous pool would run inside compressAndPut with the lock held.
+    if (workerPool && !workerPool->isAsync())
+    {
+        workerPool.reset();
+    }
+
+    if (!workerPool)
+    {
+        finishPendingPuts();
+    }
+
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mCompressionPool = std::move(workerPool);
+}
+
+bool BlobCache::isAsyncCompressionEnabled() const
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    return mCompressionPool != nullptr;
+}
+
+void BlobCache::setCompressionCodec(angle::BlobCompressionCodec codec)
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    mCompressionCodec = codec;
+}
+
+angle::BlobCompressionCodec BlobCache::getCompressionCodec() const
+{
+    std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+    return mCompressionCodec;
+}
+
+void BlobCache::finishPendingPuts()
+{
+    std::vector<std::shared_ptr<angle::WaitableEvent>> pendingPutEvents;
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        pendingPutEvents = std::move(mPendingPutEvents);
+        mPendingPutEvents.clear();
+    }
+
+    // The tasks take the lock to store their blobs.
+    angle::WaitableEvent::WaitMany(&pendingPutEvents);
 }
 
 size_t BlobCache::callBlobGetCallback(const gl::Context *context,
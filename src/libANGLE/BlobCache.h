@@ -14,6 +14,9 @@
 #include <cstring>
 
 #include "common/SimpleMutex.h"
+#include "common/WorkerThread.h"
+#include "common/hash_containers.h"
+#include "libANGLE/DiskBlobCache.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/angletypes.h"
@@ -60,13 +63,16 @@ class BlobCache final : angle::NonCopyable
     void put(const gl::Context *context, const BlobCache::Key &key, angle::MemoryBuffer &&value);
 
     // Store a key-blob pair in the cache, but compress the blob before insertion. Returns false if
-    // compression fails, returns true otherwise.
+    // compression fails, returns true otherwise.  With async compression enabled, the blob is
+    // usually queued to be compressed and stored on a worker thread, in which case true is returned
+    // and |compressedSize| is set to 0.
     bool compressAndPut(const gl::Context *context,
                         const BlobCache::Key &key,
                         angle::MemoryBuffer &&uncompressedValue,
                         size_t *compressedSize);
 
     // Store a key-blob pair in the application cache, only if application callbacks are set.
+    // Otherwise the blob goes to the disk cache, if there is one.
     void putApplication(const gl::Context *context,
                         const BlobCache::Key &key,
                         const angle::MemoryBuffer &value);
@@ -105,11 +111,11 @@ class BlobCache final : angle::NonCopyable
     // Evict a blob from the binary cache.
     void remove(const BlobCache::Key &key);
 
-    // Empty the cache.
-    void clear() { mBlobCache.clear(); }
+    // Empty the cache.  Blobs queued by compressAndPut are dropped.  The disk cache is kept.
+    void clear();
 
     // Resize the cache. Discards current contents.
-    void resize(size_t maxCacheSizeBytes) { mBlobCache.resize(maxCacheSizeBytes); }
+    void resize(size_t maxCacheSizeBytes);
 
     // Returns the number of entries in the cache.
     size_t entryCount() const { return mBlobCache.entryCount(); }
@@ -132,9 +138,49 @@ class BlobCache final : angle::NonCopyable
 
     bool isCachingEnabled(const gl::Context *context) const;
 
+    // Makes compressAndPut compress and store blobs on |workerPool| instead of on the calling
+    // thread.  Passing nullptr finishes the queued puts and goes back to synchronous puts.
+    void setAsyncCompressionPool(std::shared_ptr<angle::WorkerThreadPool> workerPool);
+    bool isAsyncCompressionEnabled() const;
+
+    // The codec compressAndPut compresses blobs with.  Blobs of either codec can be decompressed
+    // regardless of this setting.
+    void setCompressionCodec(angle::BlobCompressionCodec codec);
+    angle::BlobCompressionCodec getCompressionCodec() const;
+
+    // Waits until every blob queued by compressAndPut has been stored.  Must be called before the
+    // callbacks of a context that queued puts become invalid.
+    void finishPendingPuts();
+
+    // Makes the cache persist blobs in |diskCache| when the application doesn't provide blob
+    // cache callbacks.  Blobs missing from memory are looked up in it.
+    void setDiskCache(std::unique_ptr<DiskBlobCache> diskCache);
+    bool hasDiskCache() const;
+
     angle::SimpleMutex &getMutex() { return mBlobCacheMutex; }
 
   private:
+    class CompressAndPutTask;
+
+    // A blob queued by compressAndPut.  Puts of the same key coalesce into one, which keeps the
+    // newest value.  The uncompressed value is shared with the worker compressing it, so that a
+    // coalescing put can replace it while the worker is busy.
+    struct PendingPut
+    {
+        std::shared_ptr<angle::MemoryBuffer> uncompressedValue;
+        // Captured at put time, as the worker can't safely look at the context.
+        gl::BlobCacheCallbacks contextCallbacks;
+    };
+
+    bool queueCompressAndPut(const gl::Context *context,
+                             const BlobCache::Key &key,
+                             angle::MemoryBuffer *uncompressedValue);
+    void runPendingPut(const BlobCache::Key &key, const std::shared_ptr<PendingPut> &pendingPut);
+    void putLocked(const gl::BlobCacheCallbacks &contextCallbacks,
+                   const BlobCache::Key &key,
+                   angle::MemoryBuffer &&value);
+    void putDisk(const BlobCache::Key &key, const angle::MemoryBuffer &value);
+
     size_t callBlobGetCallback(const gl::Context *context,
                                const void *key,
                                size_t keySize,
@@ -149,6 +195,15 @@ class BlobCache final : angle::NonCopyable
 
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
+
+    // State of the async compression, protected by mBlobCacheMutex.
+    std::shared_ptr<angle::WorkerThreadPool> mCompressionPool;
+    angle::HashMap<BlobCache::Key, std::shared_ptr<PendingPut>> mPendingPuts;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mPendingPutEvents;
+
+    angle::BlobCompressionCodec mCompressionCodec = angle::BlobCompressionCodec::Zlib;
+
+    std::unique_ptr<DiskBlobCache> mDiskCache;
 };
 
 }  // namespace egl
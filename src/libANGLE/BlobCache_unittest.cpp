@@ -127,4 +127,73 @@ TEST(BlobCacheTest, OversizeValue)
     EXPECT_FALSE(blobCache.get(nullptr, nullptr, MakeKey(5), &qvalue));
 }
 
+void ExpectDecompressedBlob(BlobCache *blobCache, const Key &key, const BlobPut &expected)
+{
+    angle::MemoryBuffer value;
+    ASSERT_EQ(BlobCache::GetAndDecompressResult::Success,
+              blobCache->getAndDecompress(nullptr, nullptr, key, 1024, &value));
+    ASSERT_EQ(expected.size(), value.size());
+    EXPECT_EQ(0, memcmp(expected.data(), value.data(), value.size()));
+}
+
+// Tests that blobs queued for async compression can be read back before and after they are
+// stored.
+TEST(BlobCacheTest, AsyncCompressAndPut)
+{
+    constexpr size_t kSize = 4096;
+    BlobCache blobCache(kSize);
+
+    // Synchronous pools are ignored, in which case the puts are done inline.
+    std::shared_ptr<angle::WorkerThreadPool> pool =
+        angle::WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
+    blobCache.setAsyncCompressionPool(pool);
+    EXPECT_EQ(pool->isAsync(), blobCache.isAsyncCompressionEnabled());
+
+    for (uint8_t index = 0; index < 8; ++index)
+    {
+        EXPECT_TRUE(blobCache.compressAndPut(nullptr, MakeKey(index), MakeBlob(100, index),
+                                             nullptr));
+    }
+    for (uint8_t index = 0; index < 8; ++index)
+    {
+        ExpectDecompressedBlob(&blobCache, MakeKey(index), MakeBlob(100, index));
+    }
+
+    blobCache.finishPendingPuts();
+    EXPECT_EQ(8u, blobCache.entryCount());
+    for (uint8_t index = 0; index < 8; ++index)
+    {
+        ExpectDecompressedBlob(&blobCache, MakeKey(index), MakeBlob(100, index));
+    }
+
+    blobCache.setAsyncCompressionPool(nullptr);
+    EXPECT_FALSE(blobCache.isAsyncCompressionEnabled());
+}
+
+// Tests that async puts of the same key coalesce into the newest value, and that removed keys
+// don't come back once their puts finish.
+TEST(BlobCacheTest, AsyncCompressAndPutCoalesceAndRemove)
+{
+    constexpr size_t kSize = 4096;
+    BlobCache blobCache(kSize);
+    blobCache.setAsyncCompressionPool(angle::WorkerThreadPool::Create(0, ANGLEPlatformCurrent()));
+
+    for (uint8_t start = 0; start < 10; ++start)
+    {
+        EXPECT_TRUE(blobCache.compressAndPut(nullptr, MakeKey(0), MakeBlob(100, start), nullptr));
+    }
+    ExpectDecompressedBlob(&blobCache, MakeKey(0), MakeBlob(100, 9));
+
+    EXPECT_TRUE(blobCache.compressAndPut(nullptr, MakeKey(1), MakeBlob(100), nullptr));
+    blobCache.remove(MakeKey(1));
+
+    blobCache.finishPendingPuts();
+    EXPECT_EQ(1u, blobCache.entryCount());
+    ExpectDecompressedBlob(&blobCache, MakeKey(0), MakeBlob(100, 9));
+
+    angle::MemoryBuffer value;
+    EXPECT_EQ(BlobCache::GetAndDecompressResult::NotFound,
+              blobCache.getAndDecompress(nullptr, nullptr, MakeKey(1), 1024, &value));
+}
+
 }  // namespace egl
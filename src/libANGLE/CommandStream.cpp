@@ -0,0 +1,127 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CommandStream.cpp: Implements the CommandStream class.
+
+#include "libANGLE/CommandStream.h"
+
+#include "common/debug.h"
+#include "libANGLE/Context.h"
+
+namespace gl
+{
+CommandStream::CommandStream(Context *context)
+    : mContext(context),
+      mCommands(new Command[kCapacity]),
+      mWriteIndex(0),
+      mReadIndex(0),
+      mWorkerWaiting(false),
+      mProducerWaiting(false),
+      mExit(false)
+{
+    mWorker         = std::thread(&CommandStream::workerLoop, this);
+    mWorkerThreadId = mWorker.get_id();
+}
+
+CommandStream::~CommandStream()
+{
+    ASSERT(isRecordingThread());
+    finish();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExit = true;
+    }
+    mWorkAvailable.notify_one();
+    mWorker.join();
+
+    delete[] mCommands;
+}
+
+void CommandStream::finish()
+{
+    if (!isRecordingThread())
+    {
+        return;
+    }
+    waitForReadIndex(mWriteIndex.load(std::memory_order_relaxed));
+}
+
+void CommandStream::waitForReadIndex(size_t index)
+{
+    if (mReadIndex.load(std::memory_order_acquire) >= index)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mProducerWaiting.store(true, std::memory_order_seq_cst);
+    mWorkDone.wait(lock, [this, index] {
+        return mReadIndex.load(std::memory_order_seq_cst) >= index;
+    });
+    mProducerWaiting.store(false, std::memory_order_relaxed);
+}
+
+void CommandStream::notifyWorker()
+{
+    // Taking the lock makes sure the worker is either waiting or still about to check the write
+    // index.
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+    }
+    mWorkAvailable.notify_one();
+}
+
+void CommandStream::workerLoop()
+{
+    if (mContext != nullptr)
+    {
+        SetCurrentValidContext(mContext);
+    }
+
+    size_t readIndex = 0;
+    while (true)
+    {
+        const size_t writeIndex = mWriteIndex.load(std::memory_order_acquire);
+        if (readIndex == writeIndex)
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWorkerWaiting.store(true, std::memory_order_seq_cst);
+            mWorkAvailable.wait(lock, [this, readIndex] {
+                return mExit || mWriteIndex.load(std::memory_order_seq_cst) != readIndex;
+            });
+            mWorkerWaiting.store(false, std::memory_order_relaxed);
+            if (mExit && mWriteIndex.load(std::memory_order_relaxed) == readIndex)
+            {
+                break;
+            }
+            continue;
+        }
+
+        while (readIndex != writeIndex)
+        {
+            const Command &command = mCommands[readIndex % kCapacity];
+            command.execute(command.call);
+            readIndex += command.slotCount;
+        }
+
+        // The producer only waits for the whole batch, when the ring is full or to finish the
+        // stream.
+        mReadIndex.store(readIndex, std::memory_order_seq_cst);
+        if (mProducerWaiting.load(std::memory_order_seq_cst))
+        {
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+            }
+            mWorkDone.notify_one();
+        }
+    }
+
+    if (mContext != nullptr)
+    {
+        SetCurrentValidContext(nullptr);
+    }
+}
+}  // namespace gl
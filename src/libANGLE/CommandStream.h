@@ -0,0 +1,221 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CommandStream.h: Defines the CommandStream class, a ring of recorded GL calls that a worker
+// thread executes in order.  With the asyncCommandStream frontend feature, the entry points of a
+// few frequent calls that return nothing (draws, binds, uniform and buffer updates, ...) record
+// themselves in the stream of the current context instead of running.  The client memory they read
+// is copied into the stream.  The worker then calls the same entry points, which validate and
+// execute the calls as usual.  Every other entry point finishes the stream before doing anything,
+// so the calls are observed in order.
+//
+// The ring has a single producer, the thread the context is current on, and a single consumer,
+// the worker.  Neither takes a lock unless it has to wait for the other.
+
+#ifndef LIBANGLE_COMMANDSTREAM_H_
+#define LIBANGLE_COMMANDSTREAM_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+#include "common/angleutils.h"
+#include "common/mathutil.h"
+
+namespace gl
+{
+class Context;
+
+// Client memory read by a recorded call, |size| bytes at |pointer|.  It is copied when the call is
+// recorded, and the call is executed with a pointer to the copy.
+template <typename T>
+struct CommandStreamData
+{
+    const T *pointer;
+    size_t size;
+};
+
+template <typename T>
+ANGLE_INLINE CommandStreamData<T> MakeCommandStreamData(const T *pointer, size_t size)
+{
+    return {pointer, size};
+}
+
+class CommandStream final : angle::NonCopyable
+{
+  public:
+    // The worker makes |context| its current valid context, so that the recorded entry points find
+    // it.  |context| may be null if the recorded calls don't need one.
+    explicit CommandStream(Context *context);
+    ~CommandStream();
+
+    // Whether calls made on this thread should be recorded.  Calls made by the worker run.
+    bool isRecordingThread() const { return std::this_thread::get_id() != mWorkerThreadId; }
+
+    // Records a call to |entryPoint| with |args|, waiting for the worker if the ring is full.
+    // Returns false without recording anything if the call reads more client memory than
+    // kMaxDataSize.  Negative sizes given by the application convert to such sizes, so calls that
+    // are invalid because of them are not recorded either.
+    template <typename EntryPointT, typename... Args>
+    bool record(EntryPointT entryPoint, Args... args);
+
+    // Waits until the worker has executed every recorded call.  Does nothing on the worker.
+    void finish();
+
+  private:
+    static constexpr size_t kCommandSize = 64;
+    static constexpr size_t kCapacity    = 1024;
+    // The copied client memory follows the command in the ring, so it must leave room for other
+    // commands.
+    static constexpr size_t kMaxDataSize = kCapacity / 4 * kCommandSize;
+
+    // A recorded call, followed by the client memory it reads.  The command and the memory are
+    // contiguous, with a Skip command filling the end of the ring if they don't fit before it.
+    struct alignas(kCommandSize) Command
+    {
+        void (*execute)(const void *call);
+        uint32_t slotCount;
+        alignas(alignof(void *)) uint8_t call[kCommandSize - 2 * sizeof(void *)];
+    };
+
+    template <typename EntryPointT, typename... Args>
+    struct Call
+    {
+        static void Execute(const void *call)
+        {
+            const Call *self = static_cast<const Call *>(call);
+            std::apply([self](const Args &...args) { self->entryPoint(GetArg(args)...); },
+                       self->args);
+        }
+
+        EntryPointT entryPoint;
+        std::tuple<Args...> args;
+    };
+
+    static void Skip(const void *call) {}
+
+    template <typename T>
+    static T GetArg(T arg)
+    {
+        return arg;
+    }
+    template <typename T>
+    static const T *GetArg(const CommandStreamData<T> &data)
+    {
+        return data.pointer;
+    }
+
+    template <typename T>
+    static size_t GetDataSize(const T &arg)
+    {
+        return 0;
+    }
+    template <typename T>
+    static size_t GetDataSize(const CommandStreamData<T> &data)
+    {
+        // Sizes that would overflow when rounded up are too large to record anyway.
+        return data.pointer == nullptr ? 0 : std::min(data.size, kMaxDataSize + 1);
+    }
+
+    template <typename T>
+    static T CopyData(T arg, uint8_t **dataOut)
+    {
+        return arg;
+    }
+    template <typename T>
+    static CommandStreamData<T> CopyData(const CommandStreamData<T> &data, uint8_t **dataOut)
+    {
+        if (data.pointer == nullptr)
+        {
+            return data;
+        }
+        memcpy(*dataOut, data.pointer, data.size);
+        CommandStreamData<T> copy = {reinterpret_cast<const T *>(*dataOut), data.size};
+        *dataOut += rx::roundUpPow2(data.size, alignof(void *));
+        return copy;
+    }
+
+    void workerLoop();
+    // Waits until the worker has executed the call at |index| and the ones before it.
+    void waitForReadIndex(size_t index);
+    void notifyWorker();
+
+    Context *mContext;
+    Command *mCommands;
+
+    // Number of calls recorded and executed so far.  The ring holds the calls in between.
+    std::atomic<size_t> mWriteIndex;
+    std::atomic<size_t> mReadIndex;
+
+    // Set by a side before it sleeps, so that the other one knows to notify it.
+    std::atomic<bool> mWorkerWaiting;
+    std::atomic<bool> mProducerWaiting;
+    bool mExit;
+
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailable;
+    std::condition_variable mWorkDone;
+
+    std::thread mWorker;
+    std::thread::id mWorkerThreadId;
+};
+
+template <typename EntryPointT, typename... Args>
+ANGLE_INLINE bool CommandStream::record(EntryPointT entryPoint, Args... args)
+{
+    using CallT = Call<EntryPointT, Args...>;
+    static_assert(sizeof(CallT) <= sizeof(Command::call), "Call too large for the command stream");
+    // The calls are never destroyed; their slots are overwritten.
+    static_assert((std::is_trivially_copyable<Args>::value && ...) &&
+                      std::is_trivially_destructible<CallT>::value,
+                  "Only calls with trivial arguments can be recorded");
+
+    const size_t dataSize =
+        (size_t(0) + ... + rx::roundUpPow2(GetDataSize(args), alignof(void *)));
+    if (ANGLE_UNLIKELY(dataSize > kMaxDataSize))
+    {
+        return false;
+    }
+    const size_t slotCount = 1 + (dataSize + kCommandSize - 1) / kCommandSize;
+
+    size_t writeIndex            = mWriteIndex.load(std::memory_order_relaxed);
+    const size_t slotsBeforeWrap = kCapacity - writeIndex % kCapacity;
+    const size_t skipCount       = slotCount > slotsBeforeWrap ? slotsBeforeWrap : 0;
+    const size_t endIndex        = writeIndex + skipCount + slotCount;
+    if (ANGLE_UNLIKELY(endIndex - mReadIndex.load(std::memory_order_acquire) > kCapacity))
+    {
+        waitForReadIndex(endIndex - kCapacity);
+    }
+
+    if (ANGLE_UNLIKELY(skipCount > 0))
+    {
+        Command &skip  = mCommands[writeIndex % kCapacity];
+        skip.execute   = &Skip;
+        skip.slotCount = static_cast<uint32_t>(skipCount);
+        writeIndex += skipCount;
+    }
+
+    Command &command  = mCommands[writeIndex % kCapacity];
+    command.execute   = &CallT::Execute;
+    command.slotCount = static_cast<uint32_t>(slotCount);
+    uint8_t *data     = reinterpret_cast<uint8_t *>(&command + 1);
+    new (command.call) CallT{entryPoint, std::tuple<Args...>(CopyData(args, &data)...)};
+
+    mWriteIndex.store(endIndex, std::memory_order_seq_cst);
+    if (mWorkerWaiting.load(std::memory_order_seq_cst))
+    {
+        notifyWorker();
+    }
+    return true;
+}
+}  // namespace gl
+
+#endif  // LIBANGLE_COMMANDSTREAM_H_
@@ -0,0 +1,194 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CommandStream_unittest.cpp: Unit tests of the CommandStream class.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "libANGLE/CommandStream.h"
+
+namespace
+{
+std::vector<int> gCalls;
+std::thread::id gCallThreadId;
+
+void AppendCall(int value)
+{
+    gCalls.push_back(value);
+    gCallThreadId = std::this_thread::get_id();
+}
+
+void AppendSum(int a, int64_t b, const void *c, float d)
+{
+    gCalls.push_back(a + static_cast<int>(b) + static_cast<int>(reinterpret_cast<uintptr_t>(c)) +
+                     static_cast<int>(d));
+}
+
+void AppendValues(int count, const int *values)
+{
+    gCalls.insert(gCalls.end(), values, values + count);
+}
+
+gl::CommandStream *gStream;
+
+void RecordFromWorker(int value)
+{
+    // Calls made by the worker run instead of being recorded.
+    EXPECT_FALSE(gStream->isRecordingThread());
+    gStream->finish();
+    AppendCall(value);
+}
+
+// Tests that the recorded calls run in order on another thread, once the stream is finished.
+TEST(CommandStream, Order)
+{
+    gCalls.clear();
+    {
+        gl::CommandStream stream(nullptr);
+        EXPECT_TRUE(stream.isRecordingThread());
+
+        for (int i = 0; i < 10; ++i)
+        {
+            stream.record(AppendCall, i);
+        }
+        stream.record(AppendSum, 1, int64_t(2), reinterpret_cast<const void *>(3), 4.0f);
+        stream.finish();
+
+        ASSERT_EQ(gCalls.size(), 11u);
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_EQ(gCalls[i], i);
+        }
+        EXPECT_EQ(gCalls[10], 10);
+        EXPECT_NE(gCallThreadId, std::this_thread::get_id());
+    }
+}
+
+// Tests recording many more calls than fit in the ring, finishing the stream at various points.
+TEST(CommandStream, Wrap)
+{
+    gCalls.clear();
+    gl::CommandStream stream(nullptr);
+
+    constexpr int kCallCount = 100000;
+    for (int i = 0; i < kCallCount; ++i)
+    {
+        stream.record(AppendCall, i);
+        if (i % 7919 == 0)
+        {
+            stream.finish();
+            EXPECT_EQ(gCalls.size(), static_cast<size_t>(i + 1));
+        }
+    }
+    stream.finish();
+
+    ASSERT_EQ(gCalls.size(), static_cast<size_t>(kCallCount));
+    for (int i = 0; i < kCallCount; ++i)
+    {
+        ASSERT_EQ(gCalls[i], i);
+    }
+}
+
+// Tests that the calls recorded before the stream is destroyed run.
+TEST(CommandStream, Destroy)
+{
+    gCalls.clear();
+    {
+        gl::CommandStream stream(nullptr);
+        stream.record(AppendCall, 1);
+        stream.record(AppendCall, 2);
+    }
+    EXPECT_EQ(gCalls, std::vector<int>({1, 2}));
+}
+
+// Tests that the worker doesn't wait for itself.
+TEST(CommandStream, FinishOnWorker)
+{
+    gCalls.clear();
+    gl::CommandStream stream(nullptr);
+    gStream = &stream;
+    stream.record(RecordFromWorker, 5);
+    stream.finish();
+    gStream = nullptr;
+    EXPECT_EQ(gCalls, std::vector<int>({5}));
+}
+
+// Tests that the client memory read by the recorded calls is copied when they are recorded.
+TEST(CommandStream, Data)
+{
+    gCalls.clear();
+    gl::CommandStream stream(nullptr);
+
+    std::vector<int> values = {1, 2, 3};
+    EXPECT_TRUE(stream.record(AppendValues, 3,
+                              gl::MakeCommandStreamData(values.data(), 3 * sizeof(int))));
+    values = {4, 5, 6};
+    EXPECT_TRUE(stream.record(AppendValues, 3,
+                              gl::MakeCommandStreamData(values.data(), 3 * sizeof(int))));
+    values = {7, 8, 9};
+    stream.finish();
+
+    EXPECT_EQ(gCalls, std::vector<int>({1, 2, 3, 4, 5, 6}));
+}
+
+// Tests recording calls with client memory of various sizes, which don't always fit before the end
+// of the ring.
+TEST(CommandStream, DataWrap)
+{
+    gCalls.clear();
+    gl::CommandStream stream(nullptr);
+
+    std::vector<int> expected;
+    std::vector<int> values;
+    for (int i = 0; i < 5000; ++i)
+    {
+        const int count = (i * 37) % 1000;
+        values.resize(count);
+        for (int j = 0; j < count; ++j)
+        {
+            values[j] = i + j;
+        }
+        expected.insert(expected.end(), values.begin(), values.end());
+
+        ASSERT_TRUE(stream.record(AppendValues, count,
+                                  gl::MakeCommandStreamData(values.data(), count * sizeof(int))));
+        if (i % 997 == 0)
+        {
+            stream.finish();
+            EXPECT_EQ(gCalls.size(), expected.size());
+        }
+    }
+    stream.finish();
+
+    EXPECT_EQ(gCalls, expected);
+}
+
+// Tests that calls reading too much client memory, or a negative amount given by the application,
+// are not recorded.
+TEST(CommandStream, DataTooLarge)
+{
+    gCalls.clear();
+    gl::CommandStream stream(nullptr);
+
+    std::vector<int> values(1 << 20, 1);
+    const int largeCount = static_cast<int>(values.size());
+    EXPECT_FALSE(stream.record(AppendValues, largeCount,
+                               gl::MakeCommandStreamData(values.data(), largeCount * sizeof(int))));
+
+    const int negativeCount = -1;
+    EXPECT_FALSE(stream.record(
+        AppendValues, negativeCount,
+        gl::MakeCommandStreamData(values.data(), negativeCount * sizeof(int))));
+
+    // A null pointer is passed as is, whatever the size.
+    EXPECT_TRUE(stream.record(AppendValues, 0,
+                              gl::MakeCommandStreamData<int>(nullptr, largeCount * sizeof(int))));
+    stream.finish();
+
+    EXPECT_TRUE(gCalls.empty());
+}
+}  // anonymous namespace
@@ -8,6 +8,9 @@
 
 #include "libANGLE/Compiler.h"
 
+#include <cstring>
+
+#include "anglebase/no_destructor.h"
 #include "common/debug.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
@@ -21,8 +24,9 @@ namespace gl
 namespace
 {
 
-// To know when to call sh::Initialize and sh::Finalize.
-size_t gActiveCompilers = 0;
+constexpr size_t kMaxPoolSize = 32;
+// Configurations that are no longer used are dropped, oldest first.
+constexpr size_t kMaxSharedInstancePools = 8;
 
 }  // anonymous namespace
 
@@ -36,11 +40,7 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const State &state, egl::Disp
 
     {
         std::lock_guard<angle::SimpleMutex> lock(display->getDisplayGlobalMutex());
-        if (gActiveCompilers == 0)
-        {
-            sh::Initialize();
-        }
-        ++gActiveCompilers;
+        SharedCompilerInstances::Get()->onCompilerCreated();
     }
 
     const Caps &caps             = state.getCaps();
@@ -284,42 +284,35 @@ Compiler::~Compiler() = default;
 void Compiler::onDestroy(const Context *context)
 {
     std::lock_guard<angle::SimpleMutex> lock(context->getDisplay()->getDisplayGlobalMutex());
-    for (auto &pool : mPools)
-    {
-        for (ShCompilerInstance &instance : pool)
-        {
-            instance.destroy();
-        }
-    }
-    --gActiveCompilers;
-    if (gActiveCompilers == 0)
-    {
-        sh::Finalize();
-    }
+    SharedCompilerInstances::Get()->onCompilerDestroyed(mSpec, mOutputType, mResources, &mPools);
 }
 
 ShCompilerInstance Compiler::getInstance(ShaderType type)
 {
     ASSERT(type != ShaderType::InvalidEnum);
     auto &pool = mPools[type];
-    if (pool.empty())
-    {
-        ShHandle handle = sh::ConstructCompiler(ToGLenum(type), mSpec, mOutputType, &mResources);
-        ASSERT(handle);
-        return ShCompilerInstance(handle, mOutputType, type);
-    }
-    else
+    if (!pool.empty())
     {
         ShCompilerInstance instance = std::move(pool.back());
         pool.pop_back();
         return instance;
     }
+
+    ShCompilerInstance instance =
+        SharedCompilerInstances::Get()->getInstance(type, mSpec, mOutputType, mResources);
+    if (instance.getHandle() != nullptr)
+    {
+        return instance;
+    }
+
+    ShHandle handle = sh::ConstructCompiler(ToGLenum(type), mSpec, mOutputType, &mResources);
+    ASSERT(handle);
+    return ShCompilerInstance(handle, mOutputType, type);
 }
 
 void Compiler::putInstance(ShCompilerInstance &&instance)
 {
-    static constexpr size_t kMaxPoolSize = 32;
-    auto &pool                           = mPools[instance.getShaderType()];
+    auto &pool = mPools[instance.getShaderType()];
     if (pool.size() < kMaxPoolSize)
     {
         pool.push_back(std::move(instance));
@@ -418,4 +411,151 @@ ShShaderOutput ShCompilerInstance::getShaderOutputType() const
     return mOutputType;
 }
 
+SharedCompilerInstances::SharedCompilerInstances() : mActiveCompilers(0) {}
+
+SharedCompilerInstances::~SharedCompilerInstances()
+{
+    ASSERT(mPools.empty());
+}
+
+// static
+SharedCompilerInstances *SharedCompilerInstances::Get()
+{
+    static angle::base::NoDestructor<SharedCompilerInstances> sharedCompilerInstances;
+    return sharedCompilerInstances.get();
+}
+
+void SharedCompilerInstances::onCompilerCreated()
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    if (mActiveCompilers == 0)
+    {
+        sh::Initialize();
+    }
+    ++mActiveCompilers;
+}
+
+void SharedCompilerInstances::onCompilerDestroyed(
+    ShShaderSpec spec,
+    ShShaderOutput outputType,
+    const ShBuiltInResources &resources,
+    ShaderMap<std::vector<ShCompilerInstance>> *instances)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    ASSERT(mActiveCompilers > 0);
+    --mActiveCompilers;
+    if (mActiveCompilers == 0)
+    {
+        // No other compiler can use the instances, destroy them before sh::Finalize.
+        for (std::vector<ShCompilerInstance> &pool : *instances)
+        {
+            for (ShCompilerInstance &instance : pool)
+            {
+                instance.destroy();
+            }
+            pool.clear();
+        }
+        for (Pool &sharedPool : mPools)
+        {
+            for (ShCompilerInstance &instance : sharedPool.instances)
+            {
+                instance.destroy();
+            }
+        }
+        mPools.clear();
+        sh::Finalize();
+        return;
+    }
+
+    // Leave the instances to the next compiler with the same configuration.
+    for (ShaderType shaderType : AllShaderTypes())
+    {
+        std::vector<ShCompilerInstance> &pool = (*instances)[shaderType];
+        if (pool.empty())
+        {
+            continue;
+        }
+
+        Pool *sharedPool = findPool(shaderType, spec, outputType, resources);
+        if (sharedPool == nullptr)
+        {
+            if (mPools.size() >= kMaxSharedInstancePools)
+            {
+                for (ShCompilerInstance &instance : mPools.front().instances)
+                {
+                    instance.destroy();
+                }
+                mPools.pop_front();
+            }
+            mPools.push_back(
+                {shaderType, spec, outputType, resources, std::vector<ShCompilerInstance>()});
+            sharedPool = &mPools.back();
+        }
+
+        for (ShCompilerInstance &instance : pool)
+        {
+            if (sharedPool->instances.size() < kMaxPoolSize)
+            {
+                sharedPool->instances.push_back(std::move(instance));
+            }
+            else
+            {
+                instance.destroy();
+            }
+        }
+        pool.clear();
+    }
+}
+
+ShCompilerInstance SharedCompilerInstances::getInstance(ShaderType shaderType,
+                                                        ShShaderSpec spec,
+                                                        ShShaderOutput outputType,
+                                                        const ShBuiltInResources &resources)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    Pool *sharedPool = findPool(shaderType, spec, outputType, resources);
+    if (sharedPool == nullptr || sharedPool->instances.empty())
+    {
+        return ShCompilerInstance();
+    }
+
+    ShCompilerInstance instance = std::move(sharedPool->instances.back());
+    sharedPool->instances.pop_back();
+    return instance;
+}
+
+size_t SharedCompilerInstances::getInstanceCountForTesting() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    size_t count = 0;
+    for (const Pool &sharedPool : mPools)
+    {
+        count += sharedPool.instances.size();
+    }
+    return count;
+}
+
+SharedCompilerInstances::Pool *SharedCompilerInstances::findPool(
+    ShaderType shaderType,
+    ShShaderSpec spec,
+    ShShaderOutput outputType,
+    const ShBuiltInResources &resources)
+{
+    // The resources are zero-initialized by sh::InitBuiltInResources, so they can be compared
+    // with memcmp.
+    for (Pool &sharedPool : mPools)
+    {
+        if (sharedPool.shaderType == shaderType && sharedPool.spec == spec &&
+            sharedPool.outputType == outputType &&
+            memcmp(&sharedPool.resources, &resources, sizeof(resources)) == 0)
+        {
+            return &sharedPool;
+        }
+    }
+    return nullptr;
+}
+
 }  // namespace gl
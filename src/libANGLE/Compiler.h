@@ -10,10 +10,12 @@
 #ifndef LIBANGLE_COMPILER_H_
 #define LIBANGLE_COMPILER_H_
 
+#include <deque>
 #include <vector>
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/PackedEnums.h"
+#include "common/SimpleMutex.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/RefCountObject.h"
 
@@ -73,6 +75,56 @@ class ShCompilerInstance final : public angle::NonCopyable
     ShaderType mShaderType;
 };
 
+// Keeps the compiler instances left over by destroyed Compilers for the next Compiler with the
+// same configuration, and calls sh::Initialize and sh::Finalize when the first Compiler is created
+// and the last one is destroyed.  Constructing an instance builds its built-in symbol table, which
+// costs about as much as compiling a small shader, so without this every new context (or context
+// that re-creates its compiler, for example with glReleaseShaderCompiler) pays that cost again.
+class SharedCompilerInstances final : angle::NonCopyable
+{
+  public:
+    SharedCompilerInstances();
+    ~SharedCompilerInstances();
+
+    // The instances shared by all Compilers in the process.
+    static SharedCompilerInstances *Get();
+
+    void onCompilerCreated();
+    // Takes the instances of a destroyed Compiler.  When the last Compiler is destroyed, every
+    // instance is destroyed before sh::Finalize is called.
+    void onCompilerDestroyed(ShShaderSpec spec,
+                             ShShaderOutput outputType,
+                             const ShBuiltInResources &resources,
+                             ShaderMap<std::vector<ShCompilerInstance>> *instances);
+
+    // Returns an instance without a handle if none with this configuration is left over.
+    ShCompilerInstance getInstance(ShaderType shaderType,
+                                   ShShaderSpec spec,
+                                   ShShaderOutput outputType,
+                                   const ShBuiltInResources &resources);
+
+    size_t getInstanceCountForTesting() const;
+
+  private:
+    struct Pool
+    {
+        ShaderType shaderType;
+        ShShaderSpec spec;
+        ShShaderOutput outputType;
+        ShBuiltInResources resources;
+        std::vector<ShCompilerInstance> instances;
+    };
+
+    Pool *findPool(ShaderType shaderType,
+                   ShShaderSpec spec,
+                   ShShaderOutput outputType,
+                   const ShBuiltInResources &resources);
+
+    mutable angle::SimpleMutex mMutex;
+    size_t mActiveCompilers;
+    std::deque<Pool> mPools;
+};
+
 }  // namespace gl
 
 #endif  // LIBANGLE_COMPILER_H_
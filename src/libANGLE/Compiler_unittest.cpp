@@ -0,0 +1,136 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Compiler_unittest:
+//   Tests of the compiler instances that are shared between the Compilers of different contexts.
+//
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/Compiler.h"
+
+using namespace gl;
+
+namespace
+{
+constexpr char kFragmentShader[] = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(0, 1, 0, 1);
+})";
+
+class SharedCompilerInstancesTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        sh::InitBuiltInResources(&mResources);
+
+        // Stands for a context that outlives the tests, so destroying the Compiler of another
+        // context is not the last one.
+        mSharedInstances.onCompilerCreated();
+    }
+
+    void TearDown() override
+    {
+        ShaderMap<std::vector<ShCompilerInstance>> noInstances;
+        mSharedInstances.onCompilerDestroyed(kSpec, kOutputType, mResources, &noInstances);
+
+        // Destroying the last Compiler calls sh::Finalize, which the test environment expects to
+        // do itself.
+        sh::Initialize();
+    }
+
+    // Like the Compiler of a context that compiled one fragment shader, then got destroyed.
+    ShHandle compileAndDestroyCompiler(const ShBuiltInResources &resources)
+    {
+        mSharedInstances.onCompilerCreated();
+
+        ShCompilerInstance instance =
+            mSharedInstances.getInstance(ShaderType::Fragment, kSpec, kOutputType, resources);
+        if (instance.getHandle() == nullptr)
+        {
+            instance = ShCompilerInstance(
+                sh::ConstructCompiler(GL_FRAGMENT_SHADER, kSpec, kOutputType, &resources),
+                kOutputType, ShaderType::Fragment);
+        }
+        ShHandle handle = instance.getHandle();
+
+        const char *shaderStrings[] = {kFragmentShader};
+        EXPECT_TRUE(sh::Compile(handle, shaderStrings, 1, ShCompileOptions()));
+
+        ShaderMap<std::vector<ShCompilerInstance>> instances;
+        instances[ShaderType::Fragment].push_back(std::move(instance));
+        mSharedInstances.onCompilerDestroyed(kSpec, kOutputType, resources, &instances);
+        EXPECT_TRUE(instances[ShaderType::Fragment].empty());
+
+        return handle;
+    }
+
+    static constexpr ShShaderSpec kSpec         = SH_GLES2_SPEC;
+    static constexpr ShShaderOutput kOutputType = SH_ESSL_OUTPUT;
+
+    SharedCompilerInstances mSharedInstances;
+    ShBuiltInResources mResources;
+};
+
+// Tests that the compiler instance of a destroyed context is used by the next context with the same
+// resources.
+TEST_F(SharedCompilerInstancesTest, ReusedWithMatchingResources)
+{
+    ShHandle first = compileAndDestroyCompiler(mResources);
+    EXPECT_EQ(1u, mSharedInstances.getInstanceCountForTesting());
+
+    ShHandle second = compileAndDestroyCompiler(mResources);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1u, mSharedInstances.getInstanceCountForTesting());
+}
+
+// Tests that the compiler instance of a destroyed context is not used by a context with different
+// resources, here one more extension.
+TEST_F(SharedCompilerInstancesTest, NotReusedWithDifferentResources)
+{
+    ShHandle first = compileAndDestroyCompiler(mResources);
+
+    ShBuiltInResources resourcesWithExtension    = mResources;
+    resourcesWithExtension.OES_standard_derivatives = 1;
+    EXPECT_EQ(nullptr, mSharedInstances.getInstance(ShaderType::Fragment, kSpec, kOutputType,
+                                                    resourcesWithExtension)
+                           .getHandle());
+
+    ShHandle second = compileAndDestroyCompiler(resourcesWithExtension);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(2u, mSharedInstances.getInstanceCountForTesting());
+
+    // Each configuration keeps its own instance.
+    EXPECT_EQ(first, compileAndDestroyCompiler(mResources));
+    EXPECT_EQ(second, compileAndDestroyCompiler(resourcesWithExtension));
+}
+
+// Tests that destroying the last Compiler destroys the shared instances, which can't be used after
+// sh::Finalize.
+TEST_F(SharedCompilerInstancesTest, EmptiedByLastCompiler)
+{
+    compileAndDestroyCompiler(mResources);
+    EXPECT_EQ(1u, mSharedInstances.getInstanceCountForTesting());
+
+    // Destroy the last Compiler along with an instance of its own.
+    ShaderMap<std::vector<ShCompilerInstance>> instances;
+    instances[ShaderType::Fragment].emplace_back(
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, kSpec, kOutputType, &mResources), kOutputType,
+        ShaderType::Fragment);
+    mSharedInstances.onCompilerDestroyed(kSpec, kOutputType, mResources, &instances);
+
+    EXPECT_TRUE(instances[ShaderType::Fragment].empty());
+    EXPECT_EQ(0u, mSharedInstances.getInstanceCountForTesting());
+
+    // The next Compiler starts over with sh::Initialize and constructs a new instance.
+    mSharedInstances.onCompilerCreated();
+    EXPECT_EQ(nullptr,
+              mSharedInstances.getInstance(ShaderType::Fragment, kSpec, kOutputType, mResources)
+                  .getHandle());
+}
+
+}  // anonymous namespace
@@ -16,6 +16,7 @@
 #include <sstream>
 #include <vector>
 
+#include "common/FastVector.h"
 #include "common/PackedEnums.h"
 #include "common/angle_version_info.h"
 #include "common/hash_utils.h"
@@ -921,6 +922,9 @@ egl::Error Context::onDestroy(const egl::Display *display)
         return egl::NoError();
     }
 
+    // A context that is not current has already finished its command stream.
+    mCommandStream.reset();
+
     mState.ensureNoPendingLink(this);
 
     // eglDestoryContext() must have been called for this Context and there must not be any Threads
@@ -1023,6 +1027,18 @@ void Context::releaseSharedObjects()
 
 Context::~Context() {}
 
+void Context::finishCommandStream()
+{
+    mCommandStream->finish();
+
+    // If one of the calls lost the context, only the worker has stopped seeing it as the current
+    // valid context.
+    if (ANGLE_UNLIKELY(isContextLost()))
+    {
+        SetCurrentValidContext(nullptr);
+    }
+}
+
 void Context::setLabel(EGLLabelKHR label)
 {
     mLabel = label;
@@ -1060,6 +1076,14 @@ egl::Error Context::makeCurrent(egl::Display *display,
         ContextPrivateScissor(getMutablePrivateState(), getMutablePrivateStateCache(), 0, 0, width,
                               height);
 
+        // Client arrays are read when the calls execute, which would be after the entry points
+        // return.  Frame capture needs the calls to be validated as they are made.
+        if (getFrontendFeatures().asyncCommandStream.enabled && !mState.areClientArraysEnabled() &&
+            !getShareGroup()->getFrameCaptureShared()->enabled())
+        {
+            mCommandStream = std::make_unique<CommandStream>(this);
+        }
+
         mHasBeenCurrent = true;
     }
 
@@ -6985,8 +7009,14 @@ void Context::deleteBuffers(GLsizei n, const BufferID *buffers)
 {
     for (int i = 0; i < n; i++)
     {
-        deleteBuffer(buffers[i]);
+        Buffer *buffer = mState.mBufferManager->getBuffer(buffers[i]);
+        if (buffer)
+        {
+            detachBuffer(buffer);
+        }
     }
+
+    mState.mBufferManager->deleteObjects(this, n, buffers);
 }
 
 void Context::deleteFramebuffers(GLsizei n, const FramebufferID *framebuffers)
@@ -7032,10 +7062,7 @@ void Context::detachShader(ShaderProgramID program, ShaderProgramID shader)
 
 void Context::genBuffers(GLsizei n, BufferID *buffers)
 {
-    for (int i = 0; i < n; i++)
-    {
-        buffers[i] = createBuffer();
-    }
+    mState.mBufferManager->createBuffers(n, buffers);
 }
 
 void Context::genFramebuffers(GLsizei n, FramebufferID *framebuffers)
@@ -7623,16 +7650,18 @@ void Context::programBinary(ShaderProgramID program,
 
 void Context::genQueries(GLsizei n, QueryID *ids)
 {
+    static_assert(sizeof(QueryID) == sizeof(GLuint), "Types have different sizes");
+    mQueryHandleAllocator.allocate(n, reinterpret_cast<GLuint *>(ids));
     for (GLsizei i = 0; i < n; i++)
     {
-        QueryID handle = QueryID{mQueryHandleAllocator.allocate()};
-        mQueryMap.assign(handle, nullptr);
-        ids[i] = handle;
+        mQueryMap.assign(ids[i], nullptr);
     }
 }
 
 void Context::deleteQueries(GLsizei n, const QueryID *ids)
 {
+    angle::FastVector<GLuint, 16> releasedHandles;
+    angle::FastVector<Query *, 16> queryObjects;
     for (int i = 0; i < n; i++)
     {
         QueryID query = ids[i];
@@ -7640,13 +7669,21 @@ void Context::deleteQueries(GLsizei n, const QueryID *ids)
         Query *queryObject = nullptr;
         if (mQueryMap.erase(query, &queryObject))
         {
-            mQueryHandleAllocator.release(query.value);
+            releasedHandles.push_back(query.value);
             if (queryObject)
             {
-                queryObject->release(this);
+                queryObjects.push_back(queryObject);
             }
         }
     }
+
+    mQueryHandleAllocator.release(
+        angle::Span<const GLuint>(releasedHandles.data(), releasedHandles.size()));
+
+    for (Query *queryObject : queryObjects)
+    {
+        queryObject->release(this);
+    }
 }
 
 bool Context::isQueryGenerated(QueryID query) const
@@ -9858,6 +9895,8 @@ void Context::blobCacheCallbacks(GLSETBLOBPROCANGLE set,
                                  GLGETBLOBPROCANGLE get,
                                  const void *userParam)
 {
+    // Queued blob cache puts may call the previous callbacks.
+    mDisplay->getBlobCache().finishPendingPuts();
     mState.getBlobCacheCallbacks() = {set, get, userParam};
 }
 
@@ -21,6 +21,7 @@
 #include "common/SimpleMutex.h"
 #include "common/angleutils.h"
 #include "libANGLE/Caps.h"
+#include "libANGLE/CommandStream.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Context_gles_1_0_autogen.h"
 #include "libANGLE/Context_gles_2_0_autogen.h"
@@ -659,6 +660,18 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     angle::SimpleMutex &getProgramCacheMutex() const;
 
     bool hasBeenCurrent() const { return mHasBeenCurrent; }
+
+    // With the asyncCommandStream feature, the entry points in COMMAND_STREAM_CMDS of
+    // generate_entry_points.py record their calls in the command stream, and the others finish it
+    // before using the context.  See CommandStream.h.
+    bool hasCommandStream() const { return mCommandStream != nullptr; }
+    // Records a call to |entryPoint| and returns true, unless called by the worker of the stream,
+    // when the debug output must be synchronous or when the call reads too much client memory to
+    // copy it.  The call must then run now.
+    template <typename EntryPointT, typename... Args>
+    bool recordInCommandStream(EntryPointT entryPoint, Args... args);
+    void finishCommandStream();
+
     egl::Display *getDisplay() const { return mDisplay; }
     egl::Surface *getCurrentDrawSurface() const { return mCurrentDrawSurface; }
     egl::Surface *getCurrentReadSurface() const { return mCurrentReadSurface; }
@@ -1046,8 +1059,26 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool mIsDestroyed;
 
     std::unique_ptr<Framebuffer> mDefaultFramebuffer;
+
+    std::unique_ptr<CommandStream> mCommandStream;
 };
 
+template <typename EntryPointT, typename... Args>
+ANGLE_INLINE bool Context::recordInCommandStream(EntryPointT entryPoint, Args... args)
+{
+    if (!mCommandStream->isRecordingThread())
+    {
+        return false;
+    }
+    if (ANGLE_UNLIKELY(mState.getDebug().isOutputSynchronous()) ||
+        ANGLE_UNLIKELY(!mCommandStream->record(entryPoint, args...)))
+    {
+        finishCommandStream();
+        return false;
+    }
+    return true;
+}
+
 class [[nodiscard]] ScopedContextRef
 {
   public:
@@ -113,5 +113,68 @@ TEST_F(DecompressTest, CorruptedLastDWord)
     EXPECT_TRUE(checkUncompressedData());
 }
 
+class FastLZDecompressTest : public DecompressTest
+{
+  protected:
+    void SetUp() override
+    {
+        DecompressTest::SetUp();
+        ASSERT_TRUE(CompressBlob(mTestData.size(), mTestData.data(), &mCompressedData,
+                                 BlobCompressionCodec::FastLZ));
+    }
+};
+
+// Tests that decompressing full data has no errors.
+TEST_F(FastLZDecompressTest, FullData)
+{
+    EXPECT_TRUE(decompress(mCompressedData.size(), mTestData.size()));
+    EXPECT_TRUE(checkUncompressedData());
+}
+
+// Tests expected failure if |maxUncompressedDataSize| is less than actual uncompressed size.
+TEST_F(FastLZDecompressTest, InsufficientMaxUncompressedDataSize)
+{
+    EXPECT_FALSE(decompress(mCompressedData.size(), mTestData.size() - 1));
+}
+
+// Tests expected failure if try to decompress partial compressed data.
+TEST_F(FastLZDecompressTest, UnexpectedPartialData)
+{
+    constexpr size_t kMaxUncompressedDataSize = std::numeric_limits<size_t>::max();
+
+    EXPECT_FALSE(decompress(mCompressedData.size() - 1, kMaxUncompressedDataSize));
+    EXPECT_FALSE(decompress(8, kMaxUncompressedDataSize));
+}
+
+// Tests expected failure if try to decompress corrupted data, whether the corruption breaks the
+// compressed stream or only changes the decompressed bytes.
+TEST_F(FastLZDecompressTest, CorruptedData)
+{
+    for (size_t corruptIndex : {size_t(4), size_t(12), mCompressedData.size() / 2,
+                                mCompressedData.size() - 1})
+    {
+        mCompressedData[corruptIndex] ^= 1;
+        EXPECT_FALSE(decompress(mCompressedData.size(), mTestData.size())) << corruptIndex;
+        mCompressedData[corruptIndex] ^= 1;
+    }
+
+    EXPECT_TRUE(decompress(mCompressedData.size(), mTestData.size()));
+    EXPECT_TRUE(checkUncompressedData());
+}
+
+// Tests that FastLZ compresses the repetitive test data, and that zlib blobs still decompress
+// alongside FastLZ ones.
+TEST_F(FastLZDecompressTest, MixedCodecs)
+{
+    EXPECT_LT(mCompressedData.size(), mTestData.size() / 10);
+
+    MemoryBuffer zlibData;
+    ASSERT_TRUE(CompressBlob(mTestData.size(), mTestData.data(), &zlibData,
+                             BlobCompressionCodec::Zlib));
+    EXPECT_TRUE(DecompressBlob(zlibData.data(), zlibData.size(), mTestData.size(),
+                               &mUncompressedData));
+    EXPECT_TRUE(checkUncompressedData());
+}
+
 }  // anonymous namespace
 }  // namespace angle
@@ -0,0 +1,631 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskBlobCache.cpp: Implements the file-backed blob cache.
+
+#include "libANGLE/DiskBlobCache.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/system_utils.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
+namespace egl
+{
+namespace
+{
+constexpr char kLogFileName[] = "angle_blob_cache.bin";
+
+struct FileHeader
+{
+    uint8_t magic[8];
+    uint32_t version;
+    uint32_t reserved;
+};
+constexpr uint8_t kFileMagic[8] = {'A', 'N', 'G', 'L', 'E', 'B', 'L', 'B'};
+// Bump when the file or record layout changes.  Logs of other versions are discarded.
+constexpr uint32_t kFileVersion = 1;
+
+struct RecordHeader
+{
+    uint32_t magic;
+    uint32_t valueSize;
+    // Hash of the key and value, to detect torn or corrupted records.
+    uint64_t checksum;
+    uint8_t key[angle::kBlobCacheKeyLength];
+    uint32_t flags;
+};
+static_assert(sizeof(RecordHeader) == 40, "Record header layout is part of the file format");
+
+constexpr uint32_t kRecordMagic = 0x52434241;
+// A record without a value, which hides earlier records of the same key.
+constexpr uint32_t kRecordFlagRemoved = 1;
+
+constexpr uint64_t kChecksumSeed = 0x414E474C45424C42;
+
+uint64_t ChecksumRecord(const angle::BlobCacheKey &key, const uint8_t *value, size_t valueSize)
+{
+    const uint64_t keyHash = XXH64(key.data(), key.size(), kChecksumSeed);
+    return XXH64(value, valueSize, keyHash);
+}
+}  // anonymous namespace
+
+std::unique_ptr<DiskBlobCache> DiskBlobCache::OpenFromEnvironment()
+{
+    const std::string directory = angle::GetEnvironmentVar(kDiskBlobCacheDirectoryEnv);
+    if (directory.empty())
+    {
+        return nullptr;
+    }
+
+    size_t maxSize                  = kDefaultDiskBlobCacheMaxSize;
+    const std::string maxSizeString = angle::GetEnvironmentVar(kDiskBlobCacheMaxSizeEnv);
+    if (!maxSizeString.empty())
+    {
+        char *end                       = nullptr;
+        const unsigned long long parsed = strtoull(maxSizeString.c_str(), &end, 10);
+        if (*end == '\0' && parsed > 0)
+        {
+            maxSize = static_cast<size_t>(parsed);
+        }
+        else
+        {
+            WARN() << "Ignoring invalid " << kDiskBlobCacheMaxSizeEnv << ": " << maxSizeString;
+        }
+    }
+
+    return Open(directory, maxSize);
+}
+
+#if defined(ANGLE_PLATFORM_POSIX)
+
+namespace
+{
+bool LockFd(int fd, int operation)
+{
+    while (flock(fd, operation) != 0)
+    {
+        if (errno != EINTR)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WriteAll(int fd, const void *data, size_t size, off_t offset)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    while (size > 0)
+    {
+        const ssize_t written = pwrite(fd, bytes, size, offset);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (written <= 0)
+        {
+            return false;
+        }
+        bytes += written;
+        size -= written;
+        offset += written;
+    }
+    return true;
+}
+
+bool WriteRecord(int fd,
+                 off_t offset,
+                 const angle::BlobCacheKey &key,
+                 uint32_t flags,
+                 const uint8_t *value,
+                 uint32_t valueSize,
+                 uint64_t checksum)
+{
+    RecordHeader header;
+    header.magic     = kRecordMagic;
+    header.valueSize = valueSize;
+    header.checksum  = checksum;
+    memcpy(header.key, key.data(), key.size());
+    header.flags = flags;
+
+    return WriteAll(fd, &header, sizeof(header), offset) &&
+           WriteAll(fd, value, valueSize, offset + sizeof(header));
+}
+}  // anonymous namespace
+
+// static
+std::unique_ptr<DiskBlobCache> DiskBlobCache::Open(const std::string &directory,
+                                                   size_t maxSizeBytes)
+{
+    if (!angle::IsDirectory(directory.c_str()) && !angle::CreateDirectories(directory))
+    {
+        WARN() << "Failed to create the disk blob cache directory " << directory;
+        return nullptr;
+    }
+
+    std::unique_ptr<DiskBlobCache> cache(
+        new DiskBlobCache(angle::ConcatenatePath(directory, kLogFileName), maxSizeBytes));
+    if (!cache->openFile())
+    {
+        WARN() << "Failed to open the disk blob cache " << cache->getPath();
+        return nullptr;
+    }
+    return cache;
+}
+
+DiskBlobCache::DiskBlobCache(const std::string &path, size_t maxSizeBytes)
+    : mPath(path),
+      mMaxSize(maxSizeBytes),
+      mFd(-1),
+      mMapping(nullptr),
+      mMappedSize(0),
+      mScannedSize(0),
+      mUseSerial(0)
+{}
+
+DiskBlobCache::~DiskBlobCache()
+{
+    closeFile();
+}
+
+bool DiskBlobCache::openFile()
+{
+    ASSERT(mFd < 0);
+
+    // Another process may replace the log between opening and locking it.
+    while (true)
+    {
+        mFd = open(mPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (mFd < 0)
+        {
+            return false;
+        }
+        if (!LockFd(mFd, LOCK_EX))
+        {
+            closeFile();
+            return false;
+        }
+        if (isFileCurrent())
+        {
+            break;
+        }
+        closeFile();
+    }
+
+    mIndex.clear();
+    bool opened = mapFile();
+    if (opened && hasValidFileHeader())
+    {
+        mScannedSize = sizeof(FileHeader);
+        scanRecords();
+    }
+    else if (opened)
+    {
+        // A new file, or one written by an incompatible version.  Compacting the empty index
+        // replaces it with an empty log.
+        opened = compactLocked();
+    }
+
+    unlockFile();
+    if (!opened)
+    {
+        closeFile();
+    }
+    return opened;
+}
+
+void DiskBlobCache::closeFile()
+{
+    if (mMapping != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(mMapping), mMappedSize);
+    }
+    if (mFd >= 0)
+    {
+        close(mFd);
+    }
+    mFd          = -1;
+    mMapping     = nullptr;
+    mMappedSize  = 0;
+    mScannedSize = 0;
+}
+
+bool DiskBlobCache::refresh()
+{
+    if (mFd < 0 || !isFileCurrent())
+    {
+        closeFile();
+        return openFile();
+    }
+
+    // The writer that holds the exclusive lock may truncate the torn record of a process that died
+    // while appending.  Reading that record's header through the mapping after it's truncated
+    // would fault, so map and scan under the shared lock.
+    if (!LockFd(mFd, LOCK_SH))
+    {
+        return false;
+    }
+    const bool mapped = mapFile();
+    if (mapped)
+    {
+        scanRecords();
+    }
+    unlockFile();
+    return mapped;
+}
+
+bool DiskBlobCache::isFileCurrent() const
+{
+    struct stat pathStat, fdStat;
+    if (stat(mPath.c_str(), &pathStat) != 0 || fstat(mFd, &fdStat) != 0)
+    {
+        return false;
+    }
+    return pathStat.st_dev == fdStat.st_dev && pathStat.st_ino == fdStat.st_ino;
+}
+
+bool DiskBlobCache::mapFile()
+{
+    struct stat fdStat;
+    if (fstat(mFd, &fdStat) != 0)
+    {
+        return false;
+    }
+    const size_t fileSize = static_cast<size_t>(fdStat.st_size);
+    if (mMapping != nullptr && fileSize == mMappedSize)
+    {
+        return true;
+    }
+
+    if (mMapping != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(mMapping), mMappedSize);
+        mMapping    = nullptr;
+        mMappedSize = 0;
+    }
+    if (fileSize == 0)
+    {
+        mScannedSize = 0;
+        return true;
+    }
+
+    void *mapping = mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, mFd, 0);
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+    mMapping    = static_cast<const uint8_t *>(mapping);
+    mMappedSize = fileSize;
+
+    // Only this class shrinks the file, and never below the records it indexed.  Start over if
+    // something else did.
+    if (mScannedSize > mMappedSize)
+    {
+        mIndex.clear();
+        mScannedSize = hasValidFileHeader() ? sizeof(FileHeader) : mMappedSize;
+    }
+    return true;
+}
+
+bool DiskBlobCache::hasValidFileHeader() const
+{
+    if (mMappedSize < sizeof(FileHeader))
+    {
+        return false;
+    }
+    FileHeader header;
+    memcpy(&header, mMapping, sizeof(header));
+    return memcmp(header.magic, kFileMagic, sizeof(kFileMagic)) == 0 &&
+           header.version == kFileVersion;
+}
+
+void DiskBlobCache::scanRecords()
+{
+    // A record that doesn't fit is still being appended, or was torn by a crash.  Either way,
+    // scanning stops before it.
+    while (mMappedSize - mScannedSize >= sizeof(RecordHeader))
+    {
+        RecordHeader header;
+        memcpy(&header, mMapping + mScannedSize, sizeof(header));
+        if (header.magic != kRecordMagic ||
+            header.valueSize > mMappedSize - mScannedSize - sizeof(header))
+        {
+            break;
+        }
+
+        angle::BlobCacheKey key;
+        memcpy(key.data(), header.key, key.size());
+        if ((header.flags & kRecordFlagRemoved) != 0)
+        {
+            mIndex.erase(key);
+        }
+        else if (header.valueSize > 0)
+        {
+            mIndex[key] = {mScannedSize, header.valueSize, header.checksum, ++mUseSerial};
+        }
+
+        mScannedSize += sizeof(header) + header.valueSize;
+    }
+}
+
+bool DiskBlobCache::lockCurrentFile()
+{
+    while (true)
+    {
+        if (mFd < 0 && !openFile())
+        {
+            return false;
+        }
+        if (!LockFd(mFd, LOCK_EX))
+        {
+            return false;
+        }
+        if (isFileCurrent())
+        {
+            break;
+        }
+        unlockFile();
+        closeFile();
+    }
+
+    // Index what other processes appended, then drop the torn record of a process that died
+    // while appending, if any.  Nobody else is appending while the lock is held.
+    if (!mapFile())
+    {
+        unlockFile();
+        return false;
+    }
+    scanRecords();
+    if (mScannedSize < mMappedSize &&
+        (ftruncate(mFd, static_cast<off_t>(mScannedSize)) != 0 || !mapFile()))
+    {
+        unlockFile();
+        return false;
+    }
+    return true;
+}
+
+void DiskBlobCache::unlockFile()
+{
+    flock(mFd, LOCK_UN);
+}
+
+bool DiskBlobCache::appendRecordLocked(const angle::BlobCacheKey &key,
+                                       uint32_t flags,
+                                       const uint8_t *value,
+                                       uint32_t valueSize,
+                                       uint64_t checksum)
+{
+    const off_t offset = static_cast<off_t>(mScannedSize);
+    if (!WriteRecord(mFd, offset, key, flags, value, valueSize, checksum))
+    {
+        // Don't leave a partial record for the next append to be written after.
+        (void)ftruncate(mFd, offset);
+        return false;
+    }
+
+    if (!mapFile())
+    {
+        return false;
+    }
+    scanRecords();
+    return true;
+}
+
+bool DiskBlobCache::compactLocked()
+{
+    // Keep the most recently used records that fit in half of the size limit, so that compaction
+    // doesn't happen again soon.
+    std::vector<std::pair<angle::BlobCacheKey, IndexEntry>> entries(mIndex.begin(), mIndex.end());
+    std::sort(entries.begin(), entries.end(), [](const auto &first, const auto &second) {
+        return first.second.lastUse > second.second.lastUse;
+    });
+
+    const std::string tempPath = mPath + "." + std::to_string(getpid()) + ".tmp";
+    const int tempFd = open(tempPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (tempFd < 0)
+    {
+        return false;
+    }
+
+    // Processes that open the new log once it's renamed wait until this one is done with it.
+    FileHeader fileHeader;
+    memcpy(fileHeader.magic, kFileMagic, sizeof(kFileMagic));
+    fileHeader.version  = kFileVersion;
+    fileHeader.reserved = 0;
+    bool written =
+        LockFd(tempFd, LOCK_EX) && WriteAll(tempFd, &fileHeader, sizeof(fileHeader), 0);
+
+    angle::HashMap<angle::BlobCacheKey, IndexEntry> newIndex;
+    size_t newSize = sizeof(FileHeader);
+    for (const auto &keyAndEntry : entries)
+    {
+        if (!written)
+        {
+            break;
+        }
+
+        const angle::BlobCacheKey &key = keyAndEntry.first;
+        const IndexEntry &entry        = keyAndEntry.second;
+        const size_t recordSize        = sizeof(RecordHeader) + entry.valueSize;
+        const uint8_t *value           = mMapping + entry.offset + sizeof(RecordHeader);
+        if (newSize + recordSize > mMaxSize / 2 ||
+            ChecksumRecord(key, value, entry.valueSize) != entry.checksum)
+        {
+            continue;
+        }
+
+        written = WriteRecord(tempFd, static_cast<off_t>(newSize), key, 0, value, entry.valueSize,
+                              entry.checksum);
+        newIndex[key] = {newSize, entry.valueSize, entry.checksum, entry.lastUse};
+        newSize += recordSize;
+    }
+
+    written = written && fsync(tempFd) == 0 && rename(tempPath.c_str(), mPath.c_str()) == 0;
+    if (!written)
+    {
+        close(tempFd);
+        unlink(tempPath.c_str());
+        return false;
+    }
+
+    // Closing the old log releases its lock.  The new log is locked already.
+    closeFile();
+    mFd          = tempFd;
+    mIndex       = std::move(newIndex);
+    mScannedSize = newSize;
+    return mapFile();
+}
+
+bool DiskBlobCache::get(const angle::BlobCacheKey &key,
+                        angle::ScratchBuffer *scratchBuffer,
+                        angle::BlobCacheValue *valueOut)
+{
+    auto iter = mIndex.find(key);
+    if (iter == mIndex.end())
+    {
+        // Another process may have stored it since.
+        if (!refresh())
+        {
+            return false;
+        }
+        iter = mIndex.find(key);
+        if (iter == mIndex.end())
+        {
+            return false;
+        }
+    }
+
+    IndexEntry &entry = iter->second;
+    angle::MemoryBuffer *scratchMemory;
+    if (!scratchBuffer->get(entry.valueSize, &scratchMemory))
+    {
+        ERR() << "Failed to allocate memory for binary blob";
+        return false;
+    }
+    memcpy(scratchMemory->data(), mMapping + entry.offset + sizeof(RecordHeader), entry.valueSize);
+
+    // Verify the copy, as the file is shared with other processes.
+    if (ChecksumRecord(key, scratchMemory->data(), entry.valueSize) != entry.checksum)
+    {
+        WARN() << "Dropping corrupted record from the disk blob cache";
+        mIndex.erase(iter);
+        return false;
+    }
+
+    entry.lastUse = ++mUseSerial;
+    *valueOut     = angle::BlobCacheValue(scratchMemory->data(), entry.valueSize);
+    return true;
+}
+
+void DiskBlobCache::put(const angle::BlobCacheKey &key, const uint8_t *value, size_t valueSize)
+{
+    if (valueSize == 0 || sizeof(RecordHeader) + valueSize > mMaxSize / 2)
+    {
+        return;
+    }
+
+    const uint64_t checksum = ChecksumRecord(key, value, valueSize);
+
+    // Processes that link the same programs often race to store the same blobs.
+    auto isStored = [&]() {
+        auto iter = mIndex.find(key);
+        if (iter == mIndex.end() || iter->second.valueSize != valueSize ||
+            iter->second.checksum != checksum)
+        {
+            return false;
+        }
+        iter->second.lastUse = ++mUseSerial;
+        return true;
+    };
+
+    if (isStored() || !lockCurrentFile())
+    {
+        return;
+    }
+
+    if (!isStored())
+    {
+        const size_t recordSize = sizeof(RecordHeader) + valueSize;
+        if (mScannedSize + recordSize <= mMaxSize || compactLocked())
+        {
+            (void)appendRecordLocked(key, 0, value, static_cast<uint32_t>(valueSize), checksum);
+        }
+    }
+
+    unlockFile();
+}
+
+void DiskBlobCache::remove(const angle::BlobCacheKey &key)
+{
+    if (mIndex.count(key) == 0 || !lockCurrentFile())
+    {
+        return;
+    }
+
+    if (mIndex.erase(key) > 0)
+    {
+        // Compaction leaves the removed record out, otherwise a tombstone hides it.
+        if (mScannedSize + sizeof(RecordHeader) <= mMaxSize)
+        {
+            (void)appendRecordLocked(key, kRecordFlagRemoved, nullptr, 0, 0);
+        }
+        else
+        {
+            (void)compactLocked();
+        }
+    }
+
+    unlockFile();
+}
+
+#else  // defined(ANGLE_PLATFORM_POSIX)
+
+// static
+std::unique_ptr<DiskBlobCache> DiskBlobCache::Open(const std::string &directory,
+                                                   size_t maxSizeBytes)
+{
+    WARN() << "The disk blob cache is not supported on this platform";
+    return nullptr;
+}
+
+DiskBlobCache::DiskBlobCache(const std::string &path, size_t maxSizeBytes)
+    : mPath(path),
+      mMaxSize(maxSizeBytes),
+      mFd(-1),
+      mMapping(nullptr),
+      mMappedSize(0),
+      mScannedSize(0),
+      mUseSerial(0)
+{}
+
+DiskBlobCache::~DiskBlobCache() = default;
+
+bool DiskBlobCache::get(const angle::BlobCacheKey &key,
+                        angle::ScratchBuffer *scratchBuffer,
+                        angle::BlobCacheValue *valueOut)
+{
+    return false;
+}
+
+void DiskBlobCache::put(const angle::BlobCacheKey &key, const uint8_t *value, size_t valueSize) {}
+
+void DiskBlobCache::remove(const angle::BlobCacheKey &key) {}
+
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+}  // namespace egl
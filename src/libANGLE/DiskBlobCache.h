@@ -0,0 +1,118 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskBlobCache: A file-backed store for BlobCache, so that compiled programs and pipeline caches
+//   persist across processes when the application doesn't provide EGL_ANDROID_blob_cache
+//   callbacks.
+//
+//   The cache is a single append-only log of key-value records.  It is memory-mapped read-only and
+//   indexed in memory by scanning the record headers, so lookups don't read the file.  Appends
+//   are serialized across processes with an exclusive file lock, and records written by other
+//   processes are picked up on lookup misses, scanning under a shared file lock.  When the log grows past its size limit, the most
+//   recently used records are copied into a new file that atomically replaces the log.
+//
+
+#ifndef LIBANGLE_DISK_BLOB_CACHE_H_
+#define LIBANGLE_DISK_BLOB_CACHE_H_
+
+#include <memory>
+#include <string>
+
+#include "common/MemoryBuffer.h"
+#include "common/hash_containers.h"
+#include "libANGLE/angletypes.h"
+
+namespace egl
+{
+// The environment variable that enables the disk cache, naming the directory to keep it in.
+constexpr char kDiskBlobCacheDirectoryEnv[] = "ANGLE_DISK_BLOB_CACHE_DIR";
+// Optionally overrides kDefaultDiskBlobCacheMaxSize, in bytes.
+constexpr char kDiskBlobCacheMaxSizeEnv[] = "ANGLE_DISK_BLOB_CACHE_MAX_SIZE";
+
+constexpr size_t kDefaultDiskBlobCacheMaxSize = 64 * 1024 * 1024;
+
+// Not thread-safe.  BlobCache serializes access to it.
+class DiskBlobCache final : angle::NonCopyable
+{
+  public:
+    // Opens or creates the cache in |directory|.  Returns nullptr if the cache can't be used, for
+    // example on platforms without file locking or memory-mapped files.
+    static std::unique_ptr<DiskBlobCache> Open(const std::string &directory, size_t maxSizeBytes);
+
+    // Opens the cache as configured by kDiskBlobCacheDirectoryEnv and kDiskBlobCacheMaxSizeEnv.
+    // Returns nullptr if the environment doesn't enable it.
+    static std::unique_ptr<DiskBlobCache> OpenFromEnvironment();
+
+    ~DiskBlobCache();
+
+    // Copies the value of |key| into |scratchBuffer| and points |valueOut| to it.  Returns false if
+    // it's not in the cache or the record is corrupt.
+    [[nodiscard]] bool get(const angle::BlobCacheKey &key,
+                           angle::ScratchBuffer *scratchBuffer,
+                           angle::BlobCacheValue *valueOut);
+
+    // Appends a record, unless the same key-value pair is already in the cache.
+    void put(const angle::BlobCacheKey &key, const uint8_t *value, size_t valueSize);
+
+    // Appends a record that hides earlier values of |key|.
+    void remove(const angle::BlobCacheKey &key);
+
+    // Returns the size of the log in bytes.
+    size_t size() const { return mMappedSize; }
+
+    size_t maxSize() const { return mMaxSize; }
+
+    const std::string &getPath() const { return mPath; }
+
+  private:
+    struct IndexEntry
+    {
+        // Offset of the record header in the log.
+        size_t offset;
+        uint32_t valueSize;
+        uint64_t checksum;
+        // Orders entries by their last use in this process, for compaction.
+        uint64_t lastUse;
+    };
+
+    DiskBlobCache(const std::string &path, size_t maxSizeBytes);
+
+    bool openFile();
+    void closeFile();
+    // Picks up records appended by other processes, and switches to the new log if another
+    // process compacted it.
+    bool refresh();
+    bool isFileCurrent() const;
+    bool mapFile();
+    bool hasValidFileHeader() const;
+    void scanRecords();
+
+    // Takes the file lock, reopening the log first if another process replaced it.
+    bool lockCurrentFile();
+    void unlockFile();
+
+    bool appendRecordLocked(const angle::BlobCacheKey &key,
+                            uint32_t flags,
+                            const uint8_t *value,
+                            uint32_t valueSize,
+                            uint64_t checksum);
+    // Replaces the log with a new one holding the most recently used records.
+    bool compactLocked();
+
+    std::string mPath;
+    size_t mMaxSize;
+
+    int mFd;
+    const uint8_t *mMapping;
+    size_t mMappedSize;
+    // End of the last complete record found in the log.
+    size_t mScannedSize;
+
+    angle::HashMap<angle::BlobCacheKey, IndexEntry> mIndex;
+    uint64_t mUseSerial;
+};
+}  // namespace egl
+
+#endif  // LIBANGLE_DISK_BLOB_CACHE_H_
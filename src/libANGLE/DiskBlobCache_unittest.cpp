@@ -0,0 +1,335 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DiskBlobCache_unittest.cpp: Unit tests for the file-backed blob cache.  Separate instances on the
+// same directory stand in for separate processes.
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <thread>
+
+#include "common/system_utils.h"
+#include "libANGLE/BlobCache.h"
+#include "libANGLE/DiskBlobCache.h"
+
+#if defined(ANGLE_PLATFORM_POSIX)
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
+namespace egl
+{
+namespace
+{
+constexpr size_t kMaxSize = 1024 * 1024;
+
+angle::BlobCacheKey MakeKey(uint8_t seed)
+{
+    angle::BlobCacheKey key;
+    for (size_t index = 0; index < key.size(); ++index)
+    {
+        key[index] = static_cast<uint8_t>(seed + index);
+    }
+    return key;
+}
+
+std::vector<uint8_t> MakeValue(size_t size, uint8_t seed)
+{
+    std::vector<uint8_t> value(size);
+    for (size_t index = 0; index < size; ++index)
+    {
+        value[index] = static_cast<uint8_t>(seed * 7 + index);
+    }
+    return value;
+}
+
+class DiskBlobCacheTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Use the unique name of a temporary file for the cache directory.
+        Optional<std::string> tempPath = angle::CreateTemporaryFile();
+        ASSERT_TRUE(tempPath.valid());
+        mDirectory = tempPath.value();
+        ASSERT_EQ(0, remove(mDirectory.c_str()));
+
+        std::unique_ptr<DiskBlobCache> cache = open();
+        if (!cache)
+        {
+            GTEST_SKIP() << "The disk blob cache is not supported on this platform";
+        }
+        mLogPath = cache->getPath();
+    }
+
+    void TearDown() override
+    {
+        remove(mLogPath.c_str());
+        remove(mDirectory.c_str());
+    }
+
+    std::unique_ptr<DiskBlobCache> open(size_t maxSize = kMaxSize)
+    {
+        return DiskBlobCache::Open(mDirectory, maxSize);
+    }
+
+    void put(DiskBlobCache *cache, uint8_t seed, size_t size)
+    {
+        const std::vector<uint8_t> value = MakeValue(size, seed);
+        cache->put(MakeKey(seed), value.data(), value.size());
+    }
+
+    bool hasValue(DiskBlobCache *cache, uint8_t seed, size_t size)
+    {
+        angle::BlobCacheValue value;
+        if (!cache->get(MakeKey(seed), &mScratchBuffer, &value))
+        {
+            return false;
+        }
+        const std::vector<uint8_t> expected = MakeValue(size, seed);
+        return value.size() == expected.size() &&
+               memcmp(value.data(), expected.data(), expected.size()) == 0;
+    }
+
+    // Modifies the log behind the caches' back.
+    void writeLog(long offset, const std::vector<uint8_t> &bytes)
+    {
+        FILE *file = fopen(mLogPath.c_str(), "r+b");
+        ASSERT_NE(nullptr, file);
+        ASSERT_EQ(0, fseek(file, offset, offset < 0 ? SEEK_END : SEEK_SET));
+        ASSERT_EQ(bytes.size(), fwrite(bytes.data(), 1, bytes.size(), file));
+        fclose(file);
+    }
+
+    std::string mDirectory;
+    std::string mLogPath;
+    angle::ScratchBuffer mScratchBuffer;
+};
+
+// Tests that blobs are visible to other instances, including ones opened before the put, and
+// persist after closing.
+TEST_F(DiskBlobCacheTest, PersistsAcrossInstances)
+{
+    std::unique_ptr<DiskBlobCache> first  = open();
+    std::unique_ptr<DiskBlobCache> second = open();
+    ASSERT_TRUE(first && second);
+
+    put(first.get(), 1, 1000);
+    put(second.get(), 2, 3000);
+
+    EXPECT_TRUE(hasValue(first.get(), 2, 3000));
+    EXPECT_TRUE(hasValue(second.get(), 1, 1000));
+    EXPECT_FALSE(hasValue(first.get(), 3, 1000));
+
+    first.reset();
+    second.reset();
+
+    std::unique_ptr<DiskBlobCache> reopened = open();
+    ASSERT_TRUE(reopened);
+    EXPECT_TRUE(hasValue(reopened.get(), 1, 1000));
+    EXPECT_TRUE(hasValue(reopened.get(), 2, 3000));
+}
+
+// Tests that storing a blob that is already stored, by any instance, doesn't grow the log, while
+// storing a new value does.
+TEST_F(DiskBlobCacheTest, DuplicatePuts)
+{
+    std::unique_ptr<DiskBlobCache> first  = open();
+    std::unique_ptr<DiskBlobCache> second = open();
+    ASSERT_TRUE(first && second);
+
+    put(first.get(), 1, 1000);
+    const size_t size = first->size();
+    put(first.get(), 1, 1000);
+    put(second.get(), 1, 1000);
+    EXPECT_EQ(size, first->size());
+    EXPECT_EQ(size, second->size());
+
+    put(second.get(), 1, 500);
+    EXPECT_GT(second->size(), size);
+    EXPECT_TRUE(hasValue(second.get(), 1, 500));
+}
+
+// Tests that removed blobs are gone for new instances too.
+TEST_F(DiskBlobCacheTest, Remove)
+{
+    std::unique_ptr<DiskBlobCache> cache = open();
+    ASSERT_TRUE(cache);
+
+    put(cache.get(), 1, 1000);
+    put(cache.get(), 2, 1000);
+    cache->remove(MakeKey(1));
+    EXPECT_FALSE(hasValue(cache.get(), 1, 1000));
+    EXPECT_TRUE(hasValue(cache.get(), 2, 1000));
+
+    std::unique_ptr<DiskBlobCache> reopened = open();
+    ASSERT_TRUE(reopened);
+    EXPECT_FALSE(hasValue(reopened.get(), 1, 1000));
+    EXPECT_TRUE(hasValue(reopened.get(), 2, 1000));
+}
+
+// Tests that a torn record left by a crashed process is ignored and then overwritten.
+TEST_F(DiskBlobCacheTest, TornRecord)
+{
+    std::unique_ptr<DiskBlobCache> cache = open();
+    ASSERT_TRUE(cache);
+    put(cache.get(), 1, 1000);
+    cache.reset();
+
+    // A record header that claims more bytes than the file has.
+    std::vector<uint8_t> torn = {0x41, 0x42, 0x43, 0x52, 0xFF, 0xFF, 0x00, 0x00, 1, 2, 3};
+    {
+        std::ofstream log(mLogPath, std::ios::binary | std::ios::app);
+        log.write(reinterpret_cast<const char *>(torn.data()), torn.size());
+    }
+
+    cache = open();
+    ASSERT_TRUE(cache);
+    EXPECT_TRUE(hasValue(cache.get(), 1, 1000));
+    put(cache.get(), 2, 1000);
+
+    std::unique_ptr<DiskBlobCache> reopened = open();
+    ASSERT_TRUE(reopened);
+    EXPECT_TRUE(hasValue(reopened.get(), 1, 1000));
+    EXPECT_TRUE(hasValue(reopened.get(), 2, 1000));
+}
+
+#if defined(ANGLE_PLATFORM_POSIX)
+// Tests that a lookup miss doesn't scan the log while another process holds the file lock, which it
+// may be using to truncate the torn record of a crashed process.
+TEST_F(DiskBlobCacheTest, LookupWaitsForWriter)
+{
+    std::unique_ptr<DiskBlobCache> cache = open();
+    ASSERT_TRUE(cache);
+    put(cache.get(), 1, 1000);
+
+    // Stand in for a process that found a torn record at the end of the log.
+    const int writerFd = ::open(mLogPath.c_str(), O_RDWR | O_CLOEXEC);
+    ASSERT_GE(writerFd, 0);
+    ASSERT_EQ(0, flock(writerFd, LOCK_EX));
+    struct stat logStat;
+    ASSERT_EQ(0, fstat(writerFd, &logStat));
+    const std::vector<uint8_t> torn(2 * 4096 + sizeof(uint32_t), 0);
+    ASSERT_EQ(static_cast<ssize_t>(torn.size()),
+              pwrite(writerFd, torn.data(), torn.size(), logStat.st_size));
+
+    std::atomic<bool> lookedUp(false);
+    std::thread reader([&]() {
+        EXPECT_FALSE(hasValue(cache.get(), 2, 1000));
+        lookedUp = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(lookedUp);
+
+    ASSERT_EQ(0, ftruncate(writerFd, logStat.st_size));
+    flock(writerFd, LOCK_UN);
+    close(writerFd);
+    reader.join();
+    EXPECT_TRUE(lookedUp);
+
+    EXPECT_TRUE(hasValue(cache.get(), 1, 1000));
+    put(cache.get(), 2, 1000);
+    EXPECT_TRUE(hasValue(cache.get(), 2, 1000));
+}
+#endif  // defined(ANGLE_PLATFORM_POSIX)
+
+// Tests that corrupted values are not returned.
+TEST_F(DiskBlobCacheTest, CorruptedValue)
+{
+    std::unique_ptr<DiskBlobCache> cache = open();
+    ASSERT_TRUE(cache);
+    put(cache.get(), 1, 1000);
+    put(cache.get(), 2, 1000);
+
+    // Corrupt the last byte of the second value.
+    writeLog(-1, {0xAA});
+
+    EXPECT_TRUE(hasValue(cache.get(), 1, 1000));
+    EXPECT_FALSE(hasValue(cache.get(), 2, 1000));
+}
+
+// Tests that logs of another format are discarded.
+TEST_F(DiskBlobCacheTest, IncompatibleLog)
+{
+    std::unique_ptr<DiskBlobCache> cache = open();
+    ASSERT_TRUE(cache);
+    put(cache.get(), 1, 1000);
+    cache.reset();
+
+    writeLog(0, {'N', 'O', 'T', 'A', 'N', 'G', 'L', 'E'});
+
+    cache = open();
+    ASSERT_TRUE(cache);
+    EXPECT_FALSE(hasValue(cache.get(), 1, 1000));
+    put(cache.get(), 2, 1000);
+    EXPECT_TRUE(hasValue(cache.get(), 2, 1000));
+}
+
+// Tests that the log stays under its size limit, keeping the most recently used blobs, and that
+// other instances follow the compacted log.
+TEST_F(DiskBlobCacheTest, Compaction)
+{
+    constexpr size_t kSmallMaxSize = 16 * 1024;
+    constexpr size_t kValueSize    = 1000;
+
+    std::unique_ptr<DiskBlobCache> cache    = open(kSmallMaxSize);
+    std::unique_ptr<DiskBlobCache> observer = open(kSmallMaxSize);
+    ASSERT_TRUE(cache && observer);
+
+    for (uint8_t seed = 0; seed < 100; ++seed)
+    {
+        put(cache.get(), seed, kValueSize);
+        EXPECT_LE(cache->size(), kSmallMaxSize);
+
+        // Keep the first blob in use.
+        EXPECT_TRUE(hasValue(cache.get(), 0, kValueSize)) << static_cast<int>(seed);
+    }
+
+    EXPECT_TRUE(hasValue(cache.get(), 99, kValueSize));
+    EXPECT_FALSE(hasValue(cache.get(), 1, kValueSize));
+
+    EXPECT_TRUE(hasValue(observer.get(), 99, kValueSize));
+    EXPECT_TRUE(hasValue(observer.get(), 0, kValueSize));
+    put(observer.get(), 200, kValueSize);
+    EXPECT_TRUE(hasValue(cache.get(), 200, kValueSize));
+}
+
+// Tests that BlobCache stores blobs in and loads them from the disk cache when it has no
+// application callbacks, even without memory to cache them in.
+TEST_F(DiskBlobCacheTest, BlobCache)
+{
+    BlobCache first(0);
+    BlobCache second(0);
+    EXPECT_FALSE(first.isCachingEnabled(nullptr));
+
+    first.setDiskCache(open());
+    second.setDiskCache(open());
+    EXPECT_TRUE(first.isCachingEnabled(nullptr));
+
+    const std::vector<uint8_t> value = MakeValue(1000, 1);
+    angle::MemoryBuffer buffer;
+    ASSERT_TRUE(buffer.resize(value.size()));
+    memcpy(buffer.data(), value.data(), value.size());
+    first.put(nullptr, MakeKey(1), std::move(buffer));
+
+    BlobCache::Value loaded;
+    ASSERT_TRUE(second.get(nullptr, &mScratchBuffer, MakeKey(1), &loaded));
+    ASSERT_EQ(value.size(), loaded.size());
+    EXPECT_EQ(0, memcmp(value.data(), loaded.data(), value.size()));
+
+    second.remove(MakeKey(1));
+    second.setDiskCache(open());
+    EXPECT_FALSE(second.get(nullptr, &mScratchBuffer, MakeKey(1), &loaded));
+}
+}  // anonymous namespace
+}  // namespace egl
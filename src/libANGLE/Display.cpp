@@ -1082,6 +1082,11 @@ Error Display::initialize()
         return NoError();
     }
 
+    // Without blob cache callbacks from the application, programs and pipeline caches can persist
+    // in a directory named by the environment.  The backend may read its pipeline cache while
+    // initializing.
+    mBlobCache.setDiskCache(DiskBlobCache::OpenFromEnvironment());
+
     Error error = mImplementation->initialize(this);
     if (error.isError())
     {
@@ -1155,6 +1160,14 @@ Error Display::initialize()
     mState.singleThreadPool = angle::WorkerThreadPool::Create(1, ANGLEPlatformCurrent());
     mState.multiThreadPool  = angle::WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
 
+    if (mFrontendFeatures.asyncBlobCacheCompression.enabled)
+    {
+        mBlobCache.setAsyncCompressionPool(mState.multiThreadPool);
+    }
+    mBlobCache.setCompressionCodec(mFrontendFeatures.fastBlobCacheCompression.enabled
+                                       ? angle::BlobCompressionCodec::FastLZ
+                                       : angle::BlobCompressionCodec::Zlib);
+
     if (kIsContextMutexEnabled)
     {
         ASSERT(mManagersMutex == nullptr);
@@ -1325,6 +1338,10 @@ Error Display::terminate(Thread *thread, TerminateReason terminateReason)
 
     mImplementation->terminate();
 
+    // Store the blobs still being compressed while the blob cache callbacks are valid.
+    mBlobCache.setAsyncCompressionPool(nullptr);
+    mBlobCache.setDiskCache(nullptr);
+
     mMemoryProgramCache.clear();
     mMemoryShaderCache.clear();
     mBlobCache.setBlobCacheFuncs(nullptr, nullptr);
@@ -1921,6 +1938,9 @@ Error Display::releaseContextImpl(std::unique_ptr<gl::Context> &&context)
         mGlobalSemaphoreShareGroupUsers--;
     }
 
+    // Queued blob cache puts may call the context's blob cache callbacks.
+    mBlobCache.finishPendingPuts();
+
     ANGLE_TRY(context->onDestroy(this));
 
     return NoError();
@@ -2386,6 +2406,16 @@ void Display::initializeFrontendFeatures()
 
     ANGLE_FEATURE_CONDITION(&mFrontendFeatures, forceMinimumMaxVertexAttributes, false);
 
+    // Opt-in, as blobs then reach the application's blob cache asynchronously.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, asyncBlobCacheCompression, false);
+
+    // Opt-in, as blobs written with the fast codec can't be read by older versions of ANGLE.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, fastBlobCacheCompression, false);
+
+    // Opt-in, as it costs a thread per context, and debug messages of the recorded calls are
+    // issued from that thread unless the debug output is synchronous.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, asyncCommandStream, false);
+
     // Reject shaders with undefined behavior.  In the compiler, this only applies to WebGL.
     ANGLE_FEATURE_CONDITION(&mFrontendFeatures, rejectWebglShadersWithUndefinedBehavior, true);
 
@@ -10,33 +10,38 @@
 #include "libANGLE/HandleAllocator.h"
 
 #include <algorithm>
-#include <functional>
 #include <limits>
 
 #include "common/debug.h"
+#include "common/mathutil.h"
 
 namespace gl
 {
-
-struct HandleAllocator::HandleRangeComparator
+namespace
 {
-    bool operator()(const HandleRange &range, GLuint handle) const { return (range.end < handle); }
-};
+constexpr uint64_t kAllHandlesFree = std::numeric_limits<uint64_t>::max();
+
+// Reserving a handle this close above the bitmap grows the bitmap instead of adding the handle to
+// the reserved set.  Applications that name their objects themselves typically use small,
+// consecutive names.
+constexpr uint64_t kMaxBitmapGrowthOnReserve = 4096;
+}  // anonymous namespace
 
 HandleAllocator::HandleAllocator()
     : mBaseValue(1),
       mNextValue(1),
       mMaxValue(std::numeric_limits<GLuint>::max()),
+      mFirstFreeSummaryWord(0),
       mLoggingEnabled(false)
-{
-    mUnallocatedList.push_back(HandleRange(1, mMaxValue));
-}
+{}
 
 HandleAllocator::HandleAllocator(GLuint maximumHandleValue)
-    : mBaseValue(1), mNextValue(1), mMaxValue(maximumHandleValue), mLoggingEnabled(false)
-{
-    mUnallocatedList.push_back(HandleRange(1, mMaxValue));
-}
+    : mBaseValue(1),
+      mNextValue(1),
+      mMaxValue(maximumHandleValue),
+      mFirstFreeSummaryWord(0),
+      mLoggingEnabled(false)
+{}
 
 HandleAllocator::~HandleAllocator() {}
 
@@ -47,142 +52,257 @@ void HandleAllocator::setBaseHandle(GLuint value)
     mNextValue = value;
 }
 
-GLuint HandleAllocator::allocate()
+void HandleAllocator::setFreeBits(size_t wordIndex, uint64_t bits)
 {
-    ASSERT(!mUnallocatedList.empty() || !mReleasedList.empty());
+    mFreeBits[wordIndex] = bits;
 
-    // Allocate from released list, logarithmic time for pop_heap.
-    if (!mReleasedList.empty())
+    const size_t summaryIndex = wordIndex / kBitsPerWord;
+    const uint64_t summaryBit = uint64_t(1) << (wordIndex % kBitsPerWord);
+    if (bits != 0)
+    {
+        mFreeSummary[summaryIndex] |= summaryBit;
+        mFirstFreeSummaryWord = std::min(mFirstFreeSummaryWord, summaryIndex);
+    }
+    else
     {
-        std::pop_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
-        GLuint reusedHandle = mReleasedList.back();
-        mReleasedList.pop_back();
+        mFreeSummary[summaryIndex] &= ~summaryBit;
+    }
+}
 
-        if (mLoggingEnabled)
+size_t HandleAllocator::findFreeWord()
+{
+    for (; mFirstFreeSummaryWord < mFreeSummary.size(); ++mFirstFreeSummaryWord)
+    {
+        const uint64_t summary = mFreeSummary[mFirstFreeSummaryWord];
+        if (summary != 0)
         {
-            WARN() << "HandleAllocator::allocate reusing " << reusedHandle << std::endl;
+            return mFirstFreeSummaryWord * kBitsPerWord + gl::ScanForward(summary);
         }
-
-        return reusedHandle;
     }
+    return mFreeBits.size();
+}
 
-    // Allocate from unallocated list, constant time.
-    auto listIt = mUnallocatedList.begin();
+size_t HandleAllocator::appendWord()
+{
+    const uint64_t begin = getBitmapEnd();
+    const uint64_t end   = begin + kBitsPerWord;
+    ASSERT(begin <= mMaxValue);
 
-    GLuint freeListHandle = listIt->begin;
-    ASSERT(freeListHandle > 0);
+    const size_t wordIndex = mFreeBits.size();
+    if (wordIndex % kBitsPerWord == 0)
+    {
+        mFreeSummary.push_back(0);
+    }
+    mFreeBits.push_back(0);
 
-    if (listIt->begin == listIt->end)
+    uint64_t bits = kAllHandlesFree;
+    if (begin == 0)
     {
-        mUnallocatedList.erase(listIt);
+        // Zero is never allocated.
+        bits &= ~uint64_t(1);
     }
-    else
+    if (end > static_cast<uint64_t>(mMaxValue) + 1)
     {
-        listIt->begin++;
+        bits &= (uint64_t(1) << (static_cast<uint64_t>(mMaxValue) + 1 - begin)) - 1;
     }
 
-    if (mLoggingEnabled)
+    // Move the reserved handles of the new word into the bitmap.
+    auto reservedIt = mReservedAboveBitmap.begin();
+    while (reservedIt != mReservedAboveBitmap.end() && *reservedIt < end)
     {
-        WARN() << "HandleAllocator::allocate allocating " << freeListHandle << std::endl;
+        bits &= ~(uint64_t(1) << (*reservedIt - begin));
+        reservedIt = mReservedAboveBitmap.erase(reservedIt);
     }
 
-    return freeListHandle;
+    setFreeBits(wordIndex, bits);
+    return wordIndex;
 }
 
-void HandleAllocator::release(GLuint handle)
+size_t HandleAllocator::growBitmap()
+{
+    while (true)
+    {
+        const size_t wordIndex = appendWord();
+        if (mFreeBits[wordIndex] != 0)
+        {
+            return wordIndex;
+        }
+    }
+}
+
+GLuint HandleAllocator::allocate()
 {
+    ASSERT(anyHandleAvailableForAllocation());
+
+    size_t wordIndex = findFreeWord();
+    if (wordIndex == mFreeBits.size())
+    {
+        wordIndex = growBitmap();
+    }
+
+    const uint64_t bits = mFreeBits[wordIndex];
+    const GLuint handle = static_cast<GLuint>(wordIndex * kBitsPerWord + gl::ScanForward(bits));
+    setFreeBits(wordIndex, bits & (bits - 1));
+
     if (mLoggingEnabled)
     {
-        WARN() << "HandleAllocator::release releasing " << handle << std::endl;
+        WARN() << "HandleAllocator::allocate allocating " << handle << std::endl;
     }
 
-    // Try consolidating the ranges first.
-    for (HandleRange &handleRange : mUnallocatedList)
+    return handle;
+}
+
+void HandleAllocator::allocate(size_t count, GLuint *handlesOut)
+{
+    // Take the free handles a word at a time.
+    size_t allocated = 0;
+    while (allocated < count)
     {
-        if (handleRange.begin - 1 == handle)
+        ASSERT(anyHandleAvailableForAllocation());
+
+        size_t wordIndex = findFreeWord();
+        if (wordIndex == mFreeBits.size())
         {
-            handleRange.begin--;
-            return;
+            wordIndex = growBitmap();
         }
 
-        if (handleRange.end == handle - 1)
+        const GLuint wordBase = static_cast<GLuint>(wordIndex * kBitsPerWord);
+        uint64_t bits         = mFreeBits[wordIndex];
+        for (; bits != 0 && allocated < count; bits &= bits - 1)
         {
-            handleRange.end++;
-            return;
+            handlesOut[allocated++] = wordBase + static_cast<GLuint>(gl::ScanForward(bits));
         }
+        setFreeBits(wordIndex, bits);
     }
 
-    // Add to released list, logarithmic time for push_heap.
-    mReleasedList.push_back(handle);
-    std::push_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
+    if (mLoggingEnabled)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            WARN() << "HandleAllocator::allocate allocating " << handlesOut[index] << std::endl;
+        }
+    }
 }
 
-void HandleAllocator::reserve(GLuint handle)
+void HandleAllocator::release(GLuint handle)
 {
     if (mLoggingEnabled)
     {
-        WARN() << "HandleAllocator::reserve reserving " << handle << std::endl;
+        WARN() << "HandleAllocator::release releasing " << handle << std::endl;
     }
 
-    // Clear from released list -- might be a slow operation.
-    if (!mReleasedList.empty())
+    ASSERT(handle != 0);
+    if (handle < getBitmapEnd())
     {
-        auto releasedIt = std::find(mReleasedList.begin(), mReleasedList.end(), handle);
-        if (releasedIt != mReleasedList.end())
-        {
-            mReleasedList.erase(releasedIt);
-            std::make_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
-            return;
-        }
+        const size_t wordIndex = handle / kBitsPerWord;
+        const uint64_t bit     = uint64_t(1) << (handle % kBitsPerWord);
+        ASSERT((mFreeBits[wordIndex] & bit) == 0);
+        setFreeBits(wordIndex, mFreeBits[wordIndex] | bit);
     }
+    else
+    {
+        mReservedAboveBitmap.erase(handle);
+    }
+}
 
-    // Not in released list, reserve in the unallocated list.
-    auto boundIt = std::lower_bound(mUnallocatedList.begin(), mUnallocatedList.end(), handle,
-                                    HandleRangeComparator());
-
-    ASSERT(boundIt != mUnallocatedList.end());
-
-    GLuint begin = boundIt->begin;
-    GLuint end   = boundIt->end;
-
-    if (handle == begin || handle == end)
+void HandleAllocator::release(angle::Span<const GLuint> handles)
+{
+    // Handles that share a word of the bitmap, as handles generated together mostly do, are freed
+    // with a single update of the word and its summary bit.
+    size_t pendingWordIndex = 0;
+    uint64_t pendingBits    = 0;
+    for (GLuint handle : handles)
     {
-        if (begin == end)
+        if (mLoggingEnabled)
         {
-            mUnallocatedList.erase(boundIt);
+            WARN() << "HandleAllocator::release releasing " << handle << std::endl;
         }
-        else if (handle == begin)
+
+        ASSERT(handle != 0);
+        if (handle >= getBitmapEnd())
         {
-            boundIt->begin++;
+            mReservedAboveBitmap.erase(handle);
+            continue;
         }
-        else
+
+        const size_t wordIndex = handle / kBitsPerWord;
+        const uint64_t bit     = uint64_t(1) << (handle % kBitsPerWord);
+        if (wordIndex != pendingWordIndex && pendingBits != 0)
         {
-            ASSERT(handle == end);
-            boundIt->end--;
+            setFreeBits(pendingWordIndex, mFreeBits[pendingWordIndex] | pendingBits);
+            pendingBits = 0;
         }
-        return;
+        ASSERT(((mFreeBits[wordIndex] | pendingBits) & bit) == 0);
+        pendingWordIndex = wordIndex;
+        pendingBits |= bit;
+    }
+
+    if (pendingBits != 0)
+    {
+        setFreeBits(pendingWordIndex, mFreeBits[pendingWordIndex] | pendingBits);
+    }
+}
+
+void HandleAllocator::reserve(GLuint handle)
+{
+    if (mLoggingEnabled)
+    {
+        WARN() << "HandleAllocator::reserve reserving " << handle << std::endl;
     }
 
-    ASSERT(begin < handle && handle < end);
+    if (handle >= getBitmapEnd() && handle <= mMaxValue &&
+        handle - getBitmapEnd() < kMaxBitmapGrowthOnReserve)
+    {
+        while (handle >= getBitmapEnd())
+        {
+            appendWord();
+        }
+    }
 
-    // need to split the range
-    auto placementIt = mUnallocatedList.erase(boundIt);
-    placementIt      = mUnallocatedList.insert(placementIt, HandleRange(handle + 1, end));
-    mUnallocatedList.insert(placementIt, HandleRange(begin, handle - 1));
+    if (handle < getBitmapEnd())
+    {
+        const size_t wordIndex = handle / kBitsPerWord;
+        const uint64_t bit     = uint64_t(1) << (handle % kBitsPerWord);
+        ASSERT((mFreeBits[wordIndex] & bit) != 0);
+        setFreeBits(wordIndex, mFreeBits[wordIndex] & ~bit);
+    }
+    else
+    {
+        mReservedAboveBitmap.insert(handle);
+    }
 }
 
 void HandleAllocator::reset()
 {
-    mUnallocatedList.clear();
-    mUnallocatedList.push_back(HandleRange(1, mMaxValue));
-    mReleasedList.clear();
+    mFreeBits.clear();
+    mFreeSummary.clear();
+    mFirstFreeSummaryWord = 0;
+    mReservedAboveBitmap.clear();
     mBaseValue = 1;
     mNextValue = 1;
 }
 
 bool HandleAllocator::anyHandleAvailableForAllocation() const
 {
-    return !mUnallocatedList.empty() || !mReleasedList.empty();
+    for (size_t summaryIndex = mFirstFreeSummaryWord; summaryIndex < mFreeSummary.size();
+         ++summaryIndex)
+    {
+        if (mFreeSummary[summaryIndex] != 0)
+        {
+            return true;
+        }
+    }
+
+    // Count the handles above the bitmap that are not reserved.  Zero is not a valid handle.
+    const uint64_t begin = std::max<uint64_t>(getBitmapEnd(), 1);
+    if (begin > mMaxValue)
+    {
+        return false;
+    }
+    const uint64_t handlesAboveBitmap = static_cast<uint64_t>(mMaxValue) - begin + 1;
+    const uint64_t reservedAboveBitmap =
+        std::distance(mReservedAboveBitmap.begin(), mReservedAboveBitmap.upper_bound(mMaxValue));
+    return handlesAboveBitmap > reservedAboveBitmap;
 }
 
 void HandleAllocator::enableLogging(bool enabled)
@@ -10,7 +10,11 @@
 #ifndef LIBANGLE_HANDLEALLOCATOR_H_
 #define LIBANGLE_HANDLEALLOCATOR_H_
 
+#include <set>
+#include <vector>
+
 #include "common/angleutils.h"
+#include "common/span.h"
 
 #include "angle_gl.h"
 
@@ -29,8 +33,12 @@ class HandleAllocator final : angle::NonCopyable
 
     void setBaseHandle(GLuint value);
 
+    // Returns the lowest free handle.
     GLuint allocate();
+    // Allocates |count| handles, in increasing order.
+    void allocate(size_t count, GLuint *handlesOut);
     void release(GLuint handle);
+    void release(angle::Span<const GLuint> handles);
     void reserve(GLuint handle);
     void reset();
     bool anyHandleAvailableForAllocation() const;
@@ -38,26 +46,34 @@ class HandleAllocator final : angle::NonCopyable
     void enableLogging(bool enabled);
 
   private:
+    static constexpr size_t kBitsPerWord = 64;
+
+    // Returns the index of the lowest word of |mFreeBits| with a free handle, or the number of
+    // words if there is none.
+    size_t findFreeWord();
+    // Adds a word to |mFreeBits| and returns its index.
+    size_t appendWord();
+    // Adds words to |mFreeBits| until one has a free handle.  Returns the index of that word.
+    size_t growBitmap();
+    uint64_t getBitmapEnd() const { return static_cast<uint64_t>(mFreeBits.size()) * kBitsPerWord; }
+    void setFreeBits(size_t wordIndex, uint64_t bits);
+
     GLuint mBaseValue;
     GLuint mNextValue;
     const GLuint mMaxValue;
 
-    // Represents an inclusive range [begin, end]
-    struct HandleRange
-    {
-        HandleRange(GLuint beginIn, GLuint endIn) : begin(beginIn), end(endIn) {}
-
-        GLuint begin;
-        GLuint end;
-    };
-
-    struct HandleRangeComparator;
-
-    // The freelist consists of never-allocated handles, stored
-    // as ranges, and handles that were previously allocated and
-    // released, stored in a heap.
-    std::vector<HandleRange> mUnallocatedList;
-    std::vector<GLuint> mReleasedList;
+    // The handles below the end of the bitmap are tracked by a bit each, set if the handle is
+    // free.  A bit of the summary is set if the corresponding word of |mFreeBits| has any free
+    // handle, so that the lowest free handle is found with two bit scans.  The bitmap grows as
+    // handles are allocated.
+    std::vector<uint64_t> mFreeBits;
+    std::vector<uint64_t> mFreeSummary;
+    // No summary word below this one has any bit set.
+    size_t mFirstFreeSummaryWord;
+
+    // The handles at or above the end of the bitmap are free, except for these, which the
+    // application chose itself (e.g. by binding an object name that it didn't generate).
+    std::set<GLuint> mReservedAboveBitmap;
 
     bool mLoggingEnabled;
 };
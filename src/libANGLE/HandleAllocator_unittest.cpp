@@ -6,6 +6,8 @@
 // Unit tests for HandleAllocator.
 //
 
+#include <algorithm>
+#include <set>
 #include <unordered_set>
 
 #include "gmock/gmock.h"
@@ -243,4 +245,131 @@ TEST(HandleAllocatorTest, ConsolidateRangeDuringRelease)
     EXPECT_NE(handle, static_cast<GLuint>(-1));
 }
 
+// Tests that released handles are reused lowest first.
+TEST(HandleAllocatorTest, ReuseLowestReleasedHandle)
+{
+    gl::HandleAllocator allocator;
+
+    for (GLuint handle = 1; handle <= 200; ++handle)
+    {
+        EXPECT_EQ(handle, allocator.allocate());
+    }
+
+    allocator.release(150);
+    allocator.release(7);
+    allocator.release(70);
+
+    EXPECT_EQ(7u, allocator.allocate());
+    EXPECT_EQ(70u, allocator.allocate());
+    EXPECT_EQ(150u, allocator.allocate());
+    EXPECT_EQ(201u, allocator.allocate());
+}
+
+// Tests allocating and releasing handles in batches.
+TEST(HandleAllocatorTest, BatchAllocateAndRelease)
+{
+    gl::HandleAllocator allocator;
+
+    allocator.reserve(3);
+    allocator.reserve(100);
+
+    std::vector<GLuint> handles(1000);
+    allocator.allocate(handles.size(), handles.data());
+
+    // The handles are the lowest free ones, in increasing order.
+    GLuint expected = 1;
+    for (GLuint handle : handles)
+    {
+        if (expected == 3 || expected == 100)
+        {
+            ++expected;
+        }
+        EXPECT_EQ(expected, handle);
+        ++expected;
+    }
+
+    // Release every other handle and allocate them again.
+    std::vector<GLuint> released;
+    for (size_t index = 0; index < handles.size(); index += 2)
+    {
+        released.push_back(handles[index]);
+    }
+    allocator.release({released.data(), released.size()});
+
+    std::vector<GLuint> reallocated(released.size());
+    allocator.allocate(reallocated.size(), reallocated.data());
+    EXPECT_EQ(released, reallocated);
+
+    EXPECT_EQ(expected, allocator.allocate());
+}
+
+// Tests releasing a batch of handles that are out of order and spread over several words of the
+// bitmap, including a handle reserved above it.
+TEST(HandleAllocatorTest, BatchReleaseUnordered)
+{
+    gl::HandleAllocator allocator;
+
+    std::vector<GLuint> handles(300);
+    allocator.allocate(handles.size(), handles.data());
+    allocator.reserve(100000);
+
+    const std::vector<GLuint> released = {200, 5, 6, 130, 7, 100000, 70, 71, 8};
+    allocator.release({released.data(), released.size()});
+
+    std::vector<GLuint> reallocated(8);
+    allocator.allocate(reallocated.size(), reallocated.data());
+    EXPECT_EQ(std::vector<GLuint>({5, 6, 7, 8, 70, 71, 130, 200}), reallocated);
+    EXPECT_EQ(301u, allocator.allocate());
+
+    // The released large handle can be reserved again.
+    allocator.reserve(100000);
+}
+
+// Tests reserving handles far above the allocated ones.
+TEST(HandleAllocatorTest, ReserveLargeHandles)
+{
+    gl::HandleAllocator allocator;
+
+    std::set<GLuint> reserved = {5000, 100000, 100001, 0x7FFFFFFF,
+                                 std::numeric_limits<GLuint>::max() - 1};
+    for (GLuint handle : reserved)
+    {
+        allocator.reserve(handle);
+    }
+
+    std::unordered_set<GLuint> allocated;
+    for (int count = 0; count < 10000; ++count)
+    {
+        GLuint handle = allocator.allocate();
+        EXPECT_EQ(0u, reserved.count(handle));
+        EXPECT_TRUE(allocated.insert(handle).second);
+    }
+    EXPECT_EQ(10001u, *std::max_element(allocated.begin(), allocated.end()));
+
+    // Released large handles can be reserved again.
+    allocator.release(100000);
+    allocator.release(0x7FFFFFFF);
+    allocator.reserve(100000);
+    allocator.reserve(0x7FFFFFFF);
+}
+
+// Tests that batch allocation stops at the maximum handle.
+TEST(HandleAllocatorTest, BatchAllocateUpToMaximum)
+{
+    gl::HandleAllocator allocator(100);
+
+    allocator.reserve(50);
+
+    std::vector<GLuint> handles(99);
+    allocator.allocate(handles.size(), handles.data());
+    EXPECT_EQ(1u, handles.front());
+    EXPECT_EQ(100u, handles.back());
+    EXPECT_FALSE(allocator.anyHandleAvailableForAllocation());
+
+    allocator.release(50);
+    EXPECT_TRUE(allocator.anyHandleAvailableForAllocation());
+    EXPECT_EQ(50u, allocator.allocate());
+    EXPECT_FALSE(allocator.anyHandleAvailableForAllocation());
+}
+
 }  // anonymous namespace
@@ -10,6 +10,7 @@
 #include "libANGLE/IndexRangeCache.h"
 
 #include "common/debug.h"
+#include "common/utilities.h"
 #include "libANGLE/formatutils.h"
 
 namespace gl
@@ -81,6 +82,213 @@ void IndexRangeCache::clear()
     mIndexRangeCache.clear();
 }
 
+ChunkedIndexRangeCache::ChunkedIndexRangeCache() : mBufferSize(0), mChunkCount(0), mLeafCapacity(0)
+{}
+
+ChunkedIndexRangeCache::~ChunkedIndexRangeCache() = default;
+
+IndexRange ChunkedIndexRangeCache::getRange(const uint8_t *bufferData,
+                                            size_t bufferSize,
+                                            DrawElementsType type,
+                                            size_t offset,
+                                            size_t count,
+                                            bool primitiveRestartEnabled)
+{
+    const size_t typeBytes = GetDrawElementsTypeSize(type);
+    const size_t byteFirst = offset;
+    const size_t byteLast  = offset + count * typeBytes;
+    ASSERT(byteLast <= bufferSize);
+    ASSERT(offset % typeBytes == 0);
+
+    // Only chunks entirely inside the range are served from the tree.  Ranges not covering any
+    // whole chunk are cheaper to scan directly.
+    const size_t chunkFirst = rx::roundUpPow2(byteFirst, kChunkSize) / kChunkSize;
+    const size_t chunkLast  = byteLast / kChunkSize;
+    if (chunkFirst >= chunkLast)
+    {
+        return ComputeIndexRange(type, bufferData + offset, count, primitiveRestartEnabled);
+    }
+
+    if (bufferSize != mBufferSize)
+    {
+        clear();
+        mBufferSize   = bufferSize;
+        mChunkCount   = bufferSize / kChunkSize;
+        mLeafCapacity = 1;
+        while (mLeafCapacity < mChunkCount)
+        {
+            mLeafCapacity <<= 1;
+        }
+    }
+
+    Tree &tree = mTrees[static_cast<size_t>(type) * 2 + (primitiveRestartEnabled ? 1 : 0)];
+    if (tree.empty())
+    {
+        initTree(&tree);
+    }
+
+    ChunkRange range;
+    queryTree(&tree, 1, 0, mLeafCapacity, chunkFirst, chunkLast, bufferData, type,
+              primitiveRestartEnabled, &range);
+
+    // Scan the partial chunks at either end of the range.
+    const size_t headBytes = chunkFirst * kChunkSize - byteFirst;
+    const size_t tailBytes = byteLast - chunkLast * kChunkSize;
+    const IndexRange ends[] = {
+        ComputeIndexRange(type, bufferData + byteFirst, headBytes / typeBytes,
+                          primitiveRestartEnabled),
+        ComputeIndexRange(type, bufferData + chunkLast * kChunkSize, tailBytes / typeBytes,
+                          primitiveRestartEnabled),
+    };
+    for (const IndexRange &end : ends)
+    {
+        if (!end.isEmpty())
+        {
+            range.min = std::min(range.min, end.start());
+            range.max = std::max(range.max, end.end());
+        }
+    }
+
+    if (range.min > range.max)
+    {
+        return IndexRange();
+    }
+    return IndexRange(range.min, range.max);
+}
+
+void ChunkedIndexRangeCache::invalidateRange(size_t offset, size_t size)
+{
+    if (size == 0 || offset >= mChunkCount * kChunkSize)
+    {
+        return;
+    }
+
+    const size_t chunkFirst = offset / kChunkSize;
+    const size_t chunkLast  = std::min(mChunkCount, (offset + size + kChunkSize - 1) / kChunkSize);
+    if (chunkFirst == 0 && chunkLast == mChunkCount)
+    {
+        clear();
+        return;
+    }
+
+    for (Tree &tree : mTrees)
+    {
+        if (!tree.empty())
+        {
+            invalidateTree(&tree, 1, 0, mLeafCapacity, chunkFirst, chunkLast);
+        }
+    }
+}
+
+void ChunkedIndexRangeCache::clear()
+{
+    for (Tree &tree : mTrees)
+    {
+        tree.clear();
+    }
+}
+
+void ChunkedIndexRangeCache::initTree(Tree *tree) const
+{
+    // Node 1 is the root, and node n has children 2n and 2n+1.  Leaves start at mLeafCapacity.
+    // Leaves past the end of the buffer are permanently valid and empty.
+    tree->resize(2 * mLeafCapacity);
+    for (size_t leaf = 0; leaf < mChunkCount; ++leaf)
+    {
+        (*tree)[mLeafCapacity + leaf].invalidCount = 1;
+    }
+    for (size_t node = mLeafCapacity - 1; node > 0; --node)
+    {
+        updateNode(tree, node);
+    }
+}
+
+// static
+void ChunkedIndexRangeCache::updateNode(Tree *tree, size_t node)
+{
+    const ChunkRange &left  = (*tree)[2 * node];
+    const ChunkRange &right = (*tree)[2 * node + 1];
+    ChunkRange &nodeRange   = (*tree)[node];
+    nodeRange               = left;
+    nodeRange.merge(right);
+    nodeRange.invalidCount = left.invalidCount + right.invalidCount;
+}
+
+void ChunkedIndexRangeCache::queryTree(Tree *tree,
+                                       size_t node,
+                                       size_t nodeFirst,
+                                       size_t nodeLast,
+                                       size_t first,
+                                       size_t last,
+                                       const uint8_t *bufferData,
+                                       DrawElementsType type,
+                                       bool primitiveRestartEnabled,
+                                       ChunkRange *rangeOut)
+{
+    if (last <= nodeFirst || nodeLast <= first)
+    {
+        return;
+    }
+
+    ChunkRange &nodeRange = (*tree)[node];
+    if (first <= nodeFirst && nodeLast <= last && nodeRange.invalidCount == 0)
+    {
+        rangeOut->merge(nodeRange);
+        return;
+    }
+
+    if (nodeLast - nodeFirst == 1)
+    {
+        // An invalid leaf: scan its chunk.
+        const size_t chunkIndexCount = kChunkSize / GetDrawElementsTypeSize(type);
+        IndexRange chunkRange = ComputeIndexRange(type, bufferData + nodeFirst * kChunkSize,
+                                                  chunkIndexCount, primitiveRestartEnabled);
+        nodeRange = ChunkRange();
+        if (!chunkRange.isEmpty())
+        {
+            nodeRange.min = chunkRange.start();
+            nodeRange.max = chunkRange.end();
+        }
+        rangeOut->merge(nodeRange);
+        return;
+    }
+
+    const size_t nodeMid = nodeFirst + (nodeLast - nodeFirst) / 2;
+    queryTree(tree, 2 * node, nodeFirst, nodeMid, first, last, bufferData, type,
+              primitiveRestartEnabled, rangeOut);
+    queryTree(tree, 2 * node + 1, nodeMid, nodeLast, first, last, bufferData, type,
+              primitiveRestartEnabled, rangeOut);
+
+    // Children may have been validated by the query; refresh this node from them.
+    updateNode(tree, node);
+}
+
+void ChunkedIndexRangeCache::invalidateTree(Tree *tree,
+                                            size_t node,
+                                            size_t nodeFirst,
+                                            size_t nodeLast,
+                                            size_t first,
+                                            size_t last)
+{
+    if (last <= nodeFirst || nodeLast <= first)
+    {
+        return;
+    }
+
+    ChunkRange &nodeRange = (*tree)[node];
+    if (nodeLast - nodeFirst == 1)
+    {
+        nodeRange              = ChunkRange();
+        nodeRange.invalidCount = 1;
+        return;
+    }
+
+    const size_t nodeMid = nodeFirst + (nodeLast - nodeFirst) / 2;
+    invalidateTree(tree, 2 * node, nodeFirst, nodeMid, first, last);
+    invalidateTree(tree, 2 * node + 1, nodeMid, nodeLast, first, last);
+    updateNode(tree, node);
+}
+
 bool IndexRangeKey::operator<(const IndexRangeKey &rhs) const
 {
     if (type != rhs.type)
@@ -15,7 +15,9 @@
 #include "common/angleutils.h"
 #include "common/mathutil.h"
 
+#include <array>
 #include <map>
+#include <vector>
 
 namespace gl
 {
@@ -89,6 +91,75 @@ class IndexRangeInlineCache
     IndexRangeKey mKey;
 };
 
+// Per-buffer cache answering index range queries for arbitrary (offset, count) pairs.  The buffer
+// is split into fixed-size chunks whose ranges are kept in a segment tree per index type and
+// primitive restart mode.  Chunk ranges are computed lazily the first time a query covers them,
+// and buffer updates only invalidate the chunks they touch.  Queries are answered from O(log n)
+// tree nodes plus a direct scan of the partial chunks at either end of the range.
+class ChunkedIndexRangeCache final : angle::NonCopyable
+{
+  public:
+    static constexpr size_t kChunkSize = 4096;
+
+    ChunkedIndexRangeCache();
+    ~ChunkedIndexRangeCache();
+
+    // |bufferData| must point at the start of the buffer's data and hold |bufferSize| bytes.
+    IndexRange getRange(const uint8_t *bufferData,
+                        size_t bufferSize,
+                        DrawElementsType type,
+                        size_t offset,
+                        size_t count,
+                        bool primitiveRestartEnabled);
+
+    void invalidateRange(size_t offset, size_t size);
+    void clear();
+
+  private:
+    // Min/max over the indices of a set of chunks, with the number of chunks in the set whose
+    // range is not yet known.  An empty set has min > max.
+    struct ChunkRange
+    {
+        uint32_t min          = std::numeric_limits<uint32_t>::max();
+        uint32_t max          = 0;
+        uint32_t invalidCount = 0;
+
+        void merge(const ChunkRange &other)
+        {
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+        }
+    };
+
+    // One tree per (index type, primitive restart enabled) pair.
+    static constexpr size_t kTreeCount = 2 * static_cast<size_t>(DrawElementsType::EnumCount);
+    using Tree                         = std::vector<ChunkRange>;
+
+    void initTree(Tree *tree) const;
+    static void updateNode(Tree *tree, size_t node);
+    void queryTree(Tree *tree,
+                   size_t node,
+                   size_t nodeFirst,
+                   size_t nodeLast,
+                   size_t first,
+                   size_t last,
+                   const uint8_t *bufferData,
+                   DrawElementsType type,
+                   bool primitiveRestartEnabled,
+                   ChunkRange *rangeOut);
+    void invalidateTree(Tree *tree,
+                        size_t node,
+                        size_t nodeFirst,
+                        size_t nodeLast,
+                        size_t first,
+                        size_t last);
+
+    size_t mBufferSize;
+    size_t mChunkCount;
+    size_t mLeafCapacity;
+    std::array<Tree, kTreeCount> mTrees;
+};
+
 inline IndexRangeKey::IndexRangeKey(DrawElementsType type_,
                                     size_t offset_,
                                     size_t count_,
@@ -0,0 +1,89 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests for the chunked index range cache.
+
+#include <gtest/gtest.h>
+
+#include "common/utilities.h"
+#include "libANGLE/IndexRangeCache.h"
+
+namespace gl
+{
+namespace
+{
+constexpr size_t kChunkSize = ChunkedIndexRangeCache::kChunkSize;
+
+// Test that queries spanning whole chunks and partial chunks match a direct scan.
+TEST(ChunkedIndexRangeCacheTest, MatchesDirectScan)
+{
+    constexpr size_t kIndexCount = 5 * kChunkSize + 17;
+    std::vector<uint16_t> indices(kIndexCount);
+    for (size_t i = 0; i < kIndexCount; ++i)
+    {
+        indices[i] = static_cast<uint16_t>((i * 7919) % 50000 + 100);
+    }
+    indices[kChunkSize] = 0xFFFF;
+
+    const uint8_t *data     = reinterpret_cast<const uint8_t *>(indices.data());
+    const size_t bufferSize = kIndexCount * sizeof(uint16_t);
+
+    ChunkedIndexRangeCache cache;
+    for (bool primitiveRestart : {false, true})
+    {
+        for (size_t first : {size_t(0), size_t(3), kChunkSize / 2, kChunkSize + 5})
+        {
+            for (size_t count : {size_t(10), kChunkSize, 3 * kChunkSize, kIndexCount - first})
+            {
+                IndexRange expected = ComputeIndexRange(DrawElementsType::UnsignedShort,
+                                                        indices.data() + first, count,
+                                                        primitiveRestart);
+                IndexRange cached =
+                    cache.getRange(data, bufferSize, DrawElementsType::UnsignedShort,
+                                   first * sizeof(uint16_t), count, primitiveRestart);
+                EXPECT_EQ(expected, cached);
+            }
+        }
+    }
+}
+
+// Test that invalidating a range picks up new data in the touched chunks.
+TEST(ChunkedIndexRangeCacheTest, InvalidateRange)
+{
+    constexpr size_t kBufferSize = 8 * kChunkSize;
+    std::vector<uint8_t> indices(kBufferSize, 10);
+
+    ChunkedIndexRangeCache cache;
+    EXPECT_EQ(IndexRange(10, 10), cache.getRange(indices.data(), kBufferSize,
+                                                 DrawElementsType::UnsignedByte, 0, kBufferSize,
+                                                 false));
+
+    indices[3 * kChunkSize + 1] = 2;
+    indices[5 * kChunkSize]     = 200;
+    cache.invalidateRange(3 * kChunkSize, 2 * kChunkSize + 1);
+    EXPECT_EQ(IndexRange(2, 200), cache.getRange(indices.data(), kBufferSize,
+                                                 DrawElementsType::UnsignedByte, 0, kBufferSize,
+                                                 false));
+    EXPECT_EQ(IndexRange(10, 10), cache.getRange(indices.data(), kBufferSize,
+                                                 DrawElementsType::UnsignedByte, 6 * kChunkSize,
+                                                 2 * kChunkSize, false));
+}
+
+// Test that a range made only of primitive restart indices is empty.
+TEST(ChunkedIndexRangeCacheTest, AllRestartIndices)
+{
+    constexpr size_t kIndexCount = 4 * kChunkSize / sizeof(uint32_t);
+    std::vector<uint32_t> indices(kIndexCount, 0xFFFFFFFFu);
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(indices.data());
+
+    ChunkedIndexRangeCache cache;
+    EXPECT_EQ(IndexRange(), cache.getRange(data, kIndexCount * sizeof(uint32_t),
+                                           DrawElementsType::UnsignedInt, 0, kIndexCount, true));
+    EXPECT_EQ(IndexRange(0xFFFFFFFFu, 0xFFFFFFFFu),
+              cache.getRange(data, kIndexCount * sizeof(uint32_t), DrawElementsType::UnsignedInt,
+                             0, kIndexCount, false));
+}
+}  // anonymous namespace
+}  // namespace gl
@@ -185,8 +185,33 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
     ANGLE_TRY(program->serialize(context));
     const angle::MemoryBuffer &serializedProgram = program->getSerializedBinary();
 
+    // Let the blob cache compress on a worker thread, unless the platform wants the compressed
+    // binary right away.
+    auto *platform = ANGLEPlatformCurrent();
+    if (mBlobCache.isAsyncCompressionEnabled() &&
+        platform->cacheProgram == angle::DefaultCacheProgram)
+    {
+        angle::MemoryBuffer uncompressedData;
+        if (!uncompressedData.resize(serializedProgram.size()))
+        {
+            ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
+                               "Failed to allocate memory for binary data.");
+            return angle::Result::Continue;
+        }
+        memcpy(uncompressedData.data(), serializedProgram.data(), serializedProgram.size());
+
+        if (!mBlobCache.compressAndPut(context, programHash, std::move(uncompressedData),
+                                       nullptr))
+        {
+            ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
+                               "Error compressing binary data.");
+        }
+        return angle::Result::Continue;
+    }
+
     angle::MemoryBuffer compressedData;
-    if (!angle::CompressBlob(serializedProgram.size(), serializedProgram.data(), &compressedData))
+    if (!angle::CompressBlob(serializedProgram.size(), serializedProgram.data(), &compressedData,
+                             mBlobCache.getCompressionCodec()))
     {
         ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                            "Error compressing binary data.");
@@ -199,7 +224,6 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
         // This was a workaround for Chrome until it added support for EGL_ANDROID_blob_cache,
         // tracked by http://anglebug.com/42261225. This issue has since been closed, but removing
         // this still causes a test failure.
-        auto *platform = ANGLEPlatformCurrent();
         platform->cacheProgram(platform, programHash, compressedData.size(), compressedData.data());
     }
 
@@ -33,13 +33,21 @@ namespace
 static constexpr size_t kMaxUncompressedShaderSize = 5 * 1024 * 1024;
 }  // namespace
 
-MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache) : mBlobCache(blobCache) {}
+MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache) : mBlobCache(blobCache)
+{
+    for (ShaderCacheKeyType keyType : angle::AllEnums<ShaderCacheKeyType>())
+    {
+        mLookups[keyType] = 0;
+        mHits[keyType]    = 0;
+    }
+}
 
 MemoryShaderCache::~MemoryShaderCache() {}
 
 egl::CacheGetResult MemoryShaderCache::getShader(const Context *context,
                                                  Shader *shader,
                                                  const egl::BlobCache::Key &shaderHash,
+                                                 ShaderCacheKeyType keyType,
                                                  angle::JobResultExpectancy resultExpectancy)
 {
     // If caching is effectively disabled, don't bother calculating the hash.
@@ -48,6 +56,8 @@ egl::CacheGetResult MemoryShaderCache::getShader(const Context *context,
         return egl::CacheGetResult::NotFound;
     }
 
+    mLookups[keyType].fetch_add(1, std::memory_order_relaxed);
+
     angle::MemoryBuffer uncompressedData;
     const egl::BlobCache::GetAndDecompressResult result =
         mBlobCache.getAndDecompress(context, context->getScratchBuffer(), shaderHash,
@@ -67,6 +77,7 @@ egl::CacheGetResult MemoryShaderCache::getShader(const Context *context,
             if (shader->loadBinary(context, uncompressedData.data(),
                                    static_cast<int>(uncompressedData.size()), resultExpectancy))
             {
+                mHits[keyType].fetch_add(1, std::memory_order_relaxed);
                 return egl::CacheGetResult::Success;
             }
 
@@ -116,4 +127,12 @@ size_t MemoryShaderCache::maxSize() const
     return mBlobCache.maxSize();
 }
 
+ShaderCacheStatistics MemoryShaderCache::getStatistics(ShaderCacheKeyType keyType) const
+{
+    ShaderCacheStatistics statistics;
+    statistics.lookups = mLookups[keyType].load(std::memory_order_relaxed);
+    statistics.hits    = mHits[keyType].load(std::memory_order_relaxed);
+    return statistics;
+}
+
 }  // namespace gl
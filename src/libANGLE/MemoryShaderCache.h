@@ -11,9 +11,11 @@
 #define LIBANGLE_MEMORY_SHADER_CACHE_H_
 
 #include <array>
+#include <atomic>
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/MemoryBuffer.h"
+#include "common/PackedEnums.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/Error.h"
 
@@ -24,6 +26,24 @@ class Shader;
 class ShaderState;
 class ShCompilerInstance;
 
+// What the key of a shader cache lookup is derived from.
+enum class ShaderCacheKeyType
+{
+    // The shader source.
+    Source,
+    // The token stream the shader source preprocesses to.
+    PreprocessedSource,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+struct ShaderCacheStatistics
+{
+    uint64_t lookups = 0;
+    uint64_t hits    = 0;
+};
+
 class MemoryShaderCache final : angle::NonCopyable
 {
   public:
@@ -40,6 +60,7 @@ class MemoryShaderCache final : angle::NonCopyable
     egl::CacheGetResult getShader(const Context *context,
                                   Shader *shader,
                                   const egl::BlobCache::Key &shaderHash,
+                                  ShaderCacheKeyType keyType,
                                   angle::JobResultExpectancy resultExpectancy);
 
     // Empty the cache.
@@ -48,8 +69,14 @@ class MemoryShaderCache final : angle::NonCopyable
     // Returns the maximum cache size in bytes.
     size_t maxSize() const;
 
+    // Returns how many lookups of the given key type were made, and how many of them hit.
+    ShaderCacheStatistics getStatistics(ShaderCacheKeyType keyType) const;
+
   private:
     egl::BlobCache &mBlobCache;
+
+    angle::PackedEnumMap<ShaderCacheKeyType, std::atomic<uint64_t>> mLookups;
+    angle::PackedEnumMap<ShaderCacheKeyType, std::atomic<uint64_t>> mHits;
 };
 
 }  // namespace gl
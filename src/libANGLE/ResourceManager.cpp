@@ -9,6 +9,7 @@
 
 #include "libANGLE/ResourceManager.h"
 
+#include "common/FastVector.h"
 #include "libANGLE/Buffer.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Fence.h"
@@ -38,6 +39,20 @@ IDType AllocateEmptyObject(HandleAllocator *handleAllocator,
     return handle;
 }
 
+template <typename ResourceType, typename IDType>
+void AllocateEmptyObjects(HandleAllocator *handleAllocator,
+                          ResourceMap<ResourceType, IDType> *objectMap,
+                          size_t count,
+                          IDType *handlesOut)
+{
+    static_assert(sizeof(IDType) == sizeof(GLuint), "Types have different sizes");
+    handleAllocator->allocate(count, reinterpret_cast<GLuint *>(handlesOut));
+    for (size_t index = 0; index < count; ++index)
+    {
+        objectMap->assign(handlesOut[index], nullptr);
+    }
+}
+
 }  // anonymous namespace
 
 ResourceManagerBase::ResourceManagerBase() : mRefCount(1) {}
@@ -100,6 +115,38 @@ void TypedResourceManager<ResourceType, ImplT, IDType>::deleteObject(const Conte
     }
 }
 
+template <typename ResourceType, typename ImplT, typename IDType>
+void TypedResourceManager<ResourceType, ImplT, IDType>::deleteObjects(const Context *context,
+                                                                      size_t count,
+                                                                      const IDType *handles)
+{
+    angle::FastVector<GLuint, 16> releasedHandles;
+    angle::FastVector<ResourceType *, 16> resources;
+    for (size_t index = 0; index < count; ++index)
+    {
+        ResourceType *resource = nullptr;
+        if (!mObjectMap.erase(handles[index], &resource))
+        {
+            continue;
+        }
+
+        releasedHandles.push_back(GetIDValue(handles[index]));
+        if (resource)
+        {
+            resources.push_back(resource);
+        }
+    }
+
+    // Requires an explicit this-> because of C++ template rules.
+    this->mHandleAllocator.release(
+        angle::Span<const GLuint>(releasedHandles.data(), releasedHandles.size()));
+
+    for (ResourceType *resource : resources)
+    {
+        ImplT::DeleteObject(context, resource);
+    }
+}
+
 template class TypedResourceManager<Buffer, BufferManager, BufferID>;
 template class TypedResourceManager<Texture, TextureManager, TextureID>;
 template class TypedResourceManager<Renderbuffer, RenderbufferManager, RenderbufferID>;
@@ -130,6 +177,11 @@ BufferID BufferManager::createBuffer()
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
 }
 
+void BufferManager::createBuffers(size_t count, BufferID *buffersOut)
+{
+    AllocateEmptyObjects(&mHandleAllocator, &mObjectMap, count, buffersOut);
+}
+
 Buffer *BufferManager::getBuffer(BufferID handle) const
 {
     return mObjectMap.query(handle);
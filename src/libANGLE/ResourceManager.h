@@ -69,6 +69,8 @@ class TypedResourceManager : public ResourceManagerBase
     TypedResourceManager() {}
 
     void deleteObject(const Context *context, IDType handle);
+    // Deletes the objects of |count| handles, releasing their handles together.
+    void deleteObjects(const Context *context, size_t count, const IDType *handles);
     ANGLE_INLINE bool isHandleGenerated(IDType handle) const
     {
         // Zero is always assumed to have been generated implicitly.
@@ -144,6 +146,7 @@ class BufferManager
 {
   public:
     BufferID createBuffer();
+    void createBuffers(size_t count, BufferID *buffersOut);
     Buffer *getBuffer(BufferID handle) const;
 
     ANGLE_INLINE Buffer *checkBufferAllocation(rx::GLImplFactory *factory, BufferID handle)
@@ -6,11 +6,15 @@
 // ResourceMap:
 //   An optimized resource map which packs the first set of allocated objects into a
 //   flat array, and then falls back to an unordered map for the higher handle values.
+//   Maps that are accessed without holding the share group lock keep the handles above the
+//   flat array in lazily allocated pages instead, so that they too can be queried lock-free.
 //
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
 #define LIBANGLE_RESOURCE_MAP_H_
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <type_traits>
 
@@ -126,6 +130,12 @@ class ResourceMap final : angle::NonCopyable
             return (value == InvalidPointer() ? nullptr : value);
         }
 
+        if (kNeedsLock && handle < kPagedResourcesLimit)
+        {
+            ResourceType *value = findInPagedResources(handle);
+            return (value == InvalidPointer() ? nullptr : value);
+        }
+
         return findInHashedResources(handle);
     }
 
@@ -179,8 +189,11 @@ class ResourceMap final : angle::NonCopyable
     Iterator beginWithNull() const;
     Iterator endWithNull() const;
 
-    // Used by iterators and related functions only (due to lack of thread safety).
+    // Used by iterators and related functions only (due to lack of thread safety).  The flat
+    // indices of the iterators also cover the paged resources.
     GLuint nextResource(size_t flatIndex, bool skipNulls) const;
+    GLuint flatAndPagedResourcesEnd() const;
+    ResourceType *getFlatOrPagedResource(GLuint index) const;
 
     // constexpr methods cannot contain reinterpret_cast, so we need a static method.
     static ResourceType *InvalidPointer();
@@ -200,6 +213,22 @@ class ResourceMap final : angle::NonCopyable
     static_assert(((kFlatResourcesLimit / kInitialFlatResourcesSize) &
                    (kFlatResourcesLimit / kInitialFlatResourcesSize - 1)) == 0);
 
+    // Maps that need a lock keep the handles between the flat map and |kPagedResourcesLimit| in
+    // pages of |kPageSize| handles.  Like the flat map, the pages can be accessed without a lock.
+    static constexpr size_t kPageSize            = 1024;
+    static constexpr size_t kPagedResourcesLimit = kNeedsLock ? 0x100000 : 0;
+    static constexpr size_t kPageCount           = kPagedResourcesLimit / kPageSize;
+    static_assert(kPagedResourcesLimit % kPageSize == 0);
+    static_assert(!kNeedsLock || kInitialFlatResourcesSize < kPagedResourcesLimit);
+
+    ResourceType **getPage(GLuint handle) const
+    {
+        return mPages[handle / kPageSize].load(std::memory_order_acquire);
+    }
+    ResourceType *findInPagedResources(GLuint handle) const;
+    void assignInPagedResources(GLuint handle, ResourceType *resource);
+    void clearPagedResources();
+
     bool containsInHashedResources(GLuint handle) const;
     ResourceType *findInHashedResources(GLuint handle) const;
     bool eraseFromHashedResources(GLuint handle, ResourceType **resourceOut);
@@ -209,6 +238,11 @@ class ResourceMap final : angle::NonCopyable
     size_t mFlatResourcesSize;
     ResourceType **mFlatResources;
 
+    // Pages of the handles above the flat map, for maps that need a lock.  A page is allocated by
+    // the first assignment of one of its handles and is only freed when the map is cleared, so
+    // that lock-free readers never see a page being freed.
+    std::unique_ptr<std::atomic<ResourceType **>[]> mPages;
+
     // A map of GL objects indexed by object ID.
     HashMap mHashedResources;
 
@@ -218,11 +252,11 @@ class ResourceMap final : angle::NonCopyable
     // |kFlatResourcesLimit|, but only for maps that don't need a lock (kNeedsLock == false).
     //
     // For maps that don't need a lock, this mutex is a no-op.  For those that do, the mutex is
-    // taken when allocating / deleting objects, as well as when accessing |mHashedResources|.
-    // Otherwise, access to the flat map (which never gets reallocated due to
-    // |kInitialFlatResourcesSize == kFlatResourcesLimit|) is lockless.  This latter is possible
-    // because the application is not allowed to gen/delete and bind the same ID in different
-    // threads at the same time.
+    // taken when allocating a page, as well as when accessing |mHashedResources|.  Otherwise,
+    // access to the flat map (which never gets reallocated due to
+    // |kInitialFlatResourcesSize == kFlatResourcesLimit|) and to the pages is lockless.  This
+    // latter is possible because the application is not allowed to gen/delete and bind the same
+    // ID in different threads at the same time.
     //
     // Note that because HandleAllocator is not yet thread-safe, glGen* and glDelete* functions
     // cannot be free of the share group mutex yet.  To remove the share group mutex from those
@@ -261,15 +295,66 @@ ResourceMap<ResourceType, IDType>::ResourceMap()
       mFlatResources(new ResourceType *[kInitialFlatResourcesSize])
 {
     memset(mFlatResources, kInvalidPointer, mFlatResourcesSize * sizeof(mFlatResources[0]));
+
+    if constexpr (kNeedsLock)
+    {
+        mPages.reset(new std::atomic<ResourceType **>[kPageCount]);
+        for (size_t pageIndex = 0; pageIndex < kPageCount; ++pageIndex)
+        {
+            mPages[pageIndex].store(nullptr, std::memory_order_relaxed);
+        }
+    }
 }
 
 template <typename ResourceType, typename IDType>
 ResourceMap<ResourceType, IDType>::~ResourceMap()
 {
     ASSERT(begin() == end());
+    clearPagedResources();
     delete[] mFlatResources;
 }
 
+template <typename ResourceType, typename IDType>
+ResourceType *ResourceMap<ResourceType, IDType>::findInPagedResources(GLuint handle) const
+{
+    ResourceType **page = getPage(handle);
+    return (page == nullptr ? InvalidPointer() : page[handle % kPageSize]);
+}
+
+template <typename ResourceType, typename IDType>
+void ResourceMap<ResourceType, IDType>::assignInPagedResources(GLuint handle,
+                                                               ResourceType *resource)
+{
+    ResourceType **page = getPage(handle);
+    if (page == nullptr)
+    {
+        // Another thread may be allocating the same page for a different handle.
+        std::lock_guard<Mutex> lock(mMutex);
+
+        page = getPage(handle);
+        if (page == nullptr)
+        {
+            page = new ResourceType *[kPageSize];
+            memset(page, kInvalidPointer, kPageSize * sizeof(page[0]));
+            mPages[handle / kPageSize].store(page, std::memory_order_release);
+        }
+    }
+
+    page[handle % kPageSize] = resource;
+}
+
+template <typename ResourceType, typename IDType>
+void ResourceMap<ResourceType, IDType>::clearPagedResources()
+{
+    if constexpr (kNeedsLock)
+    {
+        for (size_t pageIndex = 0; pageIndex < kPageCount; ++pageIndex)
+        {
+            delete[] mPages[pageIndex].exchange(nullptr, std::memory_order_relaxed);
+        }
+    }
+}
+
 template <typename ResourceType, typename IDType>
 bool ResourceMap<ResourceType, IDType>::containsInHashedResources(GLuint handle) const
 {
@@ -313,6 +398,11 @@ ANGLE_INLINE bool ResourceMap<ResourceType, IDType>::contains(IDType id) const
         return mFlatResources[handle] != InvalidPointer();
     }
 
+    if (kNeedsLock && handle < kPagedResourcesLimit)
+    {
+        return findInPagedResources(handle) != InvalidPointer();
+    }
+
     return containsInHashedResources(handle);
 }
 
@@ -332,6 +422,18 @@ bool ResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resource
         return true;
     }
 
+    if (kNeedsLock && handle < kPagedResourcesLimit)
+    {
+        ResourceType **page = getPage(handle);
+        if (page == nullptr || page[handle % kPageSize] == InvalidPointer())
+        {
+            return false;
+        }
+        *resourceOut             = page[handle % kPageSize];
+        page[handle % kPageSize] = InvalidPointer();
+        return true;
+    }
+
     return eraseFromHashedResources(handle, resourceOut);
 }
 
@@ -364,6 +466,10 @@ void ResourceMap<ResourceType, IDType>::assignAboveCurrentFlatSize(GLuint handle
         ASSERT(mFlatResourcesSize > handle);
         mFlatResources[handle] = resource;
     }
+    else if (kNeedsLock && handle < kPagedResourcesLimit)
+    {
+        assignInPagedResources(handle, resource);
+    }
     else
     {
         std::lock_guard<Mutex> lock(mMutex);
@@ -395,7 +501,7 @@ typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, I
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::end() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end(), true);
+    return Iterator(*this, flatAndPagedResourcesEnd(), mHashedResources.end(), true);
 }
 
 template <typename ResourceType, typename IDType>
@@ -409,7 +515,7 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator
 ResourceMap<ResourceType, IDType>::endWithNull() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end(), false);
+    return Iterator(*this, flatAndPagedResourcesEnd(), mHashedResources.end(), false);
 }
 
 template <typename ResourceType, typename IDType>
@@ -424,6 +530,7 @@ void ResourceMap<ResourceType, IDType>::clear()
     // No need for a lock as this is only called on destruction.
     memset(mFlatResources, kInvalidPointer, kInitialFlatResourcesSize * sizeof(mFlatResources[0]));
     mFlatResourcesSize = kInitialFlatResourcesSize;
+    clearPagedResources();
     mHashedResources.clear();
 }
 
@@ -432,15 +539,35 @@ GLuint ResourceMap<ResourceType, IDType>::nextResource(size_t flatIndex, bool sk
 {
     // This function is only used by the iterators, access to which is marked by
     // UnsafeResourceMapIter.  Locking is the responsibility of the caller.
-    for (size_t index = flatIndex; index < mFlatResourcesSize; index++)
+    const GLuint end = flatAndPagedResourcesEnd();
+    for (size_t index = flatIndex; index < end; index++)
     {
-        if ((mFlatResources[index] != nullptr || !skipNulls) &&
-            mFlatResources[index] != InvalidPointer())
+        if (index >= mFlatResourcesSize && getPage(static_cast<GLuint>(index)) == nullptr)
+        {
+            // Skip the rest of the missing page.
+            index = (index / kPageSize + 1) * kPageSize - 1;
+            continue;
+        }
+
+        ResourceType *value = getFlatOrPagedResource(static_cast<GLuint>(index));
+        if ((value != nullptr || !skipNulls) && value != InvalidPointer())
         {
             return static_cast<GLuint>(index);
         }
     }
-    return static_cast<GLuint>(mFlatResourcesSize);
+    return end;
+}
+
+template <typename ResourceType, typename IDType>
+GLuint ResourceMap<ResourceType, IDType>::flatAndPagedResourcesEnd() const
+{
+    return static_cast<GLuint>(kNeedsLock ? kPagedResourcesLimit : mFlatResourcesSize);
+}
+
+template <typename ResourceType, typename IDType>
+ResourceType *ResourceMap<ResourceType, IDType>::getFlatOrPagedResource(GLuint index) const
+{
+    return index < mFlatResourcesSize ? mFlatResources[index] : findInPagedResources(index);
 }
 
 template <typename ResourceType, typename IDType>
@@ -477,7 +604,7 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator &
 ResourceMap<ResourceType, IDType>::Iterator::operator++()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mFlatIndex < mOrigin.flatAndPagedResourcesEnd())
     {
         mFlatIndex = mOrigin.nextResource(mFlatIndex + 1, mSkipNulls);
     }
@@ -506,10 +633,10 @@ ResourceMap<ResourceType, IDType>::Iterator::operator*() const
 template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::Iterator::updateValue()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mFlatIndex < mOrigin.flatAndPagedResourcesEnd())
     {
         mValue.first  = mFlatIndex;
-        mValue.second = mOrigin.mFlatResources[mFlatIndex];
+        mValue.second = mOrigin.getFlatOrPagedResource(mFlatIndex);
     }
     else if (mHashIndex != mOrigin.mHashedResources.end())
     {
@@ -200,6 +200,78 @@ TEST(ResourceMapTest, QueryUnassignedLocked)
     QueryUnassigned<LockedType>();
 }
 
+template <typename T>
+void IterateWideIds()
+{
+    // Ids in the flat map, in the pages of the locked maps, and above them.
+    const std::vector<T> ids = {1, 100, 191, 192, 1000, 1023, 1024, 5000, 0xFFFFF, 0x100000,
+                                0x123456};
+
+    ResourceMap<size_t, T> resourceMap;
+    std::vector<size_t> objects(ids.size());
+
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        resourceMap.assign(ids[index], &objects[index]);
+    }
+    // A reserved id.
+    constexpr T kReservedId = 3000;
+    resourceMap.assign(kReservedId, nullptr);
+
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        EXPECT_TRUE(resourceMap.contains(ids[index]));
+        EXPECT_EQ(&objects[index], resourceMap.query(ids[index]));
+    }
+    EXPECT_TRUE(resourceMap.contains(kReservedId));
+    EXPECT_EQ(nullptr, resourceMap.query(kReservedId));
+    EXPECT_FALSE(resourceMap.contains(1025));
+    EXPECT_FALSE(resourceMap.contains(0x80000));
+
+    std::map<GLuint, size_t *> iterated;
+    for (const auto &idValue : UnsafeResourceMapIter(resourceMap))
+    {
+        EXPECT_TRUE(iterated.emplace(idValue.first, idValue.second).second);
+    }
+    EXPECT_EQ(iterated.size(), ids.size());
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        EXPECT_EQ(iterated[ids[index]], &objects[index]);
+    }
+
+    size_t withNullCount = 0;
+    for (auto it = UnsafeResourceMapIter(resourceMap).beginWithNull();
+         it != UnsafeResourceMapIter(resourceMap).endWithNull(); ++it)
+    {
+        ++withNullCount;
+    }
+    EXPECT_EQ(withNullCount, ids.size() + 1);
+
+    for (size_t index = 0; index < ids.size(); ++index)
+    {
+        size_t *found = nullptr;
+        ASSERT_TRUE(resourceMap.erase(ids[index], &found));
+        ASSERT_EQ(&objects[index], found);
+        ASSERT_FALSE(resourceMap.erase(ids[index], &found));
+    }
+    size_t *found = nullptr;
+    ASSERT_TRUE(resourceMap.erase(kReservedId, &found));
+    ASSERT_EQ(nullptr, found);
+
+    ASSERT_TRUE(UnsafeResourceMapIter(resourceMap).empty());
+}
+
+// Tests iterating over and erasing ids spread over the whole range.
+TEST(ResourceMapTest, IterateWideIdsLockless)
+{
+    IterateWideIds<LocklessType>();
+}
+// Tests iterating over and erasing ids spread over the whole range.
+TEST(ResourceMapTest, IterateWideIdsLocked)
+{
+    IterateWideIds<LockedType>();
+}
+
 void ConcurrentAccess(size_t iterations, size_t idCycleSize)
 {
     if (std::is_same_v<ResourceMapMutex, angle::NoOpMutex>)
@@ -699,14 +699,15 @@ void Shader::compile(const Context *context, angle::JobResultExpectancy resultEx
 
     // Find a shader in Blob Cache
     Compiler *compiler = context->getCompiler();
-    setShaderKey(context, options, compiler->getShaderOutputType(),
-                 compiler->getBuiltInResources());
+    computeShaderKey(context, ShaderCacheKeyType::Source, mState.getSource(), options,
+                     compiler->getShaderOutputType(), compiler->getBuiltInResources(),
+                     &mShaderHash);
     ASSERT(!mShaderHash.empty());
     MemoryShaderCache *shaderCache = context->getMemoryShaderCache();
     if (shaderCache != nullptr)
     {
-        egl::CacheGetResult result =
-            shaderCache->getShader(context, this, mShaderHash, resultExpectancy);
+        egl::CacheGetResult result = shaderCache->getShader(
+            context, this, mShaderHash, ShaderCacheKeyType::Source, resultExpectancy);
         switch (result)
         {
             case egl::CacheGetResult::Success:
@@ -729,6 +730,47 @@ void Shader::compile(const Context *context, angle::JobResultExpectancy resultEx
     ShHandle compilerHandle             = compilerInstance.getHandle();
     ASSERT(compilerHandle);
 
+    // Permutations of a shader that only differ in comments, whitespace or macros they don't use
+    // compile to the same results.  Look the shader up by the tokens its source preprocesses to.
+    mPreprocessedShaderHash.reset();
+    if (shaderCache != nullptr &&
+        context->getFrontendFeatures().cacheShadersByPreprocessedSource.enabled)
+    {
+        const char *source = mState.mSource.c_str();
+        std::string tokenStream;
+        if (sh::GetPreprocessedTokenStream(compilerHandle, &source, 1, options, &tokenStream))
+        {
+            egl::BlobCache::Key preprocessedShaderHash;
+            computeShaderKey(context, ShaderCacheKeyType::PreprocessedSource, tokenStream, options,
+                             compiler->getShaderOutputType(), compiler->getBuiltInResources(),
+                             &preprocessedShaderHash);
+
+            egl::CacheGetResult result =
+                shaderCache->getShader(context, this, preprocessedShaderHash,
+                                       ShaderCacheKeyType::PreprocessedSource, resultExpectancy);
+            if (result == egl::CacheGetResult::Success)
+            {
+                mBoundCompiler->putInstance(std::move(compilerInstance));
+
+                // Save the shader under its source key as well, so the next compile of the same
+                // source is found without running the preprocessor.
+                if (shaderCache->putShader(context, mShaderHash, this) != angle::Result::Continue)
+                {
+                    ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
+                                       "Failed to save compiled shader to memory shader cache.");
+                }
+                return;
+            }
+            if (result == egl::CacheGetResult::Rejected)
+            {
+                mState.mCompiledState =
+                    std::make_shared<CompiledShaderState>(mState.getShaderType());
+            }
+
+            mPreprocessedShaderHash = preprocessedShaderHash;
+        }
+    }
+
     // Cache load failed, fall through normal compiling.
     mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
 
@@ -790,6 +832,13 @@ void Shader::resolveCompile(const Context *context)
                     ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                                        "Failed to save compiled shader to memory shader cache.");
                 }
+                if (mPreprocessedShaderHash.valid() &&
+                    shaderCache->putShader(context, mPreprocessedShaderHash.value(), this) !=
+                        angle::Result::Continue)
+                {
+                    ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
+                                       "Failed to save compiled shader to memory shader cache.");
+                }
             }
         }
 
@@ -953,7 +1002,8 @@ bool Shader::loadBinaryImpl(const Context *context,
         ShBuiltInResources resources;
         stream.readBytes(reinterpret_cast<uint8_t *>(&resources), sizeof(ShBuiltInResources));
 
-        setShaderKey(context, compileOptions, outputType, resources);
+        computeShaderKey(context, ShaderCacheKeyType::Source, mState.getSource(), compileOptions,
+                         outputType, resources, &mShaderHash);
     }
     else
     {
@@ -988,18 +1038,23 @@ bool Shader::loadBinaryImpl(const Context *context,
     return true;
 }
 
-void Shader::setShaderKey(const Context *context,
-                          const ShCompileOptions &compileOptions,
-                          const ShShaderOutput &outputType,
-                          const ShBuiltInResources &resources)
+void Shader::computeShaderKey(const Context *context,
+                              ShaderCacheKeyType keyType,
+                              const std::string &source,
+                              const ShCompileOptions &compileOptions,
+                              const ShShaderOutput &outputType,
+                              const ShBuiltInResources &resources,
+                              egl::BlobCache::Key *keyOut) const
 {
     // Compute shader key.
     angle::base::SecureHashAlgorithm hasher;
     hasher.Init();
 
-    // Start with the shader type and source.
+    // Start with the shader type and source.  The key type keeps keys derived from preprocessed
+    // sources apart from keys derived from sources.
     AppendHashValue(hasher, mState.getShaderType());
-    hasher.Update(mState.getSource().c_str(), mState.getSource().length());
+    AppendHashValue(hasher, keyType);
+    hasher.Update(source.c_str(), source.length());
 
     // Include the shader program version hash.
     hasher.Update(angle::GetANGLEShaderProgramVersion(),
@@ -1015,7 +1070,7 @@ void Shader::setShaderKey(const Context *context,
 
     // Call the secure SHA hashing function.
     hasher.Final();
-    memcpy(mShaderHash.data(), hasher.Digest(), angle::base::kSHA1Length);
+    memcpy(keyOut->data(), hasher.Digest(), angle::base::kSHA1Length);
 }
 
 bool WaitCompileJobUnlocked(const SharedCompileJob &compileJob)
@@ -52,6 +52,7 @@ class ShaderProgramManager;
 class State;
 class BinaryInputStream;
 class BinaryOutputStream;
+enum class ShaderCacheKeyType;
 
 // We defer the compile until link time, or until properties are queried.
 enum class CompileStatus
@@ -212,11 +213,15 @@ class Shader final : angle::NonCopyable, public LabeledObject
                         angle::JobResultExpectancy resultExpectancy,
                         bool generatedWithOfflineCompiler);
 
-    // Compute a key to uniquely identify the shader object in memory caches.
-    void setShaderKey(const Context *context,
-                      const ShCompileOptions &compileOptions,
-                      const ShShaderOutput &outputType,
-                      const ShBuiltInResources &resources);
+    // Compute a key to uniquely identify the shader object in memory caches.  |source| is either
+    // the shader source or the token stream it preprocesses to, depending on |keyType|.
+    void computeShaderKey(const Context *context,
+                          ShaderCacheKeyType keyType,
+                          const std::string &source,
+                          const ShCompileOptions &compileOptions,
+                          const ShShaderOutput &outputType,
+                          const ShBuiltInResources &resources,
+                          egl::BlobCache::Key *keyOut) const;
 
     ShaderState mState;
     std::unique_ptr<rx::ShaderImpl> mImplementation;
@@ -230,6 +235,8 @@ class Shader final : angle::NonCopyable, public LabeledObject
     BindingPointer<Compiler> mBoundCompiler;
     SharedCompileJob mCompileJob;
     egl::BlobCache::Key mShaderHash;
+    // Set when the shader is compiled from source with cacheShadersByPreprocessedSource.
+    Optional<egl::BlobCache::Key> mPreprocessedShaderHash;
 
     ShaderProgramManager *mResourceManager;
 };
@@ -15,6 +15,7 @@
 #include <limits>
 
 #define USE_SYSTEM_ZLIB
+#include "common/lz_codec.h"
 #include "compression_utils_portable.h"
 
 namespace gl
@@ -1055,8 +1056,108 @@ GLsizeiptr GetBoundBufferAvailableSize(const OffsetBindingPointer<Buffer> &bindi
    //
 namespace angle
 {
-bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData)
+namespace
+{
+// Header of blobs compressed with BlobCompressionCodec::FastLZ.  The tag can't start a gzip
+// stream, whose first two bytes are 0x1F 0x8B, so zlib blobs are told apart by their first bytes.
+struct FastLZBlobHeader
+{
+    uint8_t tag[4];
+    uint32_t uncompressedSize;
+    // Hash of the uncompressed data, to detect corruption.
+    uint64_t checksum;
+};
+constexpr uint8_t kFastLZBlobTag[4]    = {'A', 'L', 'Z', '1'};
+constexpr uint64_t kFastLZChecksumSeed = 0xABCDEF98;
+
+bool IsFastLZBlob(const uint8_t *compressedData, const size_t compressedSize)
+{
+    return compressedSize >= sizeof(FastLZBlobHeader) &&
+           memcmp(compressedData, kFastLZBlobTag, sizeof(kFastLZBlobTag)) == 0;
+}
+
+bool CompressFastLZBlob(const size_t cacheSize,
+                        const uint8_t *cacheData,
+                        MemoryBuffer *compressedData)
+{
+    if (cacheSize > std::numeric_limits<uint32_t>::max())
+    {
+        ERR() << "Cache data too large to compress";
+        return false;
+    }
+
+    if (!compressedData->clearAndReserve(sizeof(FastLZBlobHeader) + LZCompressBound(cacheSize)))
+    {
+        ERR() << "Failed to allocate memory for compression";
+        return false;
+    }
+
+    FastLZBlobHeader header;
+    memcpy(header.tag, kFastLZBlobTag, sizeof(kFastLZBlobTag));
+    header.uncompressedSize = static_cast<uint32_t>(cacheSize);
+    header.checksum         = XXH64(cacheData, cacheSize, kFastLZChecksumSeed);
+    memcpy(compressedData->data(), &header, sizeof(header));
+
+    const size_t payloadSize =
+        LZCompress(cacheData, cacheSize, compressedData->data() + sizeof(header));
+    compressedData->setSize(sizeof(header) + payloadSize);
+
+    return true;
+}
+
+bool DecompressFastLZBlob(const uint8_t *compressedData,
+                          const size_t compressedSize,
+                          size_t maxUncompressedDataSize,
+                          MemoryBuffer *uncompressedData)
+{
+    FastLZBlobHeader header;
+    memcpy(&header, compressedData, sizeof(header));
+
+    if (header.uncompressedSize == 0)
+    {
+        ERR() << "Decompressed data size is zero. Wrong or corrupted data? (compressed size is: "
+              << compressedSize << ")";
+        return false;
+    }
+
+    if (header.uncompressedSize > maxUncompressedDataSize)
+    {
+        ERR() << "Decompressed data size is larger than the maximum supported ("
+              << header.uncompressedSize << " vs " << maxUncompressedDataSize << ")";
+        return false;
+    }
+
+    if (!uncompressedData->clearAndReserve(header.uncompressedSize))
+    {
+        ERR() << "Failed to allocate memory for decompression";
+        return false;
+    }
+
+    if (!LZDecompress(compressedData + sizeof(header), compressedSize - sizeof(header),
+                      uncompressedData->data(), header.uncompressedSize) ||
+        XXH64(uncompressedData->data(), header.uncompressedSize, kFastLZChecksumSeed) !=
+            header.checksum)
+    {
+        WARN() << "Failed to decompress data: corrupted blob\n";
+        return false;
+    }
+
+    uncompressedData->setSize(header.uncompressedSize);
+
+    return true;
+}
+}  // anonymous namespace
+
+bool CompressBlob(const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  MemoryBuffer *compressedData,
+                  BlobCompressionCodec codec)
 {
+    if (codec == BlobCompressionCodec::FastLZ)
+    {
+        return CompressFastLZBlob(cacheSize, cacheData, compressedData);
+    }
+
     uLong uncompressedSize       = static_cast<uLong>(cacheSize);
     uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
     uLong actualCompressedSize   = expectedCompressedSize;
@@ -1089,6 +1190,12 @@ bool DecompressBlob(const uint8_t *compressedData,
                     size_t maxUncompressedDataSize,
                     MemoryBuffer *uncompressedData)
 {
+    if (IsFastLZBlob(compressedData, compressedSize))
+    {
+        return DecompressFastLZBlob(compressedData, compressedSize, maxUncompressedDataSize,
+                                    uncompressedData);
+    }
+
     // Call zlib function to decompress.
     uint32_t uncompressedSize =
         zlib_internal::GetGzipUncompressedSize(compressedData, compressedSize);
@@ -1335,7 +1335,19 @@ class BlobCacheValue  // To be replaced with std::span when C++20 is required
     size_t mSize;
 };
 
-bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData);
+enum class BlobCompressionCodec : uint8_t
+{
+    // gzip.  Compresses best.
+    Zlib,
+    // The LZ codec in common/lz_codec.h.  Compresses and decompresses several times faster.
+    FastLZ,
+};
+
+// Blobs record their codec, so DecompressBlob handles blobs of either codec.
+bool CompressBlob(const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  MemoryBuffer *compressedData,
+                  BlobCompressionCodec codec = BlobCompressionCodec::Zlib);
 bool DecompressBlob(const uint8_t *compressedData,
                     const size_t compressedSize,
                     size_t maxUncompressedDataSize,
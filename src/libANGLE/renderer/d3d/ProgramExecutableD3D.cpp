@@ -2610,10 +2610,12 @@ void ProgramExecutableD3D::setUniformMatrixfvInternal(GLint location,
     {
         if (targetUniform->mShaderData[shaderType])
         {
-            SetFloatUniformMatrixHLSL<cols, rows>::Run(arrayElementOffset, elementCount, countIn,
-                                                       transpose, value,
-                                                       targetUniform->mShaderData[shaderType]);
-            mShaderUniformsDirty.set(shaderType);
+            if (SetFloatUniformMatrixHLSL<cols, rows>::Run(arrayElementOffset, elementCount,
+                                                           countIn, transpose, value,
+                                                           targetUniform->mShaderData[shaderType]))
+            {
+                mShaderUniformsDirty.set(shaderType);
+            }
         }
     }
 }
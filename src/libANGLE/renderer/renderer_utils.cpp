@@ -269,7 +269,7 @@ template <typename T,
           bool IsDstColumnMajor,
           int colsDst,
           int rowsDst>
-void ExpandMatrix(T *target, const GLfloat *value)
+bool ExpandMatrix(T *target, const GLfloat *value)
 {
     static_assert(colsSrc <= colsDst && rowsSrc <= rowsDst, "Can only expand!");
 
@@ -290,7 +290,12 @@ void ExpandMatrix(T *target, const GLfloat *value)
         }
     }
 
+    if (memcmp(target, staging, kDstFlatSize * sizeof(T)) == 0)
+    {
+        return false;
+    }
     memcpy(target, staging, kDstFlatSize * sizeof(T));
+    return true;
 }
 
 template <bool IsSrcColumMajor,
@@ -299,7 +304,7 @@ template <bool IsSrcColumMajor,
           bool IsDstColumnMajor,
           int colsDst,
           int rowsDst>
-void SetFloatUniformMatrix(unsigned int arrayElementOffset,
+bool SetFloatUniformMatrix(unsigned int arrayElementOffset,
                            unsigned int elementCount,
                            GLsizei countIn,
                            const GLfloat *value,
@@ -312,17 +317,22 @@ void SetFloatUniformMatrix(unsigned int arrayElementOffset,
     GLfloat *target                       = reinterpret_cast<GLfloat *>(
         targetData + arrayElementOffset * sizeof(GLfloat) * targetMatrixStride);
 
+    bool changed = false;
     for (unsigned int i = 0; i < count; i++)
     {
-        ExpandMatrix<GLfloat, IsSrcColumMajor, colsSrc, rowsSrc, IsDstColumnMajor, colsDst,
-                     rowsDst>(target, value);
+        if (ExpandMatrix<GLfloat, IsSrcColumMajor, colsSrc, rowsSrc, IsDstColumnMajor, colsDst,
+                         rowsDst>(target, value))
+        {
+            changed = true;
+        }
 
         target += targetMatrixStride;
         value += colsSrc * rowsSrc;
     }
+    return changed;
 }
 
-void SetFloatUniformMatrixFast(unsigned int arrayElementOffset,
+bool SetFloatUniformMatrixFast(unsigned int arrayElementOffset,
                                unsigned int elementCount,
                                GLsizei countIn,
                                size_t matrixSize,
@@ -335,7 +345,12 @@ void SetFloatUniformMatrixFast(unsigned int arrayElementOffset,
     const uint8_t *valueData = reinterpret_cast<const uint8_t *>(value);
     targetData               = targetData + arrayElementOffset * matrixSize;
 
+    if (memcmp(targetData, valueData, matrixSize * count) == 0)
+    {
+        return false;
+    }
     memcpy(targetData, valueData, matrixSize * count);
+    return true;
 }
 }  // anonymous namespace
 
@@ -855,7 +870,7 @@ angle::Result IncompleteTextureSet::getIncompleteTexture(
 }
 
 #define ANGLE_INSTANTIATE_SET_UNIFORM_MATRIX_FUNC(api, cols, rows) \
-    template void SetFloatUniformMatrix##api<cols, rows>::Run(     \
+    template bool SetFloatUniformMatrix##api<cols, rows>::Run(     \
         unsigned int, unsigned int, GLsizei, GLboolean, const GLfloat *, uint8_t *)
 
 ANGLE_INSTANTIATE_SET_UNIFORM_MATRIX_FUNC(GLSL, 2, 2);
@@ -875,13 +890,13 @@ ANGLE_INSTANTIATE_SET_UNIFORM_MATRIX_FUNC(HLSL, 3, 4);
 #undef ANGLE_INSTANTIATE_SET_UNIFORM_MATRIX_FUNC
 
 #define ANGLE_SPECIALIZATION_ROWS_SET_UNIFORM_MATRIX_FUNC(api, cols, rows)                      \
-    template void SetFloatUniformMatrix##api<cols, 4>::Run(unsigned int, unsigned int, GLsizei, \
+    template bool SetFloatUniformMatrix##api<cols, 4>::Run(unsigned int, unsigned int, GLsizei, \
                                                            GLboolean, const GLfloat *, uint8_t *)
 
 template <int cols>
 struct SetFloatUniformMatrixGLSL<cols, 4>
 {
-    static void Run(unsigned int arrayElementOffset,
+    static bool Run(unsigned int arrayElementOffset,
                     unsigned int elementCount,
                     GLsizei countIn,
                     GLboolean transpose,
@@ -896,13 +911,13 @@ ANGLE_SPECIALIZATION_ROWS_SET_UNIFORM_MATRIX_FUNC(GLSL, 4, 4);
 #undef ANGLE_SPECIALIZATION_ROWS_SET_UNIFORM_MATRIX_FUNC
 
 #define ANGLE_SPECIALIZATION_COLS_SET_UNIFORM_MATRIX_FUNC(api, cols, rows)                      \
-    template void SetFloatUniformMatrix##api<4, rows>::Run(unsigned int, unsigned int, GLsizei, \
+    template bool SetFloatUniformMatrix##api<4, rows>::Run(unsigned int, unsigned int, GLsizei, \
                                                            GLboolean, const GLfloat *, uint8_t *)
 
 template <int rows>
 struct SetFloatUniformMatrixHLSL<4, rows>
 {
-    static void Run(unsigned int arrayElementOffset,
+    static bool Run(unsigned int arrayElementOffset,
                     unsigned int elementCount,
                     GLsizei countIn,
                     GLboolean transpose,
@@ -917,7 +932,7 @@ ANGLE_SPECIALIZATION_COLS_SET_UNIFORM_MATRIX_FUNC(HLSL, 4, 4);
 #undef ANGLE_SPECIALIZATION_COLS_SET_UNIFORM_MATRIX_FUNC
 
 template <int cols>
-void SetFloatUniformMatrixGLSL<cols, 4>::Run(unsigned int arrayElementOffset,
+bool SetFloatUniformMatrixGLSL<cols, 4>::Run(unsigned int arrayElementOffset,
                                              unsigned int elementCount,
                                              GLsizei countIn,
                                              GLboolean transpose,
@@ -930,19 +945,19 @@ void SetFloatUniformMatrixGLSL<cols, 4>::Run(unsigned int arrayElementOffset,
         // Both src and dst matrixs are has same layout,
         // a single memcpy updates all the matrices
         constexpr size_t srcMatrixSize = sizeof(GLfloat) * cols * 4;
-        SetFloatUniformMatrixFast(arrayElementOffset, elementCount, countIn, srcMatrixSize, value,
-                                  targetData);
+        return SetFloatUniformMatrixFast(arrayElementOffset, elementCount, countIn, srcMatrixSize,
+                                         value, targetData);
     }
     else
     {
         // fallback to general cases
-        SetFloatUniformMatrix<false, cols, 4, true, cols, 4>(arrayElementOffset, elementCount,
-                                                             countIn, value, targetData);
+        return SetFloatUniformMatrix<false, cols, 4, true, cols, 4>(
+            arrayElementOffset, elementCount, countIn, value, targetData);
     }
 }
 
 template <int cols, int rows>
-void SetFloatUniformMatrixGLSL<cols, rows>::Run(unsigned int arrayElementOffset,
+bool SetFloatUniformMatrixGLSL<cols, rows>::Run(unsigned int arrayElementOffset,
                                                 unsigned int elementCount,
                                                 GLsizei countIn,
                                                 GLboolean transpose,
@@ -953,18 +968,18 @@ void SetFloatUniformMatrixGLSL<cols, rows>::Run(unsigned int arrayElementOffset,
     // GLSL expects matrix uniforms to be column-major, and each column is padded to 4 rows.
     if (isSrcColumnMajor)
     {
-        SetFloatUniformMatrix<true, cols, rows, true, cols, 4>(arrayElementOffset, elementCount,
-                                                               countIn, value, targetData);
+        return SetFloatUniformMatrix<true, cols, rows, true, cols, 4>(
+            arrayElementOffset, elementCount, countIn, value, targetData);
     }
     else
     {
-        SetFloatUniformMatrix<false, cols, rows, true, cols, 4>(arrayElementOffset, elementCount,
-                                                                countIn, value, targetData);
+        return SetFloatUniformMatrix<false, cols, rows, true, cols, 4>(
+            arrayElementOffset, elementCount, countIn, value, targetData);
     }
 }
 
 template <int rows>
-void SetFloatUniformMatrixHLSL<4, rows>::Run(unsigned int arrayElementOffset,
+bool SetFloatUniformMatrixHLSL<4, rows>::Run(unsigned int arrayElementOffset,
                                              unsigned int elementCount,
                                              GLsizei countIn,
                                              GLboolean transpose,
@@ -977,19 +992,19 @@ void SetFloatUniformMatrixHLSL<4, rows>::Run(unsigned int arrayElementOffset,
         // Both src and dst matrixs are has same layout,
         // a single memcpy updates all the matrices
         constexpr size_t srcMatrixSize = sizeof(GLfloat) * 4 * rows;
-        SetFloatUniformMatrixFast(arrayElementOffset, elementCount, countIn, srcMatrixSize, value,
-                                  targetData);
+        return SetFloatUniformMatrixFast(arrayElementOffset, elementCount, countIn, srcMatrixSize,
+                                         value, targetData);
     }
     else
     {
         // fallback to general cases
-        SetFloatUniformMatrix<true, 4, rows, false, 4, rows>(arrayElementOffset, elementCount,
-                                                             countIn, value, targetData);
+        return SetFloatUniformMatrix<true, 4, rows, false, 4, rows>(
+            arrayElementOffset, elementCount, countIn, value, targetData);
     }
 }
 
 template <int cols, int rows>
-void SetFloatUniformMatrixHLSL<cols, rows>::Run(unsigned int arrayElementOffset,
+bool SetFloatUniformMatrixHLSL<cols, rows>::Run(unsigned int arrayElementOffset,
                                                 unsigned int elementCount,
                                                 GLsizei countIn,
                                                 GLboolean transpose,
@@ -1001,13 +1016,13 @@ void SetFloatUniformMatrixHLSL<cols, rows>::Run(unsigned int arrayElementOffset,
     // padded to 4 columns.
     if (!isSrcColumnMajor)
     {
-        SetFloatUniformMatrix<false, cols, rows, false, 4, rows>(arrayElementOffset, elementCount,
-                                                                 countIn, value, targetData);
+        return SetFloatUniformMatrix<false, cols, rows, false, 4, rows>(
+            arrayElementOffset, elementCount, countIn, value, targetData);
     }
     else
     {
-        SetFloatUniformMatrix<true, cols, rows, false, 4, rows>(arrayElementOffset, elementCount,
-                                                                countIn, value, targetData);
+        return SetFloatUniformMatrix<true, cols, rows, false, 4, rows>(
+            arrayElementOffset, elementCount, countIn, value, targetData);
     }
 }
 
@@ -1041,7 +1056,7 @@ BufferAndLayout::BufferAndLayout() = default;
 BufferAndLayout::~BufferAndLayout() = default;
 
 template <typename T>
-ANGLE_NOINLINE void UpdateBufferWithLayoutStrided(GLsizei count,
+ANGLE_NOINLINE bool UpdateBufferWithLayoutStrided(GLsizei count,
                                                   uint32_t arrayIndex,
                                                   int componentCount,
                                                   const T *v,
@@ -1051,6 +1066,7 @@ ANGLE_NOINLINE void UpdateBufferWithLayoutStrided(GLsizei count,
     const int elementSize = sizeof(T) * componentCount;
     uint8_t *dst          = uniformData->data() + layoutInfo.offset;
     int maxIndex          = arrayIndex + count;
+    bool changed          = false;
     for (int writeIndex = arrayIndex, readIndex = 0; writeIndex < maxIndex;
          writeIndex++, readIndex++)
     {
@@ -1058,12 +1074,17 @@ ANGLE_NOINLINE void UpdateBufferWithLayoutStrided(GLsizei count,
         uint8_t *writePtr     = dst + arrayOffset;
         const T *readPtr      = v + (readIndex * componentCount);
         ASSERT(writePtr + elementSize <= uniformData->data() + uniformData->size());
-        memcpy(writePtr, readPtr, elementSize);
+        if (memcmp(writePtr, readPtr, elementSize) != 0)
+        {
+            memcpy(writePtr, readPtr, elementSize);
+            changed = true;
+        }
     }
+    return changed;
 }
 
 template <typename T>
-ANGLE_INLINE void UpdateBufferWithLayout(GLsizei count,
+ANGLE_INLINE bool UpdateBufferWithLayout(GLsizei count,
                                          uint32_t arrayIndex,
                                          int componentCount,
                                          const T *v,
@@ -1078,13 +1099,18 @@ ANGLE_INLINE void UpdateBufferWithLayout(GLsizei count,
         uint32_t arrayOffset = arrayIndex * layoutInfo.arrayStride;
         uint8_t *writePtr    = dst + arrayOffset;
         ASSERT(writePtr + (elementSize * count) <= uniformData->data() + uniformData->size());
+        if (memcmp(writePtr, v, elementSize * count) == 0)
+        {
+            return false;
+        }
         memcpy(writePtr, v, elementSize * count);
+        return true;
     }
     else
     {
         // Have to respect the arrayStride between each element of the array.
-        UpdateBufferWithLayoutStrided(count, arrayIndex, componentCount, v, layoutInfo,
-                                      uniformData);
+        return UpdateBufferWithLayoutStrided(count, arrayIndex, componentCount, v, layoutInfo,
+                                             uniformData);
     }
 }
 
@@ -1143,6 +1169,7 @@ ANGLE_NOINLINE void SetUniformAsBool(const gl::ProgramExecutable *executable,
 
         GLint initialArrayOffset =
             locationInfo.arrayIndex * layoutInfo.arrayStride + layoutInfo.offset;
+        bool changed = false;
         for (GLint i = 0; i < count; i++)
         {
             GLint elementOffset = i * layoutInfo.arrayStride + initialArrayOffset;
@@ -1151,11 +1178,16 @@ ANGLE_NOINLINE void SetUniformAsBool(const gl::ProgramExecutable *executable,
 
             for (int c = 0; c < componentCount; c++)
             {
-                dst[c] = (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE;
+                const GLint value = (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE;
+                changed           = changed || dst[c] != value;
+                dst[c]            = value;
             }
         }
 
-        defaultUniformBlocksDirty->set(shaderType);
+        if (changed)
+        {
+            defaultUniformBlocksDirty->set(shaderType);
+        }
     }
 }
 
@@ -1186,10 +1218,13 @@ void SetUniform(const gl::ProgramExecutable *executable,
                 continue;
             }
 
+            // Setting a uniform to the value it already has doesn't need another upload.
             const GLint componentCount = linkedUniform.getElementComponents();
-            UpdateBufferWithLayout(count, locationInfo.arrayIndex, componentCount, v, layoutInfo,
-                                   &uniformBlock.uniformData);
-            defaultUniformBlocksDirty->set(shaderType);
+            if (UpdateBufferWithLayout(count, locationInfo.arrayIndex, componentCount, v,
+                                       layoutInfo, &uniformBlock.uniformData))
+            {
+                defaultUniformBlocksDirty->set(shaderType);
+            }
         }
     }
     else
@@ -1243,11 +1278,13 @@ void SetUniformMatrixfv(const gl::ProgramExecutable *executable,
             continue;
         }
 
-        SetFloatUniformMatrixGLSL<cols, rows>::Run(
-            locationInfo.arrayIndex, linkedUniform.getBasicTypeElementCount(), count, transpose,
-            value, uniformBlock.uniformData.data() + layoutInfo.offset);
-
-        defaultUniformBlocksDirty->set(shaderType);
+        // Setting a uniform to the value it already has doesn't need another upload.
+        if (SetFloatUniformMatrixGLSL<cols, rows>::Run(
+                locationInfo.arrayIndex, linkedUniform.getBasicTypeElementCount(), count,
+                transpose, value, uniformBlock.uniformData.data() + layoutInfo.offset))
+        {
+            defaultUniformBlocksDirty->set(shaderType);
+        }
     }
 }
 
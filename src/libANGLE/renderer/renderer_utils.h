@@ -18,6 +18,7 @@
 #include "GLSLANG/ShaderLang.h"
 #include "common/angleutils.h"
 #include "common/utilities.h"
+#include "image_util/loadimage.h"
 #include "libANGLE/ImageIndex.h"
 #include "libANGLE/angletypes.h"
 
@@ -25,7 +26,6 @@ namespace angle
 {
 struct FeatureSetBase;
 struct Format;
-struct ImageLoadContext;
 enum class FormatID : uint8_t;
 }  // namespace angle
 
@@ -163,16 +163,7 @@ using InitializeTextureDataFunction = void (*)(size_t width,
                                                size_t outputRowPitch,
                                                size_t outputDepthPitch);
 
-using LoadImageFunction = void (*)(const angle::ImageLoadContext &context,
-                                   size_t width,
-                                   size_t height,
-                                   size_t depth,
-                                   const uint8_t *input,
-                                   size_t inputRowPitch,
-                                   size_t inputDepthPitch,
-                                   uint8_t *output,
-                                   size_t outputRowPitch,
-                                   size_t outputDepthPitch);
+using LoadImageFunction = angle::LoadImageFunction;
 
 struct LoadImageFunctionInfo
 {
@@ -248,7 +239,7 @@ class IncompleteTextureSet final : angle::NonCopyable
 template <int cols, int rows>
 struct SetFloatUniformMatrixGLSL
 {
-    static void Run(unsigned int arrayElementOffset,
+    static bool Run(unsigned int arrayElementOffset,
                     unsigned int elementCount,
                     GLsizei countIn,
                     GLboolean transpose,
@@ -259,7 +250,7 @@ struct SetFloatUniformMatrixGLSL
 template <int cols, int rows>
 struct SetFloatUniformMatrixHLSL
 {
-    static void Run(unsigned int arrayElementOffset,
+    static bool Run(unsigned int arrayElementOffset,
                     unsigned int elementCount,
                     GLsizei countIn,
                     GLboolean transpose,
@@ -288,8 +279,9 @@ struct BufferAndLayout final : private angle::NonCopyable
     std::vector<sh::BlockMemberInfo> uniformLayout;
 };
 
+// Returns whether any byte of |uniformData| changed.
 template <typename T>
-void UpdateBufferWithLayout(GLsizei count,
+bool UpdateBufferWithLayout(GLsizei count,
                             uint32_t arrayIndex,
                             int componentCount,
                             const T *v,
@@ -425,6 +425,7 @@ angle::Result BufferVk::setExternalBufferData(const gl::Context *context,
 
     // Release and re-create the memory and buffer.
     ANGLE_TRY(release(contextVk));
+    mIndexRangeCache.clear();
 
     VkBufferCreateInfo createInfo    = {};
     createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -512,6 +513,7 @@ angle::Result BufferVk::setDataWithMemoryType(const gl::Context *context,
     // passed in data to fill the buffer, the flag will be updated when the data is copied to the
     // buffer.
     mHasValidData = false;
+    mIndexRangeCache.clear();
 
     if (size == 0)
     {
@@ -969,9 +971,24 @@ angle::Result BufferVk::getIndexRange(const gl::Context *context,
 
     ANGLE_TRACE_EVENT0("gpu.angle", "BufferVk::getIndexRange");
 
+    // A persistently mapped buffer can be written by the application at any time without
+    // notification, so the chunked cache cannot be trusted for it.
+    const bool isPersistentlyMapped =
+        mState.isMapped() && (mState.getAccessFlags() & GL_MAP_PERSISTENT_BIT_EXT) != 0;
+
     void *mapPtr;
-    ANGLE_TRY(mapRangeForReadAccessOnly(contextVk, offset, getSize(), &mapPtr));
-    *outRange = gl::ComputeIndexRange(type, mapPtr, count, primitiveRestartEnabled);
+    if (isPersistentlyMapped)
+    {
+        ANGLE_TRY(mapRangeForReadAccessOnly(contextVk, offset, getSize(), &mapPtr));
+        *outRange = gl::ComputeIndexRange(type, mapPtr, count, primitiveRestartEnabled);
+    }
+    else
+    {
+        ANGLE_TRY(mapForReadAccessOnly(contextVk, &mapPtr));
+        *outRange = mIndexRangeCache.getRange(static_cast<const uint8_t *>(mapPtr),
+                                              static_cast<size_t>(getSize()), type, offset, count,
+                                              primitiveRestartEnabled);
+    }
     ANGLE_TRY(unmapReadAccessOnly(contextVk));
 
     return angle::Result::Continue;
@@ -1300,6 +1317,8 @@ void BufferVk::dataRangeUpdated(const RangeDeviceSize &range)
     {
         buffer.addDirtyBufferRange(range);
     }
+    mIndexRangeCache.invalidateRange(static_cast<size_t>(range.low()),
+                                     static_cast<size_t>(range.length()));
     // Now we have valid data
     mHasValidData = true;
 }
@@ -1310,6 +1329,7 @@ void BufferVk::dataUpdated()
     {
         buffer.setEntireBufferDirty();
     }
+    mIndexRangeCache.clear();
     // Now we have valid data
     mHasValidData = true;
 }
@@ -367,6 +367,10 @@ class BufferVk : public BufferImpl
     // A cache of converted vertex data.
     std::vector<VertexConversionBuffer> mVertexConversionBuffers;
 
+    // Per-chunk index ranges of the buffer's contents, kept up to date by dataUpdated() and
+    // dataRangeUpdated().
+    gl::ChunkedIndexRangeCache mIndexRangeCache;
+
     // Tracks whether mStagingBuffer has been mapped to user or not
     bool mIsStagingBufferMapped;
 
@@ -59,6 +59,7 @@ class CLPlatformVk : public CLPlatformImpl, public vk::ErrorContext, public vk::
     // vk::GlobalOps
     void putBlob(const angle::BlobCacheKey &key, const angle::MemoryBuffer &value) override;
     bool getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *valueOut) override;
+    angle::BlobCompressionCodec getBlobCompressionCodec() const override;
     std::shared_ptr<angle::WaitableEvent> postMultiThreadWorkerTask(
         const std::shared_ptr<angle::Closure> &task) override;
     void notifyDeviceLost() override;
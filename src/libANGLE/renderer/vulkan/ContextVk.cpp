@@ -2201,6 +2201,11 @@ angle::Result ContextVk::createGraphicsPipeline()
             // here.
             mGraphicsPipelineLibraryTransition.reset();
         }
+
+        if (getFeatures().warmUpRecordedPipelinesAtLink.enabled)
+        {
+            executableVk->recordDrawGraphicsPipelineDesc(this, *mGraphicsPipelineDesc);
+        }
     }
 
     // Maintain the transition cache
@@ -3515,6 +3520,7 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
     mPerfCounters.vkQueueSubmitCallsPerFrame = commandQueuePerfCounters.vkQueueSubmitCallsPerFrame;
     mPerfCounters.commandQueueWaitSemaphoresTotal =
         commandQueuePerfCounters.commandQueueWaitSemaphoresTotal;
+    mRenderer->getPipelineCacheSyncPerfCounters(&mPerfCounters);
 
     // Return current drawFramebuffer's cache stats
     mPerfCounters.framebufferCacheSize = mShareGroupVk->getFramebufferCache().getSize();
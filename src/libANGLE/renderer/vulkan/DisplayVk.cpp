@@ -674,6 +674,11 @@ bool DisplayVk::getBlob(const angle::BlobCacheKey &key, angle::BlobCacheValue *v
     return getBlobCache()->get(nullptr, &mScratchBuffer, key, valueOut);
 }
 
+angle::BlobCompressionCodec DisplayVk::getBlobCompressionCodec() const
+{
+    return getBlobCache()->getCompressionCodec();
+}
+
 std::shared_ptr<angle::WaitableEvent> DisplayVk::postMultiThreadWorkerTask(
     const std::shared_ptr<angle::Closure> &task)
 {
@@ -8,6 +8,9 @@
 
 #include "libANGLE/renderer/vulkan/ProgramExecutableVk.h"
 
+#include "anglebase/sha1.h"
+#include "common/angle_version_info.h"
+#include "common/hash_utils.h"
 #include "common/string_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
@@ -27,6 +30,65 @@ namespace
 // Limit decompressed vulkan pipelines to 10MB per program.
 static constexpr size_t kMaxLocalPipelineCacheSize = 10 * 1024 * 1024;
 
+// The descs recorded by warmUpRecordedPipelinesAtLink are stored in the blob cache as a header
+// followed by the raw descs.  The key includes the ANGLE commit hash, so the layout of the stored
+// descs matches the one of the build that reads them.  The header holds a hash of the descs, so a
+// corrupt entry is dropped instead of being used to create pipelines.
+constexpr uint32_t kRecordedGraphicsPipelineDescsVersion = 1;
+
+// Draw calls with most programs use a handful of pipelines.  Warming up many more than that at
+// link time mostly takes worker threads away from other programs.
+constexpr size_t kMaxRecordedGraphicsPipelineDescs = 16;
+constexpr uint32_t kRecordedGraphicsPipelineDescSize =
+    static_cast<uint32_t>(vk::kGraphicsPipelineDescSize);
+
+ANGLE_ENABLE_STRUCT_PADDING_WARNINGS
+
+struct RecordedGraphicsPipelineDescsHeader
+{
+    uint32_t version;
+    uint32_t descSize;
+    uint32_t descCount;
+    uint32_t descsHash;
+};
+
+ANGLE_DISABLE_STRUCT_PADDING_WARNINGS
+
+void ComputeRecordedGraphicsPipelineDescsKey(
+    const VkPhysicalDeviceProperties &physicalDeviceProperties,
+    const gl::ShaderBitSet &linkedShaderStages,
+    const gl::ShaderMap<angle::spirv::Blob> &spirvBlobs,
+    angle::BlobCacheKey *keyOut)
+{
+    angle::base::SecureHashAlgorithm hasher;
+    hasher.Init();
+
+    constexpr char kTag[] = "ANGLE Recorded Graphics Pipelines";
+    hasher.Update(kTag, sizeof(kTag));
+    hasher.Update(angle::GetANGLECommitHash(), angle::GetANGLECommitHashSize());
+
+    hasher.Update(physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+    hasher.Update(&physicalDeviceProperties.vendorID, sizeof(physicalDeviceProperties.vendorID));
+    hasher.Update(&physicalDeviceProperties.deviceID, sizeof(physicalDeviceProperties.deviceID));
+
+    for (gl::ShaderType shaderType : linkedShaderStages)
+    {
+        const angle::spirv::Blob &spirv = spirvBlobs[shaderType];
+        const uint32_t spirvSize        = static_cast<uint32_t>(spirv.size());
+        hasher.Update(&shaderType, sizeof(shaderType));
+        hasher.Update(&spirvSize, sizeof(spirvSize));
+        hasher.Update(spirv.data(), spirv.size() * sizeof(*spirv.data()));
+    }
+
+    hasher.Final();
+    memcpy(keyOut->data(), hasher.Digest(), angle::base::kSHA1Length);
+}
+
+uint32_t ComputeRecordedGraphicsPipelineDescsHash(const uint8_t *descs, size_t size)
+{
+    return static_cast<uint32_t>(angle::ComputeGenericHash(descs, size));
+}
+
 bool ValidateTransformedSpirV(vk::ErrorContext *context,
                               const gl::ShaderBitSet &linkedShaderStages,
                               const ShaderInterfaceVariableInfoMap &variableInfoMap,
@@ -207,7 +269,10 @@ void GetPipelineCacheData(ContextVk *contextVk,
         }
 
         // Compress it.
-        if (!angle::CompressBlob(pipelineCacheData.size(), pipelineCacheData.data(), cacheDataOut))
+        const angle::BlobCompressionCodec codec =
+            contextVk->getRenderer()->getGlobalOps()->getBlobCompressionCodec();
+        if (!angle::CompressBlob(pipelineCacheData.size(), pipelineCacheData.data(), cacheDataOut,
+                                 codec))
         {
             cacheDataOut->clear();
         }
@@ -466,12 +531,14 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
                        vk::GraphicsPipelineSubset subset,
                        const vk::GraphicsPipelineDesc &graphicsPipelineDesc,
                        SharedRenderPass *compatibleRenderPass,
-                       vk::PipelineHelper *placeholderPipelineHelper)
+                       vk::PipelineHelper *placeholderPipelineHelper,
+                       bool createCompatibleRenderPass)
         : WarmUpTaskCommon(renderer, executableVk, pipelineRobustness, pipelineProtectedAccess),
           mPipelineSubset(subset),
           mGraphicsPipelineDesc(graphicsPipelineDesc),
           mWarmUpPipelineHelper(placeholderPipelineHelper),
-          mCompatibleRenderPass(compatibleRenderPass)
+          mCompatibleRenderPass(compatibleRenderPass),
+          mCreateCompatibleRenderPass(createCompatibleRenderPass)
     {
         ASSERT(mCompatibleRenderPass);
         mCompatibleRenderPass->addRef();
@@ -480,11 +547,32 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
 
     void operator()() override
     {
-        angle::Result result = mExecutableVk->warmUpGraphicsPipelineCache(
-            this, mPipelineRobustness, mPipelineProtectedAccess, mPipelineSubset,
-            mGraphicsPipelineDesc, mCompatibleRenderPass->get(), mWarmUpPipelineHelper);
+        // Recorded descs may use a different render pass than the one created for
+        // |mWarmUpGraphicsPipelineDesc|.  Their compatible render pass is created here so the
+        // link does not wait for it.
+        vk::RenderPass ownRenderPass;
+        angle::Result result = angle::Result::Continue;
+        if (mCreateCompatibleRenderPass && !getFeatures().preferDynamicRendering.enabled)
+        {
+            vk::AttachmentOpsArray ops;
+            RenderPassCache::InitializeOpsForCompatibleRenderPass(
+                mGraphicsPipelineDesc.getRenderPassDesc(), &ops);
+            result = RenderPassCache::MakeRenderPass(
+                this, mGraphicsPipelineDesc.getRenderPassDesc(), ops, &ownRenderPass, nullptr);
+        }
+
+        if (result == angle::Result::Continue)
+        {
+            const vk::RenderPass &renderPass =
+                ownRenderPass.valid() ? ownRenderPass : mCompatibleRenderPass->get();
+            result = mExecutableVk->warmUpGraphicsPipelineCache(
+                this, mPipelineRobustness, mPipelineProtectedAccess, mPipelineSubset,
+                mGraphicsPipelineDesc, renderPass, mWarmUpPipelineHelper);
+        }
         ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
 
+        ownRenderPass.destroy(getDevice());
+
         // Release reference to shared renderpass. If this is the last reference -
         // 1. merge ProgramExecutableVk's pipeline cache into the Renderer's cache
         // 2. cleanup temporary renderpass
@@ -508,6 +596,7 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
 
     // Temporary objects to clean up at the end
     SharedRenderPass *mCompatibleRenderPass;
+    bool mCreateCompatibleRenderPass;
 };
 
 // ShaderInfo implementation.
@@ -896,27 +985,39 @@ angle::Result ProgramExecutableVk::getPipelineCacheWarmUpTasks(
     }
     else
     {
-        ProgramTransformOptions transformOptions = {};
         SharedRenderPass *sharedRenderPass = new SharedRenderPass(std::move(compatibleRenderPass));
 
         // Add a placeholder entry in GraphicsPipelineCache
-        const uint8_t programIndex         = transformOptions.permutationIndex;
-        vk::PipelineHelper *pipelineHelper = nullptr;
-        if (subset == vk::GraphicsPipelineSubset::Complete)
-        {
-            CompleteGraphicsPipelineCache &pipelines = mCompleteGraphicsPipelines[programIndex];
-            pipelines.populate(mWarmUpGraphicsPipelineDesc, vk::Pipeline(), &pipelineHelper);
-        }
-        else
-        {
-            ASSERT(subset == vk::GraphicsPipelineSubset::Shaders);
-            ShadersGraphicsPipelineCache &pipelines = mShadersGraphicsPipelines[programIndex];
-            pipelines.populate(mWarmUpGraphicsPipelineDesc, vk::Pipeline(), &pipelineHelper);
-        }
+        vk::PipelineHelper *pipelineHelper =
+            addWarmUpPlaceholderPipeline(subset, mWarmUpGraphicsPipelineDesc);
 
         warmUpSubTasks.push_back(std::make_shared<WarmUpGraphicsTask>(
             renderer, this, pipelineRobustness, pipelineProtectedAccess, subset,
-            *graphicsPipelineDesc, sharedRenderPass, pipelineHelper));
+            *graphicsPipelineDesc, sharedRenderPass, pipelineHelper, false));
+
+        // Also warm up the pipelines that draw calls created with this program in previous runs.
+        // This is only done when the tasks run in parallel, as the pipelines are otherwise created
+        // at draw time just as well.
+        if (renderer->getFeatures().warmUpRecordedPipelinesAtLink.enabled && postLinkSubTasksOut)
+        {
+            loadRecordedGraphicsPipelineDescs(renderer);
+
+            for (const vk::GraphicsPipelineDesc &recordedDesc : mRecordedGraphicsPipelineDescs)
+            {
+                // Recorded descs that are identical in the warm up subset share a placeholder.
+                vk::PipelineHelper *recordedPipelineHelper =
+                    addWarmUpPlaceholderPipeline(subset, recordedDesc);
+                if (recordedPipelineHelper == nullptr)
+                {
+                    continue;
+                }
+
+                warmUpSubTasks.push_back(std::make_shared<WarmUpGraphicsTask>(
+                    renderer, this, pipelineRobustness, pipelineProtectedAccess, subset,
+                    recordedDesc, sharedRenderPass, recordedPipelineHelper, true));
+            }
+            mWarmUpRecordedGraphicsPipelineDescCount = mRecordedGraphicsPipelineDescs.size();
+        }
     }
 
     // If the caller hasn't provided a valid async task container, inline the warmUp tasks.
@@ -1118,9 +1219,9 @@ void ProgramExecutableVk::waitForGraphicsPostLinkTasks(
 
     const vk::GraphicsPipelineSubset subset = GetWarmUpSubset(contextVk->getFeatures());
 
-    if (!mWarmUpGraphicsPipelineDesc.keyEqual(currentGraphicsPipelineDesc, subset))
+    if (!isWarmUpGraphicsPipelineDesc(currentGraphicsPipelineDesc, subset))
     {
-        // The GraphicsPipelineDesc used for warm up differs from the one used by the draw call.
+        // The GraphicsPipelineDescs used for warm up differ from the one used by the draw call.
         // There is no need to wait for the warm up tasks to complete.
         ANGLE_PERF_WARNING(
             contextVk->getDebug(), GL_DEBUG_SEVERITY_LOW,
@@ -1148,6 +1249,155 @@ angle::Result ProgramExecutableVk::mergePipelineCacheToRenderer(vk::ErrorContext
     return angle::Result::Continue;
 }
 
+vk::PipelineHelper *ProgramExecutableVk::addWarmUpPlaceholderPipeline(
+    vk::GraphicsPipelineSubset subset,
+    const vk::GraphicsPipelineDesc &desc)
+{
+    // Warm up is only done for the default transform options.
+    const uint8_t programIndex         = ProgramTransformOptions{}.permutationIndex;
+    vk::PipelineHelper *pipelineHelper = nullptr;
+    if (subset == vk::GraphicsPipelineSubset::Complete)
+    {
+        CompleteGraphicsPipelineCache &pipelines = mCompleteGraphicsPipelines[programIndex];
+        pipelines.populate(desc, vk::Pipeline(), &pipelineHelper);
+    }
+    else
+    {
+        ASSERT(subset == vk::GraphicsPipelineSubset::Shaders);
+        ShadersGraphicsPipelineCache &pipelines = mShadersGraphicsPipelines[programIndex];
+        pipelines.populate(desc, vk::Pipeline(), &pipelineHelper);
+    }
+    return pipelineHelper;
+}
+
+bool ProgramExecutableVk::isWarmUpGraphicsPipelineDesc(const vk::GraphicsPipelineDesc &desc,
+                                                       vk::GraphicsPipelineSubset subset) const
+{
+    if (mWarmUpGraphicsPipelineDesc.keyEqual(desc, subset))
+    {
+        return true;
+    }
+
+    for (size_t index = 0; index < mWarmUpRecordedGraphicsPipelineDescCount; ++index)
+    {
+        if (mRecordedGraphicsPipelineDescs[index].keyEqual(desc, subset))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ProgramExecutableVk::loadRecordedGraphicsPipelineDescs(vk::Renderer *renderer)
+{
+    if (mRecordedGraphicsPipelineDescsLoaded)
+    {
+        return;
+    }
+    mRecordedGraphicsPipelineDescsLoaded = true;
+
+    ComputeRecordedGraphicsPipelineDescsKey(
+        renderer->getPhysicalDeviceProperties(), mExecutable->getLinkedShaderStages(),
+        mOriginalShaderInfo.getSpirvBlobs(), &mRecordedGraphicsPipelineDescsKey);
+
+    angle::BlobCacheValue value;
+    if (!renderer->getGlobalOps()->getBlob(mRecordedGraphicsPipelineDescsKey, &value) ||
+        value.size() < sizeof(RecordedGraphicsPipelineDescsHeader))
+    {
+        return;
+    }
+
+    RecordedGraphicsPipelineDescsHeader header = {};
+    memcpy(&header, value.data(), sizeof(RecordedGraphicsPipelineDescsHeader));
+    if (header.version != kRecordedGraphicsPipelineDescsVersion ||
+        header.descSize != kRecordedGraphicsPipelineDescSize ||
+        header.descCount > kMaxRecordedGraphicsPipelineDescs ||
+        value.size() != sizeof(RecordedGraphicsPipelineDescsHeader) +
+                            header.descCount * kRecordedGraphicsPipelineDescSize)
+    {
+        WARN() << "Ignoring recorded graphics pipelines with unexpected version or size";
+        return;
+    }
+
+    const uint8_t *descsData = value.data() + sizeof(RecordedGraphicsPipelineDescsHeader);
+    if (header.descsHash != ComputeRecordedGraphicsPipelineDescsHash(
+                                descsData, header.descCount * kRecordedGraphicsPipelineDescSize))
+    {
+        WARN() << "Ignoring corrupt recorded graphics pipelines";
+        return;
+    }
+
+    mRecordedGraphicsPipelineDescs.resize(header.descCount);
+    for (uint32_t index = 0; index < header.descCount; ++index)
+    {
+        memcpy(static_cast<void *>(&mRecordedGraphicsPipelineDescs[index]),
+               descsData + index * kRecordedGraphicsPipelineDescSize,
+               kRecordedGraphicsPipelineDescSize);
+    }
+}
+
+void ProgramExecutableVk::recordDrawGraphicsPipelineDesc(ContextVk *contextVk,
+                                                         const vk::GraphicsPipelineDesc &desc)
+{
+    ASSERT(contextVk->getFeatures().warmUpRecordedPipelinesAtLink.enabled);
+
+    // Program pipelines don't warm up recorded pipelines, and pipelines of other permutations of
+    // the program can't be created at link time.
+    if (mExecutable->IsPPO() || getTransformOptions(contextVk, desc).permutationIndex != 0)
+    {
+        return;
+    }
+
+    // Descs loaded at link time are kept, so pipelines used by previous runs but not this one stay
+    // recorded.
+    vk::Renderer *renderer = contextVk->getRenderer();
+    loadRecordedGraphicsPipelineDescs(renderer);
+
+    if (mRecordedGraphicsPipelineDescs.size() >= kMaxRecordedGraphicsPipelineDescs)
+    {
+        return;
+    }
+    for (const vk::GraphicsPipelineDesc &recordedDesc : mRecordedGraphicsPipelineDescs)
+    {
+        if (recordedDesc.keyEqual(desc, vk::GraphicsPipelineSubset::Complete))
+        {
+            return;
+        }
+    }
+    mRecordedGraphicsPipelineDescs.push_back(desc);
+
+    // The whole list is stored again.  This only happens when a draw call creates a pipeline,
+    // which is far more expensive.
+    const uint32_t descCount = static_cast<uint32_t>(mRecordedGraphicsPipelineDescs.size());
+
+    RecordedGraphicsPipelineDescsHeader header = {};
+    header.version                             = kRecordedGraphicsPipelineDescsVersion;
+    header.descSize                            = kRecordedGraphicsPipelineDescSize;
+    header.descCount                           = descCount;
+
+    angle::MemoryBuffer value;
+    if (!value.resize(sizeof(RecordedGraphicsPipelineDescsHeader) +
+                      header.descCount * kRecordedGraphicsPipelineDescSize))
+    {
+        return;
+    }
+
+    uint8_t *descsData = value.data() + sizeof(RecordedGraphicsPipelineDescsHeader);
+    for (uint32_t index = 0; index < header.descCount; ++index)
+    {
+        memcpy(descsData + index * kRecordedGraphicsPipelineDescSize,
+               mRecordedGraphicsPipelineDescs[index].getPtr<uint8_t>(),
+               kRecordedGraphicsPipelineDescSize);
+    }
+
+    header.descsHash = ComputeRecordedGraphicsPipelineDescsHash(
+        descsData, header.descCount * kRecordedGraphicsPipelineDescSize);
+    memcpy(value.data(), &header, sizeof(RecordedGraphicsPipelineDescsHeader));
+
+    renderer->getGlobalOps()->putBlob(mRecordedGraphicsPipelineDescsKey, value);
+}
+
 void ProgramExecutableVk::addInterfaceBlockDescriptorSetDesc(
     const std::vector<gl::InterfaceBlock> &blocks,
     gl::ShaderBitSet shaderTypes,
@@ -1592,6 +1842,11 @@ angle::Result ProgramExecutableVk::createGraphicsPipeline(
 {
     ProgramTransformOptions transformOptions = getTransformOptions(contextVk, desc);
 
+    if (source == PipelineSource::Draw)
+    {
+        ++contextVk->getPerfCounters().drawGraphicsPipelineCacheMisses;
+    }
+
     // When creating monolithic pipelines, the renderer's pipeline cache is used as passed in.
     // When creating the shaders subset of pipelines, the program's own pipeline cache is used,
     // unless the renderer's pipeline cache is preferred.
@@ -2176,6 +2431,7 @@ angle::Result ProgramExecutableVk::updateUniforms(vk::Context *context,
         {
             const angle::MemoryBuffer &uniformData = mDefaultUniformBlocks[shaderType]->uniformData;
             memcpy(&bufferData[offsets[shaderType]], uniformData.data(), uniformData.size());
+            context->getPerfCounters().defaultUniformBytesUploaded += uniformData.size();
             mDefaultUniformDynamicDescriptorOffsets[offsetIndex] =
                 static_cast<uint32_t>(bufferOffset + offsets[shaderType]);
             mDefaultUniformBlocksDirty.reset(shaderType);
@@ -354,6 +354,10 @@ class ProgramExecutableVk : public ProgramExecutableImpl
 
     angle::Result mergePipelineCacheToRenderer(vk::ErrorContext *context) const;
 
+    // Records a desc for which a draw call had to create a pipeline, so later runs can warm it up
+    // at link time.  Used with the warmUpRecordedPipelinesAtLink feature.
+    void recordDrawGraphicsPipelineDesc(ContextVk *contextVk, const vk::GraphicsPipelineDesc &desc);
+
     void updateUniformsAndXfbDescInfo(vk::Context *context,
                                       const vk::BufferHelper *currentUniformBuffer,
                                       const vk::BufferHelper &emptyBuffer,
@@ -594,6 +598,11 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                               const vk::RenderPass &renderPass,
                                               vk::PipelineHelper *placeholderPipelineHelper);
     void waitForPostLinkTasksImpl(ContextVk *contextVk);
+    vk::PipelineHelper *addWarmUpPlaceholderPipeline(vk::GraphicsPipelineSubset subset,
+                                                     const vk::GraphicsPipelineDesc &desc);
+    bool isWarmUpGraphicsPipelineDesc(const vk::GraphicsPipelineDesc &desc,
+                                      vk::GraphicsPipelineSubset subset) const;
+    void loadRecordedGraphicsPipelineDescs(vk::Renderer *renderer);
 
     angle::Result getOrAllocateDescriptorSet(vk::Context *context,
                                              uint32_t currentFrame,
@@ -706,6 +715,15 @@ class ProgramExecutableVk : public ProgramExecutableImpl
 
     vk::GraphicsPipelineDesc mWarmUpGraphicsPipelineDesc;
 
+    // With warmUpRecordedPipelinesAtLink, the descs of pipelines that draw calls created in this
+    // and previous runs.  They are kept in the blob cache under a key derived from the SPIR-V of
+    // the program, and the first |mWarmUpRecordedGraphicsPipelineDescCount| of them are warmed up
+    // at link time along with |mWarmUpGraphicsPipelineDesc|.
+    std::vector<vk::GraphicsPipelineDesc> mRecordedGraphicsPipelineDescs;
+    angle::BlobCacheKey mRecordedGraphicsPipelineDescsKey;
+    bool mRecordedGraphicsPipelineDescsLoaded       = false;
+    size_t mWarmUpRecordedGraphicsPipelineDescCount = 0;
+
     // The "layout" information for descriptorSets
     vk::WriteDescriptorDescs mUniformBuffersWriteDescriptorDescs;
     vk::WriteDescriptorDescs mShaderResourceWriteDescriptorDescs;
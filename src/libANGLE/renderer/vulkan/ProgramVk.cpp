@@ -161,6 +161,51 @@ class LinkTaskVk final : public vk::ErrorContext, public LinkTask
     unsigned int mErrorLine    = 0;
 };
 
+// When a program is loaded from the cache, there is no link to warm up the pipeline cache.  With
+// warmUpRecordedPipelinesAtLink, the same warm up tasks are created after the load instead.
+class LoadTaskVk final : public LinkTask
+{
+  public:
+    LoadTaskVk(vk::Renderer *renderer,
+               ProgramExecutableVk *executableVk,
+               vk::PipelineRobustness pipelineRobustness,
+               vk::PipelineProtectedAccess pipelineProtectedAccess)
+        : mRenderer(renderer),
+          mExecutableVk(executableVk),
+          mPipelineRobustness(pipelineRobustness),
+          mPipelineProtectedAccess(pipelineProtectedAccess)
+    {}
+    ~LoadTaskVk() override = default;
+
+    void load(std::vector<std::shared_ptr<LinkSubTask>> *linkSubTasksOut,
+              std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut) override
+    {
+        ASSERT(linkSubTasksOut && linkSubTasksOut->empty());
+        ASSERT(postLinkSubTasksOut && postLinkSubTasksOut->empty());
+
+        // The program is usable without the warm up, so failure to set it up is not an error; the
+        // pipelines are created at draw time instead.
+        angle::Result result = mExecutableVk->getPipelineCacheWarmUpTasks(
+            mRenderer, mPipelineRobustness, mPipelineProtectedAccess, postLinkSubTasksOut);
+        if (result != angle::Result::Continue)
+        {
+            INFO() << "Error while preparing pipeline cache warm up after program load";
+            postLinkSubTasksOut->clear();
+        }
+    }
+
+    angle::Result getResult(const gl::Context *context, gl::InfoLog &infoLog) override
+    {
+        return angle::Result::Continue;
+    }
+
+  private:
+    vk::Renderer *mRenderer;
+    ProgramExecutableVk *mExecutableVk;
+    const vk::PipelineRobustness mPipelineRobustness;
+    const vk::PipelineProtectedAccess mPipelineProtectedAccess;
+};
+
 angle::Result LinkTaskVk::linkImpl(const gl::ProgramLinkedResources &resources,
                                    const gl::ProgramMergedVaryings &mergedVaryings,
                                    std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut)
@@ -348,7 +393,21 @@ angle::Result ProgramVk::load(const gl::Context *context,
     // TODO: parallelize program load.  http://anglebug.com/41488637
     *loadTaskOut = {};
 
-    return getExecutable()->load(contextVk, mState.isSeparable(), stream, resultOut);
+    ANGLE_TRY(getExecutable()->load(contextVk, mState.isSeparable(), stream, resultOut));
+
+    // Warm up the pipelines that draw calls created with this program in previous runs.  As with
+    // link, this is not done for separable programs and GLES1.
+    if (*resultOut == egl::CacheGetResult::Success && !mState.isSeparable() &&
+        !context->getState().isGLES1() &&
+        contextVk->getFeatures().warmUpPipelineCacheAtLink.enabled &&
+        contextVk->getFeatures().warmUpRecordedPipelinesAtLink.enabled)
+    {
+        *loadTaskOut = std::make_shared<LoadTaskVk>(contextVk->getRenderer(), getExecutable(),
+                                                    contextVk->pipelineRobustness(),
+                                                    contextVk->pipelineProtectedAccess());
+    }
+
+    return angle::Result::Continue;
 }
 
 void ProgramVk::save(const gl::Context *context, gl::BinaryOutputStream *stream)
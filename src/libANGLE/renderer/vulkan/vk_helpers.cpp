@@ -8903,11 +8903,19 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
     LoadImageFunctionInfo loadFunctionInfo = vkFormat.getTextureLoadFunction(access, type);
     LoadImageFunction stencilLoadFunction  = nullptr;
 
+    angle::LoadImageRowGrouping loadRowGrouping;
+    if (formatInfo.compressed)
+    {
+        loadRowGrouping.inputRowsPerPitch = formatInfo.compressedBlockHeight;
+    }
+
     bool useComputeTransCoding = false;
     if (storageFormat.isBlock)
     {
         const gl::InternalFormat &storageFormatInfo = vkFormat.getInternalFormatInfo(type);
         GLuint rowPitch;
+
+        loadRowGrouping.outputRowsPerPitch = storageFormatInfo.compressedBlockHeight;
         GLuint depthPitch;
         GLuint totalSize;
 
@@ -9040,9 +9048,24 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
                                                 MemoryCoherency::CachedNonCoherent,
                                                 storageFormat.id, &stagingOffset, &stagingPointer));
 
-    loadFunctionInfo.loadFunction(
-        contextVk->getImageLoadContext(), glExtents.width, glExtents.height, glExtents.depth,
-        source, inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch, outputDepthPitch);
+    // ASTC is decoded as a whole image, paletted data carries its palette ahead of the indices and
+    // YUV data is split into planes, so none of them can be loaded in independent bands of rows.
+    const bool canParallelizeLoad = !storageFormat.isYUV && !formatInfo.paletted &&
+                                    !gl::IsASTC2DFormat(formatInfo.internalFormat);
+    if (canParallelizeLoad)
+    {
+        angle::ParallelLoadImage(contextVk->getImageLoadContext(), loadFunctionInfo.loadFunction,
+                                 loadRowGrouping, glExtents.width, glExtents.height,
+                                 glExtents.depth, source, inputRowPitch, inputDepthPitch,
+                                 stagingPointer, outputRowPitch, outputDepthPitch);
+    }
+    else
+    {
+        loadFunctionInfo.loadFunction(contextVk->getImageLoadContext(), glExtents.width,
+                                      glExtents.height, glExtents.depth, source, inputRowPitch,
+                                      inputDepthPitch, stagingPointer, outputRowPitch,
+                                      outputDepthPitch);
+    }
 
     // YUV formats need special handling.
     if (storageFormat.isYUV)
@@ -16,7 +16,9 @@
 #include <EGL/eglext.h>
 #include <fstream>
 
+#include "common/content_chunking.h"
 #include "common/debug.h"
+#include "common/hash_utils.h"
 #include "common/platform.h"
 #include "common/system_utils.h"
 #include "common/vulkan/libvulkan_loader.h"
@@ -24,6 +26,7 @@
 #include "gpu_info_util/SystemInfo_vulkan.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/driver_utils.h"
 #include "libANGLE/renderer/vulkan/CompilerVk.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
@@ -1059,22 +1062,28 @@ void UnpackHeaderDataForPipelineCache(CacheDataHeader *data,
                   chunkCRCOut);
 }
 
-void ComputePipelineCacheVkChunkKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
-                                    const size_t slotIndex,
-                                    const size_t chunkIndex,
-                                    angle::BlobCacheKey *hashOut)
+void AppendPipelineCacheVkDeviceIdentity(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                         std::ostringstream *hashStream)
 {
-    std::ostringstream hashStream("ANGLE Pipeline Cache: ", std::ios_base::ate);
     // Add the pipeline cache UUID to make sure the blob cache always gives a compatible pipeline
     // cache.  It's not particularly necessary to write it as a hex number as done here, so long as
     // there is no '\0' in the result.
     for (const uint32_t c : physicalDeviceProperties.pipelineCacheUUID)
     {
-        hashStream << std::hex << c;
+        *hashStream << std::hex << c;
     }
     // Add the vendor and device id too for good measure.
-    hashStream << std::hex << physicalDeviceProperties.vendorID;
-    hashStream << std::hex << physicalDeviceProperties.deviceID;
+    *hashStream << std::hex << physicalDeviceProperties.vendorID;
+    *hashStream << std::hex << physicalDeviceProperties.deviceID;
+}
+
+void ComputePipelineCacheVkChunkKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                    const size_t slotIndex,
+                                    const size_t chunkIndex,
+                                    angle::BlobCacheKey *hashOut)
+{
+    std::ostringstream hashStream("ANGLE Pipeline Cache: ", std::ios_base::ate);
+    AppendPipelineCacheVkDeviceIdentity(physicalDeviceProperties, &hashStream);
 
     // Add slotIndex to generate unique keys for each slot.
     hashStream << std::hex << static_cast<uint32_t>(slotIndex);
@@ -1113,7 +1122,8 @@ size_t StorePipelineCacheVkChunks(vk::GlobalOps *globalOps,
                                   const size_t lastNumStoredChunks,
                                   const PipelineCacheVkChunkInfos &chunkInfos,
                                   const size_t cacheDataSize,
-                                  angle::MemoryBuffer *scratchBuffer);
+                                  angle::MemoryBuffer *scratchBuffer,
+                                  size_t *bytesWrittenOut);
 
 // Erasing is done by writing 1/0-sized chunks starting from the startChunk.
 void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
@@ -1121,12 +1131,20 @@ void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
                                 const size_t startChunk,
                                 const size_t numChunks,
                                 const size_t slotIndex,
-                                angle::MemoryBuffer *scratchBuffer);
+                                angle::MemoryBuffer *scratchBuffer,
+                                size_t *bytesWrittenOut);
 
-void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
-                                     Renderer *renderer,
-                                     const std::vector<uint8_t> &cacheData,
-                                     const size_t maxTotalSize)
+// Stores the segments of the cache data that changed since the last sync, followed by the
+// manifest.  Returns the number of bytes written to the blob cache.
+size_t StorePipelineCacheVkSegments(vk::GlobalOps *globalOps,
+                                    Renderer *renderer,
+                                    const std::vector<uint8_t> &cacheData);
+
+// Returns the number of bytes written to the blob cache.
+size_t CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
+                                       Renderer *renderer,
+                                       const std::vector<uint8_t> &cacheData,
+                                       const size_t maxTotalSize)
 {
     // Though the pipeline cache will be compressed and divided into several chunks to store in blob
     // cache, the largest total size of blob cache is only 2M in android now, so there is no use to
@@ -1141,16 +1159,22 @@ void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
                       "(this message will no longer repeat)";
             warned = true;
         }
-        return;
+        return 0;
+    }
+
+    if (renderer->getFeatures().incrementalPipelineCacheSync.enabled)
+    {
+        return StorePipelineCacheVkSegments(globalOps, renderer, cacheData);
     }
 
     // To make it possible to store more pipeline cache data, compress the whole pipelineCache.
     angle::MemoryBuffer compressedData;
 
-    if (!angle::CompressBlob(cacheData.size(), cacheData.data(), &compressedData))
+    if (!angle::CompressBlob(cacheData.size(), cacheData.data(), &compressedData,
+                             globalOps->getBlobCompressionCodec()))
     {
         WARN() << "Skip syncing pipeline cache data as it failed compression.";
-        return;
+        return 0;
     }
 
     // If the size of compressedData is larger than (kMaxBlobCacheSize - sizeof(numChunks)),
@@ -1169,7 +1193,7 @@ void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
     if (!scratchBuffer.resize(sizeof(CacheDataHeader) + chunkSize))
     {
         WARN() << "Skip syncing pipeline cache data due to out of memory.";
-        return;
+        return 0;
     }
 
     size_t previousSlotIndex = 0;
@@ -1180,9 +1204,11 @@ void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
     PipelineCacheVkChunkInfos chunkInfos =
         GetPipelineCacheVkChunkInfos(renderer, compressedData, numChunks, chunkSize, slotIndex);
 
+    size_t bytesWritten = 0;
+
     // Store all chunks without checking if they already exist (because they can't).
-    size_t numStoredChunks = StorePipelineCacheVkChunks(globalOps, renderer, 0, chunkInfos,
-                                                        cacheData.size(), &scratchBuffer);
+    size_t numStoredChunks = StorePipelineCacheVkChunks(
+        globalOps, renderer, 0, chunkInfos, cacheData.size(), &scratchBuffer, &bytesWritten);
     ASSERT(numStoredChunks == numChunks);
 
     // Erase all chunks from the previous slot or any trailing chunks from the current slot.
@@ -1191,21 +1217,22 @@ void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
     {
         const size_t startChunk = isSlotChanged ? 0 : numChunks;
         ErasePipelineCacheVkChunks(globalOps, renderer, startChunk, previousNumChunks,
-                                   previousSlotIndex, &scratchBuffer);
+                                   previousSlotIndex, &scratchBuffer, &bytesWritten);
     }
 
     if (!renderer->getFeatures().verifyPipelineCacheInBlobCache.enabled)
     {
         // No need to verify and restore possibly evicted chunks.
-        return;
+        return bytesWritten;
     }
 
     // Verify and restore possibly evicted chunks.
     do
     {
         const size_t lastNumStoredChunks = numStoredChunks;
-        numStoredChunks = StorePipelineCacheVkChunks(globalOps, renderer, lastNumStoredChunks,
-                                                     chunkInfos, cacheData.size(), &scratchBuffer);
+        numStoredChunks =
+            StorePipelineCacheVkChunks(globalOps, renderer, lastNumStoredChunks, chunkInfos,
+                                       cacheData.size(), &scratchBuffer, &bytesWritten);
         // Number of stored chunks must decrease so the loop can eventually exit.
         ASSERT(numStoredChunks < lastNumStoredChunks);
 
@@ -1214,6 +1241,8 @@ void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
         // need to continue the loop.
     } while (!renderer->getFeatures().hasBlobCacheThatEvictsOldItemsFirst.enabled &&
              numStoredChunks > 0);
+
+    return bytesWritten;
 }
 
 PipelineCacheVkChunkInfos GetPipelineCacheVkChunkInfos(Renderer *renderer,
@@ -1255,7 +1284,8 @@ size_t StorePipelineCacheVkChunks(vk::GlobalOps *globalOps,
                                   const size_t lastNumStoredChunks,
                                   const PipelineCacheVkChunkInfos &chunkInfos,
                                   const size_t cacheDataSize,
-                                  angle::MemoryBuffer *scratchBuffer)
+                                  angle::MemoryBuffer *scratchBuffer,
+                                  size_t *bytesWrittenOut)
 {
     // Store chunks in revers order, so when 0 chunk is available - all chunks are available.
 
@@ -1342,6 +1372,7 @@ size_t StorePipelineCacheVkChunks(vk::GlobalOps *globalOps,
         memcpy(keyData.data() + sizeof(CacheDataHeader), chunkInfo.data, chunkInfo.dataSize);
 
         globalOps->putBlob(chunkInfo.cacheHash, keyData);
+        *bytesWrittenOut += keyData.size();
     }
 
     return numChunksToStore;
@@ -1352,7 +1383,8 @@ void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
                                 const size_t startChunk,
                                 const size_t numChunks,
                                 const size_t slotIndex,
-                                angle::MemoryBuffer *scratchBuffer)
+                                angle::MemoryBuffer *scratchBuffer,
+                                size_t *bytesWrittenOut)
 {
     const VkPhysicalDeviceProperties &physicalDeviceProperties =
         renderer->getPhysicalDeviceProperties();
@@ -1372,9 +1404,474 @@ void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
         ComputePipelineCacheVkChunkKey(physicalDeviceProperties, slotIndex, chunkIndex,
                                        &chunkCacheHash);
         globalOps->putBlob(chunkCacheHash, keyData);
+        *bytesWrittenOut += keyData.size();
     }
 }
 
+// With incrementalPipelineCacheSync, the pipeline cache data is split into content-defined
+// segments (see common/content_chunking.h), each compressed and stored under a key derived from
+// the hash of its contents.  A manifest lists the segments in order.  Pipelines added to the cache
+// only change the segments around where the driver serializes them, so a sync writes those
+// segments and the manifest rather than the whole cache.  The manifest is stored last, so it never
+// refers to segments that are not stored yet.
+//
+// Segments that drop out of the manifest are not erased, as the manifest of another process
+// sharing the blob cache may still refer to them.  They are never read again, so the blob cache
+// eventually evicts them.
+constexpr uint32_t kPipelineCacheSegmentsVersion = 1;
+
+// Compressed segments and the manifest must fit in the 64K blob size limit of Android.  The
+// largest segment is small enough that it fits even if it doesn't compress.
+constexpr size_t kMaxPipelineCacheSegmentBlobSize = 64 * 1024;
+constexpr angle::ContentChunkingParams kPipelineCacheSegmentChunkingParams = {
+    16 * 1024, 32 * 1024, 60 * 1024};
+
+// Segments that were not written for this many syncs are written again, in case the blob cache
+// evicted them.  The period is extended by up to as many syncs again based on the segment hash, so
+// that segments first stored together are not all written again in the same sync.
+constexpr uint32_t kPipelineCacheSegmentRefreshPeriod = 16;
+
+constexpr uint64_t kPipelineCacheSegmentHashSeed = 0x414E474C45504353;
+
+ANGLE_ENABLE_STRUCT_PADDING_WARNINGS
+
+struct PipelineCacheManifestHeader
+{
+    uint32_t version;
+    uint32_t segmentCount;
+    uint32_t cacheDataSize;
+    uint32_t reserved;
+};
+
+struct PipelineCacheManifestEntry
+{
+    uint64_t hash;
+    uint32_t size;
+    uint32_t reserved;
+};
+
+// Followed by the compressed segment data.
+struct PipelineCacheSegmentHeader
+{
+    uint32_t version;
+    uint32_t size;
+    uint64_t hash;
+};
+
+ANGLE_DISABLE_STRUCT_PADDING_WARNINGS
+
+constexpr size_t kMaxPipelineCacheManifestEntries =
+    (kMaxPipelineCacheSegmentBlobSize - sizeof(PipelineCacheManifestHeader)) /
+    sizeof(PipelineCacheManifestEntry);
+
+void ComputePipelineCacheVkManifestKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                       angle::BlobCacheKey *hashOut)
+{
+    std::ostringstream hashStream("ANGLE Pipeline Cache Manifest: ", std::ios_base::ate);
+    AppendPipelineCacheVkDeviceIdentity(physicalDeviceProperties, &hashStream);
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), hashOut->data());
+}
+
+void ComputePipelineCacheVkSegmentKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                      const PipelineCacheManifestEntry &entry,
+                                      angle::BlobCacheKey *hashOut)
+{
+    std::ostringstream hashStream("ANGLE Pipeline Cache Segment: ", std::ios_base::ate);
+    AppendPipelineCacheVkDeviceIdentity(physicalDeviceProperties, &hashStream);
+
+    // Segments are shared by all manifests that contain the same data.
+    hashStream << std::hex << entry.hash << ':' << entry.size;
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), hashOut->data());
+}
+
+// Returns false if the blob cache holds no valid manifest.
+bool GetPipelineCacheVkManifest(vk::GlobalOps *globalOps,
+                                const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                std::vector<PipelineCacheManifestEntry> *entriesOut,
+                                uint32_t *cacheDataSizeOut,
+                                uint64_t *manifestHashOut)
+{
+    angle::BlobCacheKey manifestKey;
+    ComputePipelineCacheVkManifestKey(physicalDeviceProperties, &manifestKey);
+
+    angle::BlobCacheValue manifest;
+    if (!globalOps->getBlob(manifestKey, &manifest) ||
+        manifest.size() < sizeof(PipelineCacheManifestHeader))
+    {
+        return false;
+    }
+
+    PipelineCacheManifestHeader header = {};
+    memcpy(&header, manifest.data(), sizeof(PipelineCacheManifestHeader));
+    if (header.version != kPipelineCacheSegmentsVersion ||
+        header.segmentCount > kMaxPipelineCacheManifestEntries ||
+        manifest.size() != sizeof(PipelineCacheManifestHeader) +
+                               header.segmentCount * sizeof(PipelineCacheManifestEntry))
+    {
+        WARN() << "Ignoring pipeline cache manifest with unexpected version or size";
+        return false;
+    }
+
+    entriesOut->resize(header.segmentCount);
+    memcpy(entriesOut->data(), manifest.data() + sizeof(PipelineCacheManifestHeader),
+           header.segmentCount * sizeof(PipelineCacheManifestEntry));
+
+    size_t totalSize = 0;
+    for (const PipelineCacheManifestEntry &entry : *entriesOut)
+    {
+        totalSize += entry.size;
+    }
+    if (totalSize != header.cacheDataSize)
+    {
+        WARN() << "Ignoring pipeline cache manifest with inconsistent segment sizes";
+        return false;
+    }
+
+    *cacheDataSizeOut = header.cacheDataSize;
+    *manifestHashOut  = XXH64(manifest.data(), manifest.size(), kPipelineCacheSegmentHashSeed);
+    return true;
+}
+
+// Reassembles the pipeline cache data from the segments listed in a manifest.  Returns false if a
+// segment is missing or corrupt.
+bool GetPipelineCacheVkSegments(vk::GlobalOps *globalOps,
+                                const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                const std::vector<PipelineCacheManifestEntry> &entries,
+                                uint32_t cacheDataSize,
+                                angle::MemoryBuffer *cacheDataOut)
+{
+    if (!cacheDataOut->resize(cacheDataSize))
+    {
+        return false;
+    }
+
+    angle::MemoryBuffer segmentData;
+    size_t offset = 0;
+
+    for (const PipelineCacheManifestEntry &entry : entries)
+    {
+        angle::BlobCacheKey segmentKey;
+        ComputePipelineCacheVkSegmentKey(physicalDeviceProperties, entry, &segmentKey);
+
+        angle::BlobCacheValue segment;
+        if (!globalOps->getBlob(segmentKey, &segment) ||
+            segment.size() <= sizeof(PipelineCacheSegmentHeader))
+        {
+            WARN() << "Failed to get pipeline cache segment " << (&entry - entries.data())
+                   << " of " << entries.size();
+            return false;
+        }
+
+        PipelineCacheSegmentHeader header = {};
+        memcpy(&header, segment.data(), sizeof(PipelineCacheSegmentHeader));
+        const bool isValid =
+            header.version == kPipelineCacheSegmentsVersion && header.size == entry.size &&
+            header.hash == entry.hash &&
+            angle::DecompressBlob(segment.data() + sizeof(PipelineCacheSegmentHeader),
+                                  segment.size() - sizeof(PipelineCacheSegmentHeader), entry.size,
+                                  &segmentData) &&
+            segmentData.size() == entry.size &&
+            XXH64(segmentData.data(), segmentData.size(), kPipelineCacheSegmentHashSeed) ==
+                entry.hash;
+        if (!isValid)
+        {
+            WARN() << "Pipeline cache segment " << (&entry - entries.data()) << " of "
+                   << entries.size() << " is corrupted";
+            return false;
+        }
+
+        memcpy(cacheDataOut->data() + offset, segmentData.data(), segmentData.size());
+        offset += segmentData.size();
+    }
+
+    ASSERT(offset == cacheDataSize);
+    return true;
+}
+
+void RecordStoredPipelineCacheVkSegments(const std::vector<PipelineCacheManifestEntry> &entries,
+                                         uint64_t manifestHash,
+                                         vk::PipelineCacheSegmentState *state)
+{
+    for (const PipelineCacheManifestEntry &entry : entries)
+    {
+        state->storedSegments[entry.hash] = {entry.size, state->syncSerial};
+    }
+    state->manifestHash = manifestHash;
+}
+
+// Returns false if there is no pipeline cache stored by incrementalPipelineCacheSync.
+bool GetPipelineCacheVkFromSegments(vk::GlobalOps *globalOps,
+                                    Renderer *renderer,
+                                    angle::MemoryBuffer *cacheDataOut)
+{
+    const VkPhysicalDeviceProperties &physicalDeviceProperties =
+        renderer->getPhysicalDeviceProperties();
+
+    std::vector<PipelineCacheManifestEntry> entries;
+    uint32_t cacheDataSize = 0;
+    uint64_t manifestHash  = 0;
+    if (!GetPipelineCacheVkManifest(globalOps, physicalDeviceProperties, &entries, &cacheDataSize,
+                                    &manifestHash) ||
+        !GetPipelineCacheVkSegments(globalOps, physicalDeviceProperties, entries, cacheDataSize,
+                                    cacheDataOut))
+    {
+        return false;
+    }
+
+    RecordStoredPipelineCacheVkSegments(entries, manifestHash,
+                                        &renderer->getPipelineCacheSegmentState());
+    return true;
+}
+
+// If another process sharing the blob cache stored its pipeline cache since the last sync, merges
+// its pipelines into the global cache before this sync reads the cache data, so they are not lost
+// when the manifest is overwritten.  If the global cache can't be the destination of a merge, the
+// data is kept in |state| to be combined with the data of this sync instead.
+//
+// The pipeline cache in the blob cache is then that of the other process, so |lastSyncSizeInOut|
+// is updated for the data of this process to be stored again if it has pipelines that one doesn't.
+void MergePipelineCacheVkFromOtherProcess(vk::GlobalOps *globalOps,
+                                          Renderer *renderer,
+                                          vk::PipelineCacheSegmentState *state,
+                                          size_t *lastSyncSizeInOut)
+{
+    const VkPhysicalDeviceProperties &physicalDeviceProperties =
+        renderer->getPhysicalDeviceProperties();
+
+    std::vector<PipelineCacheManifestEntry> entries;
+    uint32_t cacheDataSize = 0;
+    uint64_t manifestHash  = 0;
+    if (!GetPipelineCacheVkManifest(globalOps, physicalDeviceProperties, &entries, &cacheDataSize,
+                                    &manifestHash) ||
+        manifestHash == state->manifestHash)
+    {
+        return;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "MergePipelineCacheVkFromOtherProcess");
+
+    angle::MemoryBuffer cacheData;
+    if (!GetPipelineCacheVkSegments(globalOps, physicalDeviceProperties, entries, cacheDataSize,
+                                    &cacheData))
+    {
+        return;
+    }
+
+    const VkResult result = renderer->mergePipelineCacheData(cacheData);
+    if (result == VK_SUCCESS)
+    {
+        // The global cache has all the pipelines of the other process now, so it has more if its
+        // data is larger.
+        *lastSyncSizeInOut = cacheDataSize;
+    }
+    else if (result == VK_ERROR_FEATURE_NOT_PRESENT)
+    {
+        // Whether the data of this process adds to it is only known once the two are combined.
+        state->unmergedCacheData = std::move(cacheData);
+        *lastSyncSizeInOut       = 0;
+    }
+    else
+    {
+        WARN() << "Failed to merge the pipeline cache stored by another process";
+    }
+
+    // Its segments were just read, so they don't need to be written again.
+    RecordStoredPipelineCacheVkSegments(entries, manifestHash, state);
+}
+
+// Combines the pipeline cache data of this process with that of another process that could not
+// be merged into the global cache, by merging both into a temporary pipeline cache.
+VkResult CombinePipelineCacheVkData(VkDevice device,
+                                    const std::vector<uint8_t> &cacheData,
+                                    const angle::MemoryBuffer &otherCacheData,
+                                    std::vector<uint8_t> *combinedCacheDataOut)
+{
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
+    pipelineCacheCreateInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheCreateInfo.flags           = 0;
+    pipelineCacheCreateInfo.initialDataSize = cacheData.size();
+    pipelineCacheCreateInfo.pInitialData    = cacheData.data();
+
+    vk::PipelineCache pipelineCache;
+    vk::PipelineCache otherPipelineCache;
+    VkResult result = pipelineCache.init(device, pipelineCacheCreateInfo);
+    if (result == VK_SUCCESS)
+    {
+        pipelineCacheCreateInfo.initialDataSize = otherCacheData.size();
+        pipelineCacheCreateInfo.pInitialData    = otherCacheData.data();
+
+        result = otherPipelineCache.init(device, pipelineCacheCreateInfo);
+    }
+    if (result == VK_SUCCESS)
+    {
+        result = pipelineCache.merge(device, 1, otherPipelineCache.ptr());
+    }
+
+    size_t combinedSize = 0;
+    if (result == VK_SUCCESS)
+    {
+        result = pipelineCache.getCacheData(device, &combinedSize, nullptr);
+    }
+    if (result == VK_SUCCESS)
+    {
+        combinedCacheDataOut->resize(combinedSize);
+        result = pipelineCache.getCacheData(device, &combinedSize, combinedCacheDataOut->data());
+        combinedCacheDataOut->resize(combinedSize);
+    }
+
+    pipelineCache.destroy(device);
+    otherPipelineCache.destroy(device);
+    return result;
+}
+
+size_t StorePipelineCacheVkSegments(vk::GlobalOps *globalOps,
+                                    Renderer *renderer,
+                                    const std::vector<uint8_t> &cacheData)
+{
+    const VkPhysicalDeviceProperties &physicalDeviceProperties =
+        renderer->getPhysicalDeviceProperties();
+    vk::PipelineCacheSegmentState &state = renderer->getPipelineCacheSegmentState();
+
+    ++state.syncSerial;
+
+    // Don't overwrite the pipeline cache of another process that could not be merged into the
+    // global cache.
+    std::vector<uint8_t> combinedCacheData;
+    if (!state.unmergedCacheData.empty())
+    {
+        const angle::MemoryBuffer otherCacheData = std::move(state.unmergedCacheData);
+        if (CombinePipelineCacheVkData(renderer->getDevice(), cacheData, otherCacheData,
+                                       &combinedCacheData) != VK_SUCCESS)
+        {
+            WARN() << "Failed to combine the pipeline cache stored by another process";
+            combinedCacheData.clear();
+        }
+        else if (combinedCacheData.size() <= otherCacheData.size())
+        {
+            // This process has no pipelines that the stored pipeline cache doesn't.
+            return 0;
+        }
+    }
+    const std::vector<uint8_t> &storedCacheData =
+        combinedCacheData.empty() ? cacheData : combinedCacheData;
+
+    std::vector<angle::ContentChunk> segments;
+    angle::SplitIntoContentDefinedChunks(storedCacheData.data(), storedCacheData.size(),
+                                         kPipelineCacheSegmentChunkingParams, &segments);
+    if (segments.size() > kMaxPipelineCacheManifestEntries)
+    {
+        static bool warned = false;
+        if (!warned)
+        {
+            WARN() << "Skip syncing pipeline cache data as it has too many segments. "
+                      "(this message will no longer repeat)";
+            warned = true;
+        }
+        return 0;
+    }
+
+    angle::MemoryBuffer manifest;
+    angle::MemoryBuffer compressedData;
+    angle::MemoryBuffer segmentBlob;
+    if (!manifest.resize(sizeof(PipelineCacheManifestHeader) +
+                         segments.size() * sizeof(PipelineCacheManifestEntry)))
+    {
+        WARN() << "Skip syncing pipeline cache data due to out of memory.";
+        return 0;
+    }
+
+    // Segments of the new manifest, replacing |state.storedSegments| once it's stored.
+    angle::HashMap<uint64_t, vk::PipelineCacheSegmentState::StoredSegment> storedSegments;
+    size_t bytesWritten = 0;
+
+    for (size_t segmentIndex = 0; segmentIndex < segments.size(); ++segmentIndex)
+    {
+        const uint8_t *segmentData = storedCacheData.data() + segments[segmentIndex].offset;
+
+        PipelineCacheManifestEntry entry = {};
+
+        entry.hash = XXH64(segmentData, segments[segmentIndex].size, kPipelineCacheSegmentHashSeed);
+        entry.size = static_cast<uint32_t>(segments[segmentIndex].size);
+        memcpy(manifest.data() + sizeof(PipelineCacheManifestHeader) +
+                   segmentIndex * sizeof(PipelineCacheManifestEntry),
+               &entry, sizeof(PipelineCacheManifestEntry));
+
+        if (storedSegments.count(entry.hash) > 0)
+        {
+            // Same data as an earlier segment.
+            continue;
+        }
+
+        angle::BlobCacheKey segmentKey;
+        ComputePipelineCacheVkSegmentKey(physicalDeviceProperties, entry, &segmentKey);
+
+        const uint32_t refreshPeriod =
+            kPipelineCacheSegmentRefreshPeriod +
+            static_cast<uint32_t>(entry.hash % kPipelineCacheSegmentRefreshPeriod);
+
+        auto stored   = state.storedSegments.find(entry.hash);
+        bool isStored = stored != state.storedSegments.end() && stored->second.size == entry.size &&
+                        state.syncSerial - stored->second.storedAtSync < refreshPeriod;
+        if (isStored && renderer->getFeatures().verifyPipelineCacheInBlobCache.enabled)
+        {
+            angle::BlobCacheValue value;
+            isStored = globalOps->getBlob(segmentKey, &value) &&
+                       value.size() > sizeof(PipelineCacheSegmentHeader);
+        }
+        if (isStored)
+        {
+            storedSegments[entry.hash] = stored->second;
+            continue;
+        }
+
+        if (!angle::CompressBlob(entry.size, segmentData, &compressedData,
+                                 globalOps->getBlobCompressionCodec()) ||
+            !segmentBlob.resize(sizeof(PipelineCacheSegmentHeader) + compressedData.size()))
+        {
+            WARN() << "Skip syncing pipeline cache data as it failed compression.";
+            return bytesWritten;
+        }
+        ASSERT(segmentBlob.size() <= kMaxPipelineCacheSegmentBlobSize);
+
+        PipelineCacheSegmentHeader header = {};
+        header.version                    = kPipelineCacheSegmentsVersion;
+        header.size                       = entry.size;
+        header.hash                       = entry.hash;
+
+        memcpy(segmentBlob.data(), &header, sizeof(PipelineCacheSegmentHeader));
+        memcpy(segmentBlob.data() + sizeof(PipelineCacheSegmentHeader), compressedData.data(),
+               compressedData.size());
+
+        globalOps->putBlob(segmentKey, segmentBlob);
+        bytesWritten += segmentBlob.size();
+        storedSegments[entry.hash] = {entry.size, state.syncSerial};
+    }
+
+    ASSERT(storedCacheData.size() <= UINT32_MAX);
+    PipelineCacheManifestHeader header = {};
+    header.version                     = kPipelineCacheSegmentsVersion;
+    header.segmentCount                = static_cast<uint32_t>(segments.size());
+    header.cacheDataSize               = static_cast<uint32_t>(storedCacheData.size());
+    memcpy(manifest.data(), &header, sizeof(PipelineCacheManifestHeader));
+
+    angle::BlobCacheKey manifestKey;
+    ComputePipelineCacheVkManifestKey(physicalDeviceProperties, &manifestKey);
+    globalOps->putBlob(manifestKey, manifest);
+    bytesWritten += manifest.size();
+
+    state.storedSegments = std::move(storedSegments);
+
+    state.manifestHash = XXH64(manifest.data(), manifest.size(), kPipelineCacheSegmentHashSeed);
+
+    return bytesWritten;
+}
+
 class CompressAndStorePipelineCacheTask : public angle::Closure
 {
   public:
@@ -1391,7 +1888,9 @@ class CompressAndStorePipelineCacheTask : public angle::Closure
     void operator()() override
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "CompressAndStorePipelineCacheVk");
-        CompressAndStorePipelineCacheVk(mGlobalOps, mRenderer, mCacheData, mMaxTotalSize);
+        const size_t bytesWritten =
+            CompressAndStorePipelineCacheVk(mGlobalOps, mRenderer, mCacheData, mMaxTotalSize);
+        mRenderer->onPipelineCacheSyncStored(bytesWritten);
     }
 
   private:
@@ -1411,6 +1910,15 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::ErrorContext *context,
 
     Renderer *renderer = context->getRenderer();
 
+    // Pipeline caches stored by older versions of ANGLE, or with the feature disabled, remain
+    // readable below.
+    if (renderer->getFeatures().incrementalPipelineCacheSync.enabled &&
+        GetPipelineCacheVkFromSegments(globalOps, renderer, uncompressedData))
+    {
+        *success = true;
+        return angle::Result::Continue;
+    }
+
     const VkPhysicalDeviceProperties &physicalDeviceProperties =
         renderer->getPhysicalDeviceProperties();
 
@@ -1913,6 +2421,9 @@ Renderer::Renderer()
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
       mPipelineCacheSizeAtLastSync(0),
       mPipelineCacheInitialized(false),
+      mPipelineCacheSyncCount(0),
+      mPipelineCacheSyncBytesWritten(0),
+      mPipelineCacheSyncStallDurationNs(0),
       mValidationMessageCount(0),
       mIsColorFramebufferFetchCoherent(false),
       mIsColorFramebufferFetchUsed(false),
@@ -5049,6 +5560,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     // Affecting Linux/Intel (unknown range).
     ANGLE_FEATURE_CONDITION(&mFeatures, wrapSwitchInIfTrue, isIntel && IsLinux());
 
+    // The translator's SPIR-V optimizations shrink the modules by a few percent at no measurable
+    // cost in translation time, but are opt-in until their effect on driver compile time is
+    // measured.
+    ANGLE_FEATURE_CONDITION(&mFeatures, optimizeTranslatedSpirv, false);
+
     // Vulkan implementations are not required to clamp gl_FragDepth to [0, 1] by default.
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsDepthClampZeroOne,
                             mDepthClampZeroOneFeatures.depthClampZeroOne == VK_TRUE);
@@ -5864,6 +6380,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
             (libraryBlobsAreReusedByMonolithicPipelines && !isQualcommProprietary &&
              !(IsLinux() && isIntel) && !(IsChromeOS() && isSwiftShader)));
 
+    // Warming up the pipelines that draw calls used in previous runs costs blob cache space and
+    // worker time for every program that is linked or loaded, so it's opt-in until measured on
+    // more apps.  It only takes effect if warmUpPipelineCacheAtLink is also enabled.
+    ANGLE_FEATURE_CONDITION(&mFeatures, warmUpRecordedPipelinesAtLink, false);
+
     // On SwiftShader, no data is retrieved from the pipeline cache, so there is no reason to
     // serialize it or put it in the blob cache.
     // For Windows NVIDIA Vulkan driver, Vulkan pipeline cache will only generate one
@@ -5947,6 +6468,9 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, verifyPipelineCacheInBlobCache,
                             !mFeatures.hasBlobCacheThatEvictsOldItemsFirst.enabled);
 
+    // Disabled by default, as older versions of ANGLE can't read the pipeline cache it stores.
+    ANGLE_FEATURE_CONDITION(&mFeatures, incrementalPipelineCacheSync, false);
+
     // On ARM, dynamic state for stencil write mask doesn't work correctly in the presence of
     // discard or alpha to coverage, if the static state provided when creating the pipeline has a
     // value of 0.
@@ -6340,16 +6864,63 @@ angle::Result Renderer::getPipelineCache(vk::ErrorContext *context,
     ANGLE_TRY(ensurePipelineCacheInitialized(context));
 
     angle::SimpleMutex *pipelineCacheMutex =
-        context->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled ||
-                context->getFeatures().preferGlobalPipelineCache.enabled ||
-                context->getFeatures().preferMonolithicPipelinesOverLibraries.enabled
-            ? &mPipelineCacheMutex
-            : nullptr;
+        isPipelineCacheAccessLocked() ? &mPipelineCacheMutex : nullptr;
 
     pipelineCacheOut->init(&mPipelineCache, pipelineCacheMutex);
     return angle::Result::Continue;
 }
 
+bool Renderer::isPipelineCacheAccessLocked() const
+{
+    return mFeatures.mergeProgramPipelineCachesToGlobalCache.enabled ||
+           mFeatures.preferGlobalPipelineCache.enabled ||
+           mFeatures.preferMonolithicPipelinesOverLibraries.enabled;
+}
+
+VkResult Renderer::mergePipelineCacheData(const angle::MemoryBuffer &pipelineCacheData)
+{
+    // The global cache must be externally synchronized while it is the destination of
+    // vkMergePipelineCaches, which only holds if every access to it takes the lock.
+    if (!isPipelineCacheAccessLocked())
+    {
+        return VK_ERROR_FEATURE_NOT_PRESENT;
+    }
+
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
+    pipelineCacheCreateInfo.sType           = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheCreateInfo.flags           = 0;
+    pipelineCacheCreateInfo.initialDataSize = pipelineCacheData.size();
+    pipelineCacheCreateInfo.pInitialData    = pipelineCacheData.data();
+
+    vk::PipelineCache pipelineCache;
+    VkResult result = pipelineCache.init(mDevice, pipelineCacheCreateInfo);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    vk::PipelineCacheAccess globalCache;
+    globalCache.init(&mPipelineCache, &mPipelineCacheMutex);
+    globalCache.merge(this, pipelineCache);
+
+    pipelineCache.destroy(mDevice);
+    return VK_SUCCESS;
+}
+
+void Renderer::onPipelineCacheSyncStored(size_t bytesWritten)
+{
+    mPipelineCacheSyncBytesWritten += bytesWritten;
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.VulkanPipelineCacheSyncBytesWrittenKB",
+                           static_cast<int>(bytesWritten / 1024));
+}
+
+void Renderer::getPipelineCacheSyncPerfCounters(angle::VulkanPerfCounters *countersOut) const
+{
+    countersOut->pipelineCacheSyncs               = mPipelineCacheSyncCount;
+    countersOut->pipelineCacheSyncBytesWritten    = mPipelineCacheSyncBytesWritten;
+    countersOut->pipelineCacheSyncStallDurationNs = mPipelineCacheSyncStallDurationNs;
+}
+
 angle::Result Renderer::mergeIntoPipelineCache(vk::ErrorContext *context,
                                                const vk::PipelineCache &pipelineCache)
 {
@@ -6501,18 +7072,32 @@ angle::Result Renderer::syncPipelineCacheVk(vk::ErrorContext *context,
         return angle::Result::Continue;
     }
 
+    // The time this thread spends syncing, until the data is handed to the worker thread if
+    // enableAsyncPipelineCacheCompression is enabled, is reported as the stall of the sync.
+    const double startTime = angle::GetCurrentSystemTime();
+
+    // The pipelines of another process are merged before reading the cache data, so the data
+    // includes them.
+    size_t lastSyncSize = mPipelineCacheSizeAtLastSync;
+    if (mFeatures.incrementalPipelineCacheSync.enabled)
+    {
+        MergePipelineCacheVkFromOtherProcess(globalOps, this, &mPipelineCacheSegmentState,
+                                             &lastSyncSize);
+    }
+
     size_t pipelineCacheSize = 0;
     std::vector<uint8_t> pipelineCacheData;
     {
         std::unique_lock<angle::SimpleMutex> lock(mPipelineCacheMutex);
-        ANGLE_TRY(getLockedPipelineCacheDataIfNew(
-            context, &pipelineCacheSize, mPipelineCacheSizeAtLastSync, &pipelineCacheData));
+        ANGLE_TRY(getLockedPipelineCacheDataIfNew(context, &pipelineCacheSize, lastSyncSize,
+                                                  &pipelineCacheData));
     }
     if (pipelineCacheData.empty())
     {
         return angle::Result::Continue;
     }
     mPipelineCacheSizeAtLastSync = pipelineCacheSize;
+    ++mPipelineCacheSyncCount;
 
     if (mFeatures.enableAsyncPipelineCacheCompression.enabled)
     {
@@ -6530,9 +7115,16 @@ angle::Result Renderer::syncPipelineCacheVk(vk::ErrorContext *context,
         // If enableAsyncPipelineCacheCompression is disabled, to avoid the risk, set kMaxTotalSize
         // to 64k.
         constexpr size_t kMaxTotalSize = 64 * 1024;
-        CompressAndStorePipelineCacheVk(globalOps, this, pipelineCacheData, kMaxTotalSize);
+        const size_t bytesWritten =
+            CompressAndStorePipelineCacheVk(globalOps, this, pipelineCacheData, kMaxTotalSize);
+        onPipelineCacheSyncStored(bytesWritten);
     }
 
+    const double stallTime = angle::GetCurrentSystemTime() - startTime;
+    mPipelineCacheSyncStallDurationNs += static_cast<uint64_t>(stallTime * 1e9);
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.VulkanPipelineCacheSyncStallMicroseconds",
+                           static_cast<int>(stallTime * 1e6));
+
     return angle::Result::Continue;
 }
 
@@ -21,6 +21,7 @@
 #include "common/SimpleMutex.h"
 #include "common/WorkerThread.h"
 #include "common/angleutils.h"
+#include "common/hash_containers.h"
 #include "common/vulkan/vk_headers.h"
 #include "common/vulkan/vulkan_icd.h"
 #include "libANGLE/Caps.h"
@@ -98,6 +99,29 @@ class ImageMemorySuballocator : angle::NonCopyable
     bool needsDedicatedMemory(VkDeviceSize size) const;
 };
 
+// Bookkeeping of the pipeline cache segments stored by the incrementalPipelineCacheSync feature.
+// Only pipeline cache initialization and syncs access it, and these never run concurrently.
+struct PipelineCacheSegmentState
+{
+    struct StoredSegment
+    {
+        uint32_t size;
+        // Value of |syncSerial| when the segment was last written to the blob cache.
+        uint32_t storedAtSync;
+    };
+
+    // Segments of the last stored manifest that are expected to be in the blob cache, keyed by the
+    // hash of their contents.
+    angle::HashMap<uint64_t, StoredSegment> storedSegments;
+    uint32_t syncSerial = 0;
+    // Hash of the manifest last written or read by this process.  A different manifest in the blob
+    // cache was written by another process.
+    uint64_t manifestHash = 0;
+    // Pipeline cache data of another process that could not be merged into the global cache.  The
+    // next sync stores it combined with the data of this process.
+    angle::MemoryBuffer unmergedCacheData;
+};
+
 // Supports one semaphore from current surface, and one semaphore passed to
 // glSignalSemaphoreEXT.
 using SignalSemaphoreVector = angle::FixedVector<VkSemaphore, 2>;
@@ -366,6 +390,17 @@ class Renderer : angle::NonCopyable
 
     size_t getNextPipelineCacheBlobCacheSlotIndex(size_t *previousSlotIndexOut);
     size_t updatePipelineCacheChunkCount(size_t chunkCount);
+    vk::PipelineCacheSegmentState &getPipelineCacheSegmentState()
+    {
+        return mPipelineCacheSegmentState;
+    }
+    // Merges serialized pipeline cache data, such as the data stored by another process, into the
+    // global pipeline cache.  Returns VK_ERROR_FEATURE_NOT_PRESENT without merging unless all
+    // accesses to the cache are locked.
+    VkResult mergePipelineCacheData(const angle::MemoryBuffer &pipelineCacheData);
+    // Records the number of bytes written to the blob cache by a pipeline cache sync.
+    void onPipelineCacheSyncStored(size_t bytesWritten);
+    void getPipelineCacheSyncPerfCounters(angle::VulkanPerfCounters *countersOut) const;
     angle::Result getPipelineCache(vk::ErrorContext *context,
                                    vk::PipelineCacheAccess *pipelineCacheOut);
     angle::Result mergeIntoPipelineCache(vk::ErrorContext *context,
@@ -754,6 +789,7 @@ class Renderer : angle::NonCopyable
                                     vk::PipelineCache *pipelineCache,
                                     bool *success);
     angle::Result ensurePipelineCacheInitialized(vk::ErrorContext *context);
+    bool isPipelineCacheAccessLocked() const;
 
     template <VkFormatFeatureFlags VkFormatProperties::*features>
     VkFormatFeatureFlags getFormatFeatureBits(angle::FormatID formatID,
@@ -960,6 +996,13 @@ class Renderer : angle::NonCopyable
     uint32_t mPipelineCacheVkUpdateTimeout;
     size_t mPipelineCacheSizeAtLastSync;
     std::atomic<bool> mPipelineCacheInitialized;
+    vk::PipelineCacheSegmentState mPipelineCacheSegmentState;
+
+    // Totals of pipeline cache syncs, reported through the perf counters.  Blobs are stored on a
+    // worker thread when enableAsyncPipelineCacheCompression is enabled.
+    std::atomic<uint64_t> mPipelineCacheSyncCount;
+    std::atomic<uint64_t> mPipelineCacheSyncBytesWritten;
+    std::atomic<uint64_t> mPipelineCacheSyncStallDurationNs;
 
     // Latest validation data for debug overlay.
     std::string mLastValidationMessage;
@@ -27,7 +27,12 @@ extern "C" {
 void GL_APIENTRY GL_ActiveTexture(GLenum texture)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_ActiveTexture, texture))
+    {
+        return;
+    }
     EVENT(context, GLActiveTexture, "context = %d, texture = %s", CID(context),
           GLenumToString(GLESEnum::TextureUnit, texture));
 
@@ -154,7 +159,12 @@ void GL_APIENTRY GL_BindAttribLocation(GLuint program, GLuint index, const GLcha
 void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_BindBuffer, target, buffer))
+    {
+        return;
+    }
     EVENT(context, GLBindBuffer, "context = %d, target = %s, buffer = %u", CID(context),
           GLenumToString(GLESEnum::BufferTargetARB, target), buffer);
 
@@ -284,7 +294,12 @@ void GL_APIENTRY GL_BindRenderbuffer(GLenum target, GLuint renderbuffer)
 void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_BindTexture, target, texture))
+    {
+        return;
+    }
     EVENT(context, GLBindTexture, "context = %d, target = %s, texture = %u", CID(context),
           GLenumToString(GLESEnum::TextureTarget, target), texture);
 
@@ -592,7 +607,13 @@ void GL_APIENTRY GL_BufferData(GLenum target, GLsizeiptr size, const void *data,
 void GL_APIENTRY GL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_BufferSubData, target, offset, size,
+                                       MakeCommandStreamData(data, size)))
+    {
+        return;
+    }
     EVENT(context, GLBufferSubData,
           "context = %d, target = %s, offset = %llu, size = %llu, data = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::BufferTargetARB, target),
@@ -684,7 +705,12 @@ GLenum GL_APIENTRY GL_CheckFramebufferStatus(GLenum target)
 void GL_APIENTRY GL_Clear(GLbitfield mask)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Clear, mask))
+    {
+        return;
+    }
     EVENT(context, GLClear, "context = %d, mask = %s", CID(context),
           GLbitfieldToString(GLESEnum::ClearBufferMask, mask).c_str());
 
@@ -721,7 +747,12 @@ void GL_APIENTRY GL_Clear(GLbitfield mask)
 void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_ClearColor, red, green, blue, alpha))
+    {
+        return;
+    }
     EVENT(context, GLClearColor, "context = %d, red = %f, green = %f, blue = %f, alpha = %f",
           CID(context), red, green, blue, alpha);
 
@@ -1765,7 +1796,12 @@ void GL_APIENTRY GL_DisableVertexAttribArray(GLuint index)
 void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_DrawArrays, mode, first, count))
+    {
+        return;
+    }
     EVENT(context, GLDrawArrays, "context = %d, mode = %s, first = %d, count = %d", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, mode), first, count);
 
@@ -1804,7 +1840,12 @@ void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
 void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_DrawElements, mode, count, type, indices))
+    {
+        return;
+    }
     EVENT(context, GLDrawElements,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR "",
           CID(context), GLenumToString(GLESEnum::PrimitiveType, mode), count,
@@ -3594,7 +3635,7 @@ GLboolean GL_APIENTRY GL_IsBuffer(GLuint buffer)
     if (ANGLE_LIKELY(context != nullptr))
     {
         BufferID bufferPacked = PackParam<BufferID>(buffer);
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -3685,7 +3726,7 @@ GLboolean GL_APIENTRY GL_IsFramebuffer(GLuint framebuffer)
     if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -4258,7 +4299,12 @@ void GL_APIENTRY GL_SampleCoverage(GLfloat value, GLboolean invert)
 void GL_APIENTRY GL_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Scissor, x, y, width, height))
+    {
+        return;
+    }
     EVENT(context, GLScissor, "context = %d, x = %d, y = %d, width = %d, height = %d", CID(context),
           x, y, width, height);
 
@@ -4918,7 +4964,12 @@ void GL_APIENTRY GL_TexSubImage2D(GLenum target,
 void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform1f, location, v0))
+    {
+        return;
+    }
     EVENT(context, GLUniform1f, "context = %d, location = %d, v0 = %f", CID(context), location, v0);
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -4960,7 +5011,13 @@ void GL_APIENTRY GL_Uniform1f(GLint location, GLfloat v0)
 void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform1fv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat))))
+    {
+        return;
+    }
     EVENT(context, GLUniform1fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5004,7 +5061,12 @@ void GL_APIENTRY GL_Uniform1fv(GLint location, GLsizei count, const GLfloat *val
 void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform1i, location, v0))
+    {
+        return;
+    }
     EVENT(context, GLUniform1i, "context = %d, location = %d, v0 = %d", CID(context), location, v0);
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -5046,7 +5108,13 @@ void GL_APIENTRY GL_Uniform1i(GLint location, GLint v0)
 void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform1iv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLint))))
+    {
+        return;
+    }
     EVENT(context, GLUniform1iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5090,7 +5158,12 @@ void GL_APIENTRY GL_Uniform1iv(GLint location, GLsizei count, const GLint *value
 void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform2f, location, v0, v1))
+    {
+        return;
+    }
     EVENT(context, GLUniform2f, "context = %d, location = %d, v0 = %f, v1 = %f", CID(context),
           location, v0, v1);
 
@@ -5133,7 +5206,13 @@ void GL_APIENTRY GL_Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform2fv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 2)))
+    {
+        return;
+    }
     EVENT(context, GLUniform2fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5177,7 +5256,12 @@ void GL_APIENTRY GL_Uniform2fv(GLint location, GLsizei count, const GLfloat *val
 void GL_APIENTRY GL_Uniform2i(GLint location, GLint v0, GLint v1)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform2i, location, v0, v1))
+    {
+        return;
+    }
     EVENT(context, GLUniform2i, "context = %d, location = %d, v0 = %d, v1 = %d", CID(context),
           location, v0, v1);
 
@@ -5220,7 +5304,13 @@ void GL_APIENTRY GL_Uniform2i(GLint location, GLint v0, GLint v1)
 void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform2iv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLint) * 2)))
+    {
+        return;
+    }
     EVENT(context, GLUniform2iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5264,7 +5354,12 @@ void GL_APIENTRY GL_Uniform2iv(GLint location, GLsizei count, const GLint *value
 void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform3f, location, v0, v1, v2))
+    {
+        return;
+    }
     EVENT(context, GLUniform3f, "context = %d, location = %d, v0 = %f, v1 = %f, v2 = %f",
           CID(context), location, v0, v1, v2);
 
@@ -5307,7 +5402,13 @@ void GL_APIENTRY GL_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
 void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform3fv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 3)))
+    {
+        return;
+    }
     EVENT(context, GLUniform3fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5351,7 +5452,12 @@ void GL_APIENTRY GL_Uniform3fv(GLint location, GLsizei count, const GLfloat *val
 void GL_APIENTRY GL_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform3i, location, v0, v1, v2))
+    {
+        return;
+    }
     EVENT(context, GLUniform3i, "context = %d, location = %d, v0 = %d, v1 = %d, v2 = %d",
           CID(context), location, v0, v1, v2);
 
@@ -5394,7 +5500,13 @@ void GL_APIENTRY GL_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform3iv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLint) * 3)))
+    {
+        return;
+    }
     EVENT(context, GLUniform3iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5438,7 +5550,12 @@ void GL_APIENTRY GL_Uniform3iv(GLint location, GLsizei count, const GLint *value
 void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform4f, location, v0, v1, v2, v3))
+    {
+        return;
+    }
     EVENT(context, GLUniform4f, "context = %d, location = %d, v0 = %f, v1 = %f, v2 = %f, v3 = %f",
           CID(context), location, v0, v1, v2, v3);
 
@@ -5481,7 +5598,13 @@ void GL_APIENTRY GL_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2
 void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform4fv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 4)))
+    {
+        return;
+    }
     EVENT(context, GLUniform4fv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5525,7 +5648,12 @@ void GL_APIENTRY GL_Uniform4fv(GLint location, GLsizei count, const GLfloat *val
 void GL_APIENTRY GL_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform4i, location, v0, v1, v2, v3))
+    {
+        return;
+    }
     EVENT(context, GLUniform4i, "context = %d, location = %d, v0 = %d, v1 = %d, v2 = %d, v3 = %d",
           CID(context), location, v0, v1, v2, v3);
 
@@ -5568,7 +5696,13 @@ void GL_APIENTRY GL_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLin
 void GL_APIENTRY GL_Uniform4iv(GLint location, GLsizei count, const GLint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform4iv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLint) * 4)))
+    {
+        return;
+    }
     EVENT(context, GLUniform4iv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -5615,7 +5749,13 @@ void GL_APIENTRY GL_UniformMatrix2fv(GLint location,
                                      const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_UniformMatrix2fv, location, count, transpose,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 4)))
+    {
+        return;
+    }
     EVENT(context, GLUniformMatrix2fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -5664,7 +5804,13 @@ void GL_APIENTRY GL_UniformMatrix3fv(GLint location,
                                      const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_UniformMatrix3fv, location, count, transpose,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 9)))
+    {
+        return;
+    }
     EVENT(context, GLUniformMatrix3fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -5713,7 +5859,13 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
                                      const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_UniformMatrix4fv, location, count, transpose,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 16)))
+    {
+        return;
+    }
     EVENT(context, GLUniformMatrix4fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -5759,7 +5911,12 @@ void GL_APIENTRY GL_UniformMatrix4fv(GLint location,
 void GL_APIENTRY GL_UseProgram(GLuint program)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_UseProgram, program))
+    {
+        return;
+    }
     EVENT(context, GLUseProgram, "context = %d, program = %u", CID(context), program);
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -6191,7 +6348,13 @@ void GL_APIENTRY GL_VertexAttribPointer(GLuint index,
                                         const void *pointer)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_VertexAttribPointer, index, size, type, normalized,
+                                       stride, pointer))
+    {
+        return;
+    }
     EVENT(context, GLVertexAttribPointer,
           "context = %d, index = %u, size = %d, type = %s, normalized = %s, stride = %d, pointer = "
           "0x%016" PRIxPTR "",
@@ -6239,7 +6402,12 @@ void GL_APIENTRY GL_VertexAttribPointer(GLuint index,
 void GL_APIENTRY GL_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Viewport, x, y, width, height))
+    {
+        return;
+    }
     EVENT(context, GLViewport, "context = %d, x = %d, y = %d, width = %d, height = %d",
           CID(context), x, y, width, height);
 
@@ -297,7 +297,12 @@ void GL_APIENTRY GL_BindTransformFeedback(GLenum target, GLuint id)
 void GL_APIENTRY GL_BindVertexArray(GLuint array)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_BindVertexArray, array))
+    {
+        return;
+    }
     EVENT(context, GLBindVertexArray, "context = %d, array = %u", CID(context), array);
 
     if (ANGLE_LIKELY(context != nullptr))
@@ -1081,7 +1086,12 @@ void GL_APIENTRY GL_DrawArraysInstanced(GLenum mode,
                                         GLsizei instancecount)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_DrawArraysInstanced, mode, first, count, instancecount))
+    {
+        return;
+    }
     EVENT(context, GLDrawArraysInstanced,
           "context = %d, mode = %s, first = %d, count = %d, instancecount = %d", CID(context),
           GLenumToString(GLESEnum::PrimitiveType, mode), first, count, instancecount);
@@ -1177,7 +1187,13 @@ void GL_APIENTRY GL_DrawElementsInstanced(GLenum mode,
                                           GLsizei instancecount)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_DrawElementsInstanced, mode, count, type, indices,
+                                       instancecount))
+    {
+        return;
+    }
     EVENT(context, GLDrawElementsInstanced,
           "context = %d, mode = %s, count = %d, type = %s, indices = 0x%016" PRIxPTR
           ", instancecount = %d",
@@ -1231,7 +1247,13 @@ void GL_APIENTRY GL_DrawRangeElements(GLenum mode,
                                       const void *indices)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_DrawRangeElements, mode, start, end, count, type,
+                                       indices))
+    {
+        return;
+    }
     EVENT(context, GLDrawRangeElements,
           "context = %d, mode = %s, start = %u, end = %u, count = %d, type = %s, indices = "
           "0x%016" PRIxPTR "",
@@ -2908,7 +2930,7 @@ GLboolean GL_APIENTRY GL_IsQuery(GLuint id)
     if (ANGLE_LIKELY(context != nullptr))
     {
         QueryID idPacked = PackParam<QueryID>(id);
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -3054,7 +3076,7 @@ GLboolean GL_APIENTRY GL_IsTransformFeedback(GLuint id)
     if (ANGLE_LIKELY(context != nullptr))
     {
         TransformFeedbackID idPacked = PackParam<TransformFeedbackID>(id);
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -3104,7 +3126,7 @@ GLboolean GL_APIENTRY GL_IsVertexArray(GLuint array)
     if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID arrayPacked = PackParam<VertexArrayID>(array);
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -3916,7 +3938,12 @@ void GL_APIENTRY GL_TransformFeedbackVaryings(GLuint program,
 void GL_APIENTRY GL_Uniform1ui(GLint location, GLuint v0)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform1ui, location, v0))
+    {
+        return;
+    }
     EVENT(context, GLUniform1ui, "context = %d, location = %d, v0 = %u", CID(context), location,
           v0);
 
@@ -3959,7 +3986,13 @@ void GL_APIENTRY GL_Uniform1ui(GLint location, GLuint v0)
 void GL_APIENTRY GL_Uniform1uiv(GLint location, GLsizei count, const GLuint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform1uiv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLuint))))
+    {
+        return;
+    }
     EVENT(context, GLUniform1uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -4003,7 +4036,12 @@ void GL_APIENTRY GL_Uniform1uiv(GLint location, GLsizei count, const GLuint *val
 void GL_APIENTRY GL_Uniform2ui(GLint location, GLuint v0, GLuint v1)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform2ui, location, v0, v1))
+    {
+        return;
+    }
     EVENT(context, GLUniform2ui, "context = %d, location = %d, v0 = %u, v1 = %u", CID(context),
           location, v0, v1);
 
@@ -4046,7 +4084,13 @@ void GL_APIENTRY GL_Uniform2ui(GLint location, GLuint v0, GLuint v1)
 void GL_APIENTRY GL_Uniform2uiv(GLint location, GLsizei count, const GLuint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform2uiv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLuint) * 2)))
+    {
+        return;
+    }
     EVENT(context, GLUniform2uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -4090,7 +4134,12 @@ void GL_APIENTRY GL_Uniform2uiv(GLint location, GLsizei count, const GLuint *val
 void GL_APIENTRY GL_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform3ui, location, v0, v1, v2))
+    {
+        return;
+    }
     EVENT(context, GLUniform3ui, "context = %d, location = %d, v0 = %u, v1 = %u, v2 = %u",
           CID(context), location, v0, v1, v2);
 
@@ -4133,7 +4182,13 @@ void GL_APIENTRY GL_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 void GL_APIENTRY GL_Uniform3uiv(GLint location, GLsizei count, const GLuint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform3uiv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLuint) * 3)))
+    {
+        return;
+    }
     EVENT(context, GLUniform3uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -4177,7 +4232,12 @@ void GL_APIENTRY GL_Uniform3uiv(GLint location, GLsizei count, const GLuint *val
 void GL_APIENTRY GL_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform4ui, location, v0, v1, v2, v3))
+    {
+        return;
+    }
     EVENT(context, GLUniform4ui, "context = %d, location = %d, v0 = %u, v1 = %u, v2 = %u, v3 = %u",
           CID(context), location, v0, v1, v2, v3);
 
@@ -4220,7 +4280,13 @@ void GL_APIENTRY GL_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2,
 void GL_APIENTRY GL_Uniform4uiv(GLint location, GLsizei count, const GLuint *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_Uniform4uiv, location, count,
+                                       MakeCommandStreamData(value, count * sizeof(GLuint) * 4)))
+    {
+        return;
+    }
     EVENT(context, GLUniform4uiv,
           "context = %d, location = %d, count = %d, value = 0x%016" PRIxPTR "", CID(context),
           location, count, (uintptr_t)value);
@@ -4317,7 +4383,13 @@ void GL_APIENTRY GL_UniformMatrix2x3fv(GLint location,
                                        const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_UniformMatrix2x3fv, location, count, transpose,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 6)))
+    {
+        return;
+    }
     EVENT(context, GLUniformMatrix2x3fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -4366,7 +4438,13 @@ void GL_APIENTRY GL_UniformMatrix2x4fv(GLint location,
                                        const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_UniformMatrix2x4fv, location, count, transpose,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 8)))
+    {
+        return;
+    }
     EVENT(context, GLUniformMatrix2x4fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -4415,7 +4493,13 @@ void GL_APIENTRY GL_UniformMatrix3x2fv(GLint location,
                                        const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_UniformMatrix3x2fv, location, count, transpose,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 6)))
+    {
+        return;
+    }
     EVENT(context, GLUniformMatrix3x2fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -4464,7 +4548,13 @@ void GL_APIENTRY GL_UniformMatrix3x4fv(GLint location,
                                        const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_UniformMatrix3x4fv, location, count, transpose,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 12)))
+    {
+        return;
+    }
     EVENT(context, GLUniformMatrix3x4fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -4513,7 +4603,13 @@ void GL_APIENTRY GL_UniformMatrix4x2fv(GLint location,
                                        const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_UniformMatrix4x2fv, location, count, transpose,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 8)))
+    {
+        return;
+    }
     EVENT(context, GLUniformMatrix4x2fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -4562,7 +4658,13 @@ void GL_APIENTRY GL_UniformMatrix4x3fv(GLint location,
                                        const GLfloat *value)
 {
     ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
-    Context *context = GetValidGlobalContext();
+    Context *context = GetValidGlobalContextForCommandStream();
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()) &&
+        context->recordInCommandStream(GL_UniformMatrix4x3fv, location, count, transpose,
+                                       MakeCommandStreamData(value, count * sizeof(GLfloat) * 12)))
+    {
+        return;
+    }
     EVENT(context, GLUniformMatrix4x3fv,
           "context = %d, location = %d, count = %d, transpose = %s, value = 0x%016" PRIxPTR "",
           CID(context), location, count, GLbooleanToString(transpose), (uintptr_t)value);
@@ -8740,7 +8740,7 @@ GLboolean GL_APIENTRY GL_IsQueryEXT(GLuint id)
     if (ANGLE_LIKELY(context != nullptr))
     {
         QueryID idPacked = PackParam<QueryID>(id);
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -17864,7 +17864,7 @@ GLboolean GL_APIENTRY GL_IsFramebufferOES(GLuint framebuffer)
     if (ANGLE_LIKELY(context != nullptr))
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
@@ -20189,7 +20189,7 @@ GLboolean GL_APIENTRY GL_IsVertexArrayOES(GLuint array)
     if (ANGLE_LIKELY(context != nullptr))
     {
         VertexArrayID arrayPacked = PackParam<VertexArrayID>(array);
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+
         bool isCallValid = context->skipValidation();
         if (!isCallValid)
         {
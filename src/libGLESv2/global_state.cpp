@@ -146,7 +146,14 @@ ANGLE_NO_SANITIZE_MEMORY ANGLE_NO_SANITIZE_THREAD Thread *GetCurrentThread()
 #else
     Thread *current = gCurrentThread;
 #endif
-    return (current ? current : AllocateCurrentThread());
+    if (current == nullptr)
+    {
+        return AllocateCurrentThread();
+    }
+
+    // The EGL entry points may use the current context or make another one current.
+    gl::FinishCommandStream(current->getContext());
+    return current;
 }
 
 void SetContextCurrent(Thread *thread, gl::Context *context)
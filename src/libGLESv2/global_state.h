@@ -120,6 +120,16 @@ ANGLE_INLINE ScopedContextMutexLock LockAndTryMergeContextMutexes(gl::Context *c
 
 namespace gl
 {
+// Finishes the command stream of |context|, so that the calls it recorded are done before the
+// calling entry point uses the context.
+ANGLE_INLINE void FinishCommandStream(Context *context)
+{
+    if (ANGLE_UNLIKELY(context != nullptr && context->hasCommandStream()))
+    {
+        context->finishCommandStream();
+    }
+}
+
 ANGLE_INLINE Context *GetGlobalContext()
 {
 #if defined(ANGLE_PLATFORM_APPLE) || defined(ANGLE_USE_STATIC_THREAD_LOCAL_VARIABLES)
@@ -128,10 +138,13 @@ ANGLE_INLINE Context *GetGlobalContext()
     egl::Thread *currentThread = egl::gCurrentThread;
 #endif
     ASSERT(currentThread);
-    return currentThread->getContext();
+    Context *context = currentThread->getContext();
+    FinishCommandStream(context);
+    return context;
 }
 
-ANGLE_INLINE Context *GetValidGlobalContext()
+// Used directly by the entry points that can be recorded in the command stream.
+ANGLE_INLINE Context *GetValidGlobalContextForCommandStream()
 {
 #if defined(ANGLE_USE_ANDROID_TLS_SLOT)
     // TODO: Replace this branch with a compile time flag (http://anglebug.com/42263361)
@@ -148,6 +161,13 @@ ANGLE_INLINE Context *GetValidGlobalContext()
 #endif
 }
 
+ANGLE_INLINE Context *GetValidGlobalContext()
+{
+    Context *context = GetValidGlobalContextForCommandStream();
+    FinishCommandStream(context);
+    return context;
+}
+
 // Generate a context lost error on the context if it is non-null and lost.
 void GenerateContextLostErrorOnCurrentGlobalContext(angle::EntryPoint entryPoint);
 
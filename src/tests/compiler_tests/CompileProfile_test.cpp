@@ -0,0 +1,152 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileProfile_test.cpp:
+//   Tests the statistics returned by sh::GetCompileProfile, and compilations that exceed
+//   ShCompileOptions::compileTimeBudgetMs.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u[4];
+out vec4 color;
+vec4 f(vec4 v)
+{
+    return v * 0.5 + u[1];
+}
+void main()
+{
+    vec4 c = u[0];
+    for (int i = 0; i < 4; ++i)
+    {
+        c += f(u[i]);
+    }
+    color = c;
+})";
+
+class CompileProfileTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        sh::InitBuiltInResources(&mResources);
+        mCompiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, SH_ESSL_OUTPUT,
+                                          &mResources);
+        ASSERT_NE(mCompiler, nullptr);
+    }
+
+    void TearDown() override { sh::Destruct(mCompiler); }
+
+    bool compile(const ShCompileOptions &options)
+    {
+        const char *shader = kFS;
+        return sh::Compile(mCompiler, &shader, 1, options);
+    }
+
+    ShBuiltInResources mResources;
+    ShHandle mCompiler = nullptr;
+};
+
+// Tests that the profile has the statistics of the last compilation.
+TEST_F(CompileProfileTest, Statistics)
+{
+    ShCompileOptions options      = {};
+    options.objectCode            = true;
+    options.collectPassStatistics = true;
+    ASSERT_TRUE(compile(options)) << sh::GetInfoLog(mCompiler);
+
+    const sh::CompileProfile &profile = sh::GetCompileProfile(mCompiler);
+    ASSERT_FALSE(profile.passes.empty());
+    EXPECT_STREQ(profile.passes[0].name, "Parse");
+    EXPECT_GT(profile.seconds, 0.0);
+    EXPECT_GT(profile.astNodes, 0u);
+    EXPECT_GT(profile.poolBytes, 0u);
+    EXPECT_GT(profile.symbolLookups, 0u);
+    EXPECT_EQ(profile.objectCodeBytes, std::string(sh::GetObjectCode(mCompiler)).size());
+    EXPECT_FALSE(profile.budgetExceeded);
+
+    // The statistics are not accumulated over compilations.
+    const size_t passCount       = profile.passes.size();
+    const uint64_t astNodes      = profile.astNodes;
+    const size_t objectCodeBytes = profile.objectCodeBytes;
+    ASSERT_TRUE(compile(options)) << sh::GetInfoLog(mCompiler);
+    EXPECT_EQ(profile.passes.size(), passCount);
+    EXPECT_EQ(profile.astNodes, astNodes);
+    EXPECT_EQ(profile.objectCodeBytes, objectCodeBytes);
+
+    ASSERT_TRUE(compile({})) << sh::GetInfoLog(mCompiler);
+    EXPECT_TRUE(profile.passes.empty());
+    EXPECT_EQ(profile.astNodes, 0u);
+}
+
+// Tests that a compilation that doesn't fit in its time budget fails, and that the next
+// compilation is not affected.
+TEST_F(CompileProfileTest, TimeBudget)
+{
+    ShCompileOptions options    = {};
+    options.objectCode          = true;
+    options.compileTimeBudgetMs = 1;
+
+    // Make the compilation take longer than the budget by translating a long shader.
+    std::string shader = "#version 300 es\nprecision highp float;\nout vec4 color;\n";
+    shader += "void main()\n{\n    vec4 c = vec4(0.0);\n";
+    for (int i = 0; i < 20000; ++i)
+    {
+        shader += "    c = c * 0.5 + vec4(c.yzwx.x, float(" + std::to_string(i) + "), c.zz);\n";
+    }
+    shader += "    color = c;\n}\n";
+
+    const char *shaderString = shader.c_str();
+    EXPECT_FALSE(sh::Compile(mCompiler, &shaderString, 1, options));
+    EXPECT_TRUE(sh::GetCompileProfile(mCompiler).budgetExceeded);
+    EXPECT_NE(std::string(sh::GetInfoLog(mCompiler)).find("time budget"), std::string::npos);
+
+    options.compileTimeBudgetMs = 0;
+    EXPECT_TRUE(compile(options)) << sh::GetInfoLog(mCompiler);
+    EXPECT_FALSE(sh::GetCompileProfile(mCompiler).budgetExceeded);
+}
+
+// Tests that constant folding during parsing stops once the compilation exceeds its time budget,
+// rather than the budget only being checked after parsing.
+TEST_F(CompileProfileTest, TimeBudgetWhileFolding)
+{
+    ShCompileOptions options      = {};
+    options.objectCode            = true;
+    options.collectPassStatistics = true;
+    options.compileTimeBudgetMs   = 1;
+
+    // Every comparison of the large constant array is folded while parsing.
+    constexpr int kArraySize = 1000;
+    std::string shader       = "#version 300 es\nprecision highp float;\nout vec4 color;\n";
+    shader += "const float a[" + std::to_string(kArraySize) + "] = float[](0.0";
+    for (int i = 1; i < kArraySize; ++i)
+    {
+        shader += ", " + std::to_string(i) + ".0";
+    }
+    shader += ");\n";
+    for (int i = 0; i < 10000; ++i)
+    {
+        shader += "const bool b" + std::to_string(i) + " = a == a;\n";
+    }
+    shader += "void main()\n{\n    color = vec4(b0);\n}\n";
+
+    const char *shaderString = shader.c_str();
+    EXPECT_FALSE(sh::Compile(mCompiler, &shaderString, 1, options));
+
+    const sh::CompileProfile &profile = sh::GetCompileProfile(mCompiler);
+    EXPECT_TRUE(profile.budgetExceeded);
+    ASSERT_EQ(profile.passes.size(), 1u);
+    EXPECT_STREQ(profile.passes[0].name, "Parse");
+    EXPECT_NE(std::string(sh::GetInfoLog(mCompiler)).find("time budget"), std::string::npos);
+}
+
+}  // anonymous namespace
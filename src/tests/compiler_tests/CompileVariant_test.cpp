@@ -0,0 +1,238 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CompileVariant_test.cpp:
+//   Tests that sh::CompileVariant produces the same results as compiling the shader from its
+//   source with the same options.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u[4];
+uniform int index;
+out vec4 color;
+struct Light
+{
+    vec4 color;
+    float intensity;
+};
+float weight(int i);
+vec4 shade(Light light)
+{
+    return light.color * light.intensity;
+}
+void main()
+{
+    struct Local
+    {
+        vec4 v;
+    };
+    Local local;
+    local.v = u[index];
+    vec4 c;
+    for (int i = 0; i < 4; ++i)
+    {
+        switch (i)
+        {
+            case 0:
+                c += u[i];
+                break;
+            default:
+                c -= u[i] * weight(i);
+                break;
+        }
+    }
+    color = shade(Light(c, 0.5)) + local.v;
+}
+float weight(int i)
+{
+    return float(i) * 0.25;
+})";
+
+struct CompileResults
+{
+    bool success;
+    std::string infoLog;
+    std::string objectCode;
+    std::vector<uint32_t> objectBinary;
+    std::vector<std::string> uniforms;
+};
+
+class CompileVariantTest : public testing::TestWithParam<ShShaderOutput>
+{
+  protected:
+    void SetUp() override
+    {
+        sh::InitBuiltInResources(&mResources);
+        mCompiler =
+            sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, GetParam(), &mResources);
+        mReferenceCompiler =
+            sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES3_SPEC, GetParam(), &mResources);
+        ASSERT_NE(mCompiler, nullptr);
+        ASSERT_NE(mReferenceCompiler, nullptr);
+    }
+
+    void TearDown() override
+    {
+        sh::Destruct(mCompiler);
+        sh::Destruct(mReferenceCompiler);
+    }
+
+    static ShCompileOptions Options()
+    {
+        ShCompileOptions options = {};
+        options.objectCode       = true;
+        return options;
+    }
+
+    static CompileResults GetResults(ShHandle compiler, bool success)
+    {
+        CompileResults results;
+        results.success    = success;
+        results.infoLog    = sh::GetInfoLog(compiler);
+        if (GetParam() != SH_SPIRV_VULKAN_OUTPUT)
+        {
+            results.objectCode = sh::GetObjectCode(compiler);
+        }
+        else if (success)
+        {
+            results.objectBinary = sh::GetObjectBinaryBlob(compiler);
+        }
+        for (const sh::ShaderVariable &uniform : *sh::GetUniforms(compiler))
+        {
+            results.uniforms.push_back(uniform.name + " " + uniform.mappedName);
+        }
+        return results;
+    }
+
+    // Compiles the shader from its source with the reference compiler, and checks that the
+    // results of the last compilation are the same.
+    void expectSameAsCompilation(const char *shader, const ShCompileOptions &options)
+    {
+        const CompileResults results = GetResults(mCompiler, true);
+        const CompileResults expected =
+            GetResults(mReferenceCompiler, sh::Compile(mReferenceCompiler, &shader, 1, options));
+
+        EXPECT_TRUE(expected.success) << expected.infoLog;
+        EXPECT_EQ(results.infoLog, expected.infoLog);
+        EXPECT_EQ(results.objectCode, expected.objectCode);
+        EXPECT_EQ(results.objectBinary, expected.objectBinary);
+        EXPECT_EQ(results.uniforms, expected.uniforms);
+    }
+
+    ShBuiltInResources mResources;
+    ShHandle mCompiler          = nullptr;
+    ShHandle mReferenceCompiler = nullptr;
+};
+
+// Tests that variants are the same as compiling the shader with their options, including when
+// they follow other variants.
+TEST_P(CompileVariantTest, MatchesCompilation)
+{
+    const char *shader = kFS;
+
+    ShCompileOptions options   = Options();
+    options.retainParsedShader = true;
+    ASSERT_TRUE(sh::Compile(mCompiler, &shader, 1, options)) << sh::GetInfoLog(mCompiler);
+    expectSameAsCompilation(kFS, options);
+
+    ShCompileOptions initializeOptions              = Options();
+    initializeOptions.initializeUninitializedLocals = true;
+    initializeOptions.initOutputVariables           = true;
+    ASSERT_TRUE(sh::CompileVariant(mCompiler, initializeOptions)) << sh::GetInfoLog(mCompiler);
+    expectSameAsCompilation(kFS, initializeOptions);
+
+    ShCompileOptions clampOptions         = Options();
+    clampOptions.clampIndirectArrayBounds = true;
+    ASSERT_TRUE(sh::CompileVariant(mCompiler, clampOptions)) << sh::GetInfoLog(mCompiler);
+    expectSameAsCompilation(kFS, clampOptions);
+
+    ASSERT_TRUE(sh::CompileVariant(mCompiler, Options())) << sh::GetInfoLog(mCompiler);
+    expectSameAsCompilation(kFS, Options());
+}
+
+// Tests that a variant with options that change how the shader is parsed compiles it again.
+TEST_P(CompileVariantTest, OptionsThatAffectParsing)
+{
+    const char *shader = kFS;
+
+    ShCompileOptions options   = Options();
+    options.retainParsedShader = true;
+    ASSERT_TRUE(sh::Compile(mCompiler, &shader, 1, options));
+
+    ShCompileOptions regenerateOptions      = Options();
+    regenerateOptions.regenerateStructNames = true;
+    ASSERT_TRUE(sh::CompileVariant(mCompiler, regenerateOptions)) << sh::GetInfoLog(mCompiler);
+    expectSameAsCompilation(kFS, regenerateOptions);
+
+    ASSERT_TRUE(sh::CompileVariant(mCompiler, Options())) << sh::GetInfoLog(mCompiler);
+    expectSameAsCompilation(kFS, Options());
+}
+
+// Tests that the warnings generated while parsing are in the info log of every variant, and that
+// errors of a variant don't affect the next one.
+TEST_P(CompileVariantTest, InfoLog)
+{
+    constexpr char kLoopFS[] = R"(#extension GL_EXT_unsupported_extension : warn
+precision mediump float;
+uniform int n;
+void main()
+{
+    float f = 0.0;
+    for (int i = 0; i < n; ++i)
+    {
+        f += 0.5;
+    }
+    gl_FragColor = vec4(f);
+})";
+
+    const char *shader = kLoopFS;
+
+    ShCompileOptions options   = Options();
+    options.retainParsedShader = true;
+    ASSERT_TRUE(sh::Compile(mCompiler, &shader, 1, options));
+    EXPECT_NE(std::string(sh::GetInfoLog(mCompiler)).find("WARNING"), std::string::npos);
+
+    ShCompileOptions validateOptions     = Options();
+    validateOptions.validateLoopIndexing = true;
+    EXPECT_FALSE(sh::CompileVariant(mCompiler, validateOptions));
+    EXPECT_NE(std::string(sh::GetInfoLog(mCompiler)).find("ERROR"), std::string::npos);
+
+    ASSERT_TRUE(sh::CompileVariant(mCompiler, Options()));
+    EXPECT_NE(std::string(sh::GetInfoLog(mCompiler)).find("WARNING"), std::string::npos);
+    EXPECT_EQ(std::string(sh::GetInfoLog(mCompiler)).find("ERROR"), std::string::npos);
+    expectSameAsCompilation(kLoopFS, Options());
+}
+
+// Tests that there are no variants of shaders that were not retained.
+TEST_P(CompileVariantTest, RequiresRetainedShader)
+{
+    const char *shader = kFS;
+
+    EXPECT_FALSE(sh::CompileVariant(mCompiler, Options()));
+
+    ShCompileOptions options   = Options();
+    options.retainParsedShader = true;
+    ASSERT_TRUE(sh::Compile(mCompiler, &shader, 1, options));
+    ASSERT_TRUE(sh::Compile(mCompiler, &shader, 1, Options()));
+    EXPECT_FALSE(sh::CompileVariant(mCompiler, Options()));
+}
+
+#ifdef ANGLE_ENABLE_VULKAN
+constexpr ShShaderOutput kOutputs[] = {SH_ESSL_OUTPUT, SH_SPIRV_VULKAN_OUTPUT};
+#else
+constexpr ShShaderOutput kOutputs[] = {SH_ESSL_OUTPUT};
+#endif
+
+INSTANTIATE_TEST_SUITE_P(, CompileVariantTest, testing::ValuesIn(kOutputs));
+
+}  // anonymous namespace
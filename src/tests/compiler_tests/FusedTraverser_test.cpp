@@ -0,0 +1,361 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FusedTraverser_test.cpp:
+//   Tests that passes run in a fused traversal see the same visits as in traversals of their own.
+//
+
+#include "compiler/translator/tree_util/FusedTraverser.h"
+
+#include <sstream>
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "compiler/translator/OutputTree.h"
+#include "compiler/translator/glsl/TranslatorESSL.h"
+#include "gtest/gtest.h"
+
+using namespace sh;
+
+namespace
+{
+
+const char kShader[] = R"(#version 300 es
+precision highp float;
+uniform vec4 u;
+uniform int i;
+out vec4 color;
+float f(float x)
+{
+    return x * 2.0 + u.x;
+}
+void main()
+{
+    vec4 v = u;
+    for (int j = 0; j < i; ++j)
+    {
+        v.x += f(v.y);
+        if (v.x > 1.0)
+        {
+            v = v.wzyx;
+        }
+    }
+    switch (i)
+    {
+        case 0:
+            v *= 2.0;
+            break;
+        default:
+            v = -v;
+    }
+    color = i > 1 ? v : u;
+})";
+
+enum class Skip
+{
+    Nothing,
+    // Returns false from the PreVisit of binary nodes.
+    BinarySubtrees,
+    // Returns false from the InVisit of function definitions.
+    FunctionBodies,
+    // Returns false from the InVisit of blocks.
+    BlocksAfterFirstStatement,
+    // Returns false from the PreVisit of every node with children.
+    Everything,
+};
+
+// Records every visit along with the traversal state that visit functions can observe.
+class RecordingTraverser : public TIntermTraverser
+{
+  public:
+    RecordingTraverser(bool preVisit, bool inVisit, bool postVisit, Skip skip)
+        : TIntermTraverser(preVisit, inVisit, postVisit), mSkip(skip)
+    {}
+
+    const std::vector<std::string> &getVisits() const { return mVisits; }
+
+    void visitSymbol(TIntermSymbol *node) override { recordLeaf("symbol", node); }
+    void visitConstantUnion(TIntermConstantUnion *node) override { recordLeaf("constant", node); }
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override
+    {
+        recordLeaf("prototype", node);
+    }
+
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override
+    {
+        return record("swizzle", visit, node);
+    }
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        return record("binary", visit, node) &&
+               !(mSkip == Skip::BinarySubtrees && visit == PreVisit);
+    }
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        return record("unary", visit, node);
+    }
+    bool visitTernary(Visit visit, TIntermTernary *node) override
+    {
+        return record("ternary", visit, node);
+    }
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override
+    {
+        return record("if", visit, node);
+    }
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        return record("switch", visit, node);
+    }
+    bool visitCase(Visit visit, TIntermCase *node) override
+    {
+        return record("case", visit, node);
+    }
+    bool visitFunctionDefinition(Visit visit, TIntermFunctionDefinition *node) override
+    {
+        return record("function", visit, node) &&
+               !(mSkip == Skip::FunctionBodies && visit == InVisit);
+    }
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        return record("aggregate", visit, node);
+    }
+    bool visitBlock(Visit visit, TIntermBlock *node) override
+    {
+        return record("block", visit, node) &&
+               !(mSkip == Skip::BlocksAfterFirstStatement && visit == InVisit);
+    }
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        return record("declaration", visit, node);
+    }
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        return record("loop", visit, node);
+    }
+    bool visitBranch(Visit visit, TIntermBranch *node) override
+    {
+        return record("branch", visit, node);
+    }
+
+  private:
+    bool record(const char *type, Visit visit, TIntermNode *node)
+    {
+        std::ostringstream out;
+        out << type << " " << node << " visit=" << visit
+            << " childIndex=" << (visit == PreVisit ? getParentChildIndex(visit)
+                                                    : getLastTraversedChildIndex(visit));
+        recordState(&out);
+        return mSkip != Skip::Everything;
+    }
+
+    void recordLeaf(const char *type, TIntermNode *node)
+    {
+        std::ostringstream out;
+        out << type << " " << node << " childIndex=" << getParentChildIndex(PreVisit);
+        recordState(&out);
+    }
+
+    void recordState(std::ostringstream *out)
+    {
+        *out << " depth=" << getCurrentTraversalDepth() << " parent=" << getParentNode()
+             << " block=" << getParentBlock() << " blockDepth=" << getCurrentBlockDepth()
+             << " global=" << mInGlobalScope;
+        mVisits.push_back(out->str());
+    }
+
+    Skip mSkip;
+    std::vector<std::string> mVisits;
+};
+
+// Inserts a copy of every declaration before it.
+class DuplicateDeclarationsTraverser : public TIntermTraverser
+{
+  public:
+    DuplicateDeclarationsTraverser() : TIntermTraverser(true, false, false) {}
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        if (!mInGlobalScope)
+        {
+            TIntermDeclaration *copy = new TIntermDeclaration();
+            copy->appendDeclarator(node->getSequence()->front()->getAsTyped()->deepCopy());
+            insertStatementInParentBlock(copy);
+        }
+        return false;
+    }
+};
+
+class TraverserPass : public TFusablePass
+{
+  public:
+    explicit TraverserPass(TIntermTraverser *traverser) : mTraverser(traverser) {}
+
+    TIntermTraverser *getTraverser() override { return mTraverser; }
+
+    bool finish(TCompiler *compiler, TIntermBlock *root) override
+    {
+        return mTraverser->updateTree(compiler, root);
+    }
+
+  private:
+    TIntermTraverser *mTraverser;
+};
+
+class FusedTraverserTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        SetGlobalPoolAllocator(&mAllocator);
+
+        ShBuiltInResources resources;
+        sh::InitBuiltInResources(&resources);
+        mTranslator = new TranslatorESSL(GL_FRAGMENT_SHADER, SH_GLES3_SPEC);
+        ASSERT_TRUE(mTranslator->Init(resources));
+    }
+
+    void TearDown() override
+    {
+        delete mTranslator;
+
+        SetGlobalPoolAllocator(nullptr);
+        mAllocator.reset();
+    }
+
+    TIntermBlock *compile()
+    {
+        const char *shaderStrings[]     = {kShader};
+        ShCompileOptions compileOptions = {};
+        TIntermBlock *root = mTranslator->compileTreeForTesting(shaderStrings, 1, compileOptions);
+        EXPECT_NE(root, nullptr) << mTranslator->getInfoSink().info.c_str();
+        return root;
+    }
+
+    std::string output(TIntermBlock *root)
+    {
+        TInfoSinkBase out;
+        OutputTree(root, out);
+        return out.c_str();
+    }
+
+    TranslatorESSL *mTranslator;
+
+  private:
+    angle::PoolAllocator mAllocator;
+};
+
+// Tests that each fused traverser sees the same visits as when traversing alone, including when
+// other traversers skip different parts of the tree.
+TEST_F(FusedTraverserTest, SameVisitsAsSeparateTraversals)
+{
+    TIntermBlock *root = compile();
+    ASSERT_NE(root, nullptr);
+
+    struct Config
+    {
+        bool preVisit, inVisit, postVisit;
+        Skip skip;
+    };
+    const Config kConfigs[] = {
+        {true, true, true, Skip::Nothing},
+        {true, false, false, Skip::BinarySubtrees},
+        {true, true, true, Skip::FunctionBodies},
+        {false, true, true, Skip::BlocksAfterFirstStatement},
+        {true, false, true, Skip::BlocksAfterFirstStatement},
+        {true, false, false, Skip::Everything},
+        {false, false, true, Skip::Nothing},
+    };
+
+    std::vector<std::vector<std::string>> expectedVisits;
+    for (const Config &config : kConfigs)
+    {
+        RecordingTraverser traverser(config.preVisit, config.inVisit, config.postVisit,
+                                     config.skip);
+        root->traverse(&traverser);
+        expectedVisits.push_back(traverser.getVisits());
+    }
+
+    std::vector<std::unique_ptr<RecordingTraverser>> traversers;
+    TFusedTraverser fusedTraverser;
+    for (const Config &config : kConfigs)
+    {
+        traversers.push_back(std::make_unique<RecordingTraverser>(
+            config.preVisit, config.inVisit, config.postVisit, config.skip));
+        fusedTraverser.addPass(std::make_unique<TraverserPass>(traversers.back().get()));
+    }
+    ASSERT_TRUE(fusedTraverser.run(mTranslator, root));
+
+    for (size_t index = 0; index < traversers.size(); ++index)
+    {
+        EXPECT_EQ(traversers[index]->getVisits(), expectedVisits[index]) << "traverser " << index;
+    }
+}
+
+// Tests that the walk is pruned where no fused traverser is interested in the subtree.
+TEST_F(FusedTraverserTest, PrunesSkippedSubtrees)
+{
+    TIntermBlock *root = compile();
+    ASSERT_NE(root, nullptr);
+
+    RecordingTraverser skipEverything(true, false, false, Skip::Everything);
+    TFusedTraverser fusedTraverser;
+    fusedTraverser.addPass(std::make_unique<TraverserPass>(&skipEverything));
+    ASSERT_TRUE(fusedTraverser.run(mTranslator, root));
+
+    // No node below the root is entered.
+    EXPECT_EQ(fusedTraverser.getMaxDepth(), 0);
+    EXPECT_EQ(skipEverything.getVisits().size(), 1u);
+}
+
+// Tests that statement insertions queued in a fused traversal are placed as in a traversal of
+// their own.
+TEST_F(FusedTraverserTest, InsertStatements)
+{
+    TIntermBlock *root = compile();
+    ASSERT_NE(root, nullptr);
+    DuplicateDeclarationsTraverser separateTraverser;
+    root->traverse(&separateTraverser);
+    ASSERT_TRUE(separateTraverser.updateTree(mTranslator, root));
+    const std::string expected = output(root);
+
+    root = compile();
+    ASSERT_NE(root, nullptr);
+    RecordingTraverser recorder(true, true, true, Skip::BlocksAfterFirstStatement);
+    DuplicateDeclarationsTraverser fusedDuplicator;
+    TFusedTraverser fusedTraverser;
+    fusedTraverser.addPass(std::make_unique<TraverserPass>(&recorder));
+    fusedTraverser.addPass(std::make_unique<TraverserPass>(&fusedDuplicator));
+    ASSERT_TRUE(fusedTraverser.run(mTranslator, root));
+
+    EXPECT_EQ(output(root), expected);
+}
+
+// Tests that pass statistics are collected when requested.
+TEST_F(FusedTraverserTest, PassStatistics)
+{
+    const char *shaderStrings[]          = {kShader};
+    ShCompileOptions compileOptions      = {};
+    compileOptions.objectCode            = true;
+    compileOptions.collectPassStatistics = true;
+    ASSERT_TRUE(mTranslator->compile(shaderStrings, 1, compileOptions));
+
+    bool foundFusedValidation = false;
+    for (const TCompiler::PassStatistics &pass : mTranslator->getPassStatistics())
+    {
+        EXPECT_GE(pass.seconds, 0.0);
+        if (std::string(pass.name) == "ValidateVaryingLocationsAndOutputs")
+        {
+            foundFusedValidation = true;
+            EXPECT_GT(pass.nodeVisits, 0u);
+        }
+    }
+    EXPECT_TRUE(foundFusedValidation);
+
+    compileOptions.collectPassStatistics = false;
+    ASSERT_TRUE(mTranslator->compile(shaderStrings, 1, compileOptions));
+    EXPECT_TRUE(mTranslator->getPassStatistics().empty());
+}
+
+}  // anonymous namespace
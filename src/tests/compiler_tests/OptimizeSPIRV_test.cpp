@@ -0,0 +1,185 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// OptimizeSPIRV_test.cpp:
+//   Tests that ShCompileOptions::optimizeSPIRV removes redundant loads and dead local variables
+//   from the generated SPIR-V, and keeps what is still needed.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "common/spirv/spirv_instruction_parser_autogen.h"
+#include "gtest/gtest.h"
+
+namespace spirv = angle::spirv;
+
+namespace
+{
+struct InstructionCounts
+{
+    size_t loads          = 0;
+    size_t localVariables = 0;
+};
+
+class OptimizeSPIRVTest : public testing::Test
+{
+  protected:
+    void SetUp() override { sh::InitBuiltInResources(&mResources); }
+
+    void TearDown() override
+    {
+        if (mCompiler)
+        {
+            sh::Destruct(mCompiler);
+        }
+    }
+
+    spirv::Blob compile(const char *shaderSource, bool optimize)
+    {
+        if (mCompiler == nullptr)
+        {
+            mCompiler = sh::ConstructCompiler(GL_COMPUTE_SHADER, SH_GLES3_1_SPEC,
+                                              SH_SPIRV_VULKAN_OUTPUT, &mResources);
+            EXPECT_NE(mCompiler, nullptr);
+        }
+
+        const char *shaderStrings[] = {shaderSource};
+
+        ShCompileOptions options        = {};
+        options.objectCode              = true;
+        options.removeInactiveVariables = true;
+        options.optimizeSPIRV           = optimize;
+
+        EXPECT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, options))
+            << sh::GetInfoLog(mCompiler);
+        return sh::GetObjectBinaryBlob(mCompiler);
+    }
+
+    static InstructionCounts CountInstructions(const spirv::Blob &blob)
+    {
+        InstructionCounts counts;
+        for (size_t currentWord = spirv::kHeaderIndexInstructions; currentWord < blob.size();)
+        {
+            uint32_t wordCount;
+            spv::Op opCode;
+            spirv::GetInstructionOpAndLength(&blob[currentWord], &opCode, &wordCount);
+
+            if (opCode == spv::OpLoad)
+            {
+                ++counts.loads;
+            }
+            else if (opCode == spv::OpVariable &&
+                     blob[currentWord + 3] == spv::StorageClassFunction)
+            {
+                ++counts.localVariables;
+            }
+
+            currentWord += wordCount;
+        }
+        return counts;
+    }
+
+    ShBuiltInResources mResources;
+    ShHandle mCompiler = nullptr;
+};
+
+// Tests that local variables that are stored and loaded within a block are replaced with the
+// values stored in them.
+TEST_F(OptimizeSPIRVTest, ForwardsLocalVariables)
+{
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x = 1) in;
+uniform vec4 u;
+layout(binding = 0) buffer Output { vec4 color; };
+void main()
+{
+    vec4 a = u * 2.0;
+    vec4 b = a + a;
+    a = b * a;
+    color = a + b;
+})";
+
+    const spirv::Blob blob          = compile(kCS, false);
+    const spirv::Blob optimizedBlob = compile(kCS, true);
+
+    const InstructionCounts counts          = CountInstructions(blob);
+    const InstructionCounts optimizedCounts = CountInstructions(optimizedBlob);
+
+    EXPECT_GT(counts.localVariables, 0u);
+    EXPECT_EQ(optimizedCounts.localVariables, 0u);
+    EXPECT_LT(optimizedCounts.loads, counts.loads);
+    EXPECT_LT(optimizedBlob.size(), blob.size());
+
+    // The ids are not renumbered.
+    EXPECT_EQ(optimizedBlob[spirv::kHeaderIndexIndexBound], blob[spirv::kHeaderIndexIndexBound]);
+}
+
+// Tests that variables whose values are needed in other blocks are kept.
+TEST_F(OptimizeSPIRVTest, KeepsVariablesUsedAcrossBlocks)
+{
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x = 1) in;
+uniform vec4 u;
+uniform int n;
+layout(binding = 0) buffer Output { vec4 color; };
+void main()
+{
+    vec4 sum = vec4(0);
+    for (int i = 0; i < n; ++i)
+    {
+        sum += u * float(i);
+    }
+    color = sum;
+})";
+
+    // Both the loop index and the sum are read in blocks other than the ones that write them.
+    const InstructionCounts optimizedCounts = CountInstructions(compile(kCS, true));
+    EXPECT_EQ(optimizedCounts.localVariables, 2u);
+}
+
+// Tests that local variables whose address is taken are not forwarded.
+TEST_F(OptimizeSPIRVTest, KeepsAliasedVariables)
+{
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x = 1) in;
+uniform vec4 u;
+uniform int index;
+layout(binding = 0) buffer Output { vec4 color; };
+void main()
+{
+    vec4 a = u;
+    a[index] = 1.0;
+    color = a;
+})";
+
+    const InstructionCounts optimizedCounts = CountInstructions(compile(kCS, true));
+    EXPECT_EQ(optimizedCounts.localVariables, 1u);
+}
+
+// Tests that the optimized SPIR-V is the same every time it's generated.
+TEST_F(OptimizeSPIRVTest, Deterministic)
+{
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x = 4) in;
+precision mediump float;
+uniform sampler2D s;
+layout(binding = 0) buffer Output { vec4 color[]; };
+vec4 f(vec4 v, inout float w)
+{
+    w += v.x;
+    return v * w;
+}
+void main()
+{
+    float w = 0.5;
+    vec4 c = texelFetch(s, ivec2(gl_LocalInvocationID.xy), 0);
+    c = f(c, w) + f(c.wzyx, w);
+    color[gl_LocalInvocationIndex] = c * w;
+})";
+
+    EXPECT_EQ(compile(kCS, true), compile(kCS, true));
+}
+
+}  // anonymous namespace
@@ -0,0 +1,224 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PreprocessedTokenStream_test.cpp:
+//   Tests that sh::GetPreprocessedTokenStream distinguishes shaders exactly when they may compile
+//   differently.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+class PreprocessedTokenStreamTest : public testing::Test
+{
+  protected:
+    void SetUp() override { sh::InitBuiltInResources(&mResources); }
+
+    void TearDown() override
+    {
+        if (mCompiler)
+        {
+            sh::Destruct(mCompiler);
+        }
+    }
+
+    void construct(GLenum shaderType)
+    {
+        mCompiler =
+            sh::ConstructCompiler(shaderType, SH_GLES3_1_SPEC, SH_ESSL_OUTPUT, &mResources);
+        ASSERT_NE(mCompiler, nullptr);
+    }
+
+    std::string getTokenStream(const char *shader)
+    {
+        if (mCompiler == nullptr)
+        {
+            construct(GL_FRAGMENT_SHADER);
+        }
+
+        std::string tokenStream;
+        EXPECT_TRUE(sh::GetPreprocessedTokenStream(mCompiler, &shader, 1, mOptions, &tokenStream));
+        return tokenStream;
+    }
+
+    std::string getTokenStream(const char *preamble, const char *shader)
+    {
+        return getTokenStream((std::string(preamble) + shader).c_str());
+    }
+
+    ShBuiltInResources mResources;
+    ShCompileOptions mOptions = {};
+    ShHandle mCompiler        = nullptr;
+};
+
+// Tests that comments, whitespace and macros that are not used don't affect the token stream.
+TEST_F(PreprocessedTokenStreamTest, IgnoresCommentsWhitespaceAndUnusedMacros)
+{
+    constexpr char kShader[] = R"(#version 300 es
+precision highp float;
+out vec4 color;
+void main()
+{
+    color = vec4(1.0);
+})";
+
+    constexpr char kDecoratedShader[] = R"(#version 300 es
+// A preamble that the shader doesn't use.
+#define USE_SHADOWS 1
+#define LIGHT_COUNT 4
+#undef USE_SHADOWS
+precision   highp float;
+out vec4 color;  /* output */
+#if defined(LIGHT_COUNT)
+void main()
+{
+    color =
+        vec4(1.0);
+}
+#else
+void main() {}
+#endif
+)";
+
+    EXPECT_EQ(getTokenStream(kShader), getTokenStream(kDecoratedShader));
+}
+
+// Tests that the token stream holds the expansion of the macros the shader uses.
+TEST_F(PreprocessedTokenStreamTest, UsedMacros)
+{
+    constexpr char kShader[] = R"(
+precision highp float;
+out vec4 color;
+void main()
+{
+    color = vec4(SCALE);
+})";
+
+    const std::string half = getTokenStream("#version 300 es\n#define SCALE 0.5", kShader);
+    const std::string halfToo =
+        getTokenStream("#version 300 es\n#define HALF 0.5\n#define SCALE HALF", kShader);
+    const std::string one = getTokenStream("#version 300 es\n#define SCALE 1.0", kShader);
+
+    EXPECT_EQ(half, halfToo);
+    EXPECT_NE(half, one);
+}
+
+// Tests that directives that affect compilation are part of the token stream.
+TEST_F(PreprocessedTokenStreamTest, Directives)
+{
+    constexpr char kShader[] = R"(
+precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(1.0);
+})";
+
+    const std::string base = getTokenStream(kShader);
+    EXPECT_NE(base, getTokenStream("#extension GL_OES_standard_derivatives : enable\n", kShader));
+    EXPECT_NE(base, getTokenStream("#pragma optimize(off)\n", kShader));
+
+    // Unknown pragmas are ignored by the compiler, but are conservatively recorded too.
+    EXPECT_NE(base, getTokenStream("#pragma unknown(on)\n", kShader));
+
+    // A shader without #version is compiled as ESSL 1.00.
+    EXPECT_EQ(base, getTokenStream("#version 100\n", kShader));
+}
+
+// Tests that macros predefined for extensions depend on the options like they do in compilation.
+TEST_F(PreprocessedTokenStreamTest, ExtensionMacrosFollowOptions)
+{
+    mResources.ANGLE_multi_draw = 1;
+    construct(GL_VERTEX_SHADER);
+
+    constexpr char kShader[] = R"(#version 300 es
+void main()
+{
+#ifdef GL_ANGLE_multi_draw
+    gl_Position = vec4(1.0);
+#else
+    gl_Position = vec4(0.0);
+#endif
+})";
+
+    mOptions.emulateGLDrawID   = true;
+    const std::string emulated = getTokenStream(kShader);
+    mOptions.emulateGLDrawID   = false;
+    EXPECT_NE(emulated, getTokenStream(kShader));
+}
+
+// Tests that token locations are part of the token stream only when the output has line
+// directives.
+TEST_F(PreprocessedTokenStreamTest, LineDirectives)
+{
+    constexpr char kShader[] = R"(
+precision highp float;
+out vec4 color;
+void main()
+{
+    color = vec4(1.0);
+})";
+
+    constexpr char kShaderWithComment[] = R"(
+precision highp float;
+out vec4 color;
+void main()
+{
+    color = /* white */ vec4(1.0);
+})";
+
+    const std::string base = getTokenStream("#version 300 es", kShader);
+    EXPECT_EQ(base, getTokenStream("#version 300 es\n// comment", kShader));
+
+    mOptions.lineDirectives         = true;
+    const std::string baseWithLines = getTokenStream("#version 300 es", kShader);
+    EXPECT_NE(baseWithLines, getTokenStream("#version 300 es\n// comment", kShader));
+
+    // Comments that don't move tokens to other lines still don't affect the token stream.
+    EXPECT_EQ(baseWithLines, getTokenStream("#version 300 es", kShaderWithComment));
+}
+
+// Tests that preprocessing errors fail.
+TEST_F(PreprocessedTokenStreamTest, Errors)
+{
+    constexpr char kShader[] = R"(#version 300 es
+#error unsupported
+void main() {})";
+
+    construct(GL_FRAGMENT_SHADER);
+    const char *shaderStrings[] = {kShader};
+    std::string tokenStream;
+    EXPECT_FALSE(
+        sh::GetPreprocessedTokenStream(mCompiler, shaderStrings, 1, mOptions, &tokenStream));
+}
+
+// Tests that getting the token stream doesn't affect the results of the previous compilation.
+TEST_F(PreprocessedTokenStreamTest, KeepsCompileResults)
+{
+    constexpr char kShader[] = R"(#version 300 es
+precision highp float;
+out vec4 color;
+void main()
+{
+    color = vec4(1.0);
+})";
+
+    construct(GL_FRAGMENT_SHADER);
+    const char *shaderStrings[]     = {kShader};
+    ShCompileOptions compileOptions = {};
+    compileOptions.objectCode       = true;
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, compileOptions));
+    const std::string objectCode = sh::GetObjectCode(mCompiler);
+
+    getTokenStream("#version 100\nvoid main() {}");
+
+    EXPECT_EQ(sh::GetShaderVersion(mCompiler), 300);
+    EXPECT_EQ(sh::GetObjectCode(mCompiler), objectCode);
+}
+
+}  // anonymous namespace
@@ -60,4 +60,30 @@ TEST(Type, BaseTypeMangledNamesUnique)
     }
 }
 
+// Verify that copies of a type have its layout qualifier, and that changing the layout qualifier
+// of a copy doesn't affect the original.
+TEST(Type, LayoutQualifierCopy)
+{
+    TScopedPoolAllocator allocator;
+
+    const TType *staticType = StaticType::Get<EbtFloat, EbpHigh, EvqFragmentOut, 4, 1>();
+    EXPECT_TRUE(staticType->getLayoutQualifier().isEmpty());
+
+    TLayoutQualifier layoutQualifier   = TLayoutQualifier::Create();
+    layoutQualifier.location           = 2;
+    layoutQualifier.locationsSpecified = 1;
+
+    TType type(*staticType);
+    type.setLayoutQualifier(layoutQualifier);
+
+    TType copy(type);
+    EXPECT_EQ(copy.getLayoutQualifier().location, 2);
+    EXPECT_EQ(copy.getLayoutQualifier().locationsSpecified, 1u);
+
+    copy.setLayoutQualifier(TLayoutQualifier::Create());
+    EXPECT_TRUE(copy.getLayoutQualifier().isEmpty());
+    EXPECT_EQ(type.getLayoutQualifier().location, 2);
+    EXPECT_TRUE(staticType->getLayoutQualifier().isEmpty());
+}
+
 }  // namespace sh
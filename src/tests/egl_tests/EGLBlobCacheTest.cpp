@@ -10,6 +10,7 @@
 #include "test_utils/ANGLETest.h"
 
 #include <map>
+#include <sstream>
 #include <vector>
 
 #include "common/PackedEnums.h"
@@ -161,7 +162,18 @@ class EGLBlobCacheTest : public ANGLETest<>
 
     bool programBinaryAvailable() { return IsGLExtensionEnabled("GL_OES_get_program_binary"); }
 
+    angle::VulkanPerfCounters getPerfCounters()
+    {
+        if (mIndexMap.empty())
+        {
+            mIndexMap = BuildCounterNameToIndexMap();
+        }
+
+        return GetPerfCounters(mIndexMap);
+    }
+
     bool mHasBlobCache;
+    CounterNameToIndexMap mIndexMap;
 };
 
 // Makes sure the extension exists and works
@@ -670,6 +682,390 @@ TEST_P(EGLBlobCacheInternalRejectionTest, ShaderCacheFunctional)
     glDeleteShader(shaderID);
 }
 
+class EGLBlobCacheRecordedPipelinesTest : public EGLBlobCacheTest
+{
+  protected:
+    static constexpr GLsizei kSize = 4;
+
+    void testSetUp() override
+    {
+        EGLBlobCacheTest::testSetUp();
+
+        glGenRenderbuffers(1, &mColor);
+        glGenFramebuffers(1, &mFramebuffer);
+        glGenRenderbuffers(1, &mResolveColor);
+        glGenFramebuffers(1, &mResolveFramebuffer);
+
+        // Draw to a multisampled framebuffer, so the pipeline used by the draw calls differs from
+        // the one that is warmed up at link time regardless of the recorded pipelines.
+        glBindRenderbuffer(GL_RENDERBUFFER, mColor);
+        glRenderbufferStorageMultisample(GL_RENDERBUFFER, 4, GL_RGBA8, kSize, kSize);
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, mColor);
+        ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+        glBindRenderbuffer(GL_RENDERBUFFER, mResolveColor);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, kSize, kSize);
+        glBindFramebuffer(GL_FRAMEBUFFER, mResolveFramebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                                  mResolveColor);
+        ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+    }
+
+    void testTearDown() override
+    {
+        glDeleteFramebuffers(1, &mResolveFramebuffer);
+        glDeleteRenderbuffers(1, &mResolveColor);
+        glDeleteFramebuffers(1, &mFramebuffer);
+        glDeleteRenderbuffers(1, &mColor);
+
+        EGLBlobCacheTest::testTearDown();
+    }
+
+    // Draws with |program| and returns the number of pipelines the draw call had to create.
+    uint64_t drawAndCountPipelineCreations(GLuint program)
+    {
+        const uint64_t misses = getPerfCounters().drawGraphicsPipelineCacheMisses;
+
+        glBindFramebuffer(GL_FRAMEBUFFER, mFramebuffer);
+        drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+        EXPECT_GL_NO_ERROR();
+
+        const uint64_t drawMisses = getPerfCounters().drawGraphicsPipelineCacheMisses - misses;
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, mFramebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, mResolveFramebuffer);
+        glBlitFramebuffer(0, 0, kSize, kSize, 0, 0, kSize, kSize, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, mResolveFramebuffer);
+        EXPECT_PIXEL_COLOR_EQ(kSize / 2, kSize / 2, GLColor::red);
+
+        return drawMisses;
+    }
+
+    // Loads |binary| in a new program and draws with it.
+    uint64_t loadBinaryAndCountPipelineCreations(GLenum binaryFormat,
+                                                 const std::vector<uint8_t> &binary)
+    {
+        GLProgram program;
+        program.makeEmpty();
+        glProgramBinary(program, binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+
+        GLint linkStatus = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        EXPECT_GL_TRUE(linkStatus);
+
+        return drawAndCountPipelineCreations(program);
+    }
+
+    // The entry holding the recorded pipelines of the program is the only one that starts with the
+    // header written by ProgramExecutableVk: version, desc size, desc count and hash of the descs.
+    std::vector<uint8_t> *findRecordedPipelinesEntry()
+    {
+        constexpr size_t kHeaderSize = 4 * sizeof(uint32_t);
+
+        for (auto &entry : gApplicationCache)
+        {
+            std::vector<uint8_t> &value = entry.second;
+            if (value.size() < kHeaderSize)
+            {
+                continue;
+            }
+
+            uint32_t header[4];
+            memcpy(header, value.data(), kHeaderSize);
+            if (header[0] == 1 && header[1] > 0 && header[2] > 0 && header[2] <= 16 &&
+                value.size() == kHeaderSize + header[1] * header[2])
+            {
+                return &value;
+            }
+        }
+
+        return nullptr;
+    }
+
+    GLuint mColor              = 0;
+    GLuint mFramebuffer        = 0;
+    GLuint mResolveColor       = 0;
+    GLuint mResolveFramebuffer = 0;
+};
+
+// Tests that the pipelines created by draw calls are warmed up when the program binary is loaded
+// again, and that a truncated or corrupt record of them is ignored.
+TEST_P(EGLBlobCacheRecordedPipelinesTest, WarmUpAfterProgramBinaryLoad)
+{
+    ANGLE_SKIP_TEST_IF(!programBinaryAvailable());
+    ANGLE_SKIP_TEST_IF(!getEGLWindow()->isFeatureEnabled(Feature::WarmUpPipelineCacheAtLink));
+    ANGLE_SKIP_TEST_IF(!getEGLWindow()->isFeatureEnabled(Feature::WarmUpRecordedPipelinesAtLink));
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_AMD_performance_monitor"));
+
+    EXPECT_TRUE(mHasBlobCache);
+    eglSetBlobCacheFuncsANDROID(getEGLWindow()->getDisplay(), SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    // The first draw call creates its pipeline, which gets recorded.
+    ANGLE_GL_PROGRAM(program, essl3_shaders::vs::Simple(), essl3_shaders::fs::Red());
+    EXPECT_GT(drawAndCountPipelineCreations(program), 0u);
+    ASSERT_NE(findRecordedPipelinesEntry(), nullptr);
+
+    GLint binaryLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    ASSERT_GT(binaryLength, 0);
+
+    std::vector<uint8_t> binary(binaryLength);
+    GLsizei writtenLength = 0;
+    GLenum binaryFormat   = GL_NONE;
+    glGetProgramBinary(program, binaryLength, &writtenLength, &binaryFormat, binary.data());
+    ASSERT_GL_NO_ERROR();
+    binary.resize(writtenLength);
+
+    // The pipeline is warmed up when the binary is loaded, so the first draw call doesn't create
+    // it.
+    EXPECT_EQ(loadBinaryAndCountPipelineCreations(binaryFormat, binary), 0u);
+
+    // A truncated record is ignored, and the draw call creates the pipeline again.  This records
+    // it again.
+    std::vector<uint8_t> *entry = findRecordedPipelinesEntry();
+    ASSERT_NE(entry, nullptr);
+    entry->pop_back();
+    EXPECT_GT(loadBinaryAndCountPipelineCreations(binaryFormat, binary), 0u);
+    EXPECT_EQ(loadBinaryAndCountPipelineCreations(binaryFormat, binary), 0u);
+
+    // A record with corrupt descs is ignored as well.
+    entry = findRecordedPipelinesEntry();
+    ASSERT_NE(entry, nullptr);
+    entry->back() ^= 0xFF;
+    EXPECT_GT(loadBinaryAndCountPipelineCreations(binaryFormat, binary), 0u);
+    EXPECT_EQ(loadBinaryAndCountPipelineCreations(binaryFormat, binary), 0u);
+}
+
+class EGLBlobCacheIncrementalPipelineCacheTest : public EGLBlobCacheTest
+{
+  protected:
+    // The period of pipeline cache syncs, in frames.
+    static constexpr uint32_t kPipelineCacheSyncPeriod = 60;
+    // The largest segment the pipeline cache is split into.
+    static constexpr size_t kMaxSegmentSize = 60 * 1024;
+    // The number of programs whose pipelines fill the pipeline cache before the first sync.
+    static constexpr uint32_t kProgramCount = 48;
+
+    // Returns a fragment shader that results in a pipeline of its own for each |index|.
+    static std::string MakeFragmentShader(uint32_t index)
+    {
+        std::stringstream shader;
+        shader << "precision mediump float;\n"
+                  "uniform float u;\n"
+                  "void main()\n"
+                  "{\n"
+                  "    float value = u;\n";
+        for (uint32_t step = 0; step <= index % 8; ++step)
+        {
+            shader << "    value = sin(value * " << (index + step + 2) << ".0) + u;\n";
+        }
+        shader << "    gl_FragColor = vec4(1.0, 0.0, value * 0.0, 1.0);\n"
+                  "}\n";
+        return shader.str();
+    }
+
+    // Links the program of |index| and draws with it.
+    void linkAndDraw(uint32_t index)
+    {
+        ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), MakeFragmentShader(index).c_str());
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    }
+
+    // Presents frames until the pipeline cache is synced to the blob cache, and returns the number
+    // of bytes the sync wrote.
+    uint64_t syncPipelineCache()
+    {
+        const angle::VulkanPerfCounters before = getPerfCounters();
+        for (uint32_t frame = 0; frame <= kPipelineCacheSyncPeriod; ++frame)
+        {
+            swapBuffers();
+            const angle::VulkanPerfCounters after = getPerfCounters();
+            if (after.pipelineCacheSyncs > before.pipelineCacheSyncs)
+            {
+                return after.pipelineCacheSyncBytesWritten - before.pipelineCacheSyncBytesWritten;
+            }
+        }
+
+        ADD_FAILURE() << "The pipeline cache was not synced";
+        return 0;
+    }
+
+    // Recreates the display, as if the application was started again with the same blob cache.
+    void restartWithBlobCache()
+    {
+        const auto blobCache = gApplicationCache;
+        recreateTestFixture();
+        gApplicationCache = blobCache;
+
+        eglSetBlobCacheFuncsANDROID(getEGLWindow()->getDisplay(), SetBlob, GetBlob);
+        ASSERT_EGL_SUCCESS();
+    }
+
+    // Returns the number of pipeline creations that hit the pipeline cache while linking and
+    // drawing with the program of |index|.
+    uint64_t linkAndDrawAndCountPipelineCacheHits(uint32_t index)
+    {
+        const uint64_t hits = getPerfCounters().pipelineCreationCacheHits;
+        linkAndDraw(index);
+        return getPerfCounters().pipelineCreationCacheHits - hits;
+    }
+
+    // The manifest is the entry holding the header (version, segment count, data size and zero),
+    // followed by the hash and size of each segment, whose sizes add up to the data size.
+    // Returns the entries of the segments it lists.
+    std::vector<std::vector<uint8_t> *> findPipelineCacheSegmentEntries()
+    {
+        constexpr size_t kHeaderSize = 4 * sizeof(uint32_t);
+        constexpr size_t kEntrySize  = sizeof(uint64_t) + 2 * sizeof(uint32_t);
+
+        std::vector<std::pair<uint64_t, uint32_t>> segments;
+        for (const auto &entry : gApplicationCache)
+        {
+            const std::vector<uint8_t> &value = entry.second;
+            if (value.size() < kHeaderSize)
+            {
+                continue;
+            }
+
+            uint32_t header[4];
+            memcpy(header, value.data(), kHeaderSize);
+            if (header[0] != 1 || header[1] == 0 || header[3] != 0 ||
+                value.size() != kHeaderSize + header[1] * kEntrySize)
+            {
+                continue;
+            }
+
+            segments.clear();
+            uint64_t totalSize = 0;
+            for (uint32_t index = 0; index < header[1]; ++index)
+            {
+                uint64_t hash;
+                uint32_t size;
+                memcpy(&hash, value.data() + kHeaderSize + index * kEntrySize, sizeof(hash));
+                memcpy(&size, value.data() + kHeaderSize + index * kEntrySize + sizeof(hash),
+                       sizeof(size));
+                segments.emplace_back(hash, size);
+                totalSize += size;
+            }
+            if (totalSize == header[2])
+            {
+                break;
+            }
+            segments.clear();
+        }
+
+        // Each segment starts with the version, its size and its hash.
+        std::vector<std::vector<uint8_t> *> segmentEntries;
+        for (const std::pair<uint64_t, uint32_t> &segment : segments)
+        {
+            for (auto &entry : gApplicationCache)
+            {
+                std::vector<uint8_t> &value = entry.second;
+                uint32_t header[2];
+                uint64_t hash;
+                if (value.size() <= sizeof(header) + sizeof(hash))
+                {
+                    continue;
+                }
+                memcpy(header, value.data(), sizeof(header));
+                memcpy(&hash, value.data() + sizeof(header), sizeof(hash));
+                if (header[0] == 1 && header[1] == segment.second && hash == segment.first)
+                {
+                    segmentEntries.push_back(&value);
+                    break;
+                }
+            }
+        }
+
+        return segmentEntries;
+    }
+};
+
+// Tests that a pipeline cache sync after creating one more pipeline writes the segments around it
+// and the manifest, rather than the whole cache, and that the pipeline cache is loaded from the
+// segments when the application is started again.
+TEST_P(EGLBlobCacheIncrementalPipelineCacheTest, SyncsChangedSegments)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_AMD_performance_monitor"));
+    ANGLE_SKIP_TEST_IF(
+        !getEGLWindow()->isFeatureEnabled(Feature::SupportsPipelineCreationFeedback));
+
+    EXPECT_TRUE(mHasBlobCache);
+    eglSetBlobCacheFuncsANDROID(getEGLWindow()->getDisplay(), SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    for (uint32_t index = 0; index < kProgramCount; ++index)
+    {
+        linkAndDraw(index);
+    }
+    const uint64_t fullSyncBytes = syncPipelineCache();
+    ASSERT_GT(fullSyncBytes, 0u);
+    EXPECT_FALSE(findPipelineCacheSegmentEntries().empty());
+
+    // With a single segment, every sync writes the whole cache.
+    ANGLE_SKIP_TEST_IF(fullSyncBytes < 2 * kMaxSegmentSize);
+
+    linkAndDraw(kProgramCount);
+    const uint64_t incrementalSyncBytes = syncPipelineCache();
+    EXPECT_GT(incrementalSyncBytes, 0u);
+    EXPECT_LT(incrementalSyncBytes, fullSyncBytes);
+
+    restartWithBlobCache();
+    EXPECT_GT(linkAndDrawAndCountPipelineCacheHits(0), 0u);
+    EXPECT_GT(linkAndDrawAndCountPipelineCacheHits(kProgramCount), 0u);
+}
+
+// Tests that a missing or corrupt segment makes the load fall back to the slot format, which
+// holds nothing here, and that the next sync stores all segments again.
+TEST_P(EGLBlobCacheIncrementalPipelineCacheTest, MissingOrCorruptSegment)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_AMD_performance_monitor"));
+    ANGLE_SKIP_TEST_IF(
+        !getEGLWindow()->isFeatureEnabled(Feature::SupportsPipelineCreationFeedback));
+
+    EXPECT_TRUE(mHasBlobCache);
+    eglSetBlobCacheFuncsANDROID(getEGLWindow()->getDisplay(), SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    for (uint32_t index = 0; index < kProgramCount; ++index)
+    {
+        linkAndDraw(index);
+    }
+    const uint64_t fullSyncBytes = syncPipelineCache();
+    ASSERT_GT(fullSyncBytes, 0u);
+
+    for (bool corrupt : {false, true})
+    {
+        std::vector<std::vector<uint8_t> *> segments = findPipelineCacheSegmentEntries();
+        ASSERT_FALSE(segments.empty());
+
+        std::vector<uint8_t> *segment = segments[segments.size() / 2];
+        if (corrupt)
+        {
+            segment->back() ^= 0xFF;
+        }
+        else
+        {
+            segment->clear();
+        }
+
+        // The pipeline cache starts empty, so the draw calls create all pipelines again and the
+        // sync writes all segments rather than those that changed.
+        restartWithBlobCache();
+        for (uint32_t index = 0; index < kProgramCount; ++index)
+        {
+            linkAndDraw(index);
+        }
+        EXPECT_GE(syncPipelineCache(), fullSyncBytes / 2);
+
+        restartWithBlobCache();
+        EXPECT_GT(linkAndDrawAndCountPipelineCacheHits(0), 0u);
+    }
+}
+
 ANGLE_INSTANTIATE_TEST(EGLBlobCacheTest,
                        ES2_D3D9(),
                        ES2_D3D11(),
@@ -708,3 +1104,25 @@ GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLBlobCacheInternalRejectionTest)
 ANGLE_INSTANTIATE_TEST(EGLBlobCacheInternalRejectionTest,
                        ES2_OPENGL().enable(Feature::CorruptProgramBinaryForTesting),
                        ES2_OPENGLES().enable(Feature::CorruptProgramBinaryForTesting));
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLBlobCacheRecordedPipelinesTest);
+ANGLE_INSTANTIATE_TEST(EGLBlobCacheRecordedPipelinesTest,
+                       ES3_VULKAN()
+                           .enable(Feature::WarmUpRecordedPipelinesAtLink)
+                           .enable(Feature::DisablePipelineCacheLoadForTesting)
+                           .disable(Feature::SyncMonolithicPipelinesToBlobCache),
+                       ES3_VULKAN_SWIFTSHADER()
+                           .enable(Feature::WarmUpRecordedPipelinesAtLink)
+                           .enable(Feature::DisablePipelineCacheLoadForTesting)
+                           .disable(Feature::SyncMonolithicPipelinesToBlobCache));
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLBlobCacheIncrementalPipelineCacheTest);
+ANGLE_INSTANTIATE_TEST(EGLBlobCacheIncrementalPipelineCacheTest,
+                       ES2_VULKAN()
+                           .enable(Feature::IncrementalPipelineCacheSync)
+                           .enable(Feature::SyncMonolithicPipelinesToBlobCache)
+                           .disable(Feature::EnableAsyncPipelineCacheCompression),
+                       ES2_VULKAN_SWIFTSHADER()
+                           .enable(Feature::IncrementalPipelineCacheSync)
+                           .enable(Feature::SyncMonolithicPipelinesToBlobCache)
+                           .disable(Feature::EnableAsyncPipelineCacheCompression));
@@ -0,0 +1,278 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// AsyncCommandStreamTest:
+//   Tests of the asyncCommandStream feature, with which frequent GL calls are recorded and executed
+//   by a worker thread while the other calls finish the stream first.
+//
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr GLfloat kQuadVertices[] = {
+    -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f, 1.0f,
+};
+
+class AsyncCommandStreamTest : public ANGLETest<>
+{
+  protected:
+    AsyncCommandStreamTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+
+        // Contexts with client arrays run every call immediately.
+        setClientArraysEnabled(false);
+    }
+
+    void testSetUp() override
+    {
+        mProgram = CompileProgram(essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+        ASSERT_NE(0u, mProgram);
+        mColorLocation = glGetUniformLocation(mProgram, essl1_shaders::ColorUniform());
+        ASSERT_NE(-1, mColorLocation);
+        mPositionLocation = glGetAttribLocation(mProgram, essl1_shaders::PositionAttrib());
+        ASSERT_NE(-1, mPositionLocation);
+
+        glGenBuffers(1, &mVertexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(kQuadVertices), kQuadVertices, GL_DYNAMIC_DRAW);
+        glEnableVertexAttribArray(mPositionLocation);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void testTearDown() override
+    {
+        glDeleteBuffers(1, &mVertexBuffer);
+        glDeleteProgram(mProgram);
+    }
+
+    // Only makes calls that are recorded.
+    void drawQuad(const GLfloat color[4])
+    {
+        glUseProgram(mProgram);
+        glUniform4fv(mColorLocation, 1, color);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+    }
+
+    EGLContext createContext()
+    {
+        EGLWindow *window = getEGLWindow();
+        EGLint attributes[] = {
+            EGL_CONTEXT_MAJOR_VERSION_KHR,
+            GetParam().majorVersion,
+            EGL_CONTEXT_MINOR_VERSION_KHR,
+            GetParam().minorVersion,
+            EGL_CONTEXT_CLIENT_ARRAYS_ENABLED_ANGLE,
+            EGL_FALSE,
+            EGL_NONE,
+        };
+        return eglCreateContext(window->getDisplay(), window->getConfig(), EGL_NO_CONTEXT,
+                                attributes);
+    }
+
+    void makeCurrent(EGLContext context)
+    {
+        EGLWindow *window = getEGLWindow();
+        EXPECT_EGL_TRUE(eglMakeCurrent(window->getDisplay(), window->getSurface(),
+                                       window->getSurface(), context));
+    }
+
+    GLuint mProgram         = 0;
+    GLint mColorLocation    = -1;
+    GLint mPositionLocation = -1;
+    GLuint mVertexBuffer    = 0;
+};
+
+// Tests that the recorded calls and the calls that run immediately are executed in order.
+TEST_P(AsyncCommandStreamTest, RecordedAndImmediateCallsInOrder)
+{
+    const GLint w = getWindowWidth();
+    const GLint h = getWindowHeight();
+
+    // Recorded.
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // The scissor test is enabled immediately, and the scissor is recorded.
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, w / 2, h);
+    const GLfloat kGreen[] = {0.0f, 1.0f, 0.0f, 1.0f};
+    drawQuad(kGreen);
+    glDisable(GL_SCISSOR_TEST);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(w - 1, h - 1, GLColor::red);
+
+    // Blending is disabled immediately, after the recorded draw has run with it.
+    const GLfloat kHalfBlue[] = {0.0f, 0.0f, 1.0f, 0.5f};
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    drawQuad(kHalfBlue);
+    glDisable(GL_BLEND);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::cyan);
+    EXPECT_PIXEL_COLOR_EQ(w - 1, h - 1, GLColor::magenta);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that the client memory of recorded uniform and buffer updates is copied when they are
+// recorded.
+TEST_P(AsyncCommandStreamTest, RecordedCallsCopyClientMemory)
+{
+    GLfloat color[] = {0.0f, 1.0f, 0.0f, 1.0f};
+    glUseProgram(mProgram);
+    glUniform4fv(mColorLocation, 1, color);
+    color[0] = 1.0f;
+    color[1] = 0.0f;
+
+    // Shrink the quad to the left half of the window, then overwrite the client copy.
+    GLfloat vertices[ArraySize(kQuadVertices)];
+    for (size_t index = 0; index < ArraySize(kQuadVertices); ++index)
+    {
+        vertices[index] =
+            index % 2 == 0 ? std::min(kQuadVertices[index], 0.0f) : kQuadVertices[index];
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+    std::fill(std::begin(vertices), std::end(vertices), 0.0f);
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, 0, GLColor::black);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that the errors of invalid recorded calls are reported by glGetError.
+TEST_P(AsyncCommandStreamTest, ErrorOfRecordedCall)
+{
+    glUseProgram(mProgram);
+    glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+
+    glDrawArrays(GL_TRIANGLES, 0, -1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glDrawArrays(GL_TEXTURE_2D, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    // An invalid recorded call followed by calls that are not recorded.
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glDrawArrays(GL_TRIANGLES, 0, -1);
+    glActiveTexture(GL_TEXTURE0);
+    GLint activeTexture = 0;
+    glGetIntegerv(GL_ACTIVE_TEXTURE, &activeTexture);
+    EXPECT_EQ(GL_TEXTURE0, activeTexture);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    // A negative count makes the call too large to record, so it runs immediately.
+    const GLfloat kGreen[] = {0.0f, 1.0f, 0.0f, 1.0f};
+    glUniform4fv(mColorLocation, -1, kGreen);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    // Valid recorded calls after the errors still run.
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawQuad(kGreen);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that the calls recorded in a context are executed before another context is made current,
+// and that each context keeps its own stream.
+TEST_P(AsyncCommandStreamTest, MakeCurrent)
+{
+    EGLContext context1 = getEGLWindow()->getContext();
+    EGLContext context2 = createContext();
+    ASSERT_NE(EGL_NO_CONTEXT, context2);
+
+    const GLfloat kGreen[] = {0.0f, 1.0f, 0.0f, 1.0f};
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawQuad(kGreen);
+
+    // The surface is shared, so context2 sees the draw recorded in context1.
+    makeCurrent(context2);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    glClearColor(1.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Switch back with calls recorded in context2.
+    makeCurrent(context1);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::yellow);
+    drawQuad(kGreen);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    makeCurrent(context2);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+
+    makeCurrent(context1);
+    EXPECT_EGL_TRUE(eglDestroyContext(getEGLWindow()->getDisplay(), context2));
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests destroying contexts with calls still recorded in their stream.
+TEST_P(AsyncCommandStreamTest, DestroyWithRecordedCalls)
+{
+    EGLDisplay display  = getEGLWindow()->getDisplay();
+    EGLContext context1 = getEGLWindow()->getContext();
+
+    // Destroyed after it is released.
+    EGLContext context2 = createContext();
+    ASSERT_NE(EGL_NO_CONTEXT, context2);
+    makeCurrent(context2);
+    for (int i = 0; i < 1000; ++i)
+    {
+        glClearColor(0.0f, 0.0f, static_cast<float>(i % 2), 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glViewport(0, 0, i % 64, i % 64);
+    }
+    makeCurrent(context1);
+    EXPECT_EGL_TRUE(eglDestroyContext(display, context2));
+
+    // Destroyed while it is current, which defers the destruction to its release.
+    EGLContext context3 = createContext();
+    ASSERT_NE(EGL_NO_CONTEXT, context3);
+    makeCurrent(context3);
+    for (int i = 0; i < 1000; ++i)
+    {
+        glClearColor(0.0f, static_cast<float>(i % 2), 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+    EXPECT_EGL_TRUE(eglDestroyContext(display, context3));
+    glClear(GL_COLOR_BUFFER_BIT);
+    makeCurrent(context1);
+
+    const GLfloat kGreen[] = {0.0f, 1.0f, 0.0f, 1.0f};
+    drawQuad(kGreen);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+}  // anonymous namespace
+
+ANGLE_INSTANTIATE_TEST(AsyncCommandStreamTest,
+                       ES2_D3D11().enable(Feature::AsyncCommandStream),
+                       ES2_METAL().enable(Feature::AsyncCommandStream),
+                       ES2_OPENGL().enable(Feature::AsyncCommandStream),
+                       ES2_OPENGLES().enable(Feature::AsyncCommandStream),
+                       ES2_VULKAN().enable(Feature::AsyncCommandStream),
+                       ES2_VULKAN_SWIFTSHADER().enable(Feature::AsyncCommandStream),
+                       ES3_VULKAN().enable(Feature::AsyncCommandStream),
+                       ES3_VULKAN_SWIFTSHADER().enable(Feature::AsyncCommandStream));
@@ -7546,6 +7546,62 @@ TEST_P(WebGL2ValidationStateChangeTest, DeleteElementArrayBufferValidation)
     EXPECT_GL_ERROR(GL_INVALID_OPERATION);
 }
 
+// Tests that repeating a valid DrawElements call is validated again after the index data, the
+// index buffer size or the vertex buffer size change.
+TEST_P(WebGL2ValidationStateChangeTest, RepeatedDrawElementsAfterBufferChanges)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glUseProgram(program);
+
+    std::array<GLushort, 6> quadIndices = GetQuadIndices();
+    std::array<Vector3, 4> quadVertices = GetIndexedQuadVertices();
+
+    GLBuffer elementArrayBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementArrayBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(quadIndices), quadIndices.data(),
+                 GL_DYNAMIC_DRAW);
+
+    GLBuffer arrayBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, arrayBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices.data(), GL_STATIC_DRAW);
+
+    GLint positionLoc = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLoc);
+    glVertexAttribPointer(positionLoc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLoc);
+
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    ASSERT_GL_NO_ERROR();
+
+    // Reference a vertex past the end of the vertex buffer.
+    constexpr GLushort kOutOfRangeIndex = 4;
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(kOutOfRangeIndex), &kOutOfRangeIndex);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(quadIndices[0]), quadIndices.data());
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    ASSERT_GL_NO_ERROR();
+
+    // Shrink the index buffer below the indices the draw reads.
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(quadIndices[0]) * 3, quadIndices.data(),
+                 GL_DYNAMIC_DRAW);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(quadIndices), quadIndices.data(),
+                 GL_DYNAMIC_DRAW);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    ASSERT_GL_NO_ERROR();
+
+    // Shrink the vertex buffer below the vertices the indices reference.
+    glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices[0]) * 3, quadVertices.data(),
+                 GL_STATIC_DRAW);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+}
+
 // Covers a bug in the D3D11 back-end related to how buffers are translated.
 TEST_P(RobustBufferAccessWebGL2ValidationStateChangeTest, BindZeroSizeBufferThenDeleteBufferBug)
 {
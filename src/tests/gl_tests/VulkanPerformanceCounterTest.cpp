@@ -8382,6 +8382,98 @@ TEST_P(VulkanPerformanceCounterTest, NoUpdatesToGraphicsDriverUniformsOnProgramC
     EXPECT_EQ(program1Count, program2Count + 1);
 }
 
+// Test that setting a uniform to the value it already has doesn't upload the default uniforms
+// again.
+TEST_P(VulkanPerformanceCounterTest, RedundantUniformUpdateDoesNotUploadDefaultUniforms)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLoc = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLoc);
+
+    glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0);
+    uint64_t uploadedBytes = getPerfCounters().defaultUniformBytesUploaded;
+
+    // Same value, several times.
+    for (int iteration = 0; iteration < 4; ++iteration)
+    {
+        glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0);
+    }
+    EXPECT_EQ(getPerfCounters().defaultUniformBytesUploaded, uploadedBytes);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    // A new value must be uploaded.
+    glUniform4f(colorLoc, 0.0f, 1.0f, 0.0f, 1.0f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0);
+    EXPECT_GT(getPerfCounters().defaultUniformBytesUploaded, uploadedBytes);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
+// Test that setting a matrix uniform to the value it already has doesn't upload the default
+// uniforms again, whether the matrix is copied as is, padded or transposed.
+TEST_P(VulkanPerformanceCounterTest, RedundantMatrixUniformUpdateDoesNotUploadDefaultUniforms)
+{
+    constexpr char kVS[] = R"(#version 300 es
+in vec4 position;
+uniform mat4 m4;
+uniform mat3 m3;
+out vec4 color;
+void main()
+{
+    gl_Position = position;
+    color = m4[0] + vec4(m3[0], 0.0);
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+in vec4 color;
+out vec4 colorOut;
+void main()
+{
+    colorOut = color;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+    GLint m4Loc = glGetUniformLocation(program, "m4");
+    ASSERT_NE(-1, m4Loc);
+    GLint m3Loc = glGetUniformLocation(program, "m3");
+    ASSERT_NE(-1, m3Loc);
+
+    // The first column of m4 is red, given in column-major and in row-major order.
+    constexpr GLfloat kRedColumnMajor[16] = {1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    constexpr GLfloat kRedRowMajor[16]    = {1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0};
+    constexpr GLfloat kAlpha[16]          = {0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    constexpr GLfloat kZero3[9]           = {};
+    constexpr GLfloat kGreen3[9]          = {0, 1, 0, 0, 0, 0, 0, 0, 0};
+
+    glUniformMatrix4fv(m4Loc, 1, GL_FALSE, kRedColumnMajor);
+    glUniformMatrix3fv(m3Loc, 1, GL_FALSE, kZero3);
+    drawQuad(program, "position", 0);
+    uint64_t uploadedBytes = getPerfCounters().defaultUniformBytesUploaded;
+
+    // Same values, several times and through the different layouts.
+    for (int iteration = 0; iteration < 4; ++iteration)
+    {
+        glUniformMatrix4fv(m4Loc, 1, GL_FALSE, kRedColumnMajor);
+        glUniformMatrix4fv(m4Loc, 1, GL_TRUE, kRedRowMajor);
+        glUniformMatrix3fv(m3Loc, 1, GL_FALSE, kZero3);
+        glUniformMatrix3fv(m3Loc, 1, GL_TRUE, kZero3);
+        drawQuad(program, "position", 0);
+    }
+    EXPECT_EQ(getPerfCounters().defaultUniformBytesUploaded, uploadedBytes);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    // New values must be uploaded.
+    glUniformMatrix4fv(m4Loc, 1, GL_FALSE, kAlpha);
+    glUniformMatrix3fv(m3Loc, 1, GL_FALSE, kGreen3);
+    drawQuad(program, "position", 0);
+    EXPECT_GT(getPerfCounters().defaultUniformBytesUploaded, uploadedBytes);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
 // This is test for optimization in vulkan backend. efootball_pes_2021 usage shows this usage
 // pattern and we expect implementation to reuse the storage for performance.
 TEST_P(VulkanPerformanceCounterTest,
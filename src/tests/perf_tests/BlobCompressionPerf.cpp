@@ -0,0 +1,291 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCompressionPerf:
+//   Performance test for the blob cache compression codecs.  Compresses and decompresses the
+//   binary of a real program, and measures relinking programs that hit in the program cache.
+//   Compress and decompress report the throughput in megabytes of uncompressed data per second.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "libANGLE/angletypes.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 20;
+
+enum class BlobOperation
+{
+    Compress,
+    Decompress,
+    // Compile and link a program that is in the program cache.
+    WarmLink,
+};
+
+// Enough uniforms, varyings and code that the program binary is a few kilobytes, like a typical
+// application program.
+constexpr char kVS[] = R"(#version 300 es
+uniform mat4 mvp;
+uniform mat4 model[8];
+uniform vec4 lights[16];
+in vec4 position;
+in vec3 normal;
+in vec2 uv;
+out vec3 vNormal;
+out vec2 vUV;
+out vec4 vLight;
+void main()
+{
+    vec4 world = vec4(0);
+    for (int i = 0; i < 8; ++i)
+    {
+        world += model[i] * position;
+    }
+    vLight = vec4(0);
+    for (int i = 0; i < 16; ++i)
+    {
+        vLight += lights[i] * max(dot(normal, lights[i].xyz), 0.0);
+    }
+    vNormal = normal;
+    vUV = uv;
+    gl_Position = mvp * world;
+})";
+
+constexpr char kFS[] = R"(#version 300 es
+precision highp float;
+uniform sampler2D albedo;
+uniform sampler2D normalMap;
+uniform vec4 material[8];
+in vec3 vNormal;
+in vec2 vUV;
+in vec4 vLight;
+out vec4 color;
+void main()
+{
+    vec3 n = normalize(vNormal + texture(normalMap, vUV).xyz);
+    vec4 c = texture(albedo, vUV);
+    for (int i = 0; i < 8; ++i)
+    {
+        c += material[i] * dot(n, material[i].xyz);
+    }
+    color = c * vLight;
+})";
+
+struct BlobCompressionParams final : public RenderTestParams
+{
+    BlobCompressionParams(BlobOperation operationIn, BlobCompressionCodec codecIn)
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        majorVersion = 3;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+        operation    = operationIn;
+        codec        = codecIn;
+    }
+
+    std::string story() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::story();
+
+        switch (operation)
+        {
+            case BlobOperation::Compress:
+                strstr << "_compress";
+                break;
+            case BlobOperation::Decompress:
+                strstr << "_decompress";
+                break;
+            case BlobOperation::WarmLink:
+                strstr << "_warm_link";
+                break;
+        }
+
+        strstr << (codec == BlobCompressionCodec::FastLZ ? "_fast_lz" : "_zlib");
+
+        return strstr.str();
+    }
+
+    BlobOperation operation;
+    BlobCompressionCodec codec;
+};
+
+std::ostream &operator<<(std::ostream &os, const BlobCompressionParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class BlobCompressionBenchmark : public ANGLERenderTest,
+                                 public ::testing::WithParamInterface<BlobCompressionParams>
+{
+  public:
+    BlobCompressionBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint linkProgram();
+
+    MemoryBuffer mBinary;
+    MemoryBuffer mCompressedBinary;
+    MemoryBuffer mOutput;
+};
+
+BlobCompressionBenchmark::BlobCompressionBenchmark()
+    : ANGLERenderTest("BlobCompression", GetParam())
+{
+    if (GetParam().operation != BlobOperation::WarmLink)
+    {
+        mReporter->RegisterImportantMetric(".throughput", "MB/s");
+    }
+}
+
+GLuint BlobCompressionBenchmark::linkProgram()
+{
+    GLuint vs = CompileShader(GL_VERTEX_SHADER, kVS);
+    GLuint fs = CompileShader(GL_FRAGMENT_SHADER, kFS);
+    if (vs == 0 || fs == 0)
+    {
+        glDeleteShader(vs);
+        glDeleteShader(fs);
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glDeleteShader(vs);
+    glAttachShader(program, fs);
+    glDeleteShader(fs);
+    glLinkProgram(program);
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    if (linkStatus != GL_TRUE)
+    {
+        glDeleteProgram(program);
+        return 0;
+    }
+    return program;
+}
+
+void BlobCompressionBenchmark::initializeBenchmark()
+{
+    const BlobCompressionParams &params = GetParam();
+
+    // The first link populates the program cache for WarmLink.
+    GLuint program = linkProgram();
+    ASSERT_NE(0u, program);
+
+    if (params.operation == BlobOperation::WarmLink)
+    {
+        glDeleteProgram(program);
+        return;
+    }
+
+    if (!IsGLExtensionEnabled("GL_OES_get_program_binary"))
+    {
+        glDeleteProgram(program);
+        skipTest("missing GL_OES_get_program_binary");
+        return;
+    }
+
+    GLint binaryLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH_OES, &binaryLength);
+    ASSERT_GT(binaryLength, 0);
+    ASSERT_TRUE(mBinary.resize(binaryLength));
+
+    GLenum binaryFormat = GL_NONE;
+    glGetProgramBinaryOES(program, binaryLength, &binaryLength, &binaryFormat, mBinary.data());
+    glDeleteProgram(program);
+    ASSERT_GL_NO_ERROR();
+
+    ASSERT_TRUE(CompressBlob(mBinary.size(), mBinary.data(), &mCompressedBinary, params.codec));
+}
+
+void BlobCompressionBenchmark::drawBenchmark()
+{
+    const BlobCompressionParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        switch (params.operation)
+        {
+            case BlobOperation::Compress:
+                (void)CompressBlob(mBinary.size(), mBinary.data(), &mOutput, params.codec);
+                break;
+            case BlobOperation::Decompress:
+                (void)DecompressBlob(mCompressedBinary.data(), mCompressedBinary.size(),
+                                     mBinary.size(), &mOutput);
+                break;
+            case BlobOperation::WarmLink:
+                glDeleteProgram(linkProgram());
+                break;
+        }
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void BlobCompressionBenchmark::destroyBenchmark()
+{
+    const double seconds = mTrialTimer.getElapsedWallClockTime();
+    if (GetParam().operation != BlobOperation::WarmLink && mTrialNumStepsPerformed > 0 &&
+        seconds > 0)
+    {
+        const double megabytes = static_cast<double>(mBinary.size()) * kIterationsPerStep *
+                                 mTrialNumStepsPerformed / (1024.0 * 1024.0);
+        recordDoubleMetric(".throughput", megabytes / seconds, "MB/s");
+    }
+}
+
+BlobCompressionParams WithCodecFeature(BlobCompressionParams params)
+{
+    // Makes the program cache of the WarmLink variants use the codec.
+    if (params.codec == BlobCompressionCodec::FastLZ)
+    {
+        params.enable(Feature::FastBlobCacheCompression);
+    }
+    return params;
+}
+
+BlobCompressionParams VulkanParams(BlobOperation operation, BlobCompressionCodec codec)
+{
+    BlobCompressionParams params(operation, codec);
+    params.eglParameters = egl_platform::VULKAN();
+    return WithCodecFeature(params);
+}
+
+BlobCompressionParams OpenGLOrGLESParams(BlobOperation operation, BlobCompressionCodec codec)
+{
+    BlobCompressionParams params(operation, codec);
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    return WithCodecFeature(params);
+}
+
+TEST_P(BlobCompressionBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(BlobCompressionBenchmark,
+                       VulkanParams(BlobOperation::Compress, BlobCompressionCodec::Zlib),
+                       VulkanParams(BlobOperation::Compress, BlobCompressionCodec::FastLZ),
+                       VulkanParams(BlobOperation::Decompress, BlobCompressionCodec::Zlib),
+                       VulkanParams(BlobOperation::Decompress, BlobCompressionCodec::FastLZ),
+                       VulkanParams(BlobOperation::WarmLink, BlobCompressionCodec::Zlib),
+                       VulkanParams(BlobOperation::WarmLink, BlobCompressionCodec::FastLZ),
+                       OpenGLOrGLESParams(BlobOperation::WarmLink, BlobCompressionCodec::Zlib),
+                       OpenGLOrGLESParams(BlobOperation::WarmLink, BlobCompressionCodec::FastLZ));
+
+}  // anonymous namespace
@@ -11,6 +11,8 @@
 
 #include "ANGLEPerfTest.h"
 
+#include <map>
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
@@ -253,6 +255,9 @@ class CompilerPerfTest : public ANGLEPerfTest,
     void setTestShader(const char *str) { mTestShader = str; }
 
   private:
+    ShCompileOptions getCompileOptions() const;
+    void recordPassStatistics();
+
     const char *mTestShader;
 
     ShBuiltInResources mResources;
@@ -286,6 +291,10 @@ void CompilerPerfTest::SetUp()
 
 void CompilerPerfTest::TearDown()
 {
+    if (mTranslator)
+    {
+        recordPassStatistics();
+    }
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -296,14 +305,53 @@ void CompilerPerfTest::TearDown()
     ANGLEPerfTest::TearDown();
 }
 
-void CompilerPerfTest::step()
+ShCompileOptions CompilerPerfTest::getCompileOptions() const
 {
-    const char *shaderStrings[] = {mTestShader};
-
     ShCompileOptions compileOptions              = {};
     compileOptions.objectCode                    = true;
     compileOptions.initializeUninitializedLocals = true;
     compileOptions.initOutputVariables           = true;
+    return compileOptions;
+}
+
+// Compiles the shader once more outside of the measured steps to report the time taken and the
+// nodes traversed by each translation pass.  Passes that run more than once are added up.
+void CompilerPerfTest::recordPassStatistics()
+{
+    const char *shaderStrings[] = {mTestShader};
+
+    ShCompileOptions compileOptions      = getCompileOptions();
+    compileOptions.collectPassStatistics = true;
+    if (!mTranslator->compile(shaderStrings, 1, compileOptions))
+    {
+        return;
+    }
+
+    std::map<std::string, std::pair<double, uint64_t>> passes;
+    uint64_t totalNodeVisits = 0;
+    for (const sh::TCompiler::PassStatistics &pass : mTranslator->getPassStatistics())
+    {
+        std::pair<double, uint64_t> &total = passes[pass.name];
+        total.first += pass.seconds;
+        total.second += pass.nodeVisits;
+        totalNodeVisits += pass.nodeVisits;
+    }
+
+    for (const auto &pass : passes)
+    {
+        const std::string prefix = ".pass_" + pass.first;
+        recordDoubleMetric((prefix + "_time").c_str(), pass.second.first * 1000000.0, "us");
+        recordIntegerMetric((prefix + "_node_visits").c_str(),
+                            static_cast<size_t>(pass.second.second), "count");
+    }
+    recordIntegerMetric(".node_visits", static_cast<size_t>(totalNodeVisits), "count");
+}
+
+void CompilerPerfTest::step()
+{
+    const char *shaderStrings[] = {mTestShader};
+
+    const ShCompileOptions compileOptions = getCompileOptions();
 
 #if !defined(NDEBUG)
     // Make sure that compilation succeeds and print the info log if it doesn't in debug mode.
@@ -325,6 +373,96 @@ TEST_P(CompilerPerfTest, Run)
     run();
 }
 
+// Mangled names of built-ins that the shaders above use, and of user-defined symbols, which are
+// also looked up among the built-ins.
+constexpr const char *kBuiltInLookupNames[] = {
+    "texture(00X20B",       "texture2D(00L10B",     "normalize(20B",   "dot(20B20B",
+    "max(00B00B",           "min(00B00B",           "clamp(00B00B00B", "mix(20B20B00B",
+    "pow(00B00B",           "length(20B",           "reflect(20B20B",  "fract(10B",
+    "smoothstep(00B00B00B", "gl_FragCoord",         "gl_FragColor",    "computeLight(20B20B",
+    "sampleShadow(10B00B",  "u_lightDirection",     "v_texCoord",      "color",
+};
+
+constexpr unsigned int kNumLookupIterationsPerStep = 1000;
+
+class BuiltInLookupPerfTest : public ANGLEPerfTest
+{
+  public:
+    BuiltInLookupPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+  private:
+    angle::PoolAllocator mAllocator;
+    sh::TCompiler *mTranslator;
+    size_t mFoundCount;
+};
+
+BuiltInLookupPerfTest::BuiltInLookupPerfTest()
+    : ANGLEPerfTest("BuiltInLookupPerf", "", "_mangled_names", kNumLookupIterationsPerStep),
+      mTranslator(nullptr),
+      mFoundCount(0)
+{}
+
+void BuiltInLookupPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    InitializePoolIndex();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    ShBuiltInResources resources;
+    sh::InitBuiltInResources(&resources);
+    mTranslator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, SH_ESSL_OUTPUT);
+    if (!mTranslator->Init(resources))
+    {
+        SafeDelete(mTranslator);
+    }
+}
+
+void BuiltInLookupPerfTest::TearDown()
+{
+    SafeDelete(mTranslator);
+
+    SetGlobalPoolAllocator(nullptr);
+    mAllocator.reset();
+
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+void BuiltInLookupPerfTest::step()
+{
+    if (mTranslator == nullptr)
+    {
+        abortTest();
+        return;
+    }
+
+    const sh::TSymbolTable &symbolTable = mTranslator->getSymbolTable();
+    for (unsigned int iteration = 0; iteration < kNumLookupIterationsPerStep; ++iteration)
+    {
+        for (const char *name : kBuiltInLookupNames)
+        {
+            if (symbolTable.findBuiltIn(sh::ImmutableString(name), 300) != nullptr)
+            {
+                ++mFoundCount;
+            }
+        }
+    }
+}
+
+// Measures TSymbolTable::findBuiltIn, which hashes the mangled name and compares it with the
+// built-in that has the same hash.
+TEST_F(BuiltInLookupPerfTest, Run)
+{
+    run();
+}
+
 ANGLE_INSTANTIATE_TEST(
     CompilerPerfTest,
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
@@ -44,6 +44,7 @@ struct DrawArraysPerfParams : public DrawCallPerfParams
     std::string story() const override;
 
     StateChange stateChange = StateChange::NoChange;
+    bool asyncCommandStream = false;
 };
 
 std::string DrawArraysPerfParams::story() const
@@ -85,6 +86,11 @@ std::string DrawArraysPerfParams::story() const
             break;
     }
 
+    if (asyncCommandStream)
+    {
+        strstr << "_async_stream";
+    }
+
     return strstr.str();
 }
 
@@ -158,6 +164,12 @@ DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf",
     {
         skipTest("https://issuetracker.google.com/issues/298407224 Fails on Pixel 6 GLES");
     }
+
+    // The command stream is only used by contexts without client arrays.
+    if (params.asyncCommandStream)
+    {
+        getConfigParams().clientArraysEnabled = false;
+    }
 }
 
 void DrawCallPerfBenchmark::initializeBenchmark()
@@ -654,6 +666,14 @@ DrawArraysPerfParams CombineStateChange(const DrawArraysPerfParams &in, StateCha
     return out;
 }
 
+DrawArraysPerfParams AsyncCommandStream(const DrawArraysPerfParams &in)
+{
+    DrawArraysPerfParams out = in;
+    out.asyncCommandStream   = true;
+    out.eglParameters.enable(Feature::AsyncCommandStream);
+    return out;
+}
+
 using P = DrawArraysPerfParams;
 
 std::vector<P> gTestsWithStateChange =
@@ -663,6 +683,19 @@ std::vector<P> gTestsWithRenderer =
 std::vector<P> gTestsWithDevice =
     CombineWithFuncs(gTestsWithRenderer, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
 
-ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTestsWithDevice);
+// Adds the Vulkan null device variants that record the frequent calls in the asynchronous command
+// stream, to compare the CPU time of the application thread with the synchronous ones.
+std::vector<P> WithCommandStream(std::vector<P> tests)
+{
+    std::vector<P> vulkanTests =
+        CombineWithFuncs(CombineWithFuncs(gTestsWithStateChange, {Vulkan<P>}), {NullDevice<P>});
+    std::vector<P> asyncTests = CombineWithFuncs(vulkanTests, {AsyncCommandStream});
+    tests.insert(tests.end(), asyncTests.begin(), asyncTests.end());
+    return tests;
+}
+
+std::vector<P> gTests = WithCommandStream(gTestsWithDevice);
+
+ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTests);
 
 }  // anonymous namespace
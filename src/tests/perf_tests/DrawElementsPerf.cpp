@@ -51,11 +51,18 @@ struct DrawElementsPerfParams final : public DrawCallPerfParams
             strstr << "_ushort";
         }
 
+        if (noError)
+        {
+            strstr << "_no_error";
+        }
+
         return strstr.str();
     }
 
     GLenum type             = GL_UNSIGNED_INT;
     bool indexBufferChanged = false;
+    // Draws are validated unless this creates the context with KHR_create_context_no_error.
+    bool noError = false;
 };
 
 std::ostream &operator<<(std::ostream &os, const DrawElementsPerfParams &params)
@@ -93,6 +100,8 @@ DrawElementsPerfBenchmark::DrawElementsPerfBenchmark()
     {
         addExtensionPrerequisite("GL_OES_element_index_uint");
     }
+
+    getConfigParams().noError = GetParam().noError;
 }
 
 GLsizei ElementTypeSize(GLenum elementType)
@@ -230,14 +239,22 @@ P CombineIndexBufferChanged(const P &in, bool indexBufferChanged)
     return out;
 }
 
+P CombineNoError(const P &in, bool noError)
+{
+    P out       = in;
+    out.noError = noError;
+    return out;
+}
+
 std::vector<GLenum> gIndexTypes = {GL_UNSIGNED_INT, GL_UNSIGNED_SHORT};
 std::vector<P> gWithIndexType   = CombineWithValues({P()}, gIndexTypes, CombineIndexType);
 std::vector<P> gWithRenderer =
     CombineWithFuncs(gWithIndexType, {D3D11<P>, GL<P>, Metal<P>, Vulkan<P>, WGL<P>});
 std::vector<P> gWithChange =
     CombineWithValues(gWithRenderer, {false, true}, CombineIndexBufferChanged);
-std::vector<P> gWithDevice = CombineWithFuncs(gWithChange, {Passthrough<P>, NullDevice<P>});
+std::vector<P> gWithDevice  = CombineWithFuncs(gWithChange, {Passthrough<P>, NullDevice<P>});
+std::vector<P> gWithNoError = CombineWithValues(gWithDevice, {false, true}, CombineNoError);
 
-ANGLE_INSTANTIATE_TEST_ARRAY(DrawElementsPerfBenchmark, gWithDevice);
+ANGLE_INSTANTIATE_TEST_ARRAY(DrawElementsPerfBenchmark, gWithNoError);
 
 }  // anonymous namespace
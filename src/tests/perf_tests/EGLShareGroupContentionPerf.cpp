@@ -0,0 +1,224 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLShareGroupContentionPerf:
+//   Performance test for looking up shared buffers in one context while another context of the
+//   same share group uploads buffer data on a second thread.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+#include "test_utils/angle_test_instantiate.h"
+
+namespace angle
+{
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 16;
+constexpr GLuint kBufferCount             = 256;
+// Above the flat part of the buffer resource map.
+constexpr GLuint kHighBufferIdBase = 0x10000;
+constexpr size_t kUploadSize       = 256;
+
+struct ShareGroupContentionParams final : public RenderTestParams
+{
+    ShareGroupContentionParams()
+    {
+        majorVersion      = 3;
+        minorVersion      = 0;
+        windowWidth       = 64;
+        windowHeight      = 64;
+        iterationsPerStep = kIterationsPerStep;
+    }
+
+    std::string story() const override;
+
+    // Whether the buffers use names above the flat part of the resource map.
+    bool highIds = false;
+    // Whether another context of the share group uploads data on a second thread.
+    bool contended = false;
+};
+
+std::ostream &operator<<(std::ostream &os, const ShareGroupContentionParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string ShareGroupContentionParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+
+    if (highIds)
+    {
+        strstr << "_high_ids";
+    }
+    if (contended)
+    {
+        strstr << "_contended";
+    }
+
+    return strstr.str();
+}
+
+class ShareGroupContentionBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<ShareGroupContentionParams>
+{
+  public:
+    ShareGroupContentionBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void uploadLoop();
+
+    std::vector<GLuint> mBuffers;
+
+    EGLDisplay mDisplay       = EGL_NO_DISPLAY;
+    EGLContext mUploadContext = EGL_NO_CONTEXT;
+    GLuint mUploadBuffer      = 0;
+    std::atomic<bool> mStopUpload{false};
+    std::thread mUploadThread;
+};
+
+ShareGroupContentionBenchmark::ShareGroupContentionBenchmark()
+    : ANGLERenderTest("EGLShareGroupContention", GetParam())
+{}
+
+void ShareGroupContentionBenchmark::initializeBenchmark()
+{
+    const ShareGroupContentionParams &params = GetParam();
+
+    mBuffers.resize(kBufferCount, 0);
+    if (params.highIds)
+    {
+        for (GLuint bufferIdx = 0; bufferIdx < kBufferCount; ++bufferIdx)
+        {
+            mBuffers[bufferIdx] = kHighBufferIdBase + bufferIdx;
+        }
+    }
+    else
+    {
+        glGenBuffers(kBufferCount, mBuffers.data());
+    }
+    for (GLuint buffer : mBuffers)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, kUploadSize, nullptr, GL_STATIC_DRAW);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    ASSERT_GL_NO_ERROR();
+
+    if (!params.contended)
+    {
+        return;
+    }
+
+    mDisplay       = eglGetCurrentDisplay();
+    mUploadContext = reinterpret_cast<EGLContext>(
+        getGLWindow()->createContextGeneric(getGLWindow()->getCurrentContextGeneric()));
+    ASSERT_NE(mUploadContext, EGL_NO_CONTEXT);
+
+    mUploadThread = std::thread(&ShareGroupContentionBenchmark::uploadLoop, this);
+}
+
+void ShareGroupContentionBenchmark::uploadLoop()
+{
+    if (eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, mUploadContext) != EGL_TRUE)
+    {
+        return;
+    }
+
+    std::vector<uint8_t> data(kUploadSize, 0x55);
+    glGenBuffers(1, &mUploadBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mUploadBuffer);
+    glBufferData(GL_ARRAY_BUFFER, kUploadSize, nullptr, GL_DYNAMIC_DRAW);
+
+    while (!mStopUpload.load(std::memory_order_relaxed))
+    {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, kUploadSize, data.data());
+    }
+
+    glDeleteBuffers(1, &mUploadBuffer);
+    eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglReleaseThread();
+}
+
+void ShareGroupContentionBenchmark::destroyBenchmark()
+{
+    if (mUploadThread.joinable())
+    {
+        mStopUpload = true;
+        mUploadThread.join();
+    }
+    if (mUploadContext != EGL_NO_CONTEXT)
+    {
+        eglDestroyContext(mDisplay, mUploadContext);
+    }
+
+    glDeleteBuffers(kBufferCount, mBuffers.data());
+}
+
+void ShareGroupContentionBenchmark::drawBenchmark()
+{
+    const ShareGroupContentionParams &params = GetParam();
+
+    GLboolean allBuffers = GL_TRUE;
+    for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+    {
+        for (GLuint buffer : mBuffers)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, buffer);
+            allBuffers &= glIsBuffer(buffer);
+        }
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    ASSERT_EQ(allBuffers, GL_TRUE);
+    ASSERT_GL_NO_ERROR();
+}
+
+ShareGroupContentionParams VulkanParams(bool highIds, bool contended)
+{
+    ShareGroupContentionParams params;
+    params.eglParameters = egl_platform::VULKAN_NULL();
+    params.highIds       = highIds;
+    params.contended     = contended;
+    return params;
+}
+
+ShareGroupContentionParams OpenGLOrGLESParams(bool highIds, bool contended)
+{
+    ShareGroupContentionParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES_NULL();
+    params.highIds       = highIds;
+    params.contended     = contended;
+    return params;
+}
+
+TEST_P(ShareGroupContentionBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(ShareGroupContentionBenchmark,
+                       VulkanParams(false, false),
+                       VulkanParams(false, true),
+                       VulkanParams(true, false),
+                       VulkanParams(true, true),
+                       OpenGLOrGLESParams(false, false),
+                       OpenGLOrGLESParams(false, true));
+
+}  // namespace
+}  // namespace angle
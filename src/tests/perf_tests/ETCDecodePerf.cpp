@@ -0,0 +1,170 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ETCDecodePerf:
+//   Performance test for the CPU ETC1/ETC2/EAC decoders, decoding to RGBA8 or R8/RG8 and
+//   transcoding to BC1/BC3/BC4/BC5.  Besides the usual timings, reports the throughput in
+//   megabytes of ETC data per second.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <sstream>
+
+#include "common/WorkerThread.h"
+#include "image_util/loadimage.h"
+#include "image_util/loadimage_simd.h"
+
+namespace
+{
+constexpr size_t kImageSize               = 2048;
+constexpr unsigned int kIterationsPerStep = 2;
+
+struct ETCDecodeParams
+{
+    const char *name;
+    angle::LoadImageFunction loadFunction;
+    size_t inputBlockBytes;
+    // Bytes per pixel for decoding loads, bytes per block for transcoding loads.
+    size_t outputBytes;
+    bool transcodes;
+    bool simd;
+    bool multiThreaded;
+};
+
+std::string ETCDecodeStory(const ETCDecodeParams &params)
+{
+    std::stringstream strstr;
+    strstr << "_" << params.name;
+    if (!params.simd)
+    {
+        strstr << "_scalar";
+    }
+    if (params.multiThreaded)
+    {
+        strstr << "_multi_threaded";
+    }
+    return strstr.str();
+}
+
+class ETCDecodePerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<ETCDecodeParams>
+{
+  public:
+    ETCDecodePerfTest();
+    ~ETCDecodePerfTest() override;
+    void step() override;
+    void TearDown() override;
+
+  private:
+    angle::ImageLoadContext mContext;
+    size_t mInputRowPitch;
+    size_t mOutputRowPitch;
+    size_t mOutputRows;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+ETCDecodePerfTest::ETCDecodePerfTest()
+    : ANGLEPerfTest("ETCDecodePerf", "", ETCDecodeStory(GetParam()), kIterationsPerStep)
+{
+    const ETCDecodeParams &params = GetParam();
+    constexpr size_t kBlocks      = kImageSize / 4;
+
+    mInputRowPitch  = kBlocks * params.inputBlockBytes;
+    mOutputRowPitch = params.transcodes ? kBlocks * params.outputBytes
+                                        : kImageSize * params.outputBytes;
+    mOutputRows     = params.transcodes ? kBlocks : kImageSize;
+
+    // Random blocks exercise every block mode.
+    mInput.resize(mInputRowPitch * kBlocks);
+    mOutput.resize(mOutputRowPitch * mOutputRows);
+    std::mt19937 generator(0);
+    for (uint8_t &byte : mInput)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+
+    if (params.multiThreaded)
+    {
+        mContext.multiThreadPool = angle::WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
+    }
+
+    angle::priv::SetMaxLoadRowSIMDLevelForTesting(params.simd
+                                                      ? angle::priv::LoadRowSIMDLevel::Vector256
+                                                      : angle::priv::LoadRowSIMDLevel::None);
+
+    mReporter->RegisterImportantMetric(".throughput", "MB/s");
+}
+
+ETCDecodePerfTest::~ETCDecodePerfTest()
+{
+    angle::priv::SetMaxLoadRowSIMDLevelForTesting(angle::priv::LoadRowSIMDLevel::Vector256);
+}
+
+void ETCDecodePerfTest::step()
+{
+    const ETCDecodeParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        params.loadFunction(mContext, kImageSize, kImageSize, 1, mInput.data(), mInputRowPitch,
+                            mInput.size(), mOutput.data(), mOutputRowPitch, mOutput.size());
+    }
+}
+
+void ETCDecodePerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+
+    const double seconds = mTrialTimer.getElapsedWallClockTime();
+    if (mTrialNumStepsPerformed > 0 && seconds > 0)
+    {
+        const double megabytes = static_cast<double>(mInput.size()) * kIterationsPerStep *
+                                 mTrialNumStepsPerformed / (1024.0 * 1024.0);
+        recordDoubleMetric(".throughput", megabytes / seconds, "MB/s");
+    }
+}
+
+TEST_P(ETCDecodePerfTest, Run)
+{
+    run();
+}
+
+std::vector<ETCDecodeParams> ETCDecodeParamsList()
+{
+    const ETCDecodeParams kFormats[] = {
+        {"ETC1RGB8ToRGBA8", angle::LoadETC1RGB8ToRGBA8, 8, 4, false, true, false},
+        {"ETC2RGB8A1ToRGBA8", angle::LoadETC2RGB8A1ToRGBA8, 8, 4, false, true, false},
+        {"ETC2RGBA8ToRGBA8", angle::LoadETC2RGBA8ToRGBA8, 16, 4, false, true, false},
+        {"EACR11ToR8", angle::LoadEACR11ToR8, 8, 1, false, true, false},
+        {"EACRG11ToRG8", angle::LoadEACRG11ToRG8, 16, 2, false, true, false},
+        {"ETC1RGB8ToBC1", angle::LoadETC1RGB8ToBC1, 8, 8, true, true, false},
+        {"ETC2RGBA8ToBC3", angle::LoadETC2RGBA8ToBC3, 16, 16, true, true, false},
+        {"EACR11ToBC4", angle::LoadEACR11ToBC4, 8, 8, true, true, false},
+        {"EACRG11ToBC5", angle::LoadEACRG11ToBC5, 16, 16, true, true, false},
+    };
+
+    std::vector<ETCDecodeParams> paramsList;
+    for (ETCDecodeParams params : kFormats)
+    {
+        paramsList.push_back(params);
+        params.simd = false;
+        paramsList.push_back(params);
+        params.simd          = true;
+        params.multiThreaded = true;
+        paramsList.push_back(params);
+    }
+    return paramsList;
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         ETCDecodePerfTest,
+                         ::testing::ValuesIn(ETCDecodeParamsList()),
+                         [](const ::testing::TestParamInfo<ETCDecodeParams> &info) {
+                             return ETCDecodeStory(info.param).substr(1);
+                         });
+}  // anonymous namespace
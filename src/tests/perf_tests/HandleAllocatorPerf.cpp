@@ -0,0 +1,116 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HandleAllocatorPerf:
+//   Performance test for gl::HandleAllocator, generating and deleting many handles per step the
+//   way glGen*/glDelete* with large counts do.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+#include "libANGLE/HandleAllocator.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 16;
+// Handles that stay allocated throughout the test, like the long-lived objects of an application.
+constexpr size_t kLiveHandleCount = 10000;
+
+struct HandleAllocatorPerfParams
+{
+    size_t count;
+    bool batched;
+};
+
+std::string HandleAllocatorStory(const HandleAllocatorPerfParams &params)
+{
+    std::stringstream strstr;
+    strstr << "_" << params.count << (params.batched ? "_batched" : "_single");
+    return strstr.str();
+}
+
+class HandleAllocatorPerfTest : public ANGLEPerfTest,
+                                public ::testing::WithParamInterface<HandleAllocatorPerfParams>
+{
+  public:
+    HandleAllocatorPerfTest();
+    void step() override;
+
+  private:
+    gl::HandleAllocator mAllocator;
+    std::vector<GLuint> mHandles;
+    std::mt19937 mGenerator;
+};
+
+HandleAllocatorPerfTest::HandleAllocatorPerfTest()
+    : ANGLEPerfTest("HandleAllocatorPerf",
+                    "",
+                    HandleAllocatorStory(GetParam()),
+                    kIterationsPerStep),
+      mHandles(GetParam().count),
+      mGenerator(0)
+{
+    // Interleave the live handles with free ones, as left by earlier deletions.
+    std::vector<GLuint> liveHandles(kLiveHandleCount * 2);
+    mAllocator.allocate(liveHandles.size(), liveHandles.data());
+    for (size_t index = 0; index < liveHandles.size(); index += 2)
+    {
+        mAllocator.release(liveHandles[index]);
+    }
+}
+
+void HandleAllocatorPerfTest::step()
+{
+    const HandleAllocatorPerfParams &params = GetParam();
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        if (params.batched)
+        {
+            mAllocator.allocate(mHandles.size(), mHandles.data());
+        }
+        else
+        {
+            for (GLuint &handle : mHandles)
+            {
+                handle = mAllocator.allocate();
+            }
+        }
+
+        // Objects are not necessarily deleted in the order they were generated.
+        std::shuffle(mHandles.begin(), mHandles.end(), mGenerator);
+
+        if (params.batched)
+        {
+            mAllocator.release({mHandles.data(), mHandles.size()});
+        }
+        else
+        {
+            for (GLuint handle : mHandles)
+            {
+                mAllocator.release(handle);
+            }
+        }
+    }
+}
+
+TEST_P(HandleAllocatorPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         HandleAllocatorPerfTest,
+                         ::testing::Values(HandleAllocatorPerfParams{16, false},
+                                           HandleAllocatorPerfParams{16, true},
+                                           HandleAllocatorPerfParams{4096, false},
+                                           HandleAllocatorPerfParams{4096, true}),
+                         [](const ::testing::TestParamInfo<HandleAllocatorPerfParams> &info) {
+                             return HandleAllocatorStory(info.param).substr(1);
+                         });
+}  // anonymous namespace
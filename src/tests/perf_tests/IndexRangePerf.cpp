@@ -0,0 +1,109 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance test for gl::ComputeIndexRange, which scans index data on the glDrawElements
+//   path whenever the index range cache misses.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <sstream>
+
+#include "common/utilities.h"
+#include "libANGLE/formatutils.h"
+
+namespace
+{
+constexpr size_t kIndexCount              = 1 << 20;
+constexpr unsigned int kIterationsPerStep = 16;
+
+struct IndexRangePerfParams
+{
+    gl::DrawElementsType type;
+    bool primitiveRestart;
+};
+
+std::string IndexRangeStory(const IndexRangePerfParams &params)
+{
+    std::stringstream strstr;
+    switch (params.type)
+    {
+        case gl::DrawElementsType::UnsignedByte:
+            strstr << "_u8";
+            break;
+        case gl::DrawElementsType::UnsignedShort:
+            strstr << "_u16";
+            break;
+        default:
+            strstr << "_u32";
+            break;
+    }
+    if (params.primitiveRestart)
+    {
+        strstr << "_restart";
+    }
+    return strstr.str();
+}
+
+class IndexRangePerfTest : public ANGLEPerfTest,
+                           public ::testing::WithParamInterface<IndexRangePerfParams>
+{
+  public:
+    IndexRangePerfTest();
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mIndexData;
+};
+
+IndexRangePerfTest::IndexRangePerfTest()
+    : ANGLEPerfTest("IndexRangePerf", "", IndexRangeStory(GetParam()), kIterationsPerStep)
+{
+    const IndexRangePerfParams &params = GetParam();
+    const size_t indexSize             = gl::GetDrawElementsTypeSize(params.type);
+    const uint32_t restartIndex        = gl::GetPrimitiveRestartIndex(params.type);
+
+    mIndexData.resize(kIndexCount * indexSize);
+
+    // Random indices with a primitive restart index sprinkled in every 64 indices.
+    std::mt19937 generator(0);
+    for (size_t i = 0; i < kIndexCount; ++i)
+    {
+        uint32_t index = (i % 64 == 63) ? restartIndex : (generator() % restartIndex);
+        memcpy(mIndexData.data() + i * indexSize, &index, indexSize);
+    }
+}
+
+void IndexRangePerfTest::step()
+{
+    const IndexRangePerfParams &params = GetParam();
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        gl::IndexRange range = gl::ComputeIndexRange(params.type, mIndexData.data(), kIndexCount,
+                                                     params.primitiveRestart);
+        ANGLE_UNUSED_VARIABLE(range);
+    }
+}
+
+TEST_P(IndexRangePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         IndexRangePerfTest,
+                         ::testing::Values(
+                             IndexRangePerfParams{gl::DrawElementsType::UnsignedByte, false},
+                             IndexRangePerfParams{gl::DrawElementsType::UnsignedByte, true},
+                             IndexRangePerfParams{gl::DrawElementsType::UnsignedShort, false},
+                             IndexRangePerfParams{gl::DrawElementsType::UnsignedShort, true},
+                             IndexRangePerfParams{gl::DrawElementsType::UnsignedInt, false},
+                             IndexRangePerfParams{gl::DrawElementsType::UnsignedInt, true}),
+                         [](const ::testing::TestParamInfo<IndexRangePerfParams> &info) {
+                             return IndexRangeStory(info.param).substr(1);
+                         });
+}  // anonymous namespace
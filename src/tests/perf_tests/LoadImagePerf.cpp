@@ -0,0 +1,132 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImagePerf:
+//   Performance test for the image_util Load* functions that have vectorized row converters,
+//   run with and without the vector paths.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <sstream>
+
+#include "image_util/loadimage.h"
+#include "image_util/loadimage_simd.h"
+
+namespace
+{
+constexpr size_t kImageSize               = 1024;
+constexpr unsigned int kIterationsPerStep = 4;
+
+struct LoadImagePerfParams
+{
+    const char *name;
+    angle::LoadImageFunction loadFunction;
+    size_t inputPixelBytes;
+    size_t outputPixelBytes;
+    bool simd;
+};
+
+std::string LoadImageStory(const LoadImagePerfParams &params)
+{
+    std::stringstream strstr;
+    strstr << "_" << params.name;
+    if (!params.simd)
+    {
+        strstr << "_scalar";
+    }
+    return strstr.str();
+}
+
+class LoadImagePerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<LoadImagePerfParams>
+{
+  public:
+    LoadImagePerfTest();
+    ~LoadImagePerfTest() override;
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+LoadImagePerfTest::LoadImagePerfTest()
+    : ANGLEPerfTest("LoadImagePerf", "", LoadImageStory(GetParam()), kIterationsPerStep)
+{
+    const LoadImagePerfParams &params = GetParam();
+
+    mInput.resize(kImageSize * kImageSize * params.inputPixelBytes);
+    mOutput.resize(kImageSize * kImageSize * params.outputPixelBytes);
+
+    std::mt19937 generator(0);
+    for (uint8_t &byte : mInput)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+
+    angle::priv::SetMaxLoadRowSIMDLevelForTesting(params.simd
+                                                      ? angle::priv::LoadRowSIMDLevel::Vector256
+                                                      : angle::priv::LoadRowSIMDLevel::None);
+}
+
+LoadImagePerfTest::~LoadImagePerfTest()
+{
+    angle::priv::SetMaxLoadRowSIMDLevelForTesting(angle::priv::LoadRowSIMDLevel::Vector256);
+}
+
+void LoadImagePerfTest::step()
+{
+    const LoadImagePerfParams &params = GetParam();
+    const angle::ImageLoadContext context;
+
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        params.loadFunction(context, kImageSize, kImageSize, 1, mInput.data(),
+                            kImageSize * params.inputPixelBytes,
+                            kImageSize * kImageSize * params.inputPixelBytes, mOutput.data(),
+                            kImageSize * params.outputPixelBytes,
+                            kImageSize * kImageSize * params.outputPixelBytes);
+    }
+}
+
+TEST_P(LoadImagePerfTest, Run)
+{
+    run();
+}
+
+std::vector<LoadImagePerfParams> LoadImagePerfParamsList()
+{
+    const LoadImagePerfParams kFormats[] = {
+        {"RGB8ToBGRX8", angle::LoadRGB8ToBGRX8, 3, 4, true},
+        {"RGBA8ToBGRA8", angle::LoadRGBA8ToBGRA8, 4, 4, true},
+        {"LA8ToRGBA8", angle::LoadLA8ToRGBA8, 2, 4, true},
+        {"RGBA4ToRGBA8", angle::LoadRGBA4ToRGBA8, 2, 4, true},
+        {"RGB5A1ToRGBA8", angle::LoadRGB5A1ToRGBA8, 2, 4, true},
+        {"RGB16FToRG11B10F", angle::LoadRGB16FToRG11B10F, 6, 4, true},
+        {"D24S8ToS8D24", angle::LoadD24S8ToS8D24, 4, 4, true},
+        {"D24S8ToD32F", angle::LoadD24S8ToD32F, 4, 4, true},
+        {"D24S8ToD32FS8X24", angle::LoadD24S8ToD32FS8X24, 4, 8, true},
+        {"X24S8ToS8", angle::LoadX24S8ToS8, 4, 1, true},
+    };
+
+    std::vector<LoadImagePerfParams> paramsList;
+    for (LoadImagePerfParams params : kFormats)
+    {
+        paramsList.push_back(params);
+        params.simd = false;
+        paramsList.push_back(params);
+    }
+    return paramsList;
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         LoadImagePerfTest,
+                         ::testing::ValuesIn(LoadImagePerfParamsList()),
+                         [](const ::testing::TestParamInfo<LoadImagePerfParams> &info) {
+                             return LoadImageStory(info.param).substr(1);
+                         });
+}  // anonymous namespace
@@ -0,0 +1,177 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PreprocessorPerf:
+//   Performance test for the shader preprocessor on generated macro-heavy shaders, like the
+//   uber-shaders that engines build out of nested function-like macros.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "compiler/preprocessor/DiagnosticsBase.h"
+#include "compiler/preprocessor/DirectiveHandlerBase.h"
+#include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
+
+namespace
+{
+constexpr unsigned int kNumIterationsPerStep = 10;
+constexpr int kNumStatements                 = 256;
+
+enum class MacroKind
+{
+    // Object-like macros naming constants.
+    Object,
+    // Function-like macros whose arguments are other function-like macro invocations.
+    NestedFunction,
+};
+
+std::string GenerateShader(MacroKind kind)
+{
+    std::stringstream shader;
+    shader << "#version 300 es\n"
+              "precision highp float;\n"
+              "uniform vec4 u[64];\n"
+              "out vec4 color;\n";
+
+    if (kind == MacroKind::Object)
+    {
+        for (int i = 0; i < 64; ++i)
+        {
+            shader << "#define LIGHT_" << i << "_INTENSITY u[" << i << "].w\n";
+            shader << "#define LIGHT_" << i << "_DIRECTION u[" << i << "].xyz\n";
+        }
+    }
+    else
+    {
+        shader << "#define ADD(a, b) ((a) + (b))\n"
+                  "#define MUL(a, b) ((a) * (b))\n"
+                  "#define MAD(a, b, c) ADD(MUL(a, b), c)\n"
+                  "#define LERP(a, b, t) MAD(ADD(b, -(a)), t, a)\n"
+                  "#define SATURATE(x) clamp(x, 0.0, 1.0)\n"
+                  "#define LIGHT(n) SATURATE(LERP(u[n].x, u[n].y, MUL(u[n].z, u[n].w)))\n";
+    }
+
+    shader << "void main()\n"
+              "{\n"
+              "    float c = 0.0;\n";
+    for (int i = 0; i < kNumStatements; ++i)
+    {
+        const int light = i % 64;
+        if (kind == MacroKind::Object)
+        {
+            shader << "    c += LIGHT_" << light << "_INTENSITY * LIGHT_" << light
+                   << "_DIRECTION.x;\n";
+        }
+        else
+        {
+            shader << "    c += LIGHT(" << light << ");\n";
+        }
+    }
+    shader << "    color = vec4(c);\n"
+              "}\n";
+    return shader.str();
+}
+
+class NullDiagnostics : public angle::pp::Diagnostics
+{
+  protected:
+    void print(ID id, const angle::pp::SourceLocation &loc, const std::string &text) override {}
+};
+
+class NullDirectiveHandler : public angle::pp::DirectiveHandler
+{
+  public:
+    void handleError(const angle::pp::SourceLocation &loc, const std::string &msg) override {}
+    void handlePragma(const angle::pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {}
+    void handleExtension(const angle::pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {}
+    void handleVersion(const angle::pp::SourceLocation &loc,
+                       int version,
+                       ShShaderSpec spec,
+                       angle::pp::MacroSet *macroSet) override
+    {}
+};
+
+struct PreprocessorPerfParams final
+{
+    MacroKind kind;
+};
+
+std::string PreprocessorStory(const PreprocessorPerfParams &params)
+{
+    return params.kind == MacroKind::Object ? "_object_macros" : "_nested_function_macros";
+}
+
+class PreprocessorPerfTest : public ANGLEPerfTest,
+                             public ::testing::WithParamInterface<PreprocessorPerfParams>
+{
+  public:
+    PreprocessorPerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    std::string mShader;
+};
+
+PreprocessorPerfTest::PreprocessorPerfTest()
+    : ANGLEPerfTest("PreprocessorPerf", "", PreprocessorStory(GetParam()), kNumIterationsPerStep)
+{}
+
+void PreprocessorPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    mShader = GenerateShader(GetParam().kind);
+}
+
+void PreprocessorPerfTest::step()
+{
+    const char *shaderStrings[] = {mShader.c_str()};
+
+    for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
+    {
+        NullDiagnostics diagnostics;
+        NullDirectiveHandler directiveHandler;
+        angle::pp::Preprocessor preprocessor(&diagnostics, &directiveHandler,
+                                             angle::pp::PreprocessorSettings(SH_GLES3_SPEC));
+        if (!preprocessor.init(1, shaderStrings, nullptr))
+        {
+            abortTest();
+            return;
+        }
+
+        angle::pp::Token token;
+        do
+        {
+            preprocessor.lex(&token);
+        } while (token.type != angle::pp::Token::LAST);
+    }
+}
+
+TEST_P(PreprocessorPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         PreprocessorPerfTest,
+                         ::testing::Values(PreprocessorPerfParams{MacroKind::Object},
+                                           PreprocessorPerfParams{MacroKind::NestedFunction}),
+                         [](const ::testing::TestParamInfo<PreprocessorPerfParams> &info) {
+                             return PreprocessorStory(info.param).substr(1);
+                         });
+
+}  // anonymous namespace
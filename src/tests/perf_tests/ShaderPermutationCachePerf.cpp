@@ -0,0 +1,201 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ShaderPermutationCachePerf:
+//   Performance test compiling the permutations of an uber shader, which are selected with
+//   #define preambles like engines do.  Every step compiles all the permutations with sources
+//   that are new to the shader cache.  Only some of the macros are used by the shader, so with
+//   cacheShadersByPreprocessedSource most permutations preprocess to tokens that are already
+//   cached.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+
+#include "libANGLE/Display.h"
+#include "libANGLE/MemoryShaderCache.h"
+#include "util/EGLWindow.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+// The features the shader uses, followed by features of other shader stages.  Each permutation
+// defines a different subset of them.
+constexpr const char *kFeatures[] = {
+    "USE_NORMAL_MAP", "USE_FOG",           "USE_SHADOWS",
+    "USE_SKINNING",   "USE_MORPH_TARGETS", "USE_INSTANCING",
+};
+constexpr uint32_t kPermutationCount = 1u << ArraySize(kFeatures);
+
+constexpr char kUberFS[] = R"(
+precision highp float;
+uniform sampler2D albedo;
+uniform sampler2D normalMap;
+uniform highp sampler2DShadow shadowMap;
+uniform vec4 lights[LIGHT_COUNT];
+uniform vec4 fogColor;
+in vec3 vNormal;
+in vec2 vUV;
+in vec4 vShadowCoord;
+in float vDepth;
+out vec4 color;
+
+vec3 getNormal()
+{
+#ifdef USE_NORMAL_MAP
+    return normalize(vNormal + texture(normalMap, vUV).xyz * 2.0 - 1.0);
+#else
+    return normalize(vNormal);
+#endif
+}
+
+void main()
+{
+    vec3 n = getNormal();
+    vec4 c = texture(albedo, vUV);
+    vec3 lit = vec3(0);
+    for (int i = 0; i < LIGHT_COUNT; ++i)
+    {
+        lit += lights[i].w * max(dot(n, lights[i].xyz), 0.0) * c.rgb;
+    }
+#ifdef USE_SHADOWS
+    lit *= texture(shadowMap, vShadowCoord.xyz / vShadowCoord.w);
+#endif
+#ifdef USE_FOG
+    lit = mix(lit, fogColor.rgb, clamp(vDepth * fogColor.a, 0.0, 1.0));
+#endif
+    color = vec4(lit, c.a);
+})";
+
+struct ShaderPermutationCacheParams final : public RenderTestParams
+{
+    ShaderPermutationCacheParams(bool cacheByPreprocessedSourceIn)
+    {
+        iterationsPerStep = 1;
+
+        majorVersion = 3;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+
+        cacheByPreprocessedSource = cacheByPreprocessedSourceIn;
+        if (cacheByPreprocessedSource)
+        {
+            enable(Feature::CacheShadersByPreprocessedSource);
+        }
+    }
+
+    std::string story() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::story();
+        strstr << (cacheByPreprocessedSource ? "_preprocessed_source_cache" : "_source_cache");
+        return strstr.str();
+    }
+
+    bool cacheByPreprocessedSource;
+};
+
+std::ostream &operator<<(std::ostream &os, const ShaderPermutationCacheParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class ShaderPermutationCacheBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<ShaderPermutationCacheParams>
+{
+  public:
+    ShaderPermutationCacheBenchmark();
+
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    gl::MemoryShaderCache *getMemoryShaderCache();
+
+    uint32_t mStep = 0;
+};
+
+ShaderPermutationCacheBenchmark::ShaderPermutationCacheBenchmark()
+    : ANGLERenderTest("ShaderPermutationCache", GetParam())
+{}
+
+gl::MemoryShaderCache *ShaderPermutationCacheBenchmark::getMemoryShaderCache()
+{
+    EGLWindow *window = static_cast<EGLWindow *>(getGLWindow());
+    return static_cast<egl::Display *>(window->getDisplay())->getMemoryShaderCache();
+}
+
+void ShaderPermutationCacheBenchmark::drawBenchmark()
+{
+    for (uint32_t permutation = 0; permutation < kPermutationCount; ++permutation)
+    {
+        // The comment makes the source unique, like the differences in the preambles of engines
+        // that don't affect the shader.
+        std::stringstream source;
+        source << "#version 300 es\n// step " << mStep << "\n#define LIGHT_COUNT 4\n";
+        for (size_t feature = 0; feature < ArraySize(kFeatures); ++feature)
+        {
+            if ((permutation >> feature & 1) != 0)
+            {
+                source << "#define " << kFeatures[feature] << "\n";
+            }
+        }
+        source << kUberFS;
+
+        GLuint fs = CompileShader(GL_FRAGMENT_SHADER, source.str().c_str());
+        ASSERT_NE(0u, fs);
+        glDeleteShader(fs);
+    }
+    ++mStep;
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void ShaderPermutationCacheBenchmark::destroyBenchmark()
+{
+    if (GetParam().cacheByPreprocessedSource)
+    {
+        const gl::ShaderCacheStatistics statistics =
+            getMemoryShaderCache()->getStatistics(gl::ShaderCacheKeyType::PreprocessedSource);
+        if (statistics.lookups > 0)
+        {
+            recordDoubleMetric(".preprocessed_source_hit_rate",
+                               100.0 * statistics.hits / statistics.lookups, "%");
+        }
+    }
+}
+
+ShaderPermutationCacheParams VulkanParams(bool cacheByPreprocessedSource)
+{
+    ShaderPermutationCacheParams params(cacheByPreprocessedSource);
+    params.eglParameters = egl_platform::VULKAN();
+    return params;
+}
+
+ShaderPermutationCacheParams OpenGLOrGLESParams(bool cacheByPreprocessedSource)
+{
+    ShaderPermutationCacheParams params(cacheByPreprocessedSource);
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    return params;
+}
+
+TEST_P(ShaderPermutationCacheBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(ShaderPermutationCacheBenchmark,
+                       VulkanParams(false),
+                       VulkanParams(true),
+                       OpenGLOrGLESParams(false),
+                       OpenGLOrGLESParams(true));
+
+}  // anonymous namespace
@@ -0,0 +1,188 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SharedCompilerInstancesPerf:
+//   Performance test for the compiler instances shared between contexts.  Every step creates the
+//   Compiler of a new context and compiles one shader on each of a number of threads, like
+//   parallel shader compilation does, then destroys the Compiler.  The instances are either
+//   constructed for each context or taken from the ones left over by the previous context.  Only
+//   the translator runs, no GPU is needed.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+#include "libANGLE/Compiler.h"
+
+namespace
+{
+constexpr ShShaderSpec kSpec         = SH_GLES3_SPEC;
+constexpr ShShaderOutput kOutputType = SH_ESSL_OUTPUT;
+
+constexpr char kFragmentShader[] = R"(#version 300 es
+precision highp float;
+uniform sampler2D albedo;
+uniform vec4 lights[4];
+in vec3 vNormal;
+in vec2 vUV;
+out vec4 color;
+void main()
+{
+    vec3 n = normalize(vNormal);
+    vec4 c = texture(albedo, vUV);
+    vec3 lit = vec3(0);
+    for (int i = 0; i < 4; ++i)
+    {
+        lit += lights[i].w * max(dot(n, lights[i].xyz), 0.0) * c.rgb;
+    }
+    color = vec4(lit, c.a);
+})";
+
+struct SharedCompilerInstancesPerfParams
+{
+    size_t threadCount;
+    bool shareInstances;
+};
+
+std::string SharedCompilerInstancesStory(const SharedCompilerInstancesPerfParams &params)
+{
+    std::stringstream strstr;
+    strstr << "_" << params.threadCount << "_threads"
+           << (params.shareInstances ? "_shared" : "_constructed");
+    return strstr.str();
+}
+
+class SharedCompilerInstancesPerfTest
+    : public ANGLEPerfTest,
+      public ::testing::WithParamInterface<SharedCompilerInstancesPerfParams>
+{
+  public:
+    SharedCompilerInstancesPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    gl::ShCompilerInstance getInstance();
+
+    gl::SharedCompilerInstances mSharedInstances;
+    ShBuiltInResources mResources;
+};
+
+SharedCompilerInstancesPerfTest::SharedCompilerInstancesPerfTest()
+    : ANGLEPerfTest("SharedCompilerInstancesPerf", "", SharedCompilerInstancesStory(GetParam()), 1)
+{}
+
+void SharedCompilerInstancesPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    sh::InitBuiltInResources(&mResources);
+    mResources.FragmentPrecisionHigh = 1;
+
+    // Stands for a context that stays alive, so the Compilers of the steps are not the last ones.
+    mSharedInstances.onCompilerCreated();
+}
+
+void SharedCompilerInstancesPerfTest::TearDown()
+{
+    gl::ShaderMap<std::vector<gl::ShCompilerInstance>> noInstances;
+    mSharedInstances.onCompilerDestroyed(kSpec, kOutputType, mResources, &noInstances);
+
+    ANGLEPerfTest::TearDown();
+}
+
+gl::ShCompilerInstance SharedCompilerInstancesPerfTest::getInstance()
+{
+    if (GetParam().shareInstances)
+    {
+        gl::ShCompilerInstance instance = mSharedInstances.getInstance(
+            gl::ShaderType::Fragment, kSpec, kOutputType, mResources);
+        if (instance.getHandle() != nullptr)
+        {
+            return instance;
+        }
+    }
+
+    return gl::ShCompilerInstance(
+        sh::ConstructCompiler(GL_FRAGMENT_SHADER, kSpec, kOutputType, &mResources), kOutputType,
+        gl::ShaderType::Fragment);
+}
+
+void SharedCompilerInstancesPerfTest::step()
+{
+    const SharedCompilerInstancesPerfParams &params = GetParam();
+
+    mSharedInstances.onCompilerCreated();
+
+    std::vector<gl::ShCompilerInstance> instances(params.threadCount);
+    std::vector<std::thread> threads;
+    std::atomic<bool> compileFailed(false);
+    for (size_t index = 0; index < params.threadCount; ++index)
+    {
+        threads.emplace_back([this, &instances, &compileFailed, index]() {
+            gl::ShCompilerInstance instance = getInstance();
+
+            const char *shaderStrings[]     = {kFragmentShader};
+            ShCompileOptions compileOptions = {};
+            compileOptions.objectCode       = true;
+            if (!sh::Compile(instance.getHandle(), shaderStrings, 1, compileOptions))
+            {
+                compileFailed = true;
+            }
+
+            instances[index] = std::move(instance);
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    if (compileFailed)
+    {
+        abortTest();
+    }
+
+    gl::ShaderMap<std::vector<gl::ShCompilerInstance>> compilerInstances;
+    if (params.shareInstances)
+    {
+        compilerInstances[gl::ShaderType::Fragment] = std::move(instances);
+    }
+    else
+    {
+        for (gl::ShCompilerInstance &instance : instances)
+        {
+            instance.destroy();
+        }
+    }
+    mSharedInstances.onCompilerDestroyed(kSpec, kOutputType, mResources, &compilerInstances);
+}
+
+TEST_P(SharedCompilerInstancesPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ,
+    SharedCompilerInstancesPerfTest,
+    ::testing::Values(SharedCompilerInstancesPerfParams{1, false},
+                      SharedCompilerInstancesPerfParams{1, true},
+                      SharedCompilerInstancesPerfParams{2, false},
+                      SharedCompilerInstancesPerfParams{2, true},
+                      SharedCompilerInstancesPerfParams{4, false},
+                      SharedCompilerInstancesPerfParams{4, true},
+                      SharedCompilerInstancesPerfParams{8, false},
+                      SharedCompilerInstancesPerfParams{8, true},
+                      SharedCompilerInstancesPerfParams{16, false},
+                      SharedCompilerInstancesPerfParams{16, true}),
+    [](const ::testing::TestParamInfo<SharedCompilerInstancesPerfParams> &info) {
+        return SharedCompilerInstancesStory(info.param).substr(1);
+    });
+}  // anonymous namespace
@@ -32,6 +32,7 @@ struct TextureUploadParams final : public RenderTestParams
 
         baseSize     = 1024;
         subImageSize = 64;
+        layers       = 0;
 
         webgl = false;
     }
@@ -40,6 +41,8 @@ struct TextureUploadParams final : public RenderTestParams
 
     GLsizei baseSize;
     GLsizei subImageSize;
+    // Only used by array texture benchmarks.
+    GLsizei layers;
 
     bool webgl;
 };
@@ -61,6 +64,16 @@ std::string TextureUploadParams::story() const
         strstr << "_webgl";
     }
 
+    if (layers > 0)
+    {
+        strstr << "_" << baseSize << "x" << baseSize << "x" << layers;
+    }
+
+    if (isEnableRequested(Feature::SingleThreadedTextureDecompression))
+    {
+        strstr << "_single_threaded";
+    }
+
     return strstr.str();
 }
 
@@ -234,6 +247,45 @@ class TextureUploadETC2TranscodingBenchmark : public TextureUploadBenchmarkBase
     std::vector<GLuint> mTextures;
 };
 
+// Uploads large RGB data into an RGBA8 array texture, which requires a CPU conversion of every
+// texel.  Run with and without SingleThreadedTextureDecompression to see how the conversion scales
+// across worker threads.
+class TextureUploadConversionBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadConversionBenchmark() : TextureUploadBenchmarkBase("TextureUploadConversion") {}
+
+    void initializeBenchmark() override
+    {
+        TextureUploadBenchmarkBase::initializeBenchmark();
+
+        const auto &params = GetParam();
+
+        glGenTextures(1, &mArrayTexture);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, mArrayTexture);
+        glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, params.baseSize, params.baseSize,
+                       params.layers);
+
+        mRGBData.resize(static_cast<size_t>(params.baseSize) * params.baseSize * params.layers * 3,
+                        0x80);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void destroyBenchmark() override
+    {
+        TextureUploadBenchmarkBase::destroyBenchmark();
+        glDeleteTextures(1, &mArrayTexture);
+    }
+
+    void drawBenchmark() override;
+
+  private:
+    GLuint mArrayTexture = 0;
+    std::vector<uint8_t> mRGBData;
+};
+
 void TextureUploadETC2TranscodingBenchmark::initShaders()
 {
     constexpr char kVS[] = R"(#version 300 es
@@ -443,6 +495,25 @@ void PBOCompressedSubImageBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadConversionBenchmark::drawBenchmark()
+{
+    const auto &params = GetParam();
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, 0, params.baseSize, params.baseSize,
+                        params.layers, GL_RGB, GL_UNSIGNED_BYTE, mRGBData.data());
+
+        // Perform a draw just so the texture data is flushed.  With the position attributes not
+        // set, a constant default value is used, resulting in a very cheap draw.
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 TextureUploadParams D3D11Params(bool webglCompat)
 {
     TextureUploadParams params;
@@ -523,6 +594,24 @@ TextureUploadParams ES3OpenGLPBOParams(GLsizei baseSize, GLsizei subImageSize)
     return params;
 }
 
+TextureUploadParams VulkanConversionParams(GLsizei baseSize,
+                                           GLsizei layers,
+                                           bool singleThreadedTextureDecompression)
+{
+    TextureUploadParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    params.majorVersion  = 3;
+    params.minorVersion  = 0;
+    params.trackGpuTime  = false;
+    params.baseSize      = baseSize;
+    params.layers        = layers;
+    if (singleThreadedTextureDecompression)
+    {
+        params.enable(Feature::SingleThreadedTextureDecompression);
+    }
+    return params;
+}
+
 }  // anonymous namespace
 
 // Test etc to bc transcoding performance.
@@ -541,6 +630,11 @@ TEST_P(TextureUploadFullMipBenchmark, Run)
     run();
 }
 
+TEST_P(TextureUploadConversionBenchmark, Run)
+{
+    run();
+}
+
 TEST_P(PBOSubImageBenchmark, Run)
 {
     run();
@@ -576,6 +670,12 @@ ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        VulkanParams(false),
                        VulkanParams(true));
 
+ANGLE_INSTANTIATE_TEST(TextureUploadConversionBenchmark,
+                       VulkanConversionParams(4096, 1, true),
+                       VulkanConversionParams(4096, 1, false),
+                       VulkanConversionParams(1024, 16, true),
+                       VulkanConversionParams(1024, 16, false));
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(PBOSubImageBenchmark);
 ANGLE_INSTANTIATE_TEST(PBOSubImageBenchmark,
                        ES3OpenGLPBOParams(1024, 128),
@@ -48,7 +48,9 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::AlwaysUseSharedStorageModeForBuffers, "alwaysUseSharedStorageModeForBuffers"},
     {Feature::AlwaysUseStagedBufferUpdates, "alwaysUseStagedBufferUpdates"},
     {Feature::AppendAliasedMemoryDecorations, "appendAliasedMemoryDecorations"},
+    {Feature::AsyncBlobCacheCompression, "asyncBlobCacheCompression"},
     {Feature::AsyncCommandBufferReset, "asyncCommandBufferReset"},
+    {Feature::AsyncCommandStream, "asyncCommandStream"},
     {Feature::AsyncGarbageCleanup, "asyncGarbageCleanup"},
     {Feature::Avoid1BitAlphaTextureFormats, "avoid1BitAlphaTextureFormats"},
     {Feature::AvoidBindFragDataLocation, "avoidBindFragDataLocation"},
@@ -63,6 +65,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::BottomLeftOriginPresentRegionRectangles, "bottomLeftOriginPresentRegionRectangles"},
     {Feature::BresenhamLineRasterization, "bresenhamLineRasterization"},
     {Feature::CacheCompiledShader, "cacheCompiledShader"},
+    {Feature::CacheShadersByPreprocessedSource, "cacheShadersByPreprocessedSource"},
     {Feature::CallClearTwice, "callClearTwice"},
     {Feature::ClampArrayAccess, "clampArrayAccess"},
     {Feature::ClampFragDepth, "clampFragDepth"},
@@ -165,6 +168,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ExplicitlyEnablePerSampleShading, "explicitlyEnablePerSampleShading"},
     {Feature::ExposeES32ForTesting, "exposeES32ForTesting"},
     {Feature::ExposeNonConformantExtensionsAndVersions, "exposeNonConformantExtensionsAndVersions"},
+    {Feature::FastBlobCacheCompression, "fastBlobCacheCompression"},
     {Feature::FinishDoesNotCauseQueriesToBeAvailable, "finishDoesNotCauseQueriesToBeAvailable"},
     {Feature::FlushAfterEndingTransformFeedback, "flushAfterEndingTransformFeedback"},
     {Feature::FlushAfterStreamVertexData, "flushAfterStreamVertexData"},
@@ -210,6 +214,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::HasShaderStencilOutput, "hasShaderStencilOutput"},
     {Feature::HasStencilAutoResolve, "hasStencilAutoResolve"},
     {Feature::HasTextureSwizzle, "hasTextureSwizzle"},
+    {Feature::IncrementalPipelineCacheSync, "incrementalPipelineCacheSync"},
     {Feature::InitFragmentOutputVariables, "initFragmentOutputVariables"},
     {Feature::InitializeCurrentVertexAttributes, "initializeCurrentVertexAttributes"},
     {Feature::InjectAsmStatementIntoLoopBodies, "injectAsmStatementIntoLoopBodies"},
@@ -231,6 +236,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::MrtPerfWorkaround, "mrtPerfWorkaround"},
     {Feature::MultisampleColorFormatShaderReadWorkaround, "multisampleColorFormatShaderReadWorkaround"},
     {Feature::MutableMipmapTextureUpload, "mutableMipmapTextureUpload"},
+    {Feature::OptimizeTranslatedSpirv, "optimizeTranslatedSpirv"},
     {Feature::OverrideSurfaceFormatRGB8ToRGBA8, "overrideSurfaceFormatRGB8ToRGBA8"},
     {Feature::PackLastRowSeparatelyForPaddingInclusion, "packLastRowSeparatelyForPaddingInclusion"},
     {Feature::PackOverlappingRowsSeparatelyPackBuffer, "packOverlappingRowsSeparatelyPackBuffer"},
@@ -462,6 +468,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::VertexIDDoesNotIncludeBaseVertex, "vertexIDDoesNotIncludeBaseVertex"},
     {Feature::WaitIdleBeforeSwapchainRecreation, "waitIdleBeforeSwapchainRecreation"},
     {Feature::WarmUpPipelineCacheAtLink, "warmUpPipelineCacheAtLink"},
+    {Feature::WarmUpRecordedPipelinesAtLink, "warmUpRecordedPipelinesAtLink"},
     {Feature::WrapSwitchInIfTrue, "wrapSwitchInIfTrue"},
     {Feature::WriteHelperSampleMask, "writeHelperSampleMask"},
     {Feature::ZeroMaxLodWorkaround, "zeroMaxLodWorkaround"},
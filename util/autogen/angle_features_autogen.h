@@ -48,7 +48,9 @@ enum class Feature
     AlwaysUseSharedStorageModeForBuffers,
     AlwaysUseStagedBufferUpdates,
     AppendAliasedMemoryDecorations,
+    AsyncBlobCacheCompression,
     AsyncCommandBufferReset,
+    AsyncCommandStream,
     AsyncGarbageCleanup,
     Avoid1BitAlphaTextureFormats,
     AvoidBindFragDataLocation,
@@ -63,6 +65,7 @@ enum class Feature
     BottomLeftOriginPresentRegionRectangles,
     BresenhamLineRasterization,
     CacheCompiledShader,
+    CacheShadersByPreprocessedSource,
     CallClearTwice,
     ClampArrayAccess,
     ClampFragDepth,
@@ -165,6 +168,7 @@ enum class Feature
     ExplicitlyEnablePerSampleShading,
     ExposeES32ForTesting,
     ExposeNonConformantExtensionsAndVersions,
+    FastBlobCacheCompression,
     FinishDoesNotCauseQueriesToBeAvailable,
     FlushAfterEndingTransformFeedback,
     FlushAfterStreamVertexData,
@@ -210,6 +214,7 @@ enum class Feature
     HasShaderStencilOutput,
     HasStencilAutoResolve,
     HasTextureSwizzle,
+    IncrementalPipelineCacheSync,
     InitFragmentOutputVariables,
     InitializeCurrentVertexAttributes,
     InjectAsmStatementIntoLoopBodies,
@@ -231,6 +236,7 @@ enum class Feature
     MrtPerfWorkaround,
     MultisampleColorFormatShaderReadWorkaround,
     MutableMipmapTextureUpload,
+    OptimizeTranslatedSpirv,
     OverrideSurfaceFormatRGB8ToRGBA8,
     PackLastRowSeparatelyForPaddingInclusion,
     PackOverlappingRowsSeparatelyPackBuffer,
@@ -462,6 +468,7 @@ enum class Feature
     VertexIDDoesNotIncludeBaseVertex,
     WaitIdleBeforeSwapchainRecreation,
     WarmUpPipelineCacheAtLink,
+    WarmUpRecordedPipelinesAtLink,
     WrapSwitchInIfTrue,
     WriteHelperSampleMask,
     ZeroMaxLodWorkaround,